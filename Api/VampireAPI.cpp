@@ -18,36 +18,52 @@
 #include "Lib/List.hpp"
 #include "Lib/Stack.hpp"
 #include "Lib/DHSet.hpp"
+#include "Lib/DHMap.hpp"
 
 #include <sstream>
 #include <algorithm>
+#include <chrono>
+#include <mutex>
 
 #include "Kernel/Term.hpp"
 #include "Kernel/Clause.hpp"
 #include "Kernel/Formula.hpp"
+#include "Kernel/HOL/HOL.hpp"
 #include "Kernel/FormulaUnit.hpp"
 #include "Kernel/Problem.hpp"
 #include "Kernel/Signature.hpp"
 #include "Kernel/Inference.hpp"
+#include "Kernel/InferenceLog.hpp"
 #include "Kernel/InferenceStore.hpp"
 #include "Kernel/OperatorType.hpp"
 #include "Kernel/Unit.hpp"
 
 #include "Indexing/TermSharing.hpp"
 
+#include "Shell/AnswerLiteralManager.hpp"
 #include "Shell/Options.hpp"
 #include "Shell/Statistics.hpp"
 #include "Shell/Preprocess.hpp"
+#include "Shell/Property.hpp"
+
+#include "Parse/TPTP.hpp"
+#include "Parse/SMTLIB2.hpp"
+
+#include "CASC/PortfolioMode.hpp"
 
 #include "Saturation/ProvingHelper.hpp"
+#include "Saturation/SaturationAlgorithm.hpp"
+#include "Saturation/ClauseContainer.hpp"
 
 #include "Lib/Timer.hpp"
+#include "Lib/Allocator.hpp"
 
 #include "Kernel/MainLoop.hpp"
 #include "Kernel/Ordering.hpp"
 #include "Kernel/PartialOrdering.hpp"
 #include "Kernel/TermPartialOrdering.hpp"
 #include "Kernel/TermOrderingDiagram.hpp"
+#include "Kernel/UnificationWithAbstraction.hpp"
 
 #include "Shell/EqualityProxyMono.hpp"
 
@@ -59,17 +75,52 @@ using namespace Shell;
 using namespace Indexing;
 using namespace Saturation;
 
-void prepareForNextProof() {
-    // Initialize the timer thread on first call (needed for timeout support)
+/**
+ * Reset the global ordering and the static caches that point into the
+ * current signature and term sharing or store results keyed to the
+ * current ordering object.  Without this, the next proof can hit stale
+ * cached comparisons from the previous ordering, causing the
+ * superposition algorithm to miss inferences and return SATISFIABLE for
+ * a problem that is actually unsatisfiable.
+ */
+static void resetKernelCaches() {
+    Ordering::unsetGlobalOrdering();
+    PrecedenceOrdering::resetStaticCaches();
+
+    Term::resetStaticCaches();
+    AtomicSort::resetStaticCaches();
+    PartialOrdering::resetStaticCaches();
+    TermPartialOrdering::resetStaticCaches();
+    TermOrderingDiagram::resetStaticCaches();
+    AbstractionOracle::resetStaticCaches();
+    HOL::reduce::resetCaches();
+
+    // Reset shell static caches
+    EqualityProxyMono::resetStaticCaches();
+}
+
+/**
+ * Start the timer thread (needed for timeout support) on first call.
+ * Lib::Timer::reinitialise() spawns a new thread every time, so it must
+ * not be called once per proof.
+ */
+static void ensureTimerInitialized() {
     static bool timer_initialized = false;
     if (!timer_initialized) {
         Lib::Timer::reinitialise();
         timer_initialized = true;
     }
+}
+
+void prepareForNextProof() {
+    ensureTimerInitialized();
 
     // Reset elapsed time so the timer thread measures from now
     Lib::Timer::resetStartTime();
 
+    // Per-subsystem memory peaks are reported per proof
+    Lib::resetMemoryPeaks();
+
     // Clear any termination reason from a previous proof so the timer thread
     // and saturation loop don't immediately trigger
     env.statistics->terminationReason = Shell::TerminationReason::UNKNOWN;
@@ -93,33 +144,18 @@ void prepareForNextProof() {
     // reference count drops to zero during preprocessing.
     Unit::resetPreprocessingEnd();
 
-    // Reset the global ordering so the next proof can set its own
-    Ordering::unsetGlobalOrdering();
-
-    // Reset static ordering caches that store results keyed to the previous
-    // ordering object.  Without this, P2 can hit stale cached comparisons
-    // from P1's ordering, causing the superposition algorithm to miss
-    // inferences and return SATISFIABLE for a problem that is actually
-    // unsatisfiable.
-    Term::resetStaticCaches();
-    AtomicSort::resetStaticCaches();
-    PartialOrdering::resetStaticCaches();
-    TermPartialOrdering::resetStaticCaches();
-    TermOrderingDiagram::resetStaticCaches();
-    EqualityProxyMono::resetStaticCaches();
+    // Reset the global ordering so the next proof can set its own, and
+    // the static caches that store results keyed to the previous one
+    resetKernelCaches();
 
     // Reset symbol usage counts.  The default symbol precedence (FREQUENCY)
     // sorts symbols by usage count.  After a proof, usage counts reflect
     // how often each symbol was used in that proof.  If not reset, the next
     // proof builds a KBO ordering with a different precedence, which can
     // block key inferences and cause the saturation to report SATISFIABLE
-    // for a problem that is actually unsatisfiable.
-    for (unsigned i = 0; i < env.signature->functions(); i++) {
-        env.signature->getFunction(i)->resetUsageCnt();
-    }
-    for (unsigned i = 0; i < env.signature->predicates(); i++) {
-        env.signature->getPredicate(i)->resetUsageCnt();
-    }
+    // for a problem that is actually unsatisfiable.  The counts carry an
+    // epoch, so this does not need to walk the signature.
+    Signature::Symbol::resetAllUsageCnts();
 
     // Invalidate all KBO weight caches stored on shared terms.  The KBO
     // ordering object is recreated for each proof, so weights cached during
@@ -133,6 +169,7 @@ void prepareForNextProof() {
     // is only valid for the ordering that was active when it was set.  Without
     // this reset, P2's ordering silently reuses P1's orientations, which can
     // direct superposition inferences the wrong way and prevent finding a proof.
+    // Like the KBO weights, this is an epoch bump.
     env.sharing->resetEqualityArgumentOrders();
 
     // Reset EXIT_LOCK to allow proofs on different threads.
@@ -142,21 +179,13 @@ void prepareForNextProof() {
 }
 
 void reset() {
-    // Reinitialize the timer (needed for timeout support after reset)
-    Lib::Timer::reinitialise();
-
-    // Reset the global ordering
-    Ordering::unsetGlobalOrdering();
-
-    // Reset all static caches in the kernel
-    Term::resetStaticCaches();
-    AtomicSort::resetStaticCaches();
-    PartialOrdering::resetStaticCaches();
-    TermPartialOrdering::resetStaticCaches();
-    TermOrderingDiagram::resetStaticCaches();
+    // Restart time measurement (the timer thread itself is kept)
+    ensureTimerInitialized();
+    Lib::Timer::resetStartTime();
+    Lib::Timer::resetLimitEnforcement();
 
-    // Reset shell static caches
-    EqualityProxyMono::resetStaticCaches();
+    // Reset the global ordering and all static caches in the kernel
+    resetKernelCaches();
 
     // Reset the inference store
     InferenceStore::instance()->reset();
@@ -167,6 +196,8 @@ void reset() {
     delete env.signature;
     delete env.statistics;
 
+    releaseMemory();
+
     env.signature = new Signature();
     env.signature->addEquality();  // Must add equality predicate (normally done in Environment constructor)
     env.sharing = new TermSharing();
@@ -177,6 +208,74 @@ void reset() {
     // by the user. The user is responsible for managing problem lifetime.
 }
 
+size_t releaseMemory() {
+    return Clause::releaseUnusedMemory() + Lib::releaseUnusedMemory();
+}
+
+/** problem of the last portfolio slice (its units may be referenced by the refutation) */
+static std::unique_ptr<Problem> portfolioProblem;
+
+/**
+ * The sessions not destroyed yet, whose units collectGarbage() keeps.
+ * Never freed, so that sessions with static storage can still be
+ * destroyed at exit.
+ */
+static DHSet<ProvingSession*>& liveSessions() {
+    static DHSet<ProvingSession*>* sessions = new DHSet<ProvingSession*>();
+    return *sessions;
+}
+static std::mutex liveSessionsMutex;
+
+size_t collectGarbage(const std::vector<Problem*>& keep, const std::vector<Unit*>& keepUnits) {
+    // lambda terms and named formulas are also referenced from the
+    // signature, which the marking does not know about
+    if (env.higherOrder()) {
+        return 0;
+    }
+    for (Problem* prb : keep) {
+        if (prb->isHigherOrder()) {
+            return 0;
+        }
+    }
+
+    // The static caches point to shared terms that may be collected
+    resetKernelCaches();
+
+    Stack<Unit*> roots;
+    auto addProblem = [&](Problem* prb) {
+        for (UnitList* us = prb->units(); us; us = us->tail()) {
+            roots.push(us->head());
+        }
+    };
+    for (Problem* prb : keep) {
+        addProblem(prb);
+    }
+    if (portfolioProblem) {
+        addProblem(portfolioProblem.get());
+    }
+    for (Unit* u : keepUnits) {
+        roots.push(u);
+    }
+    {
+        std::lock_guard<std::mutex> lock(liveSessionsMutex);
+        DHSet<ProvingSession*>::Iterator sit(liveSessions());
+        while (sit.hasNext()) {
+            sit.next()->collectRoots(roots);
+        }
+    }
+    if (env.statistics->refutation) {
+        roots.push(env.statistics->refutation);
+    }
+
+    // proofs with splits are printed using the recorded name literals
+    Stack<Literal*> nameLiterals;
+    nameLiterals.loadFromIterator(InferenceStore::instance()->splittingNameLiterals());
+
+    size_t reclaimed = env.sharing->collectGarbage(roots, nameLiterals);
+    releaseMemory();
+    return reclaimed;
+}
+
 Options& options() {
     return *env.options;
 }
@@ -189,13 +288,32 @@ Statistics& statistics() {
     return *env.statistics;
 }
 
+static MemoryUsageReport usageReport(Lib::MemoryCategory category) {
+    const Lib::MemoryUsage& usage = Lib::memoryUsage(category);
+    return MemoryUsageReport{ usage.live, usage.peak };
+}
+
+MemoryReport memoryReport() {
+    MemoryReport report;
+    report.terms = usageReport(Lib::MemoryCategory::TERMS);
+    report.clauses = usageReport(Lib::MemoryCategory::CLAUSES);
+    report.indexing = usageReport(Lib::MemoryCategory::INDEXING);
+    report.passive = usageReport(Lib::MemoryCategory::PASSIVE);
+    report.sat = usageReport(Lib::MemoryCategory::SAT);
+    report.peakTotalKB = Lib::peakMemoryUsageKB();
+    return report;
+}
+
 // ===========================================
 // Symbol Registration
 // ===========================================
 
-unsigned addFunction(const std::string& name, unsigned arity) {
-    unsigned functor = env.signature->addFunction(name, arity);
+unsigned internName(const std::string& name) {
+    return env.signature->internName(name);
+}
 
+/** Give @b functor the type taking and returning the default sort */
+static unsigned setDefaultFunctionType(unsigned functor, unsigned arity) {
     // Set a default type (all arguments and result are default sort)
     TermList defSort = AtomicSort::defaultSort();
     Stack<TermList> argSorts;
@@ -209,9 +327,16 @@ unsigned addFunction(const std::string& name, unsigned arity) {
     return functor;
 }
 
-unsigned addPredicate(const std::string& name, unsigned arity) {
-    unsigned pred = env.signature->addPredicate(name, arity);
+unsigned addFunction(const std::string& name, unsigned arity) {
+    return setDefaultFunctionType(env.signature->addFunction(name, arity), arity);
+}
+
+unsigned addFunctionByAtom(unsigned atom, unsigned arity) {
+    return setDefaultFunctionType(env.signature->addFunctionByAtom(atom, arity), arity);
+}
 
+/** Give @b pred the type taking the default sort */
+static unsigned setDefaultPredicateType(unsigned pred, unsigned arity) {
     // Set a default type (all arguments are default sort)
     TermList defSort = AtomicSort::defaultSort();
     Stack<TermList> argSorts;
@@ -225,6 +350,14 @@ unsigned addPredicate(const std::string& name, unsigned arity) {
     return pred;
 }
 
+unsigned addPredicate(const std::string& name, unsigned arity) {
+    return setDefaultPredicateType(env.signature->addPredicate(name, arity), arity);
+}
+
+unsigned addPredicateByAtom(unsigned atom, unsigned arity) {
+    return setDefaultPredicateType(env.signature->addPredicateByAtom(atom, arity), arity);
+}
+
 // ===========================================
 // Term Construction
 // ===========================================
@@ -381,6 +514,145 @@ Clause* clause(const std::vector<Literal*>& literals, UnitInputType inputType) {
         NonspecificInference0(inputType, InferenceRule::INPUT));
 }
 
+// ===========================================
+// Bulk Construction
+// ===========================================
+
+/**
+ * Decodes flat prefix encodings, reusing its stacks between the terms.
+ */
+class FlatDecoder {
+public:
+    FlatDecoder(const FlatEntry* entries, size_t count) : _entries(entries), _count(count), _pos(0) {}
+
+    bool atEnd() const { return _pos == _count; }
+
+    /** Decode the term at the current position; false if malformed */
+    bool term(TermList& res) {
+        ASS(_args.isEmpty() && _open.isEmpty());
+        do {
+            if (atEnd()) {
+                return fail();
+            }
+            const FlatEntry& e = _entries[_pos++];
+            if (e.tag == FlatTag::VAR) {
+                _args.push(TermList(e.value, false));
+            } else if (e.tag == FlatTag::FUN && e.value < env.signature->functions()) {
+                if (env.signature->functionArity(e.value) == 0) {
+                    _args.push(TermList(Term::createConstant(e.value)));
+                } else {
+                    _open.push(std::make_pair(e.value, _args.size()));
+                    continue;
+                }
+            } else {
+                return fail();
+            }
+            // build every application whose arguments are now complete
+            while (_open.isNonEmpty()) {
+                unsigned functor = _open.top().first;
+                size_t firstArg = _open.top().second;
+                unsigned arity = env.signature->functionArity(functor);
+                if (_args.size() - firstArg < arity) {
+                    break;
+                }
+                Term* t = Term::create(functor, arity, _args.begin() + firstArg);
+                _args.truncate(firstArg);
+                _args.push(TermList(t));
+                _open.pop();
+            }
+        } while (_open.isNonEmpty());
+        res = _args.pop();
+        return true;
+    }
+
+    /** Decode the literal at the current position; false if malformed */
+    bool literal(Literal*& res) {
+        if (atEnd()) {
+            return false;
+        }
+        const FlatEntry& e = _entries[_pos++];
+        if ((e.tag != FlatTag::POS_LIT && e.tag != FlatTag::NEG_LIT) || e.value >= env.signature->predicates()) {
+            return false;
+        }
+        bool positive = e.tag == FlatTag::POS_LIT;
+        unsigned arity = env.signature->predicateArity(e.value);
+        _litArgs.reset();
+        for (unsigned i = 0; i < arity; i++) {
+            TermList arg;
+            if (!term(arg)) {
+                return false;
+            }
+            _litArgs.push(arg);
+        }
+        res = e.value == 0
+            ? Literal::createEquality(positive, _litArgs[0], _litArgs[1], AtomicSort::defaultSort())
+            : Literal::create(e.value, arity, positive, _litArgs.begin());
+        return true;
+    }
+
+    /** Decode the clause at the current position; false if malformed */
+    bool clause(UnitInputType inputType, Clause*& res) {
+        if (atEnd() || _entries[_pos].tag != FlatTag::CLAUSE) {
+            return false;
+        }
+        unsigned length = _entries[_pos++].value;
+        _lits.reset();
+        for (unsigned i = 0; i < length; i++) {
+            Literal* l;
+            if (!literal(l)) {
+                return false;
+            }
+            _lits.push(l);
+        }
+        res = Clause::fromArray(_lits.begin(), length,
+            NonspecificInference0(inputType, InferenceRule::INPUT));
+        return true;
+    }
+
+private:
+    bool fail() {
+        _args.reset();
+        _open.reset();
+        return false;
+    }
+
+    const FlatEntry* _entries;
+    size_t _count;
+    size_t _pos;
+
+    /** completed terms not yet consumed by an application */
+    Stack<TermList> _args;
+    /** open applications: functor and position of its first argument in _args */
+    Stack<std::pair<unsigned, size_t>> _open;
+    Stack<TermList> _litArgs;
+    Stack<Literal*> _lits;
+};
+
+bool termsFromFlat(const FlatEntry* entries, size_t count, std::vector<TermList>& out) {
+    FlatDecoder decoder(entries, count);
+    while (!decoder.atEnd()) {
+        TermList t;
+        if (!decoder.term(t)) {
+            return false;
+        }
+        out.push_back(t);
+    }
+    return true;
+}
+
+bool clausesFromFlat(const FlatEntry* entries, size_t count, UnitInputType inputType,
+                     std::vector<Clause*>& out) {
+    FlatDecoder decoder(entries, count);
+    while (!decoder.atEnd()) {
+        Clause* c;
+        if (!decoder.clause(inputType, c)) {
+            return false;
+        }
+        out.push_back(c);
+    }
+    return true;
+}
+
 // ===========================================
 // Problem and Proving
 // ===========================================
@@ -425,12 +697,82 @@ Problem* problem(const std::vector<Unit*>& units) {
     return prb;
 }
 
+/**
+ * Read-only stream buffer over a caller-owned character range, so the
+ * parsers can read the text without it being copied into a std::string.
+ */
+class MemoryInputBuffer : public std::streambuf {
+public:
+    explicit MemoryInputBuffer(std::string_view text) {
+        // the get area is never written to
+        char* begin = const_cast<char*>(text.data());
+        setg(begin, begin, begin + text.size());
+    }
+};
+
+static void describeParseError(Exception& e, std::string* error) {
+    if (error) {
+        std::ostringstream msg;
+        e.cry(msg);
+        *error = msg.str();
+    }
+}
+
+Problem* problemFromTPTP(std::string_view text, std::string* error) {
+    MemoryInputBuffer buffer(text);
+    std::istream input(&buffer);
+
+    Parse::TPTP parser(input);
+    try {
+        parser.parse();
+    } catch (Exception& e) {
+        describeParseError(e, error);
+        UnitList::destroy(parser.units()); // units that perhaps got already parsed
+        return nullptr;
+    }
+
+    Problem* prb = new Problem(parser.units());
+    env.setMainProblem(prb);
+    return prb;
+}
+
+Problem* problemFromSMTLIB2(std::string_view text, std::string* error) {
+    MemoryInputBuffer buffer(text);
+    std::istream input(&buffer);
+
+    Parse::SMTLIB2 parser;
+    try {
+        parser.parse(input);
+    } catch (Exception& e) {
+        describeParseError(e, error);
+        UnitList::destroy(parser.getFormulas()); // units that perhaps got already parsed
+        return nullptr;
+    }
+    Unit::onParsingEnd();
+
+    Problem* prb = new Problem(parser.getFormulas());
+    // must happen before the property is computed
+    prb->setSMTLIBLogic(parser.getLogic());
+    env.setMainProblem(prb);
+    return prb;
+}
+
 static unsigned _proveCallCount = 0;
 
 ProofResult prove(Problem* prb) {
     // Ensure problem is set
     env.setMainProblem(prb);
 
+    // The input clauses are the only ones of earlier proofs that the
+    // saturation sees, so restarting the aux timestamps is safe once
+    // theirs are cleared
+    Clause::resetAuxTimestamp();
+    for (UnitList* us = prb->units(); us; us = us->tail()) {
+        if (us->head()->isClause()) {
+            us->head()->asClause()->clearAux();
+        }
+    }
+
     _proveCallCount++;
     bool debugThisCall = false;
     if (debugThisCall) {
@@ -478,12 +820,529 @@ ProofResult prove(Problem* prb) {
     }
 }
 
+std::vector<ProofResult> proveBatch(const std::vector<Problem*>& problems) {
+    std::vector<ProofResult> results;
+    results.reserve(problems.size());
+    if (problems.empty()) {
+        return results;
+    }
+
+    // a proof resolves auto values (e.g. of the term ordering) for its
+    // problem, which must not carry over to the next problem
+    Options base;
+    base.copyValuesFrom(*env.options);
+    for (Problem* prb : problems) {
+        env.options->copyValuesFrom(base);
+        prepareForNextProof();
+        results.push_back(prove(prb));
+    }
+    env.options->copyValuesFrom(base);
+    return results;
+}
+
+ProofResult provePortfolio(Problem* prb, unsigned maxSlices, std::string* strategy) {
+    if (strategy) {
+        strategy->clear();
+    }
+    CASC::Schedule quick;
+    CASC::Schedule champions;
+    CASC::PortfolioMode::getSchedules(*prb->getProperty(), quick, champions);
+
+    std::vector<std::string> slices;
+    for (const std::string& code : iterTraits(quick.iter())) {
+        slices.push_back(code);
+    }
+    for (const std::string& code : iterTraits(champions.iter())) {
+        slices.push_back(code);
+    }
+    if (maxSlices && slices.size() > maxSlices) {
+        slices.resize(maxSlices);
+    }
+
+    Options base;
+    base.copyValuesFrom(*env.options);
+    // overall limit in deciseconds, 0 if unlimited
+    const long totalLimit = base.timeLimitInDeciseconds();
+    auto start = std::chrono::steady_clock::now();
+
+    ProofResult res = ProofResult::UNKNOWN;
+    for (const std::string& code : slices) {
+        long sliceTime = 0;
+        Int::stringToLong(code.substr(code.find_last_of('_') + 1), sliceTime);
+        if (totalLimit) {
+            long elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start).count() / 100;
+            long remaining = totalLimit - elapsed;
+            if (remaining <= 0) {
+                break;
+            }
+            if (!sliceTime || sliceTime > remaining) {
+                sliceTime = remaining;
+            }
+        }
+
+        env.options->copyValuesFrom(base);
+        try {
+            env.options->readFromEncodedOptions(code);
+        } catch (Exception&) {
+            // strategy of a newer/older option set; skip it
+            continue;
+        }
+        env.options->setTimeLimitInDeciseconds(sliceTime);
+        // the input was not normalized for the portfolio
+        env.options->setNormalize(false);
+        env.options->setForcedOptionValues();
+        if (!env.options->checkGlobalOptionConstraints()) {
+            continue;
+        }
+
+        // units built by the caller are shared, but saturation changes the
+        // clause objects it works on, so every slice gets its own copies
+        UnitList* units = nullptr;
+        UnitList::Iterator uit(prb->units());
+        while (uit.hasNext()) {
+            Unit* u = uit.next();
+            UnitList::push(u->isClause() ? Clause::fromClause(static_cast<Clause*>(u)) : u, units);
+        }
+        portfolioProblem.reset(new Problem(UnitList::reverse(units)));
+
+        prepareForNextProof();
+        try {
+            res = prove(portfolioProblem.get());
+        } catch (Exception&) {
+            res = ProofResult::UNKNOWN;
+        }
+        if (res == ProofResult::PROOF || res == ProofResult::SATISFIABLE) {
+            if (strategy) {
+                *strategy = code;
+            }
+            break;
+        }
+    }
+
+    env.options->copyValuesFrom(base);
+    return res;
+}
+
+ProvingSession::ProvingSession() {
+    std::lock_guard<std::mutex> lock(liveSessionsMutex);
+    liveSessions().insert(this);
+}
+
+ProvingSession::~ProvingSession() {
+    std::lock_guard<std::mutex> lock(liveSessionsMutex);
+    liveSessions().remove(this);
+}
+
+void ProvingSession::collectRoots(Stack<Unit*>& roots) const {
+    for (Unit* u : _pending) {
+        roots.push(u);
+    }
+    for (Clause* cl : _clauses) {
+        roots.push(cl);
+    }
+    // the units a pop() restores
+    for (const Level& level : _levels) {
+        for (Unit* u : level.pending) {
+            roots.push(u);
+        }
+    }
+    if (_problem) {
+        for (UnitList* us = _problem->units(); us; us = us->tail()) {
+            roots.push(us->head());
+        }
+    }
+}
+
+void ProvingSession::addAxiom(Unit* u) {
+    _pending.push_back(u);
+}
+
+void ProvingSession::addAxioms(const std::vector<Unit*>& units) {
+    _pending.insert(_pending.end(), units.begin(), units.end());
+}
+
+void ProvingSession::clausifyPending() {
+    if (_pending.empty()) {
+        return;
+    }
+
+    UnitList* units = nullptr;
+    for (auto it = _pending.rbegin(); it != _pending.rend(); ++it) {
+        UnitList::push(*it, units);
+    }
+    _pending.clear();
+
+    Problem axioms(units);
+    // the preprocessing consults the main problem, which must not be left
+    // pointing at this local one
+    Problem* mainProblem = env.getMainProblem();
+    env.setMainProblem(&axioms);
+    try {
+        env.options->resolveAwayAutoValues0();
+        Shell::Preprocess(*env.options).clausifyOnly(axioms);
+    } catch (...) {
+        env.setMainProblem(mainProblem);
+        throw;
+    }
+    env.setMainProblem(mainProblem);
+
+    UnitList::Iterator uit(axioms.units());
+    while (uit.hasNext()) {
+        Unit* u = uit.next();
+        if (u->isClause()) {
+            _clauses.push_back(static_cast<Clause*>(u));
+        } else {
+            // not clausified (FOOL, higher-order); leave it to preprocess()
+            _pending.push_back(u);
+        }
+    }
+    UnitList::destroy(axioms.units());
+    // the selection structure has to take the new clauses into account
+    _sine.reset();
+}
+
+void ProvingSession::push() {
+    clausifyPending();
+    // clausifying again may reorder the units left pending, so they are
+    // remembered as a whole rather than by count
+    _levels.push_back(Level{_pending, _clauses.size()});
+}
+
+bool ProvingSession::pop() {
+    if (_levels.empty()) {
+        return false;
+    }
+    Level& level = _levels.back();
+    _pending = std::move(level.pending);
+    if (_clauses.size() != level.clauses) {
+        ASS_G(_clauses.size(), level.clauses);
+        _clauses.resize(level.clauses);
+        _sine.reset();
+    }
+    _levels.pop_back();
+    return true;
+}
+
+ProofResult ProvingSession::prove(const std::vector<Unit*>& conjecture) {
+    prepareForNextProof();
+    clausifyPending();
+
+    UnitList* units = nullptr;
+    for (auto it = conjecture.rbegin(); it != conjecture.rend(); ++it) {
+        UnitList::push(*it, units);
+    }
+    for (auto it = _pending.rbegin(); it != _pending.rend(); ++it) {
+        UnitList::push(*it, units);
+    }
+
+    Options::SineSelection sine = env.options->sineSelection();
+    if (sine != Options::SineSelection::AXIOMS) {
+        for (auto it = _clauses.rbegin(); it != _clauses.rend(); ++it) {
+            // saturation changes the clause objects it works on (store,
+            // literal selection), so every query gets its own copies
+            UnitList::push(Clause::fromClause(*it), units);
+        }
+        _problem.reset(new Problem(units));
+        return Api::prove(_problem.get());
+    }
+
+    if (!_sine) {
+        UnitList* axioms = nullptr;
+        for (auto it = _clauses.rbegin(); it != _clauses.rend(); ++it) {
+            UnitList::push(*it, axioms);
+        }
+        _sine.reset(new Shell::SineTheorySelector(*env.options));
+        _sine->initSelectionStructure(axioms);
+        UnitList::destroy(axioms);
+    }
+    // the query units come back together with the selected axiom clauses,
+    // only the latter need copying
+    _sine->perform(units);
+    DHSet<Unit*> queryUnits;
+    for (Unit* u : conjecture) {
+        queryUnits.insert(u);
+    }
+    for (Unit* u : _pending) {
+        queryUnits.insert(u);
+    }
+    UnitList::RefIterator uit(units);
+    while (uit.hasNext()) {
+        Unit*& u = uit.next();
+        if (!queryUnits.contains(u)) {
+            u = Clause::fromClause(static_cast<Clause*>(u));
+        }
+    }
+
+    // the selection is done, preprocess() must not repeat it on the subset
+    env.options->setSineSelection(Options::SineSelection::OFF);
+    _problem.reset(new Problem(units));
+    ProofResult res;
+    try {
+        res = Api::prove(_problem.get());
+    } catch (...) {
+        env.options->setSineSelection(sine);
+        throw;
+    }
+    env.options->setSineSelection(sine);
+    return res;
+}
+
+ProofResult ProvingSession::prove(const std::vector<Unit*>& conjecture, const std::string& strategy) {
+    Options base;
+    base.copyValuesFrom(*env.options);
+    try {
+        env.options->readFromEncodedOptions(strategy);
+    } catch (Exception&) {
+        env.options->copyValuesFrom(base);
+        return ProofResult::UNKNOWN;
+    }
+    env.options->setForcedOptionValues();
+    if (!env.options->checkGlobalOptionConstraints()) {
+        env.options->copyValuesFrom(base);
+        return ProofResult::UNKNOWN;
+    }
+    ProofResult res;
+    try {
+        res = prove(conjecture);
+    } catch (...) {
+        env.options->copyValuesFrom(base);
+        throw;
+    }
+    env.options->copyValuesFrom(base);
+    return res;
+}
+
+// ===========================================
+// Prover Contexts
+// ===========================================
+
+/**
+ * Serializes access to the global environment between threads.
+ * Recursive, so that a thread can nest scopes of different contexts.
+ */
+static std::recursive_mutex contextMutex;
+
+VampireContext::VampireContext()
+    : _options(new Options),
+      _signature(new Signature),
+      _sharing(new TermSharing),
+      _statistics(new Statistics),
+      _inferenceStore(new InferenceStore),
+      _inferenceLog(new InferenceLog),
+      _problem(nullptr),
+      _depth(0)
+{
+    // Same initialization as in the Environment constructor; the sorts
+    // have to be created in this order, since a number of places rely
+    // on the type constructor for $i being 0, that for $o being 1 etc.
+    ContextScope scope(*this);
+    _signature->addEquality();
+    AtomicSort::defaultSort();
+    AtomicSort::boolSort();
+    AtomicSort::intSort();
+    AtomicSort::realSort();
+    AtomicSort::rationalSort();
+}
+
+VampireContext::~VampireContext() {
+    // Note: order matters here due to dependencies (as in reset())
+    delete _inferenceLog;
+    delete _inferenceStore;
+    delete _sharing;
+    delete _signature;
+    delete _statistics;
+    delete _options;
+}
+
+ContextScope::ContextScope(VampireContext& ctx)
+    : _ctx(ctx),
+      _savedOptions(nullptr),
+      _savedSignature(nullptr),
+      _savedSharing(nullptr),
+      _savedStatistics(nullptr),
+      _savedInferenceStore(nullptr),
+      _savedInferenceLog(nullptr),
+      _savedProblem(nullptr)
+{
+    contextMutex.lock();
+    if (_ctx._depth++ > 0) {
+        // an outer scope has already installed the context
+        return;
+    }
+
+    _savedOptions = env.options;
+    _savedSignature = env.signature;
+    _savedSharing = env.sharing;
+    _savedStatistics = env.statistics;
+    _savedProblem = env.getMainProblem();
+
+    // The static caches point into the signature and sharing we are
+    // switching away from
+    resetKernelCaches();
+
+    env.options = _ctx._options;
+    env.signature = _ctx._signature;
+    env.sharing = _ctx._sharing;
+    env.statistics = _ctx._statistics;
+    env.setMainProblem(_ctx._problem);
+    _savedInferenceStore = InferenceStore::installInstance(_ctx._inferenceStore);
+    _savedInferenceLog = InferenceLog::installInstance(_ctx._inferenceLog);
+    _savedAnswerCallback = Shell::AnswerLiteralManager::swapAnswerCallback(_ctx._answerCallback);
+}
+
+ContextScope::~ContextScope() {
+    if (--_ctx._depth == 0) {
+        _ctx._problem = env.getMainProblem();
+
+        resetKernelCaches();
+
+        env.options = _savedOptions;
+        env.signature = _savedSignature;
+        env.sharing = _savedSharing;
+        env.statistics = _savedStatistics;
+        env.setMainProblem(_savedProblem);
+        InferenceStore::installInstance(_savedInferenceStore);
+        InferenceLog::installInstance(_savedInferenceLog);
+        _ctx._answerCallback = Shell::AnswerLiteralManager::swapAnswerCallback(std::move(_savedAnswerCallback));
+    }
+    contextMutex.unlock();
+}
+
+VampireContext* createContext() {
+    return new VampireContext();
+}
+
+void destroyContext(VampireContext* ctx) {
+    delete ctx;
+    releaseMemory();
+}
+
+ProofResult prove(VampireContext& ctx, Problem* prb) {
+    ContextScope scope(ctx);
+    prepareForNextProof();
+    return prove(prb);
+}
+
+// ===========================================
+// Asynchronous Proving
+// ===========================================
+
+ProofTask::ProofTask(VampireContext* ctx, Problem* prb, ProgressCallback callback, unsigned interval)
+    : _ctx(ctx), _problem(prb), _callback(std::move(callback)), _interval(interval),
+      _lastReported(0), _cancelRequested(false), _result(ProofResult::UNKNOWN), _done(false) {
+    _thread = std::thread(&ProofTask::run, this);
+}
+
+ProofTask::~ProofTask() {
+    cancel();
+    _thread.join();
+}
+
+bool ProofTask::wait(long timeoutMs) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (timeoutMs < 0) {
+        _finished.wait(lock, [this] { return _done; });
+        return true;
+    }
+    return _finished.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this] { return _done; });
+}
+
+bool ProofTask::isDone() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _done;
+}
+
+/**
+ * Step hook installed in the saturation loop while the task runs.
+ * Returns false to stop the search once cancellation was requested.
+ */
+bool ProofTask::onStep(void* data) {
+    ProofTask* task = static_cast<ProofTask*>(data);
+    if (task->_cancelRequested) {
+        return false;
+    }
+    unsigned activations = env.statistics->activations;
+    if (task->_callback && task->_interval && activations - task->_lastReported >= task->_interval) {
+        task->_lastReported = activations;
+
+        ProofProgress progress;
+        progress.activations = activations;
+        progress.activeClauses = 0;
+        progress.passiveClauses = 0;
+        if (SaturationAlgorithm* sa = SaturationAlgorithm::tryGetInstance()) {
+            progress.activeClauses = sa->getActiveClauseContainer()->sizeEstimate();
+            progress.passiveClauses = sa->getPassiveClauseContainer()->sizeEstimate();
+        }
+        progress.peakMemoryKB = peakMemoryUsageKB();
+        progress.elapsedMs = Timer::elapsedMilliseconds();
+        for (unsigned i = 0; i < progress.phaseMs.size(); i++) {
+            progress.phaseMs[i] = env.statistics->phaseUsage[i].nanoseconds / 1000000;
+        }
+        task->_callback(progress);
+    }
+    return true;
+}
+
+void ProofTask::run() {
+    ProofResult res = ProofResult::UNKNOWN;
+    {
+        // Without a context the task runs on the global environment,
+        // which no context may be switched into meanwhile
+        std::unique_lock<std::recursive_mutex> globalLock(contextMutex, std::defer_lock);
+        std::unique_ptr<ContextScope> scope;
+        if (_ctx) {
+            scope.reset(new ContextScope(*_ctx));
+        } else {
+            globalLock.lock();
+        }
+        SaturationAlgorithm::setStepHook(&ProofTask::onStep, this);
+        try {
+            prepareForNextProof();
+            res = prove(_problem);
+        } catch (...) {
+            // exceptions must not escape the thread; report them as UNKNOWN
+            res = ProofResult::UNKNOWN;
+        }
+        SaturationAlgorithm::setStepHook(nullptr, nullptr);
+        if (_cancelRequested && res == ProofResult::TIMEOUT) {
+            res = ProofResult::CANCELLED;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _result = res;
+    _done = true;
+    _finished.notify_all();
+}
+
+ProofTask* proveAsync(Problem* prb, ProgressCallback callback, unsigned interval) {
+    return new ProofTask(nullptr, prb, std::move(callback), interval);
+}
+
+ProofTask* proveAsync(VampireContext& ctx, Problem* prb, ProgressCallback callback, unsigned interval) {
+    return new ProofTask(&ctx, prb, std::move(callback), interval);
+}
+
+void setAnswerCallback(AnswerCallback callback) {
+    // waits for a task running on the global environment, which reads it
+    std::lock_guard<std::recursive_mutex> lock(contextMutex);
+    Shell::AnswerLiteralManager::setAnswerCallback(std::move(callback));
+}
+
+void setAnswerCallback(VampireContext& ctx, AnswerCallback callback) {
+    ContextScope scope(ctx);
+    setAnswerCallback(std::move(callback));
+}
+
 Unit* getRefutation() {
     return env.statistics->refutation;
 }
 
 void printProof(std::ostream& out, Unit* refutation) {
-    if (refutation) {
+    if (refutation && InferenceLog::enabled()) {
+        InferenceLog::outputProof(out, refutation);
+    } else if (refutation) {
         InferenceStore::instance()->outputProof(out, refutation);
     }
 }
@@ -555,59 +1414,371 @@ std::vector<Literal*> getLiterals(Clause* c) {
 
 std::vector<ProofStep> extractProof(Unit* refutation) {
     std::vector<ProofStep> steps;
-    if (!refutation) {
-        return steps;
+    ProofIterator it(refutation);
+    while (it.next()) {
+        ProofStep step;
+        step.id = it.id();
+        step.unit = it.unit();
+        step.rule = it.rule();
+        step.inputType = it.inputType();
+        step.premiseIds = it.premiseIds();
+        steps.push_back(step);
     }
+    return steps;
+}
 
-    // Collect all units in the proof DAG using DFS
-    DHSet<unsigned> visited;
-    Stack<Unit*> toProcess;
-    std::vector<Unit*> unitsInOrder;
+ProofIterator::ProofIterator(Unit* refutation) : _current(nullptr) {
+    if (refutation) {
+        _todo.push(std::make_pair(refutation, false));
+    }
+}
 
-    toProcess.push(refutation);
+bool ProofIterator::next() {
+    // post-order traversal: a unit is produced once all its premises were
+    while (_todo.isNonEmpty()) {
+        std::pair<Unit*, bool>& top = _todo.top();
+        Unit* u = top.first;
+        if (top.second) {
+            _todo.pop();
+            _current = u;
+            _premiseIds.clear();
+            Inference& inf = u->inference();
+            Inference::Iterator it = inf.iterator();
+            while (inf.hasNext(it)) {
+                _premiseIds.push_back(inf.next(it)->number());
+            }
+            return true;
+        }
+        if (!_visited.insert(u->number())) {
+            _todo.pop();
+            continue;
+        }
+        top.second = true;
+        Inference& inf = u->inference();
+        Inference::Iterator it = inf.iterator();
+        while (inf.hasNext(it)) {
+            Unit* premise = inf.next(it);
+            if (!_visited.find(premise->number())) {
+                _todo.push(std::make_pair(premise, false));
+            }
+        }
+    }
+    _current = nullptr;
+    return false;
+}
 
-    while (!toProcess.isEmpty()) {
-        Unit* current = toProcess.pop();
+void clauseToFlat(Clause* c, std::vector<FlatEntry>& out) {
+    out.push_back({ FlatTag::CLAUSE, c->length() });
+    Stack<TermList> todo;
+    for (Literal* l : c->iterLits()) {
+        out.push_back({ l->isPositive() ? FlatTag::POS_LIT : FlatTag::NEG_LIT, l->functor() });
+        // arguments are pushed in reverse so that they pop in order
+        for (unsigned i = l->arity(); i > 0; i--) {
+            todo.push(*l->nthArgument(i - 1));
+        }
+        while (todo.isNonEmpty()) {
+            TermList t = todo.pop();
+            if (t.isVar()) {
+                out.push_back({ FlatTag::VAR, t.var() });
+                continue;
+            }
+            Term* trm = t.term();
+            out.push_back({ FlatTag::FUN, trm->functor() });
+            for (unsigned i = trm->arity(); i > 0; i--) {
+                todo.push(*trm->nthArgument(i - 1));
+            }
+        }
+    }
+}
 
-        if (!visited.insert(current->number())) {
-            continue;  // Already visited
+static void writeVarint(std::ostream& out, uint64_t n) {
+    while (n >= 0x80) {
+        out.put(static_cast<char>((n & 0x7f) | 0x80));
+        n >>= 7;
+    }
+    out.put(static_cast<char>(n));
+}
+
+void writeProofBinary(Unit* refutation, std::ostream& out) {
+    std::vector<FlatEntry> flat;
+    ProofIterator it(refutation);
+    while (it.next()) {
+        writeVarint(out, it.id());
+        writeVarint(out, static_cast<unsigned>(it.rule()));
+        writeVarint(out, static_cast<unsigned>(it.inputType()));
+        writeVarint(out, it.premiseIds().size());
+        for (unsigned id : it.premiseIds()) {
+            writeVarint(out, id);
+        }
+        if (!it.unit()->isClause()) {
+            writeVarint(out, 0);
+            continue;
         }
+        writeVarint(out, 1);
+        flat.clear();
+        clauseToFlat(static_cast<Clause*>(it.unit()), flat);
+        writeVarint(out, flat.size());
+        for (const FlatEntry& e : flat) {
+            writeVarint(out, static_cast<unsigned>(e.tag));
+            writeVarint(out, e.value);
+        }
+    }
+}
 
-        unitsInOrder.push_back(current);
+// ===========================================
+// Session Snapshots
+// ===========================================
 
-        // Add parents (premises) to the stack
-        Inference& inf = current->inference();
-        Inference::Iterator it = inf.iterator();
-        while (inf.hasNext(it)) {
-            Unit* parent = inf.next(it);
-            toProcess.push(parent);
+static bool readVarint(std::istream& in, uint64_t& n) {
+    n = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        int c = in.get();
+        if (c == std::istream::traits_type::eof()) {
+            return false;
+        }
+        n |= static_cast<uint64_t>(c & 0x7f) << shift;
+        if (!(c & 0x80)) {
+            return true;
         }
     }
+    return false;
+}
 
-    // Reverse to get topological order (premises before conclusions)
-    std::reverse(unitsInOrder.begin(), unitsInOrder.end());
+static const uint64_t SNAPSHOT_VERSION = 1;
 
-    // Build ProofStep for each unit
-    for (Unit* u : unitsInOrder) {
-        ProofStep step;
-        step.id = u->number();
-        step.unit = u;
+enum SnapshotSymbolFlags : unsigned {
+    SNAPSHOT_SKOLEM = 1,
+    SNAPSHOT_INTRODUCED = 2,
+};
 
-        Inference& inf = u->inference();
-        step.rule = inf.rule();
-        step.inputType = inf.inputType();
+bool ProvingSession::saveSnapshot(std::ostream& out) {
+    clausifyPending();
+    if (!_pending.empty()) {
+        return false;
+    }
 
-        // Collect premise IDs
-        Inference::Iterator it = inf.iterator();
-        while (inf.hasNext(it)) {
-            Unit* parent = inf.next(it);
-            step.premiseIds.push_back(parent->number());
+    std::vector<std::vector<FlatEntry>> flat(_clauses.size());
+    DHSet<unsigned> functions;
+    DHSet<unsigned> predicates;
+    for (size_t i = 0; i < _clauses.size(); i++) {
+        clauseToFlat(_clauses[i], flat[i]);
+        for (const FlatEntry& e : flat[i]) {
+            if (e.tag == FlatTag::FUN) {
+                functions.insert(e.value);
+            } else if ((e.tag == FlatTag::POS_LIT || e.tag == FlatTag::NEG_LIT) && e.value != 0) {
+                predicates.insert(e.value);
+            }
         }
+    }
 
-        steps.push_back(step);
+    // only the default-sorted signature is reproducible from names and arities
+    Stack<std::pair<unsigned, unsigned>> symbols;
+    for (unsigned f : iterTraits(functions.iterator())) {
+        if (!env.signature->getFunction(f)->fnType()->isAllDefault()) {
+            return false;
+        }
+        symbols.push({ 0, f });
+    }
+    for (unsigned p : iterTraits(predicates.iterator())) {
+        if (!env.signature->getPredicate(p)->predType()->isAllDefault()) {
+            return false;
+        }
+        symbols.push({ 1, p });
     }
 
-    return steps;
+    writeVarint(out, SNAPSHOT_VERSION);
+    writeVarint(out, symbols.size());
+    for (const auto& [kind, number] : symbols) {
+        Signature::Symbol* sym = kind == 0
+            ? env.signature->getFunction(number)
+            : env.signature->getPredicate(number);
+        unsigned flags = (sym->skolem() ? SNAPSHOT_SKOLEM : 0)
+                       | (sym->introduced() ? SNAPSHOT_INTRODUCED : 0);
+        writeVarint(out, kind);
+        writeVarint(out, number);
+        writeVarint(out, sym->arity());
+        writeVarint(out, flags);
+        writeVarint(out, sym->name().size());
+        out.write(sym->name().data(), sym->name().size());
+    }
+
+    writeVarint(out, _clauses.size());
+    for (size_t i = 0; i < _clauses.size(); i++) {
+        writeVarint(out, static_cast<unsigned>(_clauses[i]->inputType()));
+        writeVarint(out, flat[i].size());
+        for (const FlatEntry& e : flat[i]) {
+            writeVarint(out, static_cast<unsigned>(e.tag));
+            writeVarint(out, e.value);
+        }
+    }
+    return static_cast<bool>(out);
+}
+
+/**
+ * Map a snapshot symbol onto the current signature, adding it if needed.
+ * Returns false if a symbol of that name exists with a non-default type.
+ */
+static bool loadSnapshotSymbol(bool predicate, const std::string& name, unsigned arity,
+                               unsigned flags, unsigned& number) {
+    Signature* sig = env.signature;
+    if (flags & SNAPSHOT_SKOLEM) {
+        // Skolem names are only unique within the process that made them
+        number = predicate ? sig->addSkolemPredicate(arity) : sig->addSkolemFunction(arity);
+    } else if (flags & SNAPSHOT_INTRODUCED) {
+        number = predicate ? sig->addFreshPredicate(arity, "sP") : sig->addFreshFunction(arity, "sF");
+    } else {
+        bool added;
+        number = predicate ? sig->addPredicate(name, arity, added) : sig->addFunction(name, arity, added);
+        if (!added) {
+            return predicate
+                ? sig->getPredicate(number)->predType()->isAllDefault()
+                : sig->getFunction(number)->fnType()->isAllDefault();
+        }
+    }
+
+    TermList defSort = AtomicSort::defaultSort();
+    Stack<TermList> argSorts;
+    for (unsigned i = 0; i < arity; i++) {
+        argSorts.push(defSort);
+    }
+    if (predicate) {
+        sig->getPredicate(number)->setType(OperatorType::getPredicateType(arity, argSorts.begin()));
+    } else {
+        sig->getFunction(number)->setType(OperatorType::getFunctionType(arity, argSorts.begin(), defSort));
+    }
+    return true;
+}
+
+/** A symbol as written to a snapshot */
+struct SnapshotSymbol {
+    bool predicate;
+    unsigned number;
+    unsigned arity;
+    unsigned flags;
+    std::string name;
+};
+
+/** A clause record of a snapshot, with the symbol numbers of the writer */
+struct SnapshotClause {
+    UnitInputType inputType;
+    std::vector<FlatEntry> flat;
+};
+
+/** Clauses decoded from a snapshot, destroyed unless the load completes */
+class SnapshotClauses {
+public:
+    SnapshotClauses() = default;
+    SnapshotClauses(const SnapshotClauses&) = delete;
+    SnapshotClauses& operator=(const SnapshotClauses&) = delete;
+    ~SnapshotClauses() {
+        for (Clause* cl : _clauses) {
+            cl->destroy();
+        }
+    }
+
+    std::vector<Clause*>& clauses() { return _clauses; }
+
+    /** Hand the clauses over to @b out */
+    void release(std::vector<Clause*>& out) {
+        out.insert(out.end(), _clauses.begin(), _clauses.end());
+        _clauses.clear();
+    }
+
+private:
+    std::vector<Clause*> _clauses;
+};
+
+/** False if a symbol of the name of @b sym exists with a non-default type */
+static bool snapshotSymbolFits(const SnapshotSymbol& sym) {
+    if (sym.flags & (SNAPSHOT_SKOLEM | SNAPSHOT_INTRODUCED)) {
+        return true;
+    }
+    unsigned number;
+    if (sym.predicate) {
+        return !env.signature->tryGetPredicateNumber(sym.name, sym.arity, number)
+            || env.signature->getPredicate(number)->predType()->isAllDefault();
+    }
+    return !env.signature->tryGetFunctionNumber(sym.name, sym.arity, number)
+        || env.signature->getFunction(number)->fnType()->isAllDefault();
+}
+
+bool ProvingSession::loadSnapshot(std::istream& in) {
+    // the whole snapshot is read and checked before the signature changes
+    uint64_t version, symbolCount;
+    if (!readVarint(in, version) || version != SNAPSHOT_VERSION || !readVarint(in, symbolCount)) {
+        return false;
+    }
+
+    std::vector<SnapshotSymbol> symbols;
+    DHSet<unsigned> functionNumbers;
+    DHSet<unsigned> predicateNumbers;
+    for (uint64_t i = 0; i < symbolCount; i++) {
+        uint64_t kind, number, arity, flags, nameLength;
+        if (!readVarint(in, kind) || kind > 1 || !readVarint(in, number) ||
+            !readVarint(in, arity) || !readVarint(in, flags) || !readVarint(in, nameLength)) {
+            return false;
+        }
+        SnapshotSymbol sym{ kind == 1, static_cast<unsigned>(number), static_cast<unsigned>(arity),
+                            static_cast<unsigned>(flags), std::string(nameLength, '\0') };
+        if (!in.read(&sym.name[0], nameLength) || !snapshotSymbolFits(sym) ||
+            !(sym.predicate ? predicateNumbers : functionNumbers).insert(sym.number)) {
+            return false;
+        }
+        symbols.push_back(std::move(sym));
+    }
+
+    uint64_t clauseCount;
+    if (!readVarint(in, clauseCount)) {
+        return false;
+    }
+    std::vector<SnapshotClause> records;
+    for (uint64_t i = 0; i < clauseCount; i++) {
+        uint64_t inputType, entryCount;
+        if (!readVarint(in, inputType) || !readVarint(in, entryCount)) {
+            return false;
+        }
+        SnapshotClause record{ static_cast<UnitInputType>(inputType), {} };
+        for (uint64_t j = 0; j < entryCount; j++) {
+            uint64_t tag, value;
+            if (!readVarint(in, tag) || tag > static_cast<unsigned>(FlatTag::CLAUSE) ||
+                !readVarint(in, value)) {
+                return false;
+            }
+            FlatEntry e{ static_cast<FlatTag>(tag), static_cast<unsigned>(value) };
+            // equality and variables keep their numbers
+            bool isPredicate = (e.tag == FlatTag::POS_LIT || e.tag == FlatTag::NEG_LIT) && e.value != 0;
+            if ((isPredicate && !predicateNumbers.find(e.value)) ||
+                (e.tag == FlatTag::FUN && !functionNumbers.find(e.value))) {
+                return false;
+            }
+            record.flat.push_back(e);
+        }
+        records.push_back(std::move(record));
+    }
+
+    DHMap<unsigned, unsigned> functions;
+    DHMap<unsigned, unsigned> predicates;
+    for (const SnapshotSymbol& sym : symbols) {
+        unsigned current;
+        ALWAYS(loadSnapshotSymbol(sym.predicate, sym.name, sym.arity, sym.flags, current));
+        (sym.predicate ? predicates : functions).insert(sym.number, current);
+    }
+
+    SnapshotClauses loaded;
+    for (SnapshotClause& record : records) {
+        for (FlatEntry& e : record.flat) {
+            bool isPredicate = (e.tag == FlatTag::POS_LIT || e.tag == FlatTag::NEG_LIT) && e.value != 0;
+            if (isPredicate || e.tag == FlatTag::FUN) {
+                e.value = (isPredicate ? predicates : functions).get(e.value);
+            }
+        }
+        if (!clausesFromFlat(record.flat.data(), record.flat.size(), record.inputType, loaded.clauses())) {
+            return false;
+        }
+    }
+
+    loaded.release(_clauses);
+    return true;
 }
 
 } // namespace Api
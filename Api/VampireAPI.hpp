@@ -21,8 +21,17 @@
 #define __VampireAPI__
 
 #include <string>
+#include <string_view>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <initializer_list>
+#include <istream>
+#include <memory>
+#include <mutex>
 #include <ostream>
+#include <thread>
 #include <vector>
 
 #include "Forwards.hpp"
@@ -33,7 +42,12 @@
 #include "Kernel/Problem.hpp"
 #include "Kernel/Signature.hpp"
 #include "Kernel/Inference.hpp"
+#include "Kernel/InferenceLog.hpp"
+#include "Kernel/InferenceStore.hpp"
+#include "Lib/DHSet.hpp"
+#include "Lib/Stack.hpp"
 #include "Shell/Options.hpp"
+#include "Shell/SineUtils.hpp"
 #include "Shell/Statistics.hpp"
 
 namespace Api {
@@ -50,7 +64,8 @@ enum class ProofResult {
     TIMEOUT,          // Time limit exceeded
     MEMORY_LIMIT,     // Memory limit exceeded
     UNKNOWN,          // Could not determine
-    INCOMPLETE        // Incomplete search
+    INCOMPLETE,       // Incomplete search
+    CANCELLED         // Stopped by ProofTask::cancel()
 };
 
 /**
@@ -75,6 +90,34 @@ void prepareForNextProof();
  */
 void reset();
 
+/**
+ * Return memory held by the small-object and clause allocators that is
+ * no longer in use to the operating system. Memory is otherwise kept for reuse by
+ * later allocations, so the footprint stays at the peak of the largest
+ * proof so far. reset() and destroyContext() call this automatically.
+ * Takes time linear in the amount of free memory held.
+ * @return Number of bytes released
+ */
+size_t releaseMemory();
+
+/**
+ * Destroy the shared terms and literals that are no longer used by any of
+ * the given problems or units, then release the freed memory.
+ *
+ * Terms are never reclaimed otherwise, so long-running applications that
+ * prove many problems in one environment can call this now and then
+ * instead of a full reset(), which would also discard the signature.
+ * The units of @b keep, the units in @b keepUnits, the axioms and last
+ * query of every live ProvingSession (including the levels saved by its
+ * push()), the last refutation and everything they were derived from stay
+ * valid; every other term, literal
+ * and proof handle obtained earlier may be invalidated. Must not be called
+ * while a proof is running. Does nothing for higher-order problems.
+ * @return Number of bytes reclaimed from the term sharing structure
+ */
+size_t collectGarbage(const std::vector<Problem*>& keep,
+                      const std::vector<Unit*>& keepUnits = std::vector<Unit*>());
+
 /**
  * Access the options object for configuration.
  */
@@ -90,6 +133,265 @@ Signature& signature();
  */
 Statistics& statistics();
 
+/** Memory in use by one subsystem, see memoryReport() */
+struct MemoryUsageReport {
+    size_t liveBytes;
+    size_t peakBytes;
+};
+
+/**
+ * Memory use broken down by subsystem. Only the main data structures of
+ * each subsystem are counted, so the numbers are lower bounds. Peaks are
+ * measured from the start of the last proof attempt.
+ */
+struct MemoryReport {
+    MemoryUsageReport terms;     ///< Shared and non-shared terms and literals
+    MemoryUsageReport clauses;   ///< Clauses, without their literals
+    MemoryUsageReport indexing;  ///< Substitution and code tree nodes
+    MemoryUsageReport passive;   ///< Clause queues of the passive container
+    MemoryUsageReport sat;       ///< Clauses of the SAT solvers
+    long peakTotalKB;            ///< Peak memory of the whole process
+};
+
+/**
+ * Report the memory used by the term bank, clauses, indices, passive
+ * container and SAT solvers, e.g. to decide which of them to limit
+ * before a proof runs out of memory. Also printed with the full statistics.
+ */
+MemoryReport memoryReport();
+
+// ===========================================
+// Prover Contexts
+// ===========================================
+
+/**
+ * An isolated prover state with its own Signature, TermSharing,
+ * Options, Statistics and InferenceStore.
+ *
+ * Every API function operates on the global environment. While a
+ * ContextScope for a context is alive, the global environment is
+ * switched to that context's state, so symbols, terms, clauses and
+ * proofs created inside the scope belong to the context and do not
+ * interfere with those of other contexts.
+ *
+ * Contexts may be used from different threads. The kernel still keeps
+ * process-wide state (the small object allocator, the global ordering
+ * and the static sort/term caches), so at most one context is active
+ * at a time: entering a scope blocks until no other thread has a
+ * context active.
+ *
+ * Contexts do not share a term bank. Every term of a context is built
+ * over the symbol numbers of its own Signature and carries an id that
+ * the kernel's caches take as unique, so a frozen base of axiom terms
+ * would need the signature and the id ranges layered as well. With one
+ * context active at a time, the memory of several loaded copies of a
+ * large axiom set is better saved by proving the queries in one context
+ * one after another, with the axioms loaded once.
+ */
+class VampireContext {
+public:
+    VampireContext();
+    ~VampireContext();
+
+    VampireContext(const VampireContext&) = delete;
+    VampireContext& operator=(const VampireContext&) = delete;
+
+    Options& options() { return *_options; }
+    Signature& signature() { return *_signature; }
+    Statistics& statistics() { return *_statistics; }
+
+    /** True if the global environment currently runs on this context */
+    bool isActive() const { return _depth > 0; }
+
+private:
+    friend class ContextScope;
+
+    Options* _options;
+    Signature* _signature;
+    Indexing::TermSharing* _sharing;
+    Statistics* _statistics;
+    InferenceStore* _inferenceStore;
+    InferenceLog* _inferenceLog;
+    /** receives the question answering answers of this context's proofs */
+    std::function<void(const std::string&)> _answerCallback;
+    Problem* _problem;
+    /** number of live ContextScope objects for this context */
+    unsigned _depth;
+};
+
+/**
+ * RAII guard that activates a VampireContext for the current thread.
+ * Scopes for the same context may be nested; the outermost one
+ * installs and finally restores the previous global state.
+ */
+class ContextScope {
+public:
+    explicit ContextScope(VampireContext& ctx);
+    ~ContextScope();
+
+    ContextScope(const ContextScope&) = delete;
+    ContextScope& operator=(const ContextScope&) = delete;
+
+private:
+    VampireContext& _ctx;
+
+    Options* _savedOptions;
+    Signature* _savedSignature;
+    Indexing::TermSharing* _savedSharing;
+    Statistics* _savedStatistics;
+    InferenceStore* _savedInferenceStore;
+    InferenceLog* _savedInferenceLog;
+    std::function<void(const std::string&)> _savedAnswerCallback;
+    Problem* _savedProblem;
+};
+
+/**
+ * Create a new prover context.
+ * The returned pointer must be released with destroyContext().
+ */
+VampireContext* createContext();
+
+/**
+ * Destroy a prover context and everything it owns.
+ * All terms, literals, clauses and problems created within the context
+ * become invalid. The context must not be active.
+ */
+void destroyContext(VampireContext* ctx);
+
+/**
+ * Run the prover on a problem built within the given context.
+ * Equivalent to entering a ContextScope, calling prepareForNextProof()
+ * and prove(prb).
+ * @param ctx The context the problem belongs to
+ * @param prb The problem to solve
+ * @return The proof result
+ */
+ProofResult prove(VampireContext& ctx, Problem* prb);
+
+// ===========================================
+// Asynchronous Proving
+// ===========================================
+
+/**
+ * Snapshot of a running proof search, passed to progress callbacks.
+ */
+struct ProofProgress {
+    unsigned activations;       // Clauses activated so far
+    unsigned activeClauses;     // Current size of the active set
+    unsigned passiveClauses;    // Current size of the passive set
+    long peakMemoryKB;          // Peak memory usage of the process
+    long elapsedMs;             // Time since the proof attempt started
+    // Time spent so far in the saturation phases, all 0 unless the
+    // phase_timing option is on; indexed by Shell::SaturationPhase
+    std::array<long, static_cast<unsigned>(Shell::SaturationPhase::COUNT)> phaseMs;
+};
+
+/**
+ * Progress callback. It runs on the prover thread, between two
+ * activations, and must not call back into the API.
+ */
+typedef std::function<void(const ProofProgress&)> ProgressCallback;
+
+/**
+ * A proof attempt running on its own thread (see proveAsync()).
+ *
+ * The global prover state is used by the task until it finishes, so
+ * no other API function may be called meanwhile, except on a different
+ * VampireContext. Destroying the task cancels it and waits for it.
+ */
+class ProofTask {
+public:
+    ~ProofTask();
+
+    ProofTask(const ProofTask&) = delete;
+    ProofTask& operator=(const ProofTask&) = delete;
+
+    /**
+     * Ask the prover to stop. The search stops after the current
+     * activation and the result becomes CANCELLED.
+     */
+    void cancel() { _cancelRequested = true; }
+
+    /**
+     * Wait for the task to finish.
+     * @param timeoutMs Maximum time to wait in milliseconds, negative to wait forever
+     * @return true if the task has finished
+     */
+    bool wait(long timeoutMs = -1);
+
+    /** True if the task has finished */
+    bool isDone() const;
+
+    /** The proof result; only meaningful once the task has finished */
+    ProofResult result() const { return _result; }
+
+private:
+    ProofTask(VampireContext* ctx, Problem* prb, ProgressCallback callback, unsigned interval);
+
+    friend ProofTask* proveAsync(Problem*, ProgressCallback, unsigned);
+    friend ProofTask* proveAsync(VampireContext&, Problem*, ProgressCallback, unsigned);
+
+    void run();
+    static bool onStep(void* task);
+
+    VampireContext* _ctx;
+    Problem* _problem;
+    ProgressCallback _callback;
+    /** activations between two callback invocations */
+    unsigned _interval;
+    /** activation count at the last callback invocation */
+    unsigned _lastReported;
+
+    std::atomic<bool> _cancelRequested;
+    ProofResult _result;
+    bool _done;
+    mutable std::mutex _mutex;
+    std::condition_variable _finished;
+    std::thread _thread;
+};
+
+/**
+ * Start proving a problem on a separate thread.
+ * Runs prepareForNextProof() and prove(prb) on that thread. The task
+ * keeps the global environment to itself like an active context: other
+ * threads entering a context, setting the answer callback or starting
+ * another such task wait until it finishes.
+ * @param prb The problem to solve
+ * @param callback Called every @b interval activations, may be empty
+ * @param interval Number of activations between callbacks (0 disables them)
+ * @return The running task, to be deleted by the caller
+ */
+ProofTask* proveAsync(Problem* prb, ProgressCallback callback = ProgressCallback(), unsigned interval = 0);
+
+/**
+ * Start proving a problem built within the given context on a separate
+ * thread. The context is entered on the prover thread.
+ */
+ProofTask* proveAsync(VampireContext& ctx, Problem* prb,
+                      ProgressCallback callback = ProgressCallback(), unsigned interval = 0);
+
+/**
+ * Answer callback for question answering. Receives each answer as the
+ * "% SZS answers Tuple" line printed for it, on the prover thread.
+ */
+typedef std::function<void(const std::string&)> AnswerCallback;
+
+/**
+ * Set the callback receiving the answers of question answering as they
+ * are found; with question_answering_answers other than 1, the search goes
+ * on after each answer. An empty callback restores printing to std::cout.
+ * Waits for a task started by proveAsync(prb) to finish first.
+ */
+void setAnswerCallback(AnswerCallback callback);
+
+/**
+ * Like setAnswerCallback(callback), for the proofs run on @b ctx.
+ * Waits while another thread has a context or the global environment
+ * active.
+ * Each context has its own callback, installed while it is active.
+ */
+void setAnswerCallback(VampireContext& ctx, AnswerCallback callback);
+
 // ===========================================
 // Symbol Registration
 // ===========================================
@@ -111,6 +413,30 @@ unsigned addFunction(const std::string& name, unsigned arity);
  */
 unsigned addPredicate(const std::string& name, unsigned arity);
 
+/**
+ * Intern a symbol name. Registering many symbols of the same name by the
+ * returned atom avoids hashing the name every time.
+ * @param name Symbol name
+ * @return atom for addFunctionByAtom and addPredicateByAtom
+ */
+unsigned internName(const std::string& name);
+
+/**
+ * Register a function symbol with the name of an atom from internName.
+ * @param atom Atom of the symbol name
+ * @param arity Number of arguments
+ * @return functor index for use in term construction
+ */
+unsigned addFunctionByAtom(unsigned atom, unsigned arity);
+
+/**
+ * Register a predicate symbol with the name of an atom from internName.
+ * @param atom Atom of the symbol name
+ * @param arity Number of arguments
+ * @return predicate index for use in literal construction
+ */
+unsigned addPredicateByAtom(unsigned atom, unsigned arity);
+
 // ===========================================
 // Term Construction
 // ===========================================
@@ -334,6 +660,52 @@ Clause* clause(std::initializer_list<Literal*> literals, UnitInputType inputType
  */
 Clause* clause(const std::vector<Literal*>& literals, UnitInputType inputType);
 
+// ===========================================
+// Bulk Construction
+// ===========================================
+
+/**
+ * Tag of an entry of a flat prefix encoding, modeled on Kernel::FlatTerm.
+ */
+enum class FlatTag : unsigned {
+    VAR = 0,      // Variable, value is its index
+    FUN = 1,      // Function application, value is the functor; followed by its arguments
+    POS_LIT = 2,  // Positive literal, value is the predicate; followed by its arguments
+    NEG_LIT = 3,  // Negative literal, as POS_LIT
+    CLAUSE = 4    // Clause, value is the number of literals that follow
+};
+
+/**
+ * Entry of a flat prefix encoding. Arities are taken from the signature;
+ * an equality literal (predicate 0) has two arguments of the default sort.
+ */
+struct FlatEntry {
+    FlatTag tag;
+    unsigned value;
+};
+
+/**
+ * Build a sequence of terms from their flat prefix encoding in one pass.
+ * @param entries The encoding (VAR and FUN entries only)
+ * @param count Number of entries
+ * @param out Receives the terms, in order
+ * @return false if the encoding is malformed (out then holds the terms
+ *         decoded before the error)
+ */
+bool termsFromFlat(const FlatEntry* entries, size_t count, std::vector<TermList>& out);
+
+/**
+ * Build a sequence of clauses from their flat prefix encoding in one pass.
+ * Each clause is a CLAUSE entry followed by the given number of literals.
+ * @param entries The encoding
+ * @param count Number of entries
+ * @param inputType Input type of the clauses
+ * @param out Receives the clauses, in order
+ * @return false if the encoding is malformed (see termsFromFlat())
+ */
+bool clausesFromFlat(const FlatEntry* entries, size_t count, UnitInputType inputType,
+                     std::vector<Clause*>& out);
+
 // ===========================================
 // Problem and Proving
 // ===========================================
@@ -368,6 +740,26 @@ Problem* problem(std::initializer_list<Unit*> units);
  */
 Problem* problem(const std::vector<Unit*>& units);
 
+/**
+ * Parse a problem in TPTP syntax.
+ * The text is read in place from the caller's buffer, which only needs
+ * to stay valid during the call. Symbols are added to the signature.
+ * include() directives are resolved against the include option.
+ * @param text The TPTP input
+ * @param error If not null, receives the parser's message on failure
+ * @return Pointer to the problem, or nullptr if the input could not be parsed
+ */
+Problem* problemFromTPTP(std::string_view text, std::string* error = nullptr);
+
+/**
+ * Parse a problem in SMT-LIB 2 syntax (see problemFromTPTP()).
+ * The logic set by the input is recorded in the problem.
+ * @param text The SMT-LIB 2 input
+ * @param error If not null, receives the parser's message on failure
+ * @return Pointer to the problem, or nullptr if the input could not be parsed
+ */
+Problem* problemFromSMTLIB2(std::string_view text, std::string* error = nullptr);
+
 /**
  * Run the prover on a problem.
  * Results are stored in statistics().
@@ -376,6 +768,165 @@ Problem* problem(const std::vector<Unit*>& units);
  */
 ProofResult prove(Problem* prb);
 
+/**
+ * Run the prover on a sequence of problems.
+ * Compared to a reset() before every problem, the signature, the term
+ * sharing and the timer are kept, and every problem only pays for the
+ * light reset done by prepareForNextProof(), so the time limit applies
+ * to each problem separately. Symbols are shared by all problems of the
+ * batch. The ordering and the indices depend on the problem and are built
+ * for each one.
+ *
+ * Every problem is proved with the options current at the call, not with
+ * those the proof of the previous problem resolved its auto values to.
+ *
+ * Only the result of the last problem's proof is kept in statistics(),
+ * so getRefutation() returns the refutation of the last problem.
+ * @param problems The problems to solve, in order
+ * @return The proof result of each problem, in the same order
+ */
+std::vector<ProofResult> proveBatch(const std::vector<Problem*>& problems);
+
+/**
+ * Run a strategy portfolio on a problem within this process.
+ *
+ * The strategies of the schedule selected by the schedule option (see
+ * CASC/Schedules.cpp) are tried one after another, each with its own
+ * slice time, until one of them gives a definitive answer (PROOF or
+ * SATISFIABLE) or the overall time limit of the current options runs
+ * out. Every slice preprocesses a fresh copy of the problem's unit list;
+ * the parsed input units themselves are shared between slices.
+ * The options are restored after the run.
+ *
+ * Slices run sequentially: the prover state is process-wide, so they
+ * cannot run on concurrent threads.
+ * @param prb The problem to solve (not modified)
+ * @param maxSlices Maximum number of strategies to try, 0 for the whole schedule
+ * @param strategy If not null, receives the strategy that gave the definitive
+ *        answer (cleared if no strategy did)
+ * @return The definitive result, or the result of the last slice tried
+ */
+ProofResult provePortfolio(Problem* prb, unsigned maxSlices = 0, std::string* strategy = nullptr);
+
+/**
+ * A fixed set of axioms queried with many different conjectures.
+ *
+ * The axioms are clausified once, on the first query after they were
+ * added. Every query then only clausifies its own conjecture units and
+ * runs the remaining preprocessing and saturation on the combined
+ * clause set, so the clausification cost of the theory is paid once.
+ *
+ * Each query works on fresh copies of the axiom clauses, so the
+ * saturation state of one query never leaks into the next.
+ *
+ * With sine_selection=axioms, the SInE trigger relation of the axiom
+ * clauses is likewise built once, and each query only walks it from the
+ * symbols of its conjecture; only the selected axioms are copied.
+ *
+ * push() and pop() scope the axioms like SMT-LIB assertion levels, so an
+ * incremental script can be replayed on one session, each check-sat
+ * being a prove() with no conjecture units.
+ *
+ * A session is also the prepared form of a problem for running several
+ * strategies on it: add the problem's units as axioms and call prove()
+ * with a strategy per lane. The input is clausified once, with the
+ * options current at the first query, and every lane runs the rest of the
+ * preprocessing and the saturation on its own copies of the clauses.
+ */
+class ProvingSession {
+public:
+    ProvingSession();
+    ~ProvingSession();
+
+    ProvingSession(const ProvingSession&) = delete;
+    ProvingSession& operator=(const ProvingSession&) = delete;
+
+    /** Add an axiom (clause or formula unit) to the session */
+    void addAxiom(Unit* u);
+
+    /** Add several axioms to the session */
+    void addAxioms(const std::vector<Unit*>& units);
+
+    /**
+     * Prove the conjecture units (e.g. from conjectureF()) together with
+     * the session's axioms. Runs prepareForNextProof() first.
+     * @param conjecture The query-specific units
+     * @return The proof result
+     */
+    ProofResult prove(const std::vector<Unit*>& conjecture);
+
+    /**
+     * Like prove(conjecture), but with the options changed by @b strategy,
+     * a strategy code as in the schedules of CASC/Schedules.cpp (whose
+     * time limit is used). The options are restored afterwards. Options
+     * of the clausification done by an earlier query are not redone.
+     * @return The proof result, UNKNOWN if the strategy code is not valid
+     */
+    ProofResult prove(const std::vector<Unit*>& conjecture, const std::string& strategy);
+
+    /**
+     * Write the session's clausified axioms, with the symbols they use, to
+     * @b out so that a later process can skip parsing and clausification.
+     * Clausifies pending axioms first.
+     * @return false if an axiom could not be clausified or a symbol is not
+     *         default-sorted (nothing is written in that case)
+     */
+    bool saveSnapshot(std::ostream& out);
+
+    /**
+     * Add the axioms of a snapshot written by saveSnapshot() to the session.
+     * Symbols are matched by name and arity; Skolem and other introduced
+     * symbols are renamed afresh.
+     * @return false if the snapshot is malformed or a symbol clashes with an
+     *         existing non-default-sorted one. No axioms are added then;
+     *         the signature is only changed if the snapshot is complete
+     *         and its clauses do not match the arities of its symbols
+     */
+    bool loadSnapshot(std::istream& in);
+
+    /** Number of clauses the axioms were clausified into (so far) */
+    size_t clauseCount() const { return _clauses.size(); }
+
+    /**
+     * Open an assertion level, as SMT-LIB's (push 1). Axioms added from
+     * now on are retracted by the matching pop(). Clausifies pending
+     * axioms first, so that those stay in the outer level.
+     */
+    void push();
+
+    /**
+     * Retract the axioms added since the matching push(), as SMT-LIB's
+     * (pop 1). The symbols they introduced stay in the signature.
+     * @return false if no level is open (nothing is retracted)
+     */
+    bool pop();
+
+private:
+    void clausifyPending();
+    /** Push the units the session refers to onto @b roots */
+    void collectRoots(Stack<Unit*>& roots) const;
+
+    friend size_t collectGarbage(const std::vector<Problem*>& keep, const std::vector<Unit*>& keepUnits);
+
+    /** axioms added since the last query */
+    std::vector<Unit*> _pending;
+    /** clausified axioms */
+    std::vector<Clause*> _clauses;
+    /** problem of the last query (its units may be referenced by the refutation) */
+    std::unique_ptr<Problem> _problem;
+    /** SInE selection structure over _clauses, built on demand */
+    std::unique_ptr<Shell::SineTheorySelector> _sine;
+
+    /** what the session held when an assertion level was opened */
+    struct Level {
+        /** units that could not be clausified (already processed) */
+        std::vector<Unit*> pending;
+        size_t clauses;
+    };
+    /** open assertion levels, innermost last */
+    std::vector<Level> _levels;
+};
+
 /**
  * Get the refutation (proof) after a successful prove().
  * @return The empty clause with inference chain, or nullptr if no proof
@@ -429,6 +980,59 @@ struct ProofStep {
  */
 std::vector<ProofStep> extractProof(Unit* refutation);
 
+/**
+ * Iterator over the steps of a proof in topological order (premises
+ * before conclusions), computed lazily by a depth-first traversal of
+ * the inference DAG. Unlike extractProof(), no array of steps is built;
+ * the iterator only keeps the traversal state.
+ *
+ *   ProofIterator it(getRefutation());
+ *   while (it.next()) { ... it.unit() ... it.premiseIds() ... }
+ */
+class ProofIterator {
+public:
+    explicit ProofIterator(Unit* refutation);
+
+    /** Advance to the next step; false once the proof is exhausted */
+    bool next();
+
+    /** The current step's unit */
+    Unit* unit() const { return _current; }
+    unsigned id() const { return _current->number(); }
+    InferenceRule rule() const { return _current->inference().rule(); }
+    UnitInputType inputType() const { return _current->inference().inputType(); }
+    /** Premise ids of the current step; valid until the next call to next() */
+    const std::vector<unsigned>& premiseIds() const { return _premiseIds; }
+
+private:
+    /** units whose premises are being visited, with a flag "premises pushed" */
+    Stack<std::pair<Unit*, bool>> _todo;
+    DHSet<unsigned> _visited;
+    Unit* _current;
+    std::vector<unsigned> _premiseIds;
+};
+
+/**
+ * Append the flat prefix encoding of a clause (see FlatEntry) to @b out;
+ * clausesFromFlat() reads it back.
+ */
+void clauseToFlat(Clause* c, std::vector<FlatEntry>& out);
+
+/**
+ * Write a proof in a compact binary form, step by step in the order of
+ * ProofIterator, without materializing it. All numbers are unsigned
+ * LEB128 varints. Each step is
+ *
+ *   id rule inputType premiseCount premiseId* kind [entryCount (tag value)*]
+ *
+ * where rule and inputType are the enum values, kind is 1 for a clause
+ * (followed by its clauseToFlat() encoding) and 0 for a formula unit
+ * (no body).
+ * @param refutation The refutation from getRefutation()
+ * @param out The stream to write to
+ */
+void writeProofBinary(Unit* refutation, std::ostream& out);
+
 /**
  * Get the literals of a clause as a vector.
  * @param c The clause
@@ -17,6 +17,7 @@
 #include "vampire_c_api.h"
 #include "VampireAPI.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <functional>
@@ -30,6 +31,10 @@
 #define TO_UNIT(u) (reinterpret_cast<Kernel::Unit*>(u))
 #define TO_CLAUSE(c) (reinterpret_cast<Kernel::Clause*>(c))
 #define TO_PROBLEM(p) (reinterpret_cast<Kernel::Problem*>(p))
+#define TO_CONTEXT(c) (reinterpret_cast<Api::VampireContext*>(c))
+#define TO_SESSION(s) (reinterpret_cast<Api::ProvingSession*>(s))
+#define TO_TASK(t) (reinterpret_cast<Api::ProofTask*>(t))
+#define TO_PROOF_ITER(i) (reinterpret_cast<Api::ProofIterator*>(i))
 
 #define FROM_TERM(t) (reinterpret_cast<vampire_term_t*>(new Kernel::TermList(t)))
 #define FROM_LITERAL(l) (reinterpret_cast<vampire_literal_t*>(l))
@@ -37,6 +42,10 @@
 #define FROM_UNIT(u) (reinterpret_cast<vampire_unit_t*>(u))
 #define FROM_CLAUSE(c) (reinterpret_cast<vampire_clause_t*>(c))
 #define FROM_PROBLEM(p) (reinterpret_cast<vampire_problem_t*>(p))
+#define FROM_CONTEXT(c) (reinterpret_cast<vampire_context_t*>(c))
+#define FROM_SESSION(s) (reinterpret_cast<vampire_session_t*>(s))
+#define FROM_TASK(t) (reinterpret_cast<vampire_proof_task_t*>(t))
+#define FROM_PROOF_ITER(i) (reinterpret_cast<vampire_proof_iter_t*>(i))
 
 // Helper: structural equality for Formula (formulas are not hash-consed)
 static bool formulaEqual(const Kernel::Formula* a, const Kernel::Formula* b) {
@@ -135,6 +144,9 @@ static size_t formulaHash(const Kernel::Formula* f) {
     return h;
 }
 
+// Scopes opened by vampire_context_enter() on the current thread
+static thread_local std::vector<Api::ContextScope*> enteredContexts;
+
 extern "C" {
 
 /* ===========================================
@@ -149,6 +161,60 @@ void vampire_reset(void) {
     Api::reset();
 }
 
+size_t vampire_release_memory(void) {
+    return Api::releaseMemory();
+}
+
+size_t vampire_collect_garbage(vampire_problem_t** keep, size_t count) {
+    std::vector<Kernel::Problem*> problems;
+    for (size_t i = 0; i < count; i++) {
+        problems.push_back(TO_PROBLEM(keep[i]));
+    }
+    return Api::collectGarbage(problems);
+}
+
+static vampire_memory_usage_t to_c_usage(const Api::MemoryUsageReport& usage) {
+    vampire_memory_usage_t result;
+    result.live_bytes = usage.liveBytes;
+    result.peak_bytes = usage.peakBytes;
+    return result;
+}
+
+void vampire_memory_report(vampire_memory_report_t* out) {
+    Api::MemoryReport report = Api::memoryReport();
+    out->terms = to_c_usage(report.terms);
+    out->clauses = to_c_usage(report.clauses);
+    out->indexing = to_c_usage(report.indexing);
+    out->passive = to_c_usage(report.passive);
+    out->sat = to_c_usage(report.sat);
+    out->peak_total_kb = report.peakTotalKB;
+}
+
+/* ===========================================
+ * Prover Contexts
+ * =========================================== */
+
+vampire_context_t* vampire_context_new(void) {
+    return FROM_CONTEXT(Api::createContext());
+}
+
+void vampire_context_free(vampire_context_t* ctx) {
+    Api::destroyContext(TO_CONTEXT(ctx));
+}
+
+void vampire_context_enter(vampire_context_t* ctx) {
+    enteredContexts.push_back(new Api::ContextScope(*TO_CONTEXT(ctx)));
+}
+
+int vampire_context_leave(void) {
+    if (enteredContexts.empty()) {
+        return -1;
+    }
+    delete enteredContexts.back();
+    enteredContexts.pop_back();
+    return 0;
+}
+
 /* ===========================================
  * Options Configuration
  * =========================================== */
@@ -177,6 +243,10 @@ void vampire_set_saturation_algorithm(const char* algorithm) {
     Api::options().set("saturation_algorithm", algorithm);
 }
 
+void vampire_set_schedule(const char* schedule) {
+    Api::options().set("schedule", schedule);
+}
+
 /* ===========================================
  * Symbol Registration
  * =========================================== */
@@ -189,6 +259,18 @@ unsigned int vampire_add_predicate(const char* name, unsigned int arity) {
     return Api::addPredicate(std::string(name), arity);
 }
 
+unsigned int vampire_intern_name(const char* name) {
+    return Api::internName(std::string(name));
+}
+
+unsigned int vampire_add_function_atom(unsigned int atom, unsigned int arity) {
+    return Api::addFunctionByAtom(atom, arity);
+}
+
+unsigned int vampire_add_predicate_atom(unsigned int atom, unsigned int arity) {
+    return Api::addPredicateByAtom(atom, arity);
+}
+
 /* ===========================================
  * Term Construction
  * =========================================== */
@@ -316,6 +398,19 @@ vampire_clause_t* vampire_conjecture_clause(vampire_literal_t** literals, size_t
     return FROM_CLAUSE(Api::conjecture(cpp_literals));
 }
 
+static Kernel::UnitInputType to_input_type(vampire_input_type_t input_type) {
+    switch (input_type) {
+        case VAMPIRE_AXIOM:
+            return Kernel::UnitInputType::AXIOM;
+        case VAMPIRE_NEGATED_CONJECTURE:
+            return Kernel::UnitInputType::NEGATED_CONJECTURE;
+        case VAMPIRE_CONJECTURE:
+            return Kernel::UnitInputType::CONJECTURE;
+        default:
+            return Kernel::UnitInputType::AXIOM;
+    }
+}
+
 vampire_clause_t* vampire_clause(vampire_literal_t** literals, size_t count,
                                   vampire_input_type_t input_type) {
     std::vector<Kernel::Literal*> cpp_literals;
@@ -324,23 +419,48 @@ vampire_clause_t* vampire_clause(vampire_literal_t** literals, size_t count,
         cpp_literals.push_back(TO_LITERAL(literals[i]));
     }
 
-    Kernel::UnitInputType cpp_input_type;
-    switch (input_type) {
-        case VAMPIRE_AXIOM:
-            cpp_input_type = Kernel::UnitInputType::AXIOM;
-            break;
-        case VAMPIRE_NEGATED_CONJECTURE:
-            cpp_input_type = Kernel::UnitInputType::NEGATED_CONJECTURE;
-            break;
-        case VAMPIRE_CONJECTURE:
-            cpp_input_type = Kernel::UnitInputType::CONJECTURE;
-            break;
-        default:
-            cpp_input_type = Kernel::UnitInputType::AXIOM;
-            break;
+    return FROM_CLAUSE(Api::clause(cpp_literals, to_input_type(input_type)));
+}
+
+/* ===========================================
+ * Bulk Construction
+ * =========================================== */
+
+static_assert(sizeof(vampire_flat_entry_t) == sizeof(Api::FlatEntry),
+              "the C and C++ flat entries must have the same layout");
+
+#define TO_FLAT(e) (reinterpret_cast<const Api::FlatEntry*>(e))
+
+int vampire_terms_from_flat(const vampire_flat_entry_t* entries, size_t count,
+                            vampire_term_t** out_terms, size_t capacity, size_t* out_count) {
+    std::vector<Kernel::TermList> terms;
+    if (!Api::termsFromFlat(TO_FLAT(entries), count, terms) || terms.size() > capacity) {
+        return -1;
+    }
+    for (size_t i = 0; i < terms.size(); i++) {
+        out_terms[i] = FROM_TERM(terms[i]);
+    }
+    if (out_count) {
+        *out_count = terms.size();
     }
+    return 0;
+}
 
-    return FROM_CLAUSE(Api::clause(cpp_literals, cpp_input_type));
+int vampire_clauses_from_flat(const vampire_flat_entry_t* entries, size_t count,
+                              vampire_input_type_t input_type,
+                              vampire_clause_t** out_clauses, size_t capacity, size_t* out_count) {
+    std::vector<Kernel::Clause*> clauses;
+    if (!Api::clausesFromFlat(TO_FLAT(entries), count, to_input_type(input_type), clauses)
+        || clauses.size() > capacity) {
+        return -1;
+    }
+    for (size_t i = 0; i < clauses.size(); i++) {
+        out_clauses[i] = FROM_CLAUSE(clauses[i]);
+    }
+    if (out_count) {
+        *out_count = clauses.size();
+    }
+    return 0;
 }
 
 /* ===========================================
@@ -365,9 +485,15 @@ vampire_problem_t* vampire_problem_from_units(vampire_unit_t** units, size_t cou
     return FROM_PROBLEM(Api::problem(cpp_units));
 }
 
-vampire_proof_result_t vampire_prove(vampire_problem_t* problem) {
-    Api::ProofResult result = Api::prove(TO_PROBLEM(problem));
+vampire_problem_t* vampire_parse_tptp(const char* text, size_t length) {
+    return FROM_PROBLEM(Api::problemFromTPTP(std::string_view(text, length)));
+}
+
+vampire_problem_t* vampire_parse_smtlib2(const char* text, size_t length) {
+    return FROM_PROBLEM(Api::problemFromSMTLIB2(std::string_view(text, length)));
+}
 
+static vampire_proof_result_t convert_proof_result(Api::ProofResult result) {
     switch (result) {
         case Api::ProofResult::PROOF:
             return VAMPIRE_PROOF;
@@ -379,11 +505,155 @@ vampire_proof_result_t vampire_prove(vampire_problem_t* problem) {
             return VAMPIRE_MEMORY_LIMIT;
         case Api::ProofResult::INCOMPLETE:
             return VAMPIRE_INCOMPLETE;
+        case Api::ProofResult::CANCELLED:
+            return VAMPIRE_CANCELLED;
         default:
             return VAMPIRE_UNKNOWN;
     }
 }
 
+vampire_proof_result_t vampire_prove(vampire_problem_t* problem) {
+    return convert_proof_result(Api::prove(TO_PROBLEM(problem)));
+}
+
+int vampire_prove_batch(vampire_problem_t** problems, size_t count,
+                        vampire_proof_result_t* out_results) {
+    if ((!problems || !out_results) && count > 0) {
+        return -1;
+    }
+
+    std::vector<Kernel::Problem*> cpp_problems;
+    cpp_problems.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        cpp_problems.push_back(TO_PROBLEM(problems[i]));
+    }
+
+    std::vector<Api::ProofResult> results = Api::proveBatch(cpp_problems);
+    for (size_t i = 0; i < results.size(); i++) {
+        out_results[i] = convert_proof_result(results[i]);
+    }
+    return 0;
+}
+
+/** strategy of the last vampire_prove_portfolio() of this thread that answered */
+static thread_local std::string portfolioStrategy;
+
+vampire_proof_result_t vampire_prove_portfolio(vampire_problem_t* problem,
+                                               unsigned max_slices) {
+    return convert_proof_result(Api::provePortfolio(TO_PROBLEM(problem), max_slices, &portfolioStrategy));
+}
+
+const char* vampire_portfolio_strategy(void) {
+    return portfolioStrategy.c_str();
+}
+
+vampire_session_t* vampire_session_new(void) {
+    return FROM_SESSION(new Api::ProvingSession());
+}
+
+void vampire_session_free(vampire_session_t* session) {
+    delete TO_SESSION(session);
+}
+
+void vampire_session_add_axioms(vampire_session_t* session,
+                                vampire_unit_t** units, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        TO_SESSION(session)->addAxiom(TO_UNIT(units[i]));
+    }
+}
+
+vampire_proof_result_t vampire_session_prove(vampire_session_t* session,
+                                             vampire_unit_t** units, size_t count) {
+    std::vector<Kernel::Unit*> cpp_units;
+    cpp_units.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        cpp_units.push_back(TO_UNIT(units[i]));
+    }
+    return convert_proof_result(TO_SESSION(session)->prove(cpp_units));
+}
+
+vampire_proof_result_t vampire_session_prove_strategy(vampire_session_t* session,
+                                                      vampire_unit_t** units, size_t count,
+                                                      const char* strategy) {
+    std::vector<Kernel::Unit*> cpp_units;
+    cpp_units.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        cpp_units.push_back(TO_UNIT(units[i]));
+    }
+    return convert_proof_result(TO_SESSION(session)->prove(cpp_units, strategy));
+}
+
+vampire_proof_result_t vampire_prove_in_context(vampire_context_t* ctx,
+                                                vampire_problem_t* problem) {
+    Api::ContextScope scope(*TO_CONTEXT(ctx));
+    Api::prepareForNextProof();
+    return vampire_prove(problem);
+}
+
+static Api::ProgressCallback wrap_progress_callback(vampire_progress_callback_t callback,
+                                                   void* user_data) {
+    if (!callback) {
+        return Api::ProgressCallback();
+    }
+    return [callback, user_data](const Api::ProofProgress& p) {
+        vampire_progress_t progress;
+        progress.activations = p.activations;
+        progress.active_clauses = p.activeClauses;
+        progress.passive_clauses = p.passiveClauses;
+        progress.peak_memory_kb = p.peakMemoryKB;
+        progress.elapsed_ms = p.elapsedMs;
+        static_assert(VAMPIRE_SATURATION_PHASES == std::tuple_size<decltype(p.phaseMs)>::value);
+        for (unsigned i = 0; i < VAMPIRE_SATURATION_PHASES; i++) {
+            progress.phase_ms[i] = p.phaseMs[i];
+        }
+        callback(&progress, user_data);
+    };
+}
+
+vampire_proof_task_t* vampire_prove_async(vampire_problem_t* problem,
+                                          vampire_progress_callback_t callback,
+                                          unsigned every_n, void* user_data) {
+    return FROM_TASK(Api::proveAsync(TO_PROBLEM(problem),
+                                     wrap_progress_callback(callback, user_data), every_n));
+}
+
+vampire_proof_task_t* vampire_prove_async_in_context(vampire_context_t* ctx,
+                                                     vampire_problem_t* problem,
+                                                     vampire_progress_callback_t callback,
+                                                     unsigned every_n, void* user_data) {
+    return FROM_TASK(Api::proveAsync(*TO_CONTEXT(ctx), TO_PROBLEM(problem),
+                                     wrap_progress_callback(callback, user_data), every_n));
+}
+
+void vampire_cancel(vampire_proof_task_t* task) {
+    TO_TASK(task)->cancel();
+}
+
+int vampire_wait(vampire_proof_task_t* task, long timeout_ms,
+                 vampire_proof_result_t* out_result) {
+    if (!TO_TASK(task)->wait(timeout_ms)) {
+        return 1;
+    }
+    if (out_result) {
+        *out_result = convert_proof_result(TO_TASK(task)->result());
+    }
+    return 0;
+}
+
+void vampire_proof_task_free(vampire_proof_task_t* task) {
+    delete TO_TASK(task);
+}
+
+void vampire_set_answer_callback(vampire_answer_callback_t callback, void* user_data) {
+    if (!callback) {
+        Api::setAnswerCallback(Api::AnswerCallback());
+        return;
+    }
+    Api::setAnswerCallback([callback, user_data](const std::string& answer) {
+        callback(answer.c_str(), user_data);
+    });
+}
+
 vampire_unit_t* vampire_get_refutation(void) {
     return FROM_UNIT(Api::getRefutation());
 }
@@ -481,6 +751,111 @@ void vampire_free_proof_steps(vampire_proof_step_t* steps, size_t count) {
     free(steps);
 }
 
+vampire_proof_iter_t* vampire_proof_iter_new(vampire_unit_t* refutation) {
+    return FROM_PROOF_ITER(new Api::ProofIterator(TO_UNIT(refutation)));
+}
+
+bool vampire_proof_iter_next(vampire_proof_iter_t* iter, vampire_proof_step_t* out_step) {
+    Api::ProofIterator* it = TO_PROOF_ITER(iter);
+    if (!it->next()) {
+        return false;
+    }
+    out_step->id = it->id();
+    out_step->rule = static_cast<vampire_inference_rule_t>(static_cast<unsigned char>(it->rule()));
+    out_step->input_type = convert_input_type(it->inputType());
+    out_step->unit = FROM_UNIT(it->unit());
+    out_step->premise_count = it->premiseIds().size();
+    // points into the iterator's buffer, see vampire_proof_iter_next()
+    out_step->premise_ids = const_cast<unsigned int*>(it->premiseIds().data());
+    return true;
+}
+
+void vampire_proof_iter_free(vampire_proof_iter_t* iter) {
+    delete TO_PROOF_ITER(iter);
+}
+
+/**
+ * Output stream buffer handing consecutive chunks to a C callback.
+ */
+class CallbackOutputBuffer : public std::streambuf {
+public:
+    CallbackOutputBuffer(vampire_write_callback_t write, void* user_data)
+        : _write(write), _userData(user_data), _failed(false) {
+        setp(_buffer, _buffer + sizeof(_buffer));
+    }
+
+    bool failed() const { return _failed; }
+
+protected:
+    int overflow(int c) override {
+        if (sync() != 0) {
+            return traits_type::eof();
+        }
+        if (c != traits_type::eof()) {
+            *pptr() = static_cast<char>(c);
+            pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    int sync() override {
+        size_t n = pptr() - pbase();
+        if (n && !_failed && _write(pbase(), n, _userData) != 0) {
+            _failed = true;
+        }
+        setp(_buffer, _buffer + sizeof(_buffer));
+        return _failed ? -1 : 0;
+    }
+
+private:
+    vampire_write_callback_t _write;
+    void* _userData;
+    bool _failed;
+    char _buffer[4096];
+};
+
+int vampire_write_proof_binary(vampire_unit_t* refutation,
+                               vampire_write_callback_t write, void* user_data) {
+    CallbackOutputBuffer buffer(write, user_data);
+    std::ostream out(&buffer);
+    Api::writeProofBinary(TO_UNIT(refutation), out);
+    out.flush();
+    return buffer.failed() ? -1 : 0;
+}
+
+int vampire_session_save_snapshot(vampire_session_t* session,
+                                  vampire_write_callback_t write, void* user_data) {
+    CallbackOutputBuffer buffer(write, user_data);
+    std::ostream out(&buffer);
+    bool written = TO_SESSION(session)->saveSnapshot(out);
+    out.flush();
+    return written && !buffer.failed() ? 0 : -1;
+}
+
+/** Read-only stream buffer over memory owned by the caller */
+class MemoryInputBuffer : public std::streambuf {
+public:
+    MemoryInputBuffer(const void* data, size_t size) {
+        char* begin = const_cast<char*>(static_cast<const char*>(data));
+        setg(begin, begin, begin + size);
+    }
+};
+
+int vampire_session_load_snapshot(vampire_session_t* session,
+                                  const void* data, size_t size) {
+    MemoryInputBuffer buffer(data, size);
+    std::istream in(&buffer);
+    return TO_SESSION(session)->loadSnapshot(in) ? 0 : -1;
+}
+
+int vampire_write_statistics_json(vampire_write_callback_t write, void* user_data) {
+    CallbackOutputBuffer buffer(write, user_data);
+    std::ostream out(&buffer);
+    Api::statistics().printJson(out);
+    out.flush();
+    return buffer.failed() ? -1 : 0;
+}
+
 int vampire_get_literals(vampire_clause_t* clause,
                          vampire_literal_t*** out_literals,
                          size_t* out_count) {
@@ -540,10 +915,120 @@ bool vampire_clause_is_empty(vampire_clause_t* clause) {
     return TO_CLAUSE(clause)->isEmpty();
 }
 
+/* ===========================================
+ * Term Ids
+ * =========================================== */
+
+static Kernel::TermList term_of_id(vampire_term_id_t id) {
+    Kernel::TermList t;
+    t.setContent(id);
+    return t;
+}
+
+vampire_term_id_t vampire_var_id(unsigned int index) {
+    return Api::var(index).content();
+}
+
+vampire_term_id_t vampire_term_id(unsigned int functor, const vampire_term_id_t* args,
+                                  size_t arg_count) {
+    static_assert(sizeof(vampire_term_id_t) == sizeof(Kernel::TermList),
+                  "a term id must be the content of a TermList");
+    if (arg_count == 0) {
+        return Api::constant(functor).content();
+    }
+    return Kernel::TermList(Kernel::Term::create(functor, arg_count,
+        reinterpret_cast<const Kernel::TermList*>(args))).content();
+}
+
+vampire_term_id_t vampire_term_get_id(vampire_term_t* term) {
+    return TO_TERM(term).content();
+}
+
+vampire_term_t* vampire_term_from_id(vampire_term_id_t id) {
+    return FROM_TERM(term_of_id(id));
+}
+
+bool vampire_id_is_var(vampire_term_id_t id) {
+    return term_of_id(id).isVar();
+}
+
+unsigned int vampire_id_var_index(vampire_term_id_t id) {
+    return term_of_id(id).var();
+}
+
+unsigned int vampire_id_functor(vampire_term_id_t id) {
+    return term_of_id(id).term()->functor();
+}
+
+unsigned int vampire_id_arity(vampire_term_id_t id) {
+    return term_of_id(id).term()->arity();
+}
+
+vampire_term_id_t vampire_id_arg(vampire_term_id_t id, unsigned int n) {
+    return term_of_id(id).term()->nthArgument(n)->content();
+}
+
+vampire_literal_t* vampire_lit_from_ids(unsigned int pred, bool positive,
+                                        const vampire_term_id_t* args, size_t arg_count) {
+    // Literal::create does not modify the arguments
+    return FROM_LITERAL(Kernel::Literal::create(pred, arg_count, positive,
+        const_cast<Kernel::TermList*>(reinterpret_cast<const Kernel::TermList*>(args))));
+}
+
+vampire_literal_t* vampire_eq_from_ids(bool positive, vampire_term_id_t lhs, vampire_term_id_t rhs) {
+    return FROM_LITERAL(Api::eq(positive, term_of_id(lhs), term_of_id(rhs)));
+}
+
+unsigned int vampire_literal_predicate(vampire_literal_t* literal) {
+    return TO_LITERAL(literal)->functor();
+}
+
+bool vampire_literal_is_positive(vampire_literal_t* literal) {
+    return TO_LITERAL(literal)->isPositive();
+}
+
+unsigned int vampire_literal_arity(vampire_literal_t* literal) {
+    return TO_LITERAL(literal)->arity();
+}
+
+vampire_term_id_t vampire_literal_arg(vampire_literal_t* literal, unsigned int n) {
+    return TO_LITERAL(literal)->nthArgument(n)->content();
+}
+
+size_t vampire_clause_length(vampire_clause_t* clause) {
+    return TO_CLAUSE(clause)->length();
+}
+
+vampire_literal_t* vampire_clause_literal(vampire_clause_t* clause, size_t n) {
+    return FROM_LITERAL((*TO_CLAUSE(clause))[n]);
+}
+
 /* ===========================================
  * String Conversions
  * =========================================== */
 
+/** Copy @b str into a caller buffer with snprintf semantics */
+static size_t write_string(const std::string& str, char* buffer, size_t size) {
+    if (size > 0) {
+        size_t n = std::min(str.length(), size - 1);
+        std::memcpy(buffer, str.data(), n);
+        buffer[n] = '\0';
+    }
+    return str.length();
+}
+
+size_t vampire_term_id_write_string(vampire_term_id_t id, char* buffer, size_t size) {
+    return write_string(Api::termToString(term_of_id(id)), buffer, size);
+}
+
+size_t vampire_literal_write_string(vampire_literal_t* literal, char* buffer, size_t size) {
+    return write_string(Api::literalToString(TO_LITERAL(literal)), buffer, size);
+}
+
+size_t vampire_clause_write_string(vampire_clause_t* clause, char* buffer, size_t size) {
+    return write_string(Api::clauseToString(TO_CLAUSE(clause)), buffer, size);
+}
+
 char* vampire_term_to_string(vampire_term_t* term) {
     if (!term) {
         return nullptr;
@@ -51,6 +51,18 @@ typedef struct vampire_clause_t vampire_clause_t;
 /** Opaque handle to a problem */
 typedef struct vampire_problem_t vampire_problem_t;
 
+/** Opaque handle to a proving session (fixed axioms, many queries) */
+typedef struct vampire_session_t vampire_session_t;
+
+/** Opaque handle to an isolated prover context */
+typedef struct vampire_context_t vampire_context_t;
+
+/** Opaque handle to an iterator over the steps of a proof */
+typedef struct vampire_proof_iter_t vampire_proof_iter_t;
+
+/** Opaque handle to a proof attempt running on its own thread */
+typedef struct vampire_proof_task_t vampire_proof_task_t;
+
 /* ===========================================
  * Enumerations
  * =========================================== */
@@ -62,7 +74,8 @@ typedef enum {
     VAMPIRE_TIMEOUT = 2,         /* Time limit exceeded */
     VAMPIRE_MEMORY_LIMIT = 3,    /* Memory limit exceeded */
     VAMPIRE_UNKNOWN = 4,         /* Could not determine */
-    VAMPIRE_INCOMPLETE = 5       /* Incomplete search */
+    VAMPIRE_INCOMPLETE = 5,      /* Incomplete search */
+    VAMPIRE_CANCELLED = 6        /* Stopped by vampire_cancel() */
 } vampire_proof_result_t;
 
 /** Input type for units */
@@ -318,6 +331,84 @@ void vampire_prepare_for_next_proof(void);
  */
 void vampire_reset(void);
 
+/**
+ * Return memory that Vampire holds for reuse but no longer needs to the
+ * operating system. vampire_reset() and vampire_context_free() do this
+ * automatically.
+ * @return Number of bytes released
+ */
+size_t vampire_release_memory(void);
+
+/**
+ * Destroy the terms and literals no longer used by any of the given
+ * problems or by the last refutation, then release the freed memory.
+ * Every other term, literal, clause and proof handle obtained earlier may
+ * become invalid. Must not be called while a proof is running.
+ * @param keep Problems whose units stay valid (may be NULL if count is 0)
+ * @param count Number of problems in keep
+ * @return Number of bytes reclaimed
+ */
+size_t vampire_collect_garbage(vampire_problem_t** keep, size_t count);
+
+/** Memory in use by one subsystem */
+typedef struct {
+    size_t live_bytes;
+    size_t peak_bytes;  /* Since the start of the last proof attempt */
+} vampire_memory_usage_t;
+
+/** Memory use by subsystem. The counts cover the main data structures only. */
+typedef struct {
+    vampire_memory_usage_t terms;     /* Terms and literals */
+    vampire_memory_usage_t clauses;   /* Clauses, without their literals */
+    vampire_memory_usage_t indexing;  /* Substitution and code tree nodes */
+    vampire_memory_usage_t passive;   /* Clause queues of the passive container */
+    vampire_memory_usage_t sat;       /* Clauses of the SAT solvers */
+    long peak_total_kb;               /* Peak memory of the whole process */
+} vampire_memory_report_t;
+
+/**
+ * Report the memory used by each subsystem.
+ * @param out Filled with the current report
+ */
+void vampire_memory_report(vampire_memory_report_t* out);
+
+/* ===========================================
+ * Prover Contexts
+ * =========================================== */
+
+/**
+ * Create a new prover context with its own signature, term sharing,
+ * options, statistics and inference store.
+ *
+ * All other functions operate on the active context. Between
+ * vampire_context_enter() and the matching vampire_context_leave(),
+ * the calling thread works on the given context. Only one context is
+ * active per process at a time: entering blocks while another thread
+ * has a context entered.
+ *
+ * @return Context handle, to be released with vampire_context_free()
+ */
+vampire_context_t* vampire_context_new(void);
+
+/**
+ * Destroy a prover context. All handles created within the context
+ * become invalid. The context must not be entered.
+ */
+void vampire_context_free(vampire_context_t* ctx);
+
+/**
+ * Make the given context active for the calling thread.
+ * Calls may be nested; each must be matched by vampire_context_leave()
+ * on the same thread.
+ */
+void vampire_context_enter(vampire_context_t* ctx);
+
+/**
+ * Leave the context entered last by the calling thread.
+ * @return 0 on success, -1 if the thread has no entered context
+ */
+int vampire_context_leave(void);
+
 /* ===========================================
  * Options Configuration
  * =========================================== */
@@ -348,6 +439,12 @@ void vampire_set_show_proof(bool show);
  */
 void vampire_set_saturation_algorithm(const char* algorithm);
 
+/**
+ * Set the schedule run by vampire_prove_portfolio().
+ * @param schedule Name of a schedule (e.g., "casc", "casc_sat", "smtcomp")
+ */
+void vampire_set_schedule(const char* schedule);
+
 /* ===========================================
  * Symbol Registration
  * =========================================== */
@@ -369,6 +466,30 @@ unsigned int vampire_add_function(const char* name, unsigned int arity);
  */
 unsigned int vampire_add_predicate(const char* name, unsigned int arity);
 
+/**
+ * Intern a symbol name. Registering many symbols of the same name by the
+ * returned atom avoids hashing the name every time.
+ * @param name Symbol name (null-terminated string)
+ * @return atom for vampire_add_function_atom and vampire_add_predicate_atom
+ */
+unsigned int vampire_intern_name(const char* name);
+
+/**
+ * Register a function symbol with the name of an atom from vampire_intern_name.
+ * @param atom Atom of the symbol name
+ * @param arity Number of arguments
+ * @return functor index for use in term construction
+ */
+unsigned int vampire_add_function_atom(unsigned int atom, unsigned int arity);
+
+/**
+ * Register a predicate symbol with the name of an atom from vampire_intern_name.
+ * @param atom Atom of the symbol name
+ * @param arity Number of arguments
+ * @return predicate index for use in literal construction
+ */
+unsigned int vampire_add_predicate_atom(unsigned int atom, unsigned int arity);
+
 /* ===========================================
  * Term Construction
  * =========================================== */
@@ -548,6 +669,56 @@ vampire_clause_t* vampire_conjecture_clause(vampire_literal_t** literals, size_t
 vampire_clause_t* vampire_clause(vampire_literal_t** literals, size_t count,
                                   vampire_input_type_t input_type);
 
+/* ===========================================
+ * Bulk Construction
+ * =========================================== */
+
+/** Tag of an entry of a flat prefix encoding */
+typedef enum {
+    VAMPIRE_FLAT_VAR = 0,      /* Variable, value is its index */
+    VAMPIRE_FLAT_FUN = 1,      /* Function application, value is the functor; its arguments follow */
+    VAMPIRE_FLAT_POS_LIT = 2,  /* Positive literal, value is the predicate; its arguments follow */
+    VAMPIRE_FLAT_NEG_LIT = 3,  /* Negative literal, as VAMPIRE_FLAT_POS_LIT */
+    VAMPIRE_FLAT_CLAUSE = 4    /* Clause, value is the number of literals that follow */
+} vampire_flat_tag_t;
+
+/**
+ * Entry of a flat prefix encoding. Arities are taken from the signature;
+ * an equality literal (predicate 0) has two arguments.
+ * For example, f(X0, c) is {FUN f}, {VAR 0}, {FUN c}.
+ */
+typedef struct {
+    uint32_t tag;    /* a vampire_flat_tag_t */
+    uint32_t value;
+} vampire_flat_entry_t;
+
+/**
+ * Build a sequence of terms from their flat prefix encoding in one call.
+ * @param entries The encoding (VAMPIRE_FLAT_VAR and VAMPIRE_FLAT_FUN entries only)
+ * @param count Number of entries
+ * @param out_terms Output array receiving the term handles
+ * @param capacity Size of out_terms
+ * @param out_count Receives the number of terms built
+ * @return 0 on success, -1 if the encoding is malformed or out_terms is too small
+ */
+int vampire_terms_from_flat(const vampire_flat_entry_t* entries, size_t count,
+                            vampire_term_t** out_terms, size_t capacity, size_t* out_count);
+
+/**
+ * Build a sequence of clauses from their flat prefix encoding in one call.
+ * Each clause is a VAMPIRE_FLAT_CLAUSE entry followed by its literals.
+ * @param entries The encoding
+ * @param count Number of entries
+ * @param input_type The input type of all the clauses
+ * @param out_clauses Output array receiving the clause handles
+ * @param capacity Size of out_clauses
+ * @param out_count Receives the number of clauses built
+ * @return 0 on success, -1 if the encoding is malformed or out_clauses is too small
+ */
+int vampire_clauses_from_flat(const vampire_flat_entry_t* entries, size_t count,
+                              vampire_input_type_t input_type,
+                              vampire_clause_t** out_clauses, size_t capacity, size_t* out_count);
+
 /* ===========================================
  * Problem and Proving
  * =========================================== */
@@ -569,6 +740,24 @@ vampire_problem_t* vampire_problem_from_clauses(vampire_clause_t** clauses, size
  */
 vampire_problem_t* vampire_problem_from_units(vampire_unit_t** units, size_t count);
 
+/**
+ * Parse a problem in TPTP syntax.
+ * The text is read in place and need not be null-terminated; it only
+ * has to stay valid during the call. Symbols are added to the signature.
+ * @param text The TPTP input
+ * @param length Length of the input in bytes
+ * @return Problem handle, or NULL if the input could not be parsed
+ */
+vampire_problem_t* vampire_parse_tptp(const char* text, size_t length);
+
+/**
+ * Parse a problem in SMT-LIB 2 syntax (see vampire_parse_tptp()).
+ * @param text The SMT-LIB 2 input
+ * @param length Length of the input in bytes
+ * @return Problem handle, or NULL if the input could not be parsed
+ */
+vampire_problem_t* vampire_parse_smtlib2(const char* text, size_t length);
+
 /**
  * Run the prover on a problem.
  * @param problem The problem to solve
@@ -576,6 +765,190 @@ vampire_problem_t* vampire_problem_from_units(vampire_unit_t** units, size_t cou
  */
 vampire_proof_result_t vampire_prove(vampire_problem_t* problem);
 
+/**
+ * Run the prover on an array of problems, one after the other.
+ * The light reset of vampire_prepare_for_next_proof() is done before
+ * each problem, and the time limit applies to each problem separately.
+ * All problems are proved with the options current at the call.
+ * @param problems Array of problem handles
+ * @param count Number of problems
+ * @param out_results Output array of at least count results
+ * @return 0 on success, -1 on error
+ */
+int vampire_prove_batch(vampire_problem_t** problems, size_t count,
+                        vampire_proof_result_t* out_results);
+
+/**
+ * Run a strategy portfolio on a problem within this process.
+ * Strategies of the schedule selected by the "schedule" option are tried
+ * one after another until one of them finds a proof or a counter-model,
+ * or the overall time limit runs out.
+ * @param problem The problem to solve
+ * @param max_slices Maximum number of strategies to try (0 for the whole schedule)
+ * @return The proof result
+ */
+vampire_proof_result_t vampire_prove_portfolio(vampire_problem_t* problem,
+                                               unsigned max_slices);
+
+/**
+ * Get the strategy that gave the answer of the last vampire_prove_portfolio()
+ * of the calling thread, so threads proving in their own contexts do not see
+ * each other's strategies.
+ * @return Encoded strategy (as in the schedules), or an empty string if no
+ *         strategy gave a definitive answer; valid until the next portfolio
+ *         run of the calling thread
+ */
+const char* vampire_portfolio_strategy(void);
+
+/**
+ * Create a proving session: a fixed set of axioms that is clausified
+ * once and then queried with many conjectures.
+ * @return Session handle, to be released with vampire_session_free()
+ */
+vampire_session_t* vampire_session_new(void);
+
+/**
+ * Destroy a proving session.
+ */
+void vampire_session_free(vampire_session_t* session);
+
+/**
+ * Add axioms (clauses or formula units) to a session.
+ * @param session The session
+ * @param units Array of unit handles
+ * @param count Number of units
+ */
+void vampire_session_add_axioms(vampire_session_t* session,
+                                vampire_unit_t** units, size_t count);
+
+/**
+ * Prove conjecture units together with the session's axioms.
+ * The axioms are clausified only on the first query after they were added.
+ * @param session The session
+ * @param units Array of query-specific unit handles (e.g. from vampire_conjecture_formula())
+ * @param count Number of units
+ * @return The proof result
+ */
+vampire_proof_result_t vampire_session_prove(vampire_session_t* session,
+                                             vampire_unit_t** units, size_t count);
+
+/**
+ * Prove conjecture units together with the session's axioms, with the
+ * options changed by a strategy code (as in the portfolio schedules) for
+ * this query only. Running several strategies on one session clausifies
+ * its axioms once.
+ * @param session The session
+ * @param units Array of query-specific unit handles
+ * @param count Number of units
+ * @param strategy Strategy code, e.g. "lrs+10_1:1_sil=2000_100"
+ * @return The proof result, VAMPIRE_UNKNOWN if the strategy code is not valid
+ */
+vampire_proof_result_t vampire_session_prove_strategy(vampire_session_t* session,
+                                                      vampire_unit_t** units, size_t count,
+                                                      const char* strategy);
+
+/**
+ * Run the prover on a problem built within the given context.
+ * Enters the context, prepares it for a new proof and proves.
+ * The refutation stays available via vampire_get_refutation() while
+ * the context is entered.
+ * @param ctx The context the problem belongs to
+ * @param problem The problem to solve
+ * @return The proof result
+ */
+vampire_proof_result_t vampire_prove_in_context(vampire_context_t* ctx,
+                                                vampire_problem_t* problem);
+
+/* ===========================================
+ * Asynchronous Proving
+ * =========================================== */
+
+/** Number of saturation phases timed in vampire_progress_t */
+#define VAMPIRE_SATURATION_PHASES 6
+
+/** Snapshot of a running proof search */
+typedef struct {
+    unsigned activations;        /* Clauses activated so far */
+    unsigned active_clauses;     /* Current size of the active set */
+    unsigned passive_clauses;    /* Current size of the passive set */
+    long peak_memory_kb;         /* Peak memory usage of the process */
+    long elapsed_ms;             /* Time since the proof attempt started */
+    /* Time spent in selection, activation, generation, forward and backward
+       simplification and splitting; all 0 unless phase_timing is on */
+    long phase_ms[VAMPIRE_SATURATION_PHASES];
+} vampire_progress_t;
+
+/**
+ * Progress callback. Runs on the prover thread between two activations
+ * and must not call any other vampire_* function.
+ */
+typedef void (*vampire_progress_callback_t)(const vampire_progress_t* progress,
+                                            void* user_data);
+
+/**
+ * Start proving a problem on a separate thread.
+ * No other vampire_* function may be called until the task has finished,
+ * except vampire_cancel(), vampire_wait() and functions of other contexts.
+ * @param problem The problem to solve
+ * @param callback Progress callback, or NULL
+ * @param every_n Number of activations between callbacks (0 disables them)
+ * @param user_data Passed to the callback unchanged
+ * @return Handle of the running task, release with vampire_proof_task_free()
+ */
+vampire_proof_task_t* vampire_prove_async(vampire_problem_t* problem,
+                                          vampire_progress_callback_t callback,
+                                          unsigned every_n, void* user_data);
+
+/**
+ * Start proving a problem built within the given context on a separate
+ * thread. The context is entered on the prover thread.
+ * @see vampire_prove_async()
+ */
+vampire_proof_task_t* vampire_prove_async_in_context(vampire_context_t* ctx,
+                                                     vampire_problem_t* problem,
+                                                     vampire_progress_callback_t callback,
+                                                     unsigned every_n, void* user_data);
+
+/**
+ * Ask a running task to stop. The search stops after the current
+ * activation and the task's result becomes VAMPIRE_CANCELLED.
+ * @param task The task
+ */
+void vampire_cancel(vampire_proof_task_t* task);
+
+/**
+ * Wait for a task to finish.
+ * @param task The task
+ * @param timeout_ms Maximum time to wait in milliseconds, negative to wait forever
+ * @param out_result Receives the proof result if the task finished (may be NULL)
+ * @return 0 if the task finished, 1 if the timeout expired first
+ */
+int vampire_wait(vampire_proof_task_t* task, long timeout_ms,
+                 vampire_proof_result_t* out_result);
+
+/**
+ * Release a task. A task that is still running is cancelled and
+ * waited for first.
+ * @param task The task
+ */
+void vampire_proof_task_free(vampire_proof_task_t* task);
+
+/**
+ * Answer callback for question answering. Receives each answer as the
+ * "% SZS answers Tuple" line printed for it and must not call any other
+ * vampire_* function.
+ */
+typedef void (*vampire_answer_callback_t)(const char* answer, void* user_data);
+
+/**
+ * Set the callback receiving the answers of question answering as they are
+ * found (see the question_answering_answers option, which makes the search
+ * go on after an answer).
+ * @param callback Answer callback, or NULL to print the answers to stdout
+ * @param user_data Passed to the callback unchanged
+ */
+void vampire_set_answer_callback(vampire_answer_callback_t callback, void* user_data);
+
 /**
  * Get the refutation (proof) after a successful vampire_prove() call.
  * @return The empty clause with inference chain, or NULL if no proof
@@ -623,6 +996,85 @@ int vampire_extract_proof(vampire_unit_t* refutation,
  */
 void vampire_free_proof_steps(vampire_proof_step_t* steps, size_t count);
 
+/**
+ * Create an iterator over the steps of a proof, in topological order
+ * (premises before conclusions). Steps are computed on demand, so no
+ * array of all steps is built.
+ * @param refutation The refutation from vampire_get_refutation()
+ * @return Iterator handle, release with vampire_proof_iter_free()
+ */
+vampire_proof_iter_t* vampire_proof_iter_new(vampire_unit_t* refutation);
+
+/**
+ * Advance to the next proof step.
+ * The step's premise_ids array is owned by the iterator and stays
+ * valid until the next call; do not free it.
+ * @param iter The iterator
+ * @param out_step Receives the step
+ * @return true if a step was produced, false once the proof is exhausted
+ */
+bool vampire_proof_iter_next(vampire_proof_iter_t* iter, vampire_proof_step_t* out_step);
+
+/**
+ * Free a proof iterator.
+ * @param iter The iterator
+ */
+void vampire_proof_iter_free(vampire_proof_iter_t* iter);
+
+/**
+ * Sink for vampire_write_proof_binary().
+ * @return 0 to continue, non-zero to abort the export
+ */
+typedef int (*vampire_write_callback_t)(const void* data, size_t size, void* user_data);
+
+/**
+ * Stream a proof in a compact binary form (varint-encoded step ids,
+ * rule and input type codes, premise ids, and each clause as a flat
+ * prefix encoding, see vampire_clauses_from_flat()). The format is
+ * documented at Api::writeProofBinary().
+ * @param refutation The refutation from vampire_get_refutation()
+ * @param write Called with consecutive chunks of the output
+ * @param user_data Passed to write unchanged
+ * @return 0 on success, -1 if write aborted the export
+ */
+int vampire_write_proof_binary(vampire_unit_t* refutation,
+                               vampire_write_callback_t write, void* user_data);
+
+/**
+ * Write the clausified axioms of a session, with the symbols they use,
+ * in a compact binary form that vampire_session_load_snapshot() reads
+ * back, so that another process can skip parsing and clausification.
+ * Only default-sorted (untyped) axioms can be written.
+ * @param session The session
+ * @param write Called with consecutive chunks of the output
+ * @param user_data Passed to write unchanged
+ * @return 0 on success, -1 if an axiom cannot be written or write aborted
+ */
+int vampire_session_save_snapshot(vampire_session_t* session,
+                                  vampire_write_callback_t write, void* user_data);
+
+/**
+ * Add the axioms of a snapshot written by vampire_session_save_snapshot()
+ * to a session. Symbols are matched by name and arity.
+ * @param session The session
+ * @param data The snapshot
+ * @param size Its length in bytes
+ * @return 0 on success, -1 if the snapshot is malformed or clashes with
+ *         the current signature (no axioms are added)
+ */
+int vampire_session_load_snapshot(vampire_session_t* session,
+                                  const void* data, size_t size);
+
+/**
+ * Write the statistics of the last proof attempt as one line of JSON:
+ * the termination reason, elapsed time, rates such as activations per
+ * second, and every non-zero counter of the full statistics.
+ * @param write Called with consecutive chunks of the output
+ * @param user_data Passed to write unchanged
+ * @return 0 on success, -1 if write aborted the export
+ */
+int vampire_write_statistics_json(vampire_write_callback_t write, void* user_data);
+
 /**
  * Get the literals of a clause as an array.
  * @param clause The clause
@@ -663,10 +1115,105 @@ vampire_formula_t* vampire_unit_as_formula(vampire_unit_t* unit);
  */
 bool vampire_clause_is_empty(vampire_clause_t* clause);
 
+/* ===========================================
+ * Term Ids
+ * =========================================== */
+
+/*
+ * Terms are hash-consed, so a term is identified by a single integer:
+ * a tagged reference to the shared term, or a tagged variable index.
+ * Ids need no freeing and stay valid as long as the term does (until
+ * vampire_reset() or the owning context is freed). Equal terms have
+ * equal ids, so ids can be compared and hashed directly.
+ */
+typedef uint64_t vampire_term_id_t;
+
+/** Id of the variable with the given index */
+vampire_term_id_t vampire_var_id(unsigned int index);
+
+/**
+ * Id of a function application (a constant if arg_count is 0).
+ * @param functor Function symbol index from vampire_add_function()
+ * @param args Array of argument ids
+ * @param arg_count Number of arguments
+ */
+vampire_term_id_t vampire_term_id(unsigned int functor, const vampire_term_id_t* args,
+                                  size_t arg_count);
+
+/** Id of a term handle */
+vampire_term_id_t vampire_term_get_id(vampire_term_t* term);
+
+/** Term handle for an id, for use with the handle-based functions */
+vampire_term_t* vampire_term_from_id(vampire_term_id_t id);
+
+/** True if the id denotes a variable */
+bool vampire_id_is_var(vampire_term_id_t id);
+
+/** Variable index of a variable id */
+unsigned int vampire_id_var_index(vampire_term_id_t id);
+
+/** Functor of a non-variable id */
+unsigned int vampire_id_functor(vampire_term_id_t id);
+
+/** Number of arguments of a non-variable id */
+unsigned int vampire_id_arity(vampire_term_id_t id);
+
+/** Id of the n-th argument (from 0) of a non-variable id */
+vampire_term_id_t vampire_id_arg(vampire_term_id_t id, unsigned int n);
+
+/**
+ * Create a predicate literal from argument ids.
+ * For equalities use vampire_eq_from_ids().
+ * @param pred Predicate symbol index from vampire_add_predicate()
+ * @param positive true for positive literal, false for negative
+ * @param args Array of argument ids
+ * @param arg_count Number of arguments
+ */
+vampire_literal_t* vampire_lit_from_ids(unsigned int pred, bool positive,
+                                        const vampire_term_id_t* args, size_t arg_count);
+
+/** Create an equality or disequality literal from two ids */
+vampire_literal_t* vampire_eq_from_ids(bool positive, vampire_term_id_t lhs, vampire_term_id_t rhs);
+
+/** Predicate of a literal (0 for equality) */
+unsigned int vampire_literal_predicate(vampire_literal_t* literal);
+
+/** True if the literal is positive */
+bool vampire_literal_is_positive(vampire_literal_t* literal);
+
+/** Number of arguments of a literal */
+unsigned int vampire_literal_arity(vampire_literal_t* literal);
+
+/** Id of the n-th argument (from 0) of a literal */
+vampire_term_id_t vampire_literal_arg(vampire_literal_t* literal, unsigned int n);
+
+/** Number of literals of a clause */
+size_t vampire_clause_length(vampire_clause_t* clause);
+
+/** The n-th literal (from 0) of a clause, without copying the literal array */
+vampire_literal_t* vampire_clause_literal(vampire_clause_t* clause, size_t n);
+
 /* ===========================================
  * String Conversions
  * =========================================== */
 
+/**
+ * Write the string representation of a term id into a caller buffer.
+ * Like snprintf, the output is truncated to size-1 characters and
+ * null-terminated (if size > 0).
+ * @param id The term id
+ * @param buffer Output buffer
+ * @param size Size of the buffer
+ * @return Length of the full string representation
+ */
+size_t vampire_term_id_write_string(vampire_term_id_t id, char* buffer, size_t size);
+
+/** Like vampire_term_id_write_string(), for a literal */
+size_t vampire_literal_write_string(vampire_literal_t* literal, char* buffer, size_t size);
+
+/** Like vampire_term_id_write_string(), for a clause */
+size_t vampire_clause_write_string(vampire_clause_t* clause, char* buffer, size_t size);
+
 /**
  * Convert a term to a string representation.
  * @param term The term
@@ -15,6 +15,7 @@
 
 
 #include "Debug/Assertion.hpp"
+#include "Lib/DHMap.hpp"
 #include "Lib/Environment.hpp"
 #include "Lib/Int.hpp"
 #include "Lib/Portability.hpp"
@@ -43,6 +44,7 @@
 //only for detecting number of cores, no threading here!
 #include <thread>
 
+#include "Saturation/ClauseExchange.hpp"
 #include "Saturation/ProvingHelper.hpp"
 
 #include "Kernel/Problem.hpp"
@@ -149,6 +151,10 @@ bool PortfolioMode::searchForProof()
     TIME_TRACE(TimeTrace::PREPROCESSING);
 
     //we normalize now so that we don't have to do it in every child Vampire
+    //(the later preprocessing steps cannot be shared in the same way: already the
+    //first ones -- answer literals, goal guessing, shuffling, theory axioms -- depend
+    //on slice options, and any step creating units here would shift the unit numbers
+    //seen by a slice, so that it would no longer behave as when run alone via --decode)
     ScopedLet<ExecutionPhase> phaseLet(env.statistics->phase,ExecutionPhase::NORMALIZATION);
 
     if (env.options->normalize()) { // set explicitly by CASC(SAT) and SMTCOMP modes
@@ -170,7 +176,16 @@ bool PortfolioMode::searchForProof()
   // now all the cpu usage will be in children, we'll just be waiting for them
   Timer::disableLimitEnforcement();
 
-  return prepareScheduleAndPerform(*property);
+  // the children share clauses over the signature as it is now
+  if (env.options->portfolioClauseExchange() && _numWorkers > 1) {
+    Saturation::ClauseExchange::setUp(
+      fs::temp_directory_path() / ("vampire-exchange-" + Int::toString(getpid())),
+      env.options->portfolioClauseExchange());
+  }
+
+  bool result = prepareScheduleAndPerform(*property);
+  Saturation::ClauseExchange::tearDown();
+  return result;
 }
 
 bool PortfolioMode::prepareScheduleAndPerform(const Shell::Property& prop)
@@ -406,6 +421,10 @@ bool PortfolioMode::runSchedule(Schedule schedule) {
 
   Schedule::BottomFirstIterator it(schedule);
   Set<pid_t> processes;
+  // the strategy each running process was started with
+  DHMap<pid_t, std::string> slices;
+  // strategies of the current round that would not benefit from more time
+  Set<std::string> gaveUp;
   bool success = false;
   int remainingTime;
   bool scheduleRepeat = false;
@@ -415,10 +434,20 @@ bool PortfolioMode::runSchedule(Schedule schedule) {
     while(processes.size() < _numWorkers)
     {
       // after exhaustion we replace the schedule
-      // by copies with x2 time limits and do this forever
+      // by copies with x2 time limits and do this forever,
+      // dropping the slices that gave up (unless all of them did)
       if(!it.hasNext()) {
+        Schedule promising;
+        Schedule::BottomFirstIterator sit(schedule);
+        while (sit.hasNext()) {
+          std::string s = sit.next();
+          if (!gaveUp.contains(s)) {
+            promising.push(s);
+          }
+        }
+        gaveUp.reset();
         Schedule next;
-        rescaleScheduleLimits(schedule, next, 2.0);
+        rescaleScheduleLimits(promising.isEmpty() ? schedule : promising, next, 2.0);
         scheduleRepeat = true;
         schedule = std::move(next);
         it = Schedule::BottomFirstIterator(schedule);
@@ -426,15 +455,22 @@ bool PortfolioMode::runSchedule(Schedule schedule) {
       ALWAYS(it.hasNext());
 
       std::string code = it.next();
+      // the parent holds nothing but the parsed problem, so it already is
+      // the clean post-parse snapshot each slice starts from; preprocessing
+      // depends on the slice's options and has to be redone by the child
       pid_t process = Multiprocessing::instance()->fork();
       ASS_NEQ(process, -1);
       if(process == 0)
       {
         TIME_TRACE_NEW_ROOT("child process")
+#if VTIME_PROFILING
+        TimeTrace::instance().startSampling(env.options->timeStatisticsSamples());
+#endif
         runSlice(code, remainingTime, scheduleRepeat);
         ASSERTION_VIOLATION; // should not return
       }
       ALWAYS(processes.insert(process));
+      slices.insert(process, code);
     }
 
     bool exited, signalled;
@@ -452,16 +488,22 @@ bool PortfolioMode::runSchedule(Schedule schedule) {
     if(exited)
     {
       ALWAYS(processes.remove(process));
+      std::string slice = slices.get(process);
+      slices.remove(process);
       if(!code)
       {
         success = true;
         break;
       }
+      if (code == SLICE_GAVE_UP) {
+        gaveUp.insert(slice);
+      }
     } else if (signalled) {
       // killed by an external agency (could be e.g. a slurm cluster killing for too much memory allocated)
       Shell::addCommentSignForSZS(cout);
       cout<<"Child killed by signal " << code << endl;
       ALWAYS(processes.remove(process));
+      slices.remove(process);
     }
   }
 
@@ -647,7 +689,15 @@ void PortfolioMode::runSlice(Options& opt)
   if(!succeeded) {
     if(outputAllowed())
       UIHelper::outputResult(cout);
-    exit(EXIT_FAILURE);
+    TerminationReason reason = env.statistics->terminationReason;
+    // a saturation that discarded clauses (LRS, weight or memory limits)
+    // depends on the time it had and may go further with more
+    bool saturatedFully = reason == TerminationReason::REFUTATION_NOT_FOUND
+      && !env.statistics->discardedNonRedundantClauses;
+    exit(saturatedFully ||
+         reason == TerminationReason::INAPPROPRIATE ||
+         reason == TerminationReason::MEMORY_LIMIT
+      ? SLICE_GAVE_UP : EXIT_FAILURE);
   }
 
   // whether this Vampire should print a proof or not
@@ -692,17 +742,25 @@ void PortfolioMode::runSlice(Options& opt)
   if (outputAllowed() && env.options->multicore() != 1)
     addCommentSignForSZS(cout) << "First to succeed." << endl;
 
+  // a proof using clauses of other workers says where they come from
+  auto outputProof = [](std::ostream& out) {
+    UIHelper::outputResult(out);
+    if (Saturation::ClauseExchange::enabled() && env.statistics->refutation) {
+      Saturation::ClauseExchange::explainImports(env.statistics->refutation, out);
+    }
+  };
+
   if (_path.empty()) {
     // we already failed above in accessing the file (let's not try opening or reporting the empty name)
-    UIHelper::outputResult(cout);
+    outputProof(cout);
   } else {
     std::ofstream output(_path);
     if(output.fail()) {
       // failed to open file, fallback to stdout
       addCommentSignForSZS(cout) << "Solution printing to a file '" << _path <<  "' failed. Outputting to stdout" << endl;
-      UIHelper::outputResult(cout);
+      outputProof(cout);
     } else {
-      UIHelper::outputResult(output);
+      outputProof(output);
       if(outputAllowed())
         addCommentSignForSZS(cout) << "Solution written to " << _path << endl;
     }
@@ -39,13 +39,22 @@ public:
 
   static void rescaleScheduleLimits(const Schedule& sOld, Schedule& sNew, float limit_multiplier);
   static void addScheduleExtra(const Schedule& sOld, Schedule& sNew, std::string extra);
+  /** Fetch the schedules selected by the schedule option for a problem with property @b prop */
+  static void getSchedules(const Property& prop, Schedule& quick, Schedule& champions);
 
 private:
+  /**
+   * Exit status of a slice that failed for a reason more time would not
+   * cure (saturated with an incomplete strategy but without discarding
+   * clauses, inappropriate, out of memory); such slices are left out when
+   * the schedule is repeated.
+   */
+  static constexpr int SLICE_GAVE_UP = 100;
+
   // some of these names are kind of arbitrary and should be perhaps changed
   unsigned getSliceTime(const std::string &sliceCode);
   bool searchForProof();
   bool prepareScheduleAndPerform(const Shell::Property& prop);
-  void getSchedules(const Property& prop, Schedule& quick, Schedule& champions);
 
   bool runSchedule(Schedule schedule);
   bool runScheduleAndRecoverProof(Schedule schedule);
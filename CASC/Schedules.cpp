@@ -46,6 +46,10 @@ void Schedules::getScheduleFromFile(const std::string& filename, Schedule& quick
   }
   ASS(schedule_file.is_open());
   std::string line;
+  // every strategy is checked on its own, starting from the default options;
+  // resetting one object is much cheaper than constructing one per line
+  const Options defaults;
+  Options opts;
   while (getline(schedule_file, line)) {
     // Allow structuring the schedule file with empty lines.
     // Allow documenting the schedule file with line comments.
@@ -53,7 +57,7 @@ void Schedules::getScheduleFromFile(const std::string& filename, Schedule& quick
     if (line == "" or line[0] == '%') {
       continue;
     }
-    Options opts;
+    opts.copyValuesFrom(defaults);
     try {
       opts.readFromEncodedOptions(line);
       opts.checkGlobalOptionConstraints();
@@ -61,7 +65,7 @@ void Schedules::getScheduleFromFile(const std::string& filename, Schedule& quick
     catch (...) {
       USER_ERROR("Bad strategy: " + line);
     }
-    quick.push(line);
+    quick.push(std::move(line));
   }
 }
 
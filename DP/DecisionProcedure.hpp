@@ -59,6 +59,14 @@ public:
   virtual void getUnsatCore(LiteralStack& res, unsigned coreIndex=0) = 0;
   /** reset decision procedure object into state equivalent to its initial state */
   virtual void reset() = 0;
+
+  /**
+   * Open a backtracking level. The literals added after the call are
+   * retracted by the matching pop(), literals added before stay.
+   */
+  virtual void push() = 0;
+  /** Retract the literals added since the last push() that is still open */
+  virtual void pop() = 0;
 };
 
 }
@@ -49,6 +49,12 @@ public:
     _unsatCores.reset();
   }
 
+  void push() override { _inner->push(); }
+  void pop() override {
+    _inner->pop();
+    _unsatCores.reset();
+  }
+
   Status getStatus(bool getMultipleCores) override;
 
   void getModel(LiteralStack& model) override {
@@ -139,8 +139,6 @@ SimpleCongruenceClosure::SimpleCongruenceClosure(Ordering* ord) :
   _posLitConst = getFreshConst();
   _negLitConst = getFreshConst();
   _negEqualities.push(CEq(_posLitConst, _negLitConst, 0));
-
-  _hadPropagated = false;
 }
 
 void SimpleCongruenceClosure::reset()
@@ -174,7 +172,126 @@ void SimpleCongruenceClosure::reset()
   _distinctConstraints.reset();
   _negDistinctConstraints.reset();
 
-  _hadPropagated = false;
+  _trail.reset();
+  _levels.reset();
+}
+
+/**
+ * Open a backtracking level. Pending equalities are propagated first,
+ * so that pop() can simply drop those of the level.
+ */
+void SimpleCongruenceClosure::push()
+{
+  propagate();
+
+  _levels.push(Level{_trail.size(), _negEqualities.size(),
+      _distinctConstraints.size(), _negDistinctConstraints.size()});
+}
+
+/**
+ * Retract the literals added since the matching push(), undoing the
+ * changes on the trail in reverse order.
+ *
+ * Pair names created at the level stay, but if some of their arguments
+ * were not representatives, they were registered with the classes of the
+ * level. Such pairs are registered again with the classes left.
+ */
+void SimpleCongruenceClosure::pop()
+{
+  ASS(_levels.isNonEmpty());
+
+  Level lvl = _levels.pop();
+
+  static Stack<CPair> orphans;
+  ASS(orphans.isEmpty());
+  while(_trail.size()>lvl.trailSize) {
+    undo(_trail.pop(), orphans);
+  }
+
+  _negEqualities.truncate(lvl.negEqualities);
+  _distinctConstraints.truncate(lvl.distinctConstraints);
+  _negDistinctConstraints.truncate(lvl.negDistinctConstraints);
+  _pendingEqualities.reset();
+  _unsatEqs.reset();
+
+  // in the order of creation
+  while(orphans.isNonEmpty()) {
+    CPair orphan = orphans.pop();
+    registerPair(orphan.first, orphan.second);
+  }
+}
+
+/** Remove the last occurrence of @c c from @c s */
+static void removeLast(Stack<unsigned>& s, unsigned c)
+{
+  size_t i = s.size();
+  do {
+    ASS_G(i,0);
+    i--;
+  } while(s[i]!=c);
+  for(; i+1<s.size(); i++) {
+    s[i] = s[i+1];
+  }
+  s.pop();
+}
+
+/**
+ * Undo the change recorded by @c e. The pairs registered by NEW_PAIR
+ * entries are collected in @c orphans, together with the pair name they
+ * were found congruent with, if any.
+ */
+void SimpleCongruenceClosure::undo(const TrailEntry& e, Stack<CPair>& orphans)
+{
+  switch(e.kind) {
+  case TrailEntry::MERGE: {
+    ConstInfo& aInfo = _cInfos[e.c1];
+    ConstInfo& bInfo = _cInfos[e.c2];
+    ASS_EQ(aInfo.reprConst, e.c2);
+    ASS_EQ(bInfo.reprConst, 0);
+
+    aInfo.reprConst = 0;
+    Stack<unsigned>::Iterator aChildIt(aInfo.classList);
+    while(aChildIt.hasNext()) {
+      _cInfos[aChildIt.next()].reprConst = e.c1;
+    }
+    bInfo.classList.truncate(e.classListSize);
+
+    // the use list entries added after the merge were either undone or
+    // name pairs with b itself as an argument, which stay
+    Stack<unsigned>& bUse = bInfo.useList;
+    for(size_t i = e.useListSize; i+e.useCnt<bUse.size(); i++) {
+      bUse[i] = bUse[i+e.useCnt];
+    }
+    bUse.truncate(bUse.size()-e.useCnt);
+
+    // cut the proof tree edge of the merge, whichever way it points now
+    ConstInfo& aProofInfo = _cInfos[e.proofC1];
+    ConstInfo& bProofInfo = _cInfos[e.proofC2];
+    if(aProofInfo.proofPredecessor==e.proofC2) {
+      aProofInfo.proofPredecessor = 0;
+      aProofInfo.predecessorPremise = CEq(0,0);
+    }
+    else {
+      ASS_EQ(bProofInfo.proofPredecessor, e.proofC1);
+      bProofInfo.proofPredecessor = 0;
+      bProofInfo.predecessorPremise = CEq(0,0);
+    }
+    break;
+  }
+  case TrailEntry::PAIR_NAME: {
+    // the entry may have been taken over by the pair's own name meanwhile
+    if(_cInfos[_pairNames.get(e.pair)].namedPair!=e.pair) {
+      _pairNames.remove(e.pair);
+    }
+    break;
+  }
+  case TrailEntry::USE:
+    removeLast(_cInfos[e.c1].useList, e.c2);
+    break;
+  case TrailEntry::NEW_PAIR:
+    orphans.push(CPair(e.c1, e.c2));
+    break;
+  }
 }
 
 /** Introduce fresh congruence closure constant */
@@ -204,31 +321,75 @@ unsigned SimpleCongruenceClosure::getSignatureConst(unsigned symbol, SignatureKi
 unsigned SimpleCongruenceClosure::getPairName(CPair p)
 {
   unsigned* pRes;
+  unsigned congruent = 0;
   if(!_pairNames.getValuePtr(p, pRes)) {
-    return *pRes;
+    if(_cInfos[*pRes].namedPair==p) {
+      return *pRes;
+    }
+    // the entry was added by propagation for a pair congruent to p, the
+    // constant naming p itself takes it over
+    congruent = *pRes;
   }
   unsigned res = getFreshConst();
   _cInfos[res].namedPair = p;
   *pRes = res;
 
+  // these stay in the use lists after reset(); see resetEquivalences
   _cInfos[p.first].useList.push(res);
-  if(_cInfos[p.first].reprConst!=0) {
-    // Martin: if we are here, the above insertion was not needed now,
-    // but will become necessary after reset(); see resetEquivalences
-    unsigned fRepr = _cInfos[p.first].reprConst;
-    _cInfos[fRepr].useList.push(res);
-  }
   _cInfos[p.second].useList.push(res);
-  if(_cInfos[p.second].reprConst!=0) {
-    // Martin: if we are here, the above insertion was not needed now,
-    // but will become necessary after reset(); see resetEquivalences
-    unsigned sRepr = _cInfos[p.second].reprConst;
-    _cInfos[sRepr].useList.push(res);
-  }
 
+  registerPair(res, congruent);
   return res;
 }
 
+/**
+ * Make the congruence aware of the pair named by @c name, whose arguments
+ * may already have been merged with other constants. If @c congruent is
+ * non-zero, it is a pair name that may be congruent to @c name.
+ */
+void SimpleCongruenceClosure::registerPair(unsigned name, unsigned congruent)
+{
+  CPair p = _cInfos[name].namedPair;
+  CPair derefPair = deref(p);
+
+  if(congruent && deref(_cInfos[congruent].namedPair)==derefPair) {
+    addPendingEquality(CEq(congruent, name));
+  }
+  else {
+    congruent = 0;
+  }
+
+  if(derefPair!=p) {
+    if(derefPair.first!=p.first) {
+      _cInfos[derefPair.first].useList.push(name);
+      if(trailing()) {
+        _trail.push(TrailEntry::use(derefPair.first, name));
+      }
+    }
+    if(derefPair.second!=p.second) {
+      _cInfos[derefPair.second].useList.push(name);
+      if(trailing()) {
+        _trail.push(TrailEntry::use(derefPair.second, name));
+      }
+    }
+
+    unsigned* pDerefPairName;
+    if(!_pairNames.getValuePtr(derefPair, pDerefPairName)) {
+      addPendingEquality(CEq(*pDerefPairName, name));
+    }
+    else {
+      *pDerefPairName = name;
+      if(trailing()) {
+        _trail.push(TrailEntry::pairName(derefPair));
+      }
+    }
+  }
+
+  if(trailing() && (derefPair!=p || congruent)) {
+    _trail.push(TrailEntry::newPair(name, congruent));
+  }
+}
+
 // memoising structure used in convertFO below
 // TODO: should this be provided as part of the BUE machinery?
 struct Memo {
@@ -374,8 +535,6 @@ SimpleCongruenceClosure::CEq SimpleCongruenceClosure::convertFOEquality(Literal*
  */
 void SimpleCongruenceClosure::addLiterals(LiteralIterator lits, bool onlyEqualites)
 {
-  ASS(!_hadPropagated);
-
   while(lits.hasNext()) {
     Literal* l = lits.next();
     if(!l->ground()) {
@@ -454,8 +613,6 @@ void SimpleCongruenceClosure::makeProofRepresentant(unsigned c)
  */
 void SimpleCongruenceClosure::propagate()
 {
-  _hadPropagated = true;
-
   while(_pendingEqualities.isNonEmpty()) {
     CEq curr0 = _pendingEqualities.pop_back();
     CPair curr = deref(curr0);
@@ -491,6 +648,9 @@ void SimpleCongruenceClosure::propagate()
     DEBUG_CODE( aInfo.assertValid(*this, aRep); );
     DEBUG_CODE( bInfo.assertValid(*this, bRep); );
 
+    unsigned bClassListSize = bInfo.classList.size();
+    unsigned bUseListSize = bInfo.useList.size();
+
     // Merge first class into second (which is why we wanted the first to be smaller)
     // To do this we update the representative for all constants in
     // the class of aRep to be bRep
@@ -519,8 +679,16 @@ void SimpleCongruenceClosure::propagate()
       else {
 	*pDerefPairName = usePairConst;
 	bInfo.useList.push(usePairConst);
+	if(trailing()) {
+	  _trail.push(TrailEntry::pairName(derefPair));
+	}
       }
     }
+
+    if(trailing()) {
+      _trail.push(TrailEntry::merge(aRep, bRep, curr0.c1, curr0.c2,
+          bClassListSize, bUseListSize, bInfo.useList.size()-bUseListSize));
+    }
   }
 }
 
@@ -598,6 +766,8 @@ DecisionProcedure::Status SimpleCongruenceClosure::checkNegativeDistincts(bool r
  */
 DecisionProcedure::Status SimpleCongruenceClosure::getStatus(bool retrieveMultipleCores)
 {
+  _unsatEqs.reset();
+
   // Propagate any pending equalities
   propagate();
 
@@ -44,6 +44,12 @@ using namespace Kernel;
  * 
  * However, classList of a representative 
  * does not (physically) contain that representative (only logically)
+ *
+ * Literals can be added incrementally, also after getStatus. Between push()
+ * and pop(), the unions, the pair lookup entries and the use list entries
+ * that depend on them are recorded on a trail, so that pop() undoes only
+ * the work done for the literals of the level. The constants naming terms
+ * and pairs are kept, as they are by reset().
  */
 class SimpleCongruenceClosure : public DecisionProcedure
 {
@@ -60,6 +66,9 @@ public:
   
   void reset() override;
 
+  void push() override;
+  void pop() override;
+
   /**
    * New, more fine-grained way of insertion. The terms may contain variables which are treated as constants.
    */
@@ -122,6 +131,7 @@ private:
   unsigned getFreshConst();
   unsigned getSignatureConst(unsigned symbol, SignatureKind kind);
   unsigned getPairName(CPair p);
+  void registerPair(unsigned name, unsigned congruent = 0);
 
 
   struct FOConversionWorker;
@@ -296,11 +306,62 @@ private:
    * "It can be used only as a fact, not under any connective." */  
   DistinctStack _negDistinctConstraints;
 
-  /**
-   * used to assert we don't add literals after propagation.
-   * this would cause problems with term caches upon reset.
-   */
-  bool _hadPropagated;
+  /** A change made by the algorithm that pop() has to undo */
+  struct TrailEntry
+  {
+    enum Kind {
+      /** class of c1 merged into class of c2, by the equality of proofC1 and proofC2 */
+      MERGE,
+      /** pair lookup entry for pair added */
+      PAIR_NAME,
+      /** pair name c2 added to the use list of representative c1 */
+      USE,
+      /**
+       * pair name c1 registered while some of its arguments were not
+       * representatives, or found congruent to pair name c2 if non-zero
+       */
+      NEW_PAIR
+    };
+
+    static TrailEntry merge(unsigned aRep, unsigned bRep, unsigned aProof, unsigned bProof,
+        unsigned classListSize, unsigned useListSize, unsigned useCnt)
+    { return TrailEntry{MERGE, aRep, bRep, aProof, bProof, classListSize, useListSize, useCnt, CPair(0,0)}; }
+    static TrailEntry pairName(CPair p)
+    { return TrailEntry{PAIR_NAME, 0, 0, 0, 0, 0, 0, 0, p}; }
+    static TrailEntry use(unsigned repr, unsigned name)
+    { return TrailEntry{USE, repr, name, 0, 0, 0, 0, 0, CPair(0,0)}; }
+    static TrailEntry newPair(unsigned name, unsigned congruent)
+    { return TrailEntry{NEW_PAIR, name, congruent, 0, 0, 0, 0, 0, CPair(0,0)}; }
+
+    Kind kind;
+    unsigned c1;
+    unsigned c2;
+    unsigned proofC1;
+    unsigned proofC2;
+    /** for MERGE, the size of the class list of c2 before merging */
+    unsigned classListSize;
+    /** for MERGE, the size of the use list of c2 before merging */
+    unsigned useListSize;
+    /** for MERGE, the number of pair names added to the use list of c2 */
+    unsigned useCnt;
+    CPair pair;
+  };
+  void undo(const TrailEntry& e, Stack<CPair>& orphans);
+
+  /** Sizes of the data structures at a push() */
+  struct Level
+  {
+    size_t trailSize;
+    size_t negEqualities;
+    size_t distinctConstraints;
+    size_t negDistinctConstraints;
+  };
+
+  /** True if changes are recorded on the trail */
+  bool trailing() const { return _levels.isNonEmpty(); }
+
+  Stack<TrailEntry> _trail;
+  Stack<Level> _levels;
 }; // class SimpleCongruenceClosure
 
 }
@@ -13,6 +13,8 @@
 #include "Debug/TimeProfiling.hpp"
 #include <iomanip>
 #include <cstring>
+#include <csignal>
+#include <sys/time.h>
 #include "Shell/Options.hpp"
 #include "Lib/Environment.hpp"
 
@@ -24,7 +26,9 @@ using namespace Lib;
 TimeTrace::TimeTrace() 
   : _root("[root]")
   , _stack({ {&_root, Clock::now(), }, }) 
+  , _current(&_root)
   , _enabled(false)
+  , _sampling(false)
 {  }
 
 TimeTrace::ScopedTimer::ScopedTimer(const char* name)
@@ -53,6 +57,7 @@ TimeTrace::ScopedTimer::ScopedTimer(TimeTrace& trace, const char* name)
 #endif 
 
     _trace._stack.push(std::make_pair(node, start));
+    _trace._current = node;
   }
 }
 
@@ -61,11 +66,47 @@ TimeTrace TimeTrace::_instance;
 void TimeTrace::setEnabled(bool v) 
 { _enabled = v; }
 
+void TimeTrace::onSample(int)
+{ _instance._current->samples++; }
+
+/**
+ * Let the profiling timer interrupt the process @b hz times per second of
+ * CPU time and attribute each interrupt to the innermost TIME_TRACE block.
+ * Unlike the measurements, which read the clock on entering and leaving each
+ * block, the samples cost nothing in between interrupts and are not skewed
+ * by the overhead of the clock in short blocks.
+ *
+ * Interval timers are not inherited by forked processes, so a child has to
+ * call this again.
+ */
+void TimeTrace::startSampling(unsigned hz)
+{
+  if (!_enabled || hz == 0) {
+    return;
+  }
+  struct sigaction sa;
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = onSample;
+  sa.sa_flags = SA_RESTART;
+  sigemptyset(&sa.sa_mask);
+  if (sigaction(SIGPROF, &sa, nullptr) != 0) {
+    return;
+  }
+  struct itimerval timer;
+  // tv_usec has to stay below a second, which 1 Hz would reach
+  unsigned periodUsec = hz >= 1000000 ? 1 : 1000000 / hz;
+  timer.it_interval.tv_sec = periodUsec / 1000000;
+  timer.it_interval.tv_usec = periodUsec % 1000000;
+  timer.it_value = timer.it_interval;
+  _sampling = setitimer(ITIMER_PROF, &timer, nullptr) == 0;
+}
+
 TimeTrace::ScopedTimer::~ScopedTimer()
 {
   if (_trace._enabled) {
     auto now = Clock::now();
     auto cur = _trace._stack.pop();
+    _trace._current = get<0>(_trace._stack.top());
     auto node = get<0>(cur);
     auto start = get<1>(cur);
     node->measurements.add(now  - start);
@@ -288,6 +329,22 @@ void TimeTrace::Node::flatten_(FlattenState& s)
   }
 }
 
+/** Print the samples of this subtree as lines "root;child;...;node count" */
+void TimeTrace::Node::printSamplesRec(std::ostream& out, Stack<const char*>& path)
+{
+  path.push(name);
+  if (samples != 0) {
+    for (unsigned i = 0; i < path.size(); i++) {
+      out << (i == 0 ? "" : ";") << path[i];
+    }
+    out << " " << samples << std::endl;
+  }
+  for (auto& c : children) {
+    c->printSamplesRec(out, path);
+  }
+  path.pop();
+}
+
 void TimeTrace::printPretty(std::ostream& out)
 {
 
@@ -335,6 +392,16 @@ void TimeTrace::printPretty(std::ostream& out)
     focus.flatten().printPrettyRec(out, rootOpts);
     out << "===== end of flattened focussed time profile =====" << std::endl;
   }
+
+  if (_sampling) {
+    out <<                                                  std::endl;
+
+    // the folded format read by flame graph tools
+    Stack<const char*> path;
+    out << "===== start of sampled time profile =====" << std::endl;
+    root.printSamplesRec(out, path);
+    out << "===== end of sampled time profile =====" << std::endl;
+  }
 }
 
 } // namespace Shell
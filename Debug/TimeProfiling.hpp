@@ -135,7 +135,9 @@ private:
     const char* name;
     Lib::Stack<std::unique_ptr<Node>> children;
     Measurements measurements;
-    Node(const char* name) : name(name), children(), measurements() {}
+    /** number of profiling signals that arrived while this node was innermost */
+    unsigned samples;
+    Node(const char* name) : name(name), children(), measurements(), samples(0) {}
     struct NodeFormatOpts ;
     void printPrettyRec(std::ostream& out, NodeFormatOpts& opts);
     void printPrettySelf(std::ostream& out, NodeFormatOpts& opts);
@@ -150,6 +152,7 @@ private:
     void extendWith(Node const& n);
     struct FlattenState;
     void flatten_(FlattenState&);
+    void printSamplesRec(std::ostream& out, Lib::Stack<const char*>& path);
   };
 
   friend std::ostream& operator<<(std::ostream& out, Duration const& self);
@@ -183,12 +186,20 @@ public:
   void printPretty(std::ostream& out);
   void serialize(std::ostream& out);
   void setEnabled(bool);
+  void startSampling(unsigned hz);
 private:
+  static void onSample(int);
 
   Node _root;
   Lib::Stack<Node*> _tmpRoots;
   Lib::Stack<std::tuple<Node*, TimePoint>> _stack;
+  /**
+   * the top of _stack, kept separately so that the signal handler of the
+   * sampling profiler never looks at a stack that is being resized
+   */
+  Node* volatile _current;
   bool _enabled;
+  bool _sampling;
 };
 
 #endif // VTIME_PROFILING
@@ -9,23 +9,109 @@
  */
 /**
  * @file CliqueFinder.hpp
- * Defines a heurstic for finding maximal cliques, the method is not complete 
+ * Defines a branch and bound search for maximum cliques, which gives up
+ * after a fixed number of search nodes.
  */
 
 #ifndef __CliqueFinder__
 #define __CliqueFinder__
 
+#include <cstdint>
+#include <algorithm>
+
+#include "Lib/DArray.hpp"
 #include "Lib/DHMap.hpp"
+#include "Lib/DHSet.hpp"
+#include "Lib/Stack.hpp"
 
 namespace FMB {
 
+  /**
+   * Finds the size of a maximum clique of a graph, to be used as a lower
+   * bound on the size of a domain.
+   *
+   * The search is the bitset branch and bound of San Segundo et al., based
+   * on the one of Tomita and Seki: the vertices are numbered by decreasing
+   * degree, and the candidates of every node are greedily coloured to
+   * bound the size of the cliques they can extend. After MAX_NODES search
+   * nodes the largest clique found so far is returned, which is still a
+   * lower bound.
+   *
+   * The adjacency bitsets take n*n bits, so on graphs of more than
+   * MAX_VERTICES vertices the cheaper check of findHeuristically is used.
+   */
   class CliqueFinder {
+    static constexpr unsigned MAX_NODES = 1 << 20;
+    static constexpr unsigned MAX_VERTICES = 4096;
+
   public:
     static unsigned findMaxCliqueSize(DHMap<unsigned,DHSet<unsigned>*>* Ngraph)
     {
-      //std::cout << "findMaxCliqueSize with " << Ngraph->size() << std::endl;
+      // the vertices, also those known only as neighbours
+      DHMap<unsigned,unsigned> degree;
+      DHMap<unsigned,DHSet<unsigned>*>::Iterator miter(*Ngraph);
+      while(miter.hasNext()){
+        unsigned c;
+        DHSet<unsigned>* nbs;
+        miter.next(c,nbs);
+        unsigned* deg;
+        degree.getValuePtr(c,deg,0);
+        DHSet<unsigned>::Iterator nit(*nbs);
+        while(nit.hasNext()){
+          unsigned d = nit.next();
+          if(d!=c){
+            degree.getValuePtr(c,deg,0);
+            (*deg)++;
+            degree.getValuePtr(d,deg,0);
+            (*deg)++;
+          }
+        }
+      }
+      if(degree.size()==0){
+        return 1;
+      }
+      if(degree.size()>MAX_VERTICES){
+        return findHeuristically(Ngraph);
+      }
+
+      Stack<unsigned> vertices;
+      vertices.loadFromIterator(degree.domain());
+      std::sort(vertices.begin(),vertices.end(),[&](unsigned a, unsigned b) {
+        unsigned da = degree.get(a);
+        unsigned db = degree.get(b);
+        return da!=db ? da>db : a<b;
+      });
+      DHMap<unsigned,unsigned> number;
+      for(unsigned i=0;i<vertices.size();i++){
+        number.insert(vertices[i],i);
+      }
 
-      // at least stores the number of nodes with at least index neighbours
+      Search search(vertices.size());
+      DHMap<unsigned,DHSet<unsigned>*>::Iterator eiter(*Ngraph);
+      while(eiter.hasNext()){
+        unsigned c;
+        DHSet<unsigned>* nbs;
+        eiter.next(c,nbs);
+        DHSet<unsigned>::Iterator nit(*nbs);
+        while(nit.hasNext()){
+          unsigned d = nit.next();
+          if(d!=c){
+            search.addEdge(number.get(c),number.get(d));
+          }
+        }
+      }
+      return search.run();
+    }
+
+  private:
+    /**
+     * Look for a vertex of i neighbours forming a clique with them, for
+     * decreasing i. Only a few candidate cliques are checked, so the result
+     * is a weak lower bound.
+     */
+    static unsigned findHeuristically(DHMap<unsigned,DHSet<unsigned>*>* Ngraph)
+    {
+      // atleast[i] stores the vertices with at least i neighbours
       DArray<Stack<unsigned>> atleast;
       atleast.ensure(Ngraph->size()+1); // the +1 is to protect against a self-loop sneaking in
 
@@ -34,83 +120,177 @@ namespace FMB {
         unsigned c;
         DHSet<unsigned>* nbs;
         miter.next(c,nbs);
-        unsigned size = nbs->size();
-        //std::cout << ">> " << c << ": " << size << std::endl;
-
-        //DHSet<unsigned>::Iterator dit(*nbs);
-        //while(dit.hasNext()){ std::cout << dit.next() << std::endl; }
-
+        unsigned size = std::min<unsigned>(nbs->size(),atleast.size()-1);
         for(;size>0;size--){
           atleast[size].push(c);
         }
       }
-      //std::cout << "Searching" << std::endl;
 
       for(unsigned i=atleast.size()-1;i>1;i--){
         // in this case we would expect atleast[i] to be the clique
         if(atleast[i].size() == i+1){
-          //std::cout << "CASE 1" << std::endl;
           if(checkClique(Ngraph,atleast[i])){
-            //std::cout << "FIND(A) max clique of " << (i+1) << std::endl;
-            //for(unsigned j=0;j<atleast[i].size();j++){ std::cout << atleast[i][j] << " ";}; std::cout << std::endl;
             return i+1;
           }
         }
-        // in this case atleast[i] may contain a clique but cannot be a clique itself
-        // we need to look at subsets
-        else if (atleast[i].size() > i+1){
-          //std::cout << "CASE 2" << std::endl;
+        // atleast[i] may contain a clique but cannot be one itself
+        else if(atleast[i].size() > i+1){
           unsigned left = atleast[i].size();
           Stack<unsigned>::Iterator niter(atleast[i]);
           while(niter.hasNext() && left >= i+1){
             unsigned c = niter.next();
-            //std::cout << ">> " << c << std::endl;
-            auto ns = Ngraph->get(c);
+            DHSet<unsigned>* ns = Ngraph->get(c);
             if(ns->size()==i){
               Stack<unsigned> clique;
               clique.loadFromIterator(ns->iterator());
               clique.push(c);
               if(checkClique(Ngraph,clique)){
-                //std::cout << "FIND(B) max clique of " << (i+1) << std::endl;
                 return i+1;
               }
               left--;
             }
           }
-          //std::cout << "In this case with " << std::left << " left" << std::endl;
         }
       }
-
-      //for(unsigned i=1;i<atleast.size();i++){
-      //  std::cout << i << ":"<< atleast[i].size() << std::endl; 
-      //}
       return 1;
     }
-  private:
 
-    // check if a clique is a clique
+    /** Check that the vertices of @b clique are pairwise adjacent */
     static bool checkClique(DHMap<unsigned,DHSet<unsigned>*>* Ngraph, Stack<unsigned>& clique)
     {
-      //std::cout << "CHECK "; for(unsigned j=0;j<clique.size();j++){ std::cout << clique[j] << " ";}; std::cout << std::endl;
-
-      for(unsigned i=0;i<clique.size()-1;i++){
-        unsigned c1 = clique[i];
-        auto ns = Ngraph->get(c1);
-        //std::cout << c1 << " neighbours: "; 
-        //DHSet<unsigned>::Iterator pit(*ns);while(pit.hasNext()){std::cout << pit.next() << " ";};std::cout<<std::endl;
+      for(unsigned i=0;i+1<clique.size();i++){
+        DHSet<unsigned>* ns;
+        if(!Ngraph->find(clique[i],ns)){
+          return false;
+        }
         for(unsigned j=i+1;j<clique.size();j++){
-          unsigned c2 = clique[j];
-          //std::cout << "checking " << c2 << " is a neighbour of " << c1 << std::endl;
-          if(!ns->find(c2)){ return false; }
+          if(clique[j]==clique[i] || !ns->find(clique[j])){
+            return false;
+          }
         }
       }
       return true;
     }
 
+    /** The state of the search on a graph with vertices 0..n-1 */
+    class Search {
+    public:
+      Search(unsigned n) : _n(n), _words((n+63)/64), _best(1), _nodes(0)
+      {
+        _adj.expand(_n*_words,0);
+        // a clique has at most n vertices, so the depth is at most n
+        for(unsigned i=0;i<=_n+1;i++){
+          _levels.push(Stack<uint64_t>());
+        }
+      }
 
-  };
+      void addEdge(unsigned a, unsigned b)
+      {
+        _adj[a*_words+b/64] |= uint64_t(1) << (b%64);
+        _adj[b*_words+a/64] |= uint64_t(1) << (a%64);
+      }
 
+      unsigned run()
+      {
+        Stack<uint64_t>& cand = _levels[0];
+        cand.reset();
+        for(unsigned w=0;w<_words;w++){
+          cand.push(~uint64_t(0));
+        }
+        if(_n%64){
+          cand[_words-1] = (uint64_t(1) << (_n%64)) - 1;
+        }
+        expand(0,0);
+        return _best;
+      }
 
+    private:
+      /**
+       * Extend a clique of @b size vertices by the candidates of depth
+       * @b depth, the vertices adjacent to all of its vertices.
+       */
+      void expand(unsigned depth, unsigned size)
+      {
+        if(++_nodes>MAX_NODES){
+          return;
+        }
+
+        // greedy colouring of the candidates: every vertex gets the first
+        // colour none of its neighbours coloured before has
+        static Stack<unsigned> orders;
+        static Stack<unsigned> colours;
+        unsigned base = orders.size();
+        {
+          Stack<uint64_t>& cand = _levels[depth];
+          static Stack<uint64_t> uncoloured;
+          static Stack<uint64_t> colourClass;
+          uncoloured = cand;
+          unsigned colour = 0;
+          unsigned left = 0;
+          for(uint64_t w : uncoloured){
+            left += __builtin_popcountll(w);
+          }
+          while(left){
+            colour++;
+            colourClass = uncoloured;
+            for(unsigned w=0;w<_words;w++){
+              while(colourClass[w]){
+                unsigned v = w*64+__builtin_ctzll(colourClass[w]);
+                colourClass[w] &= colourClass[w]-1;
+                uncoloured[w] &= ~(uint64_t(1) << (v%64));
+                left--;
+                const uint64_t* nbs = &_adj[v*_words];
+                for(unsigned u=w;u<_words;u++){
+                  colourClass[u] &= ~nbs[u];
+                }
+                orders.push(v);
+                colours.push(colour);
+              }
+            }
+          }
+        }
+
+        // the vertices with the highest colours first, until the colours
+        // show no larger clique can be found
+        Stack<uint64_t>& cand = _levels[depth];
+        Stack<uint64_t>& next = _levels[depth+1];
+        for(unsigned i=orders.size();i>base;i--){
+          if(size+colours[i-1]<=_best || _nodes>MAX_NODES){
+            break;
+          }
+          unsigned v = orders[i-1];
+          const uint64_t* nbs = &_adj[v*_words];
+          next.reset();
+          bool empty = true;
+          for(unsigned w=0;w<_words;w++){
+            uint64_t word = cand[w] & nbs[w];
+            empty &= !word;
+            next.push(word);
+          }
+          if(empty){
+            _best = std::max(_best,size+1);
+          }
+          else{
+            expand(depth+1,size+1);
+          }
+          cand[v/64] &= ~(uint64_t(1) << (v%64));
+        }
+        orders.truncate(base);
+        colours.truncate(base);
+      }
+
+      unsigned _n;
+      unsigned _words;
+      /** the adjacency bitsets, _words words per vertex */
+      DArray<uint64_t> _adj;
+      /** the candidate sets, by depth */
+      Stack<Stack<uint64_t>> _levels;
+      /** the size of the largest clique found */
+      unsigned _best;
+      unsigned _nodes;
+    };
+
+  };
 
 }
 
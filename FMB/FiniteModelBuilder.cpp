@@ -27,6 +27,7 @@
 
 #include "SAT/CadicalInterfacing.hpp"
 #include "SAT/MinisatInterfacing.hpp"
+#include "SAT/PortfolioSATSolver.hpp"
 
 #include "Lib/Environment.hpp"
 #include "Lib/Timer.hpp"
@@ -242,6 +243,10 @@ bool FiniteModelBuilder::reset(){
   }
 
   // Create a new SAT solver
+  // The offsets above (and so every propositional variable of the encoding) depend on
+  // all the current sort sizes, so nothing of the previous encoding carries over and the
+  // old solver is dropped. Keeping the solver alive across sizes would first need a
+  // size-independent numbering of the symbol tables, e.g. one block per domain element.
   if (env.options->satSolver() == Options::SatSolver::MINISAT) {
     if(env.options->fmbUseSimplifyingSolver())
       _solver = new MinisatInterfacingNewSimp;
@@ -250,8 +255,11 @@ bool FiniteModelBuilder::reset(){
   }
   else if (env.options->satSolver() == Options::SatSolver::CADICAL) {
     _solver = new CadicalInterfacing;
+  }
+  else if (env.options->satSolver() == Options::SatSolver::PORTFOLIO) {
+    _solver = new PortfolioSATSolver(new MinisatInterfacing, new CadicalInterfacing);
   } else {
-    USER_ERROR("Finite model builder can only use minisat or cadical as SAT solvers.");
+    USER_ERROR("Finite model builder can only use minisat, cadical or their portfolio as SAT solvers.");
   }
 
   // set the number of SAT variables, this could cause an exception
@@ -389,6 +397,7 @@ void FiniteModelBuilder::init()
   if(!_prb.units()) return;
 
   env.statistics->phase = ExecutionPhase::FMB_PREPROCESSING;
+  TIME_TRACE("fmb preprocessing");
 
   DHSet<std::pair<unsigned,unsigned>> vampire_sort_constraints_nonstrict;
   DHSet<std::pair<unsigned,unsigned>> vampire_sort_constraints_strict;
@@ -1012,6 +1021,54 @@ void FiniteModelBuilder::addNewInstances()
       }
     }
     
+    // The SAT variable of a grounded literal is its offset plus the sum,
+    // over the arguments, of the stride of the argument times its value
+    // minus one (see getSATLiteral). The offsets and strides only depend
+    // on the model sizes, so they are computed once for all the instances.
+    struct LiteralPlan {
+      unsigned offset;
+      bool positive;
+      bool twoVarEquality;
+      // the arguments of the literal in argPlan, or the two variables of x=y
+      unsigned first;
+      unsigned cnt;
+    };
+    static Stack<LiteralPlan> litPlan;
+    // pairs of a variable and the stride of its argument position
+    static Stack<std::pair<unsigned,unsigned>> argPlan;
+    litPlan.reset();
+    argPlan.reset();
+    for(unsigned lindex=0;lindex<c->length();lindex++){
+      Literal* lit = (*c)[lindex];
+      if(lit->isTwoVarEquality()){
+        litPlan.push({ 0, lit->isPositive(), true, lit->nthArgument(0)->var(), lit->nthArgument(1)->var() });
+        continue;
+      }
+      Term* t = lit;
+      bool isFunction = lit->isEquality();
+      if(isFunction){
+        ASS(lit->nthArgument(0)->isTerm());
+        ASS(lit->nthArgument(1)->isVar());
+        t = lit->nthArgument(0)->term();
+      }
+      unsigned functor = t->functor();
+      DArray<unsigned>& signature = isFunction ?
+                 _sortedSignature->functionSignatures[functor] :
+                 _sortedSignature->predicateSignatures[functor];
+      LiteralPlan lp { isFunction ? f_offsets[functor] : p_offsets[functor], lit->isPositive(), false, static_cast<unsigned>(argPlan.size()), 0 };
+      unsigned mult=1;
+      for(unsigned j=0;j<t->arity();j++){
+        ASS(t->nthArgument(j)->isVar());
+        argPlan.push(std::make_pair(t->nthArgument(j)->var(), mult));
+        mult *= _sortModelSizes[signature[j]];
+      }
+      if(isFunction){
+        argPlan.push(std::make_pair(lit->nthArgument(1)->var(), mult));
+      }
+      lp.cnt = argPlan.size()-lp.first;
+      litPlan.push(lp);
+    }
+
     static DArray<unsigned> grounding;
     grounding.ensure(vars);
 
@@ -1074,49 +1131,22 @@ instanceLabel:
         }
 
         // Ground and translate each literal into a SATLiteral
-        for(unsigned lindex=0;lindex<c->length();lindex++){
-          Literal* lit = (*c)[lindex];
-
+        for(const LiteralPlan& lp : litPlan){
           // check cases where literal is x=y
-          if(lit->isTwoVarEquality()){
-            bool equal = grounding[lit->nthArgument(0)->var()] == grounding[lit->nthArgument(1)->var()]; 
-            if((lit->isPositive() && equal) || (!lit->isPositive() && !equal)){
+          if(lp.twoVarEquality){
+            bool equal = grounding[lp.first] == grounding[lp.cnt];
+            if(equal == lp.positive){
               //Skip instance
-              goto instanceLabel; 
-            } 
-            if((lit->isPositive() && !equal) || (!lit->isPositive() && equal)){
-              //Skip literal
-              continue;
+              goto instanceLabel;
             }
+            //Skip literal
+            continue;
           }
-          if(lit->isEquality()){
-            ASS(lit->nthArgument(0)->isTerm());
-            ASS(lit->nthArgument(1)->isVar());
-            Term* t = lit->nthArgument(0)->term();
-            unsigned functor = t->functor();
-            unsigned arity = t->arity();
-            static DArray<unsigned> use;
-            use.ensure(arity+1);
-
-            for(unsigned j=0;j<arity;j++){
-              ASS(t->nthArgument(j)->isVar());
-              use[j] = grounding[t->nthArgument(j)->var()];
-            }
-            use[arity]=grounding[lit->nthArgument(1)->var()];
-            satClauseLits.push(getSATLiteral(functor,use,lit->polarity(),true));
-
-          }else{
-            unsigned functor = lit->functor();
-            unsigned arity = lit->arity();
-            static DArray<unsigned> use;
-            use.ensure(arity);
-
-            for(unsigned j=0;j<arity;j++){
-              ASS(lit->nthArgument(j)->isVar());
-              use[j] = grounding[lit->nthArgument(j)->var()];
-            }
-            satClauseLits.push(getSATLiteral(functor,use,lit->polarity(),false));
+          unsigned var = lp.offset;
+          for(unsigned j=lp.first;j<lp.first+lp.cnt;j++){
+            var += argPlan[j].second*(grounding[argPlan[j].first]-1);
           }
+          satClauseLits.push(SATLiteral(var,lp.positive));
         }
      
         SATClause* satCl = SATClause::fromStack(satClauseLits);
@@ -1753,8 +1783,8 @@ MainLoopResult FiniteModelBuilder::runImpl()
               }
 
               Stack<std::pair<unsigned,unsigned>>::Iterator it2(_strict_distinct_sort_constraints);
-              while (it1.hasNext()) {
-                std::pair<unsigned,unsigned> constr = it1.next();
+              while (it2.hasNext()) {
+                std::pair<unsigned,unsigned> constr = it2.next();
                 if (_distinctSortSizes[constr.first] <= _distinctSortSizes[constr.second]) {
                   _distinctSortSizes[constr.first] = _distinctSortSizes[constr.second]+1;
                   updated = true;
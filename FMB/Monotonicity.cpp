@@ -17,6 +17,8 @@
 
 #include "Lib/Stack.hpp"
 #include "Lib/DHMap.hpp"
+#include "Debug/TimeProfiling.hpp"
+
 #include "Lib/Environment.hpp"
 #include "Lib/List.hpp"
 
@@ -40,6 +42,7 @@ using namespace std;
 
 Monotonicity::Monotonicity(ClauseList* clauses, unsigned srt) : _srt(srt)
 {
+  TIME_TRACE("fmb monotonicity");
   _solver = new MinisatInterfacing;
 
  // create pt and pf per predicate and add the constraint -pf | -pt
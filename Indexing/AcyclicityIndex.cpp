@@ -57,7 +57,8 @@ namespace Indexing
 
   AcyclicityIndex::AcyclicityIndex(SaturationAlgorithm&) :
     _sIndexes(),
-    _tis(new TermSubstitutionTree<TermLiteralClause>())
+    _tis(new TermSubstitutionTree<TermLiteralClause>()),
+    _subtermTis(new TermSubstitutionTree<TermLiteralClause>())
   {}
   
   List<TypedTermList>* AcyclicityIndex::getSubterms(Term *t)
@@ -415,8 +416,13 @@ namespace Indexing
 
       ULit ulit = make_pair(lit, c);
       if (!index->find(ulit)) {
-        index->insert(ulit, new IndexEntry(lit, c, TypedTermList(*t,sort), getSubterms(fs->term())));
+        List<TypedTermList>* subterms = getSubterms(fs->term());
+        index->insert(ulit, new IndexEntry(lit, c, TypedTermList(*t,sort), subterms));
         _tis->insert(TermLiteralClause{ TypedTermList(*t, sort), lit, c });
+        List<TypedTermList>::Iterator it(subterms);
+        while (it.hasNext()) {
+          _subtermTis->insert(TermLiteralClause{ it.next(), lit, c });
+        }
       }
     }
   }
@@ -429,16 +435,57 @@ namespace Indexing
      
     if (matchesPattern(lit, fs, t, &sort) && _sIndexes.find(sort)) {
       ULit ulit = make_pair(lit, c);
-      if (!_sIndexes.get(sort)->find(ulit))
+      IndexEntry* entry;
+      if (!_sIndexes.get(sort)->find(ulit, entry))
         return;
 
+      List<TypedTermList>::Iterator it(entry->subterms);
+      while (it.hasNext()) {
+        _subtermTis->remove(TermLiteralClause{ it.next(), lit, c });
+      }
       _sIndexes.get(sort)->remove(ulit);
       _tis->remove(TermLiteralClause{ TypedTermList(*t, sort), lit, c });
     }
   }
 
+  /**
+   * False if no cycle can go through the indexed equation @b lit of @b c.
+   *
+   * A cycle leaves the equation t = f(...) through a subterm of f(...)
+   * unifying with the left-hand side of an indexed equation, and comes back
+   * through a subterm of an indexed equation unifying with t. The search
+   * only unifies instances of these terms, so if either lookup fails, the
+   * search would find nothing.
+   */
+  bool AcyclicityIndex::mayCloseCycle(Literal *lit, Clause *c)
+  {
+    if (!lit->isEquality()) {
+      return false;
+    }
+    SIndex* index;
+    IndexEntry* entry;
+    if (!_sIndexes.find(SortHelper::getEqualityArgumentSort(lit), index) ||
+        !index->find(make_pair(lit, c), entry)) {
+      return false;
+    }
+
+    if (!_subtermTis->getUnifications(entry->t, false).hasNext()) {
+      return false;
+    }
+    List<TypedTermList>::Iterator it(entry->subterms);
+    while (it.hasNext()) {
+      if (_tis->getUnifications(it.next(), false).hasNext()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   CycleQueryResultsIterator AcyclicityIndex::queryCycles(Literal *lit, Clause *c)
   {
+    if (!mayCloseCycle(lit, c)) {
+      return CycleQueryResultsIterator::getEmpty();
+    }
     return pvi(CycleSearchIterator(lit, c, *this));
   }
 }
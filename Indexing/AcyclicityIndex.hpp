@@ -64,6 +64,7 @@ protected:
   void handleClause(Kernel::Clause* c, bool adding) override;
 private:
   bool matchesPattern(Kernel::Literal *lit, Kernel::TermList *&fs, Kernel::TermList *&t, TermList *sort);
+  bool mayCloseCycle(Kernel::Literal *lit, Kernel::Clause *c);
   Lib::List<TypedTermList>* getSubterms(Kernel::Term *t);
   
   struct IndexEntry;
@@ -73,7 +74,13 @@ private:
   typedef Lib::DHMap<ULit, IndexEntry*> SIndex;
 
   Lib::DHMap<TermList, SIndex*> _sIndexes;
+  /** the terms t of the indexed equations t = f(...) */
   TermIndexingStructure* _tis;
+  /**
+   * the constructor subterms of the indexed equations, kept along with
+   * _tis to rule out cycles without searching
+   */
+  TermIndexingStructure* _subtermTis;
 };
 
 }
@@ -0,0 +1,71 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file ClauseBodyIndex.cpp
+ * Implements class ClauseBodyIndex.
+ */
+
+#include <algorithm>
+
+#include "Lib/Hash.hpp"
+#include "Lib/Stack.hpp"
+
+#include "Kernel/Clause.hpp"
+
+#include "ClauseBodyIndex.hpp"
+
+namespace Indexing {
+
+/** The hash code of the body of @b cl, independent of the order of its literals */
+unsigned ClauseBodyIndex::bodyHash(Clause* cl)
+{
+  uint64_t res = cl->length();
+  for (Literal* lit : cl->iterLits()) {
+    // a sum, so that the order does not matter and repeated literals count
+    res += HashUtils::mix(lit->getId());
+  }
+  return static_cast<unsigned>(res ^ (res >> 32));
+}
+
+/** True if @b c1 and @b c2 have the same multisets of literals */
+bool ClauseBodyIndex::sameBody(Clause* c1, Clause* c2)
+{
+  unsigned len = c1->length();
+  if (len != c2->length()) {
+    return false;
+  }
+  static Stack<Literal*> lits1;
+  static Stack<Literal*> lits2;
+  lits1.reset();
+  lits2.reset();
+  lits1.loadFromIterator(c1->iterLits());
+  lits2.loadFromIterator(c2->iterLits());
+  std::sort(lits1.begin(), lits1.end());
+  std::sort(lits2.begin(), lits2.end());
+  return std::equal(lits1.begin(), lits1.end(), lits2.begin());
+}
+
+Clause* ClauseBodyIndex::findDuplicate(Clause* cl)
+{
+  noteQuery();
+  Clause* res;
+  return _clauses.find(Body{cl}, res) ? res : nullptr;
+}
+
+void ClauseBodyIndex::handleClause(Clause* c, bool adding)
+{
+  if (adding) {
+    _clauses.insert(c);
+  } else {
+    ALWAYS(_clauses.remove(c));
+  }
+}
+
+}
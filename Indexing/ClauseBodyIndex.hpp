@@ -0,0 +1,74 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file ClauseBodyIndex.hpp
+ * Defines class ClauseBodyIndex of clauses by their multisets of literals.
+ */
+
+#ifndef __ClauseBodyIndex__
+#define __ClauseBodyIndex__
+
+#include "Forwards.hpp"
+
+#include "Lib/SwissSet.hpp"
+
+#include "Index.hpp"
+
+namespace Indexing {
+
+using namespace Lib;
+using namespace Kernel;
+
+/**
+ * Index of clauses by their bodies, the multisets of their literals.
+ *
+ * Literals are shared, so two clauses have the same body iff they have the
+ * same literal pointers in some order. The hash code of a body does not
+ * depend on the order of the literals, and bodies with equal hash codes are
+ * compared by sorting copies of their literal arrays, so finding an exact
+ * duplicate costs a hash lookup instead of a subsumption check.
+ */
+class ClauseBodyIndex
+: public Index
+{
+public:
+  ClauseBodyIndex(SaturationAlgorithm&) {}
+
+  /** A clause of the index with the body of @b cl other than @b cl, or nullptr */
+  Clause* findDuplicate(Clause* cl);
+
+  static unsigned bodyHash(Clause* cl);
+  static bool sameBody(Clause* c1, Clause* c2);
+
+protected:
+  void handleClause(Clause* c, bool adding) override;
+
+private:
+  /**
+   * Clauses are inserted and removed by identity, as several clauses of
+   * the index may have the same body; a Body looks up any of them.
+   */
+  struct Body {
+    Clause* cl;
+  };
+
+  struct BodyHash {
+    static unsigned hash(Clause* cl) { return bodyHash(cl); }
+    static bool equals(Clause* c1, Clause* c2) { return c1 == c2; }
+    static unsigned hash(Body b) { return bodyHash(b.cl); }
+    static bool equals(Clause* c, Body b) { return c != b.cl && sameBody(c, b.cl); }
+  };
+
+  SwissSet<Clause*, BodyHash> _clauses;
+};
+
+};
+
+#endif /*__ClauseBodyIndex__*/
@@ -153,6 +153,21 @@ void HashingClauseVariantIndex::insert(Clause* cl)
   // cout << _entries.size() << "buckets after " << ++insertions << " insertions" << endl;
 }
 
+void HashingClauseVariantIndex::remove(Clause* cl)
+{
+  TIME_TRACE("hvci remove");
+
+  unsigned h = computeHash(cl->literals(),cl->length());
+
+  ClauseList** lst = _entries.findPtr(h);
+  ASS(lst);
+  ASS(ClauseList::member(cl, *lst));
+  *lst = ClauseList::remove(cl, *lst);
+  if (!*lst) {
+    _entries.remove(h);
+  }
+}
+
 ClauseIterator HashingClauseVariantIndex::retrieveVariants(Literal* const * lits, unsigned length)
 {
   TIME_TRACE("hvci retrieve");
@@ -52,6 +52,8 @@ public:
   ~HashingClauseVariantIndex() override;
 
   void insert(Clause* cl) override;
+  /** Remove @b cl, which must have been inserted before */
+  void remove(Clause* cl);
 
   ClauseIterator retrieveVariants(Literal* const * lits, unsigned length) override;
 
@@ -12,6 +12,7 @@
  * Implements class CodeTree.
  */
 
+#include <algorithm>
 #include <utility>
 
 #include "Debug/RuntimeStatistics.hpp"
@@ -28,6 +29,13 @@
 
 #define GROUND_TERM_CHECK 0
 
+/** Dispatch code tree instructions with computed gotos (a GNU extension) where available */
+#if defined(__GNUC__)
+#define CODE_TREE_THREADED_DISPATCH 1
+#else
+#define CODE_TREE_THREADED_DISPATCH 0
+#endif
+
 #undef RSTAT_COLLECTION
 #define RSTAT_COLLECTION 0
 
@@ -100,7 +108,7 @@ CodeTree::MatchInfo* CodeTree::MatchInfo::alloc(unsigned bindCnt)
   size_t size=sizeof(MatchInfo)+bindCnt*sizeof(TermList);
   size-=sizeof(TermList);
 
-  void* mem=ALLOC_KNOWN(size,"CodeTree::MatchInfo");
+  void* mem=ALLOC_ACCOUNTED(size, INDEXING);
   return reinterpret_cast<MatchInfo*>(mem);
 }
 
@@ -115,7 +123,7 @@ void CodeTree::MatchInfo::destroy(unsigned bindCnt)
   size_t size=sizeof(MatchInfo)+bindCnt*sizeof(TermList);
   size-=sizeof(TermList);
 
-  DEALLOC_KNOWN(this, size,"CodeTree::MatchInfo");
+  DEALLOC_ACCOUNTED(this, size, INDEXING);
 }
 
 
@@ -140,7 +148,7 @@ CodeTree::ILStruct::ILStruct(const Literal* lit, unsigned varCnt, Stack<unsigned
   if(varCnt) {
     size_t gvnSize=sizeof(unsigned)*varCnt;
     globalVarNumbers=static_cast<unsigned*>(
-	ALLOC_KNOWN(gvnSize, "CodeTree::ILStruct::globalVarNumbers"));
+	ALLOC_ACCOUNTED(gvnSize, INDEXING));
     memcpy(globalVarNumbers, gvnStack.begin(), gvnSize);
   }
   else {
@@ -163,15 +171,12 @@ CodeTree::ILStruct::~ILStruct()
 
   if(globalVarNumbers) {
     size_t gvSize=sizeof(unsigned)*varCnt;
-    DEALLOC_KNOWN(globalVarNumbers, gvSize,
-		"CodeTree::ILStruct::globalVarNumbers");
+    DEALLOC_ACCOUNTED(globalVarNumbers, gvSize, INDEXING);
     if(sortedGlobalVarNumbers) {
-      DEALLOC_KNOWN(sortedGlobalVarNumbers, gvSize,
-		  "CodeTree::ILStruct::sortedGlobalVarNumbers");
+      DEALLOC_ACCOUNTED(sortedGlobalVarNumbers, gvSize, INDEXING);
     }
     if(globalVarPermutation) {
-      DEALLOC_KNOWN(globalVarPermutation, gvSize,
-		  "CodeTree::ILStruct::globalVarPermutation");
+      DEALLOC_ACCOUNTED(globalVarPermutation, gvSize, INDEXING);
     }
   }
 }
@@ -210,9 +215,9 @@ void CodeTree::ILStruct::putIntoSequence(ILStruct* previous_)
 
   size_t gvSize=sizeof(unsigned)*varCnt;
   sortedGlobalVarNumbers=static_cast<unsigned*>(
-	ALLOC_KNOWN(gvSize, "CodeTree::ILStruct::sortedGlobalVarNumbers"));
+	ALLOC_ACCOUNTED(gvSize, INDEXING));
   globalVarPermutation=static_cast<unsigned*>(
-	ALLOC_KNOWN(gvSize, "CodeTree::ILStruct::globalVarPermutation"));
+	ALLOC_ACCOUNTED(gvSize, INDEXING));
 
   for(unsigned i=0;i<varCnt;i++) {
     sortedGlobalVarNumbers[i]=gvArr[i].first;
@@ -482,41 +487,42 @@ CodeTree::SearchStructImpl<k>::SearchStructImpl(size_t length)
 {
 }
 
+/**
+ * Search structures with up to this many entries are searched by
+ * counting smaller values in one pass instead of by binary search.
+ * The loop has no data-dependent branches, so the compiler can
+ * vectorize it, and it avoids the mispredictions of bisecting.
+ */
+static constexpr size_t SEARCH_STRUCT_LINEAR_MAX = 32;
+
 template<CodeTree::SearchStruct::Kind k>
 template<bool doInsert>
 CodeTree::CodeOp*& CodeTree::SearchStructImpl<k>::targetOp(const T& val)
 {
-  size_t left=0;
-  size_t right=length()-1;
-  while(left<right) {
-    size_t mid=(left+right)/2;
-    switch(Int::compare(val, values[mid])) {
-    case LESS:
-      right=mid;
-      break;
-    case GREATER:
-      left=mid+1;
-      break;
-    case EQUAL:
-      return targets[mid];
+  ASS_G(length(),0);
+
+  // position of the first value not smaller than val
+  size_t pos;
+  if (length() <= SEARCH_STRUCT_LINEAR_MAX) {
+    pos=0;
+    for(size_t i=0; i<length(); i++) {
+      pos += values[i] < val;
     }
+  } else {
+    pos=std::lower_bound(values.begin(), values.end(), val)-values.begin();
   }
-  ASS_EQ(left,right);
-  ASS(left==length()-1 || val<=values[left]);
 
-  if constexpr (!doInsert) {
-    return targets[left];
+  if (pos<length() && val==values[pos]) {
+    return targets[pos];
   }
-  if (val==values[left]) {
-    return targets[left];
+  if constexpr (!doInsert) {
+    // the caller checks the returned op, so any nearby one will do
+    return targets[std::min(pos,length()-1)];
   }
 
-  if (val>=values[left]) {
-    left++;
-  }
-  targets.insert(targets.begin()+left,0);
-  values.insert(values.begin()+left,val);
-  return targets[left];
+  targets.insert(targets.begin()+pos,0);
+  values.insert(values.begin()+pos,val);
+  return targets[pos];
 }
 
 inline bool CodeTree::BaseMatcher::doCheckGroundTerm()
@@ -1186,6 +1192,7 @@ bool CodeTree::RemovingMatcher<checkRange>::next()
   for(;;) {
     if(op->alternative()) {
       btStack.push(BTPoint(tp, op->alternative(), firstsInBlocks->size()));
+      VAMPIRE_PREFETCH(op->alternative());
     }
     switch(op->_instruction()) {
       case SUCCESS_OR_FAIL:
@@ -1378,10 +1385,80 @@ bool CodeTree::Matcher::execute()
   }
 
 
+#if CODE_TREE_THREADED_DISPATCH
+  // Threaded dispatch: every instruction jumps directly to the handler of
+  // the next one, so each of them gets its own indirect branch (and branch
+  // prediction history) instead of all sharing the one of a switch.
+  static void* const handlers[] = {
+    &&op_success_or_fail, // SUCCESS_OR_FAIL
+    &&op_check_ground_term, // CHECK_GROUND_TERM
+    &&op_lit_end, // LIT_END
+    &&op_check_fun, // CHECK_FUN
+    &&op_assign_var, // ASSIGN_VAR
+    &&op_check_var, // CHECK_VAR
+    &&op_search_struct, // SEARCH_STRUCT
+  };
+  static_assert(sizeof(handlers)/sizeof(handlers[0]) == SEARCH_STRUCT+1, "one handler per instruction");
+
+#define CT_DISPATCH()                                        \
+  do {                                                       \
+    if(op->alternative()) {                                  \
+      btStack.push(BTPoint(tp, op->alternative()));          \
+      VAMPIRE_PREFETCH(op->alternative());                   \
+    }                                                        \
+    goto *handlers[op->_instruction()];                      \
+  } while(0)
+  //the SEARCH_STRUCT operation does not appear in CodeBlocks and in each
+  //CodeBlock there is always either operation LIT_END or FAIL, so if we
+  //haven't encountered one yet, we may safely increase the operation pointer
+#define CT_NEXT() do { ASS(!op->isSearchStruct()); op++; CT_DISPATCH(); } while(0)
+#define CT_FAIL() do { if(!backtrack()) { return false; } CT_DISPATCH(); } while(0)
+
+  CT_DISPATCH();
+
+op_success_or_fail:
+  //yield successes only in the first round (we don't want to yield the
+  //same thing for each query literal)
+  if(op->isFail() || curLInfo!=0) {
+    CT_FAIL();
+  }
+  return true;
+op_lit_end:
+  return true;
+op_check_ground_term:
+  if(!doCheckGroundTerm()) {
+    CT_FAIL();
+  }
+  CT_NEXT();
+op_check_fun:
+  if(!doCheckFun()) {
+    CT_FAIL();
+  }
+  CT_NEXT();
+op_assign_var:
+  doAssignVar();
+  CT_NEXT();
+op_check_var:
+  if(!doCheckVar()) {
+    CT_FAIL();
+  }
+  CT_NEXT();
+op_search_struct:
+  if(doSearchStruct()) {
+    //a new value of @b op is assigned
+    CT_DISPATCH();
+  }
+  CT_FAIL();
+
+#undef CT_FAIL
+#undef CT_NEXT
+#undef CT_DISPATCH
+#else
   bool shouldBacktrack=false;
   for(;;) {
     if(op->alternative()) {
       btStack.push(BTPoint(tp, op->alternative()));
+      VAMPIRE_PREFETCH(op->alternative());
     }
     switch(op->_instruction()) {
       case SUCCESS_OR_FAIL:
@@ -1437,6 +1514,7 @@ bool CodeTree::Matcher::execute()
       op++;
     }
   }
+#endif
 }
 
 /**
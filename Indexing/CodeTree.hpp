@@ -20,6 +20,7 @@
 #include "Lib/Allocator.hpp"
 #include "Lib/DArray.hpp"
 #include "Lib/DHMap.hpp"
+#include "Lib/Portability.hpp"
 #include "Lib/Stack.hpp"
 #include "Lib/Vector.hpp"
 
@@ -110,7 +111,7 @@ public:
 
     void ensureFreshness(unsigned globalTimestamp);
 
-    USE_ALLOCATOR(ILStruct);
+    USE_ACCOUNTED_ALLOCATOR(ILStruct, INDEXING);
 
     struct GVArrComparator;
 
@@ -92,21 +92,10 @@ class CodeTreeTIS<Data>::ResultIterator
 {
 public:
   ResultIterator(CodeTreeTIS* tree, TermList t, bool retrieveSubstitutions)
-  : _retrieveSubstitutions(retrieveSubstitutions),
+  : _subst(&_matcher->bindings, &*_resultNormalizer), _retrieveSubstitutions(retrieveSubstitutions),
     _found(0), _finished(false), _tree(tree)
   {
     _matcher->init(&_tree->_ct, t);
-
-    if(_retrieveSubstitutions) {
-      _subst = new CodeTreeSubstitution<Data>(&_matcher->bindings, &*_resultNormalizer);
-    }
-  }
-
-  ~ResultIterator() override
-  {
-    if(_retrieveSubstitutions) {
-      delete _subst;
-    }
   }
 
   USE_ALLOCATOR(ResultIterator);
@@ -136,7 +125,7 @@ public:
         _resultNormalizer->reset();
         _resultNormalizer->normalizeVariables(_found->term);
       }
-      subs = ResultSubstitutionSP(_subst, /* nondisposable */ true);
+      subs = ResultSubstitutionSP(&_subst, /* nondisposable */ true);
     }
     auto out = QueryRes<ResultSubstitutionSP, Data>(subs, _found);
     _found=0;
@@ -144,13 +133,14 @@ public:
   }
 private:
 
-  CodeTreeSubstitution<Data>* _subst;
+  // declared before the substitution, which refers to them
   Recycled<Renaming> _resultNormalizer;
+  Recycled<typename TermCodeTree<Data>::TermMatcher> _matcher;
+  CodeTreeSubstitution<Data> _subst;
   bool _retrieveSubstitutions;
   Data* _found;
   bool _finished;
   CodeTreeTIS* _tree;
-  Recycled<typename TermCodeTree<Data>::TermMatcher> _matcher;
 };
 
 template<class Data>
@@ -0,0 +1,272 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file GroundHashIndexingStructure.hpp
+ * Defines indexing structures that keep ground entries in a hash table
+ * in front of another indexing structure.
+ */
+
+#ifndef __GroundHashIndexingStructure__
+#define __GroundHashIndexingStructure__
+
+#include "Forwards.hpp"
+
+#include "Lib/DHMap.hpp"
+#include "Lib/Environment.hpp"
+#include "Lib/Metaiterators.hpp"
+#include "Lib/Stack.hpp"
+
+#include "Index.hpp"
+#include "LiteralIndexingStructure.hpp"
+#include "ResultSubstitution.hpp"
+#include "TermIndexingStructure.hpp"
+#include "TermSharing.hpp"
+
+namespace Indexing
+{
+
+using namespace Kernel;
+using namespace Lib;
+
+/**
+ * Entries whose key is a ground shared term or literal, by the key.
+ *
+ * Shared terms are hash-consed, so a ground entry is a generalization of a
+ * query exactly when its key is the query itself, and these can be looked
+ * up in constant time instead of by a tree retrieval.
+ */
+template<class Data>
+class GroundEntries
+{
+public:
+  ~GroundEntries() { clear(); }
+
+  static bool isGroundKey(Term* t) { return t->shared() && t->ground(); }
+
+  void insert(Term* key, Data data)
+  {
+    Stack<Data*>* entries;
+    _entries.getValuePtr(key, entries);
+    entries->push(new Data(std::move(data)));
+  }
+
+  void remove(Term* key, Data const& data)
+  {
+    Stack<Data*>* entries = _entries.findPtr(key);
+    ASS(entries);
+    for (unsigned i = 0; i < entries->size(); i++) {
+      if (*(*entries)[i] == data) {
+        delete (*entries)[i];
+        entries->swapRemove(i);
+        break;
+      }
+    }
+    if (entries->isEmpty()) {
+      _entries.remove(key);
+    }
+  }
+
+  /** Retrieval results for a query equal to @b key */
+  VirtualIterator<QueryRes<ResultSubstitutionSP, Data>> find(Term* key, bool retrieveSubstitutions) const
+  {
+    const Stack<Data*>* entries = _entries.findPtr(key);
+    if (!entries) {
+      return VirtualIterator<QueryRes<ResultSubstitutionSP, Data>>::getEmpty();
+    }
+    return pvi(iterTraits(entries->iterFifo())
+      .map([retrieveSubstitutions](Data* d) {
+        return queryRes(retrieveSubstitutions ? ResultSubstitutionSP(new IdentitySubstitution()) : ResultSubstitutionSP(), d);
+      }));
+  }
+
+  bool isEmpty() const { return _entries.isEmpty(); }
+
+  bool contains(Term* key) const { return _entries.findPtr(key); }
+
+  /** Hand all entries over to @b insert and forget them */
+  template<class Insert>
+  void moveAll(Insert insert)
+  {
+    typename DHMap<Term*, Stack<Data*>>::Iterator it(_entries);
+    while (it.hasNext()) {
+      Term* key;
+      for (Data* d : it.nextRef(key)) {
+        insert(std::move(*d));
+        delete d;
+      }
+    }
+    _entries.reset();
+  }
+
+private:
+  void clear()
+  {
+    typename DHMap<Term*, Stack<Data*>>::Iterator it(_entries);
+    while (it.hasNext()) {
+      Term* key;
+      for (Data* d : it.nextRef(key)) {
+        delete d;
+      }
+    }
+    _entries.reset();
+  }
+
+  DHMap<Term*, Stack<Data*>> _entries;
+};
+
+/**
+ * Term indexing structure that answers generalization queries for ground
+ * entries from a hash table and passes everything else to @b _inner.
+ *
+ * Other kinds of retrieval would have to find ground entries as well; the
+ * first such query moves the ground entries into @b _inner, which then
+ * receives all entries from there on.
+ */
+template<class Data>
+class GroundHashTIS : public TermIndexingStructure<Data>
+{
+public:
+  explicit GroundHashTIS(TermIndexingStructure<Data>* inner) : _inner(inner) {}
+
+  void handle(Data data, bool insert) final
+  {
+    TypedTermList key = data.key();
+    if (!_hashing || !key.isTerm() || !GroundEntries<Data>::isGroundKey(key.term())) {
+      _inner->handle(std::move(data), insert);
+    } else if (insert) {
+      _ground.insert(key.term(), std::move(data));
+    } else {
+      _ground.remove(key.term(), data);
+    }
+  }
+
+  VirtualIterator<QueryRes<ResultSubstitutionSP, Data>> getGeneralizations(TypedTermList t, bool retrieveSubstitutions = true) final
+  {
+    if (!_hashing || _ground.isEmpty() || !t.isTerm() || !GroundEntries<Data>::isGroundKey(t.term())) {
+      return _inner->getGeneralizations(t, retrieveSubstitutions);
+    }
+    return pvi(concatIters(
+      _ground.find(t.term(), retrieveSubstitutions),
+      _inner->getGeneralizations(t, retrieveSubstitutions)));
+  }
+
+  bool generalizationExists(TermList t) final
+  {
+    if (_hashing && t.isTerm() && GroundEntries<Data>::isGroundKey(t.term()) && _ground.contains(t.term())) {
+      return true;
+    }
+    return _inner->generalizationExists(t);
+  }
+
+  VirtualIterator<QueryRes<ResultSubstitutionSP, Data>> getUnifications(TypedTermList t, bool retrieveSubstitutions = true) final
+  { stopHashing(); return _inner->getUnifications(t, retrieveSubstitutions); }
+
+  VirtualIterator<QueryRes<AbstractingUnifier*, Data>> getUwa(TypedTermList t, Options::UnificationWithAbstraction uwa, bool fixedPointIteration) final
+  { stopHashing(); return _inner->getUwa(t, uwa, fixedPointIteration); }
+
+  VirtualIterator<QueryRes<ResultSubstitutionSP, Data>> getUnificationsUsingSorts(TypedTermList t, bool retrieveSubstitutions = true) final
+  { stopHashing(); return _inner->getUnificationsUsingSorts(t, retrieveSubstitutions); }
+
+  VirtualIterator<QueryRes<ResultSubstitutionSP, Data>> getInstances(TypedTermList t, bool retrieveSubstitutions = true) final
+  { stopHashing(); return _inner->getInstances(t, retrieveSubstitutions); }
+
+  void output(std::ostream& out) const final { out << *_inner; }
+
+private:
+  void stopHashing()
+  {
+    if (_hashing) {
+      _hashing = false;
+      _ground.moveAll([this](Data d) { _inner->insert(std::move(d)); });
+    }
+  }
+
+  std::unique_ptr<TermIndexingStructure<Data>> _inner;
+  GroundEntries<Data> _ground;
+  bool _hashing = true;
+};
+
+/**
+ * Literal indexing structure that answers generalization queries for
+ * ground entries from a hash table and passes everything else to
+ * @b _inner; the literal counterpart of GroundHashTIS.
+ */
+template<class Data>
+class GroundHashLIS : public LiteralIndexingStructure<Data>
+{
+public:
+  explicit GroundHashLIS(LiteralIndexingStructure<Data>* inner) : _inner(inner) {}
+
+  void handle(Data data, bool insert) final
+  {
+    Literal* key = data.key();
+    if (!_hashing || !GroundEntries<Data>::isGroundKey(key)) {
+      _inner->handle(std::move(data), insert);
+    } else if (insert) {
+      _ground.insert(key, std::move(data));
+    } else {
+      _ground.remove(key, data);
+    }
+  }
+
+  VirtualIterator<QueryRes<ResultSubstitutionSP, Data>> getGeneralizations(Literal* lit, bool complementary, bool retrieveSubstitutions = true) final
+  {
+    if (!_hashing || _ground.isEmpty() || !GroundEntries<Data>::isGroundKey(lit)) {
+      return _inner->getGeneralizations(lit, complementary, retrieveSubstitutions);
+    }
+    // shared equalities have their arguments in a normal order, so no
+    // second orientation needs to be looked up
+    Literal* key = complementary ? env.sharing->tryGetOpposite(lit) : lit;
+    if (!key) {
+      return _inner->getGeneralizations(lit, complementary, retrieveSubstitutions);
+    }
+    return pvi(concatIters(
+      _ground.find(key, retrieveSubstitutions),
+      _inner->getGeneralizations(lit, complementary, retrieveSubstitutions)));
+  }
+
+  VirtualIterator<Data> getAll() final
+  { stopHashing(); return _inner->getAll(); }
+
+  VirtualIterator<QueryRes<ResultSubstitutionSP, Data>> getUnifications(Literal* lit, bool complementary, bool retrieveSubstitutions = true) final
+  { stopHashing(); return _inner->getUnifications(lit, complementary, retrieveSubstitutions); }
+
+  VirtualIterator<QueryRes<AbstractingUnifier*, Data>> getUwa(Literal* lit, bool complementary, Options::UnificationWithAbstraction uwa, bool fixedPointIteration) final
+  { stopHashing(); return _inner->getUwa(lit, complementary, uwa, fixedPointIteration); }
+
+  VirtualIterator<QueryRes<ResultSubstitutionSP, Data>> getInstances(Literal* lit, bool complementary, bool retrieveSubstitutions = true) final
+  { stopHashing(); return _inner->getInstances(lit, complementary, retrieveSubstitutions); }
+
+  VirtualIterator<QueryRes<ResultSubstitutionSP, Data>> getVariants(Literal* lit, bool complementary, bool retrieveSubstitutions = true) final
+  { stopHashing(); return _inner->getVariants(lit, complementary, retrieveSubstitutions); }
+
+  size_t getUnificationCount(Literal* lit, bool complementary) final
+  { stopHashing(); return _inner->getUnificationCount(lit, complementary); }
+
+  void output(std::ostream& out, Option<unsigned> multilineIndent) const final
+  { _inner->output(out, multilineIndent); }
+
+private:
+  void stopHashing()
+  {
+    if (_hashing) {
+      _hashing = false;
+      _ground.moveAll([this](Data d) { _inner->insert(std::move(d)); });
+    }
+  }
+
+  std::unique_ptr<LiteralIndexingStructure<Data>> _inner;
+  GroundEntries<Data> _ground;
+  bool _hashing = true;
+};
+
+};
+
+#endif /*__GroundHashIndexingStructure__*/
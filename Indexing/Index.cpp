@@ -16,12 +16,19 @@
 #include "Index.hpp"
 #include "Forwards.hpp"
 
+#include "Lib/Environment.hpp"
+#include "Shell/Statistics.hpp"
+
 namespace Indexing
 {
 
 using namespace Lib;
 using namespace Kernel;
 using namespace Saturation;
+using namespace Shell;
+
+unsigned Index::s_totalQueries = 0;
+unsigned Index::s_totalUpdates = 0;
 
 Index::~Index()
 {
@@ -30,6 +37,76 @@ Index::~Index()
     _addedSD->unsubscribe();
     _removedSD->unsubscribe();
   }
+  if (_name && (_insertions || _queries)) {
+    Statistics::IndexUsage& usage = env.statistics->indexUsage[_name];
+    usage.insertions += _insertions;
+    usage.queries += _queries;
+  }
+}
+
+void Index::onAddedToContainer(Clause* c)
+{
+  s_totalUpdates++;
+  if (_deferInsertions) {
+    ALWAYS(_deferredPos.insert(c, _deferred.size()));
+    _deferred.push(c);
+    return;
+  }
+  _insertions++;
+  handleClause(c, true);
+}
+
+void Index::onRemovedFromContainer(Clause* c)
+{
+  s_totalUpdates++;
+  if (_deferInsertions && cancelDeferred(c)) {
+    return;
+  }
+  handleClause(c, false);
+}
+
+/**
+ * Insert the clauses queued since the last query.
+ */
+void Index::insertDeferred()
+{
+  for (Clause* c : _deferred) {
+    if (c) {
+      _insertions++;
+      handleClause(c, true);
+    }
+  }
+  _deferred.reset();
+  _deferredPos.reset();
+  _cancelledCnt = 0;
+}
+
+/**
+ * If @b c is queued for insertion, drop it from the queue and return true.
+ */
+bool Index::cancelDeferred(Clause* c)
+{
+  unsigned pos;
+  if (!_deferredPos.pop(c, pos)) {
+    return false;
+  }
+  _deferred[pos] = nullptr;
+  _cancelledCnt++;
+
+  // an index that is never queried must not accumulate cancelled entries
+  if (_cancelledCnt > _deferred.size() / 2) {
+    unsigned kept = 0;
+    for (unsigned i = 0; i < _deferred.size(); i++) {
+      if (Clause* d = _deferred[i]) {
+        _deferred[kept] = d;
+        _deferredPos.set(d, kept);
+        kept++;
+      }
+    }
+    _deferred.truncate(kept);
+    _cancelledCnt = 0;
+  }
+  return true;
 }
 
 /**
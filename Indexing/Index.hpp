@@ -18,7 +18,9 @@
 #include "Forwards.hpp"
 #include "Lib/Output.hpp"
 
+#include "Lib/DHMap.hpp"
 #include "Lib/Event.hpp"
+#include "Lib/Stack.hpp"
 #include "Kernel/Clause.hpp"
 #include "Kernel/Term.hpp"
 #include "Saturation/ClauseContainer.hpp"
@@ -188,21 +190,64 @@ public:
   virtual ~Index();
 
   void attachContainer(ClauseContainer* cc);
+
+  /**
+   * Name under which the index reports its insertion and query counts
+   * to Statistics when it is destroyed; unnamed indices do not report.
+   */
+  void setName(const char* name) { _name = name; }
+
+  /** Number of queries of all indices so far */
+  static unsigned totalQueries() { return s_totalQueries; }
+  /** Number of clauses added to or removed from all indices so far */
+  static unsigned totalUpdates() { return s_totalUpdates; }
 protected:
   Index() {}
 
-  void onAddedToContainer(Clause* c)
-  { handleClause(c, true); }
-  void onRemovedFromContainer(Clause* c)
-  { handleClause(c, false); }
+  void onAddedToContainer(Clause* c);
+  void onRemovedFromContainer(Clause* c);
 
   virtual void handleClause(Clause* c, bool adding) {}
 
+  /**
+   * Make the index queue added clauses and insert them only when the next
+   * query arrives. For indices that many strategies maintain but rarely
+   * query. To be called from the constructor of the index.
+   */
+  void deferInsertions() { _deferInsertions = true; }
+
+  /** To be called at the start of every query of the index */
+  void noteQuery()
+  {
+    _queries++;
+    s_totalQueries++;
+    if (_deferred.isNonEmpty()) {
+      insertDeferred();
+    }
+  }
+
   //TODO: postponing index modifications during iteration (methods isBeingIterated() etc...)
 
 private:
+  void insertDeferred();
+
+  static unsigned s_totalQueries;
+  static unsigned s_totalUpdates;
+  bool cancelDeferred(Clause* c);
+
   SubscriptionData _addedSD;
   SubscriptionData _removedSD;
+
+  const char* _name = nullptr;
+  unsigned _insertions = 0;
+  unsigned _queries = 0;
+
+  bool _deferInsertions = false;
+  /** added clauses not inserted yet, in order; cancelled ones are nullptr */
+  Stack<Clause*> _deferred;
+  /** positions of the clauses in _deferred */
+  DHMap<Clause*, unsigned> _deferredPos;
+  unsigned _cancelledCnt = 0;
 };
 
 };
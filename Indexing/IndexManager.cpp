@@ -12,6 +12,7 @@
  * Implements class IndexManager.
  */
 
+#include "ClauseBodyIndex.hpp"
 #include "CodeTreeInterfaces.hpp"
 #include "AcyclicityIndex.hpp"
 #include "LiteralIndex.hpp"
@@ -34,6 +35,7 @@ using namespace Indexing;
 SIMP_INDEX_IMPL(AlascaIndex<ALASCA::Demodulation::Lhs>)
 SIMP_INDEX_IMPL(AlascaIndex<ALASCA::Demodulation::Rhs>)
 SIMP_INDEX_IMPL(DemodulationLHSIndex)
+SIMP_INDEX_IMPL(ClauseBodyIndex)
 SIMP_INDEX_IMPL(CodeTreeSubsumptionIndex)
 SIMP_INDEX_IMPL(BackwardSubsumptionIndex)
 SIMP_INDEX_IMPL(FwSubsSimplifyingLiteralIndex)
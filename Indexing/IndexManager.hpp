@@ -46,6 +46,7 @@ public:
     }
 
     shared = std::make_shared<IndexType>(_alg);
+    shared->setName(indexName<IndexType, isGenerating>());
     weak = shared;
     attachContainer<isGenerating>(*shared);
     return shared;
@@ -55,6 +56,9 @@ private:
   template<typename IndexType, bool isGenerating>
   std::weak_ptr<IndexType> &getUniqueWeakPtr();
 
+  template<typename IndexType, bool isGenerating>
+  static const char* indexName();
+
   template<bool isGenerating>
   void attachContainer(Index &i);
   SaturationAlgorithm& _alg;
@@ -65,6 +69,10 @@ private:
   IndexManager::getUniqueWeakPtr<IndexType, isGenerating>() {               \
     static std::weak_ptr<IndexType> index;                                  \
     return index;                                                           \
+  }                                                                         \
+  template<> const char*                                                    \
+  IndexManager::indexName<IndexType, isGenerating>() {                      \
+    return isGenerating ? "Generating " #IndexType : "Simplifying " #IndexType; \
   }
 
 #define GEN_INDEX_IMPL(IndexType) INDEX_IMPL(IndexType, /*isGenerating=*/true)
@@ -14,8 +14,12 @@
 
 #include "InductionFormulaIndex.hpp"
 
+#include "Lib/Environment.hpp"
+
 #include "Inferences/Induction.hpp"
 
+#include "Shell/Statistics.hpp"
+
 namespace Indexing
 {
 
@@ -46,6 +50,10 @@ Key InductionFormulaIndex::represent(const InductionContext& context)
  *          and can be extended with new clausified induction formulas.
  * @param bound1 only used with integer induction to distinguish bounds from other literals
  * @param bound2 only used with integer induction to distinguish bounds from other literals
+ *
+ * The literals of a context have the induction terms replaced by placeholders,
+ * so an entry serves the contexts of all induction terms of the same shape,
+ * without clausifying their induction formulas again.
  */
 bool InductionFormulaIndex::findOrInsert(const InductionContext& context, Entry*& e, Literal* bound1, Literal* bound2)
 {
@@ -53,7 +61,11 @@ bool InductionFormulaIndex::findOrInsert(const InductionContext& context, Entry*
   auto k = represent(context);
   k.second.first = bound1;
   k.second.second = bound2;
-  return _map.getValuePtr(std::move(k), e);
+  if (!_map.getValuePtr(std::move(k), e)) {
+    env.statistics->inductionFormulasReused++;
+    return false;
+  }
+  return true;
 }
 
 }
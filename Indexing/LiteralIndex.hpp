@@ -20,6 +20,7 @@
 #include "Lib/Output.hpp"
 #include "Lib/DHMap.hpp"
 
+#include "GroundHashIndexingStructure.hpp"
 #include "Index.hpp"
 #include "LiteralIndexingStructure.hpp"
 
@@ -31,28 +32,29 @@ class LiteralIndex
 {
 public:
   VirtualIterator<LiteralClause> getAll()
-  { return _is->getAll(); }
+  { noteQuery(); return _is->getAll(); }
 
   VirtualIterator<QueryRes<ResultSubstitutionSP, LiteralClause>> getUnifications(Literal* lit, bool complementary, bool retrieveSubstitutions = true)
-  { return _is->getUnifications(lit, complementary, retrieveSubstitutions); }
+  { noteQuery(); return _is->getUnifications(lit, complementary, retrieveSubstitutions); }
 
   VirtualIterator<QueryRes<AbstractingUnifier*, Data>> getUwa(Literal* lit, bool complementary, Options::UnificationWithAbstraction uwa, bool fixedPointIteration)
-  { return _is->getUwa(lit, complementary, uwa, fixedPointIteration); }
+  { noteQuery(); return _is->getUwa(lit, complementary, uwa, fixedPointIteration); }
 
   VirtualIterator<QueryRes<ResultSubstitutionSP, LiteralClause>> getGeneralizations(Literal* lit, bool complementary, bool retrieveSubstitutions = true)
-  { return _is->getGeneralizations(lit, complementary, retrieveSubstitutions); }
+  { noteQuery(); return _is->getGeneralizations(lit, complementary, retrieveSubstitutions); }
 
   VirtualIterator<QueryRes<ResultSubstitutionSP, LiteralClause>> getInstances(Literal* lit, bool complementary, bool retrieveSubstitutions = true)
-  { return _is->getInstances(lit, complementary, retrieveSubstitutions); }
+  { noteQuery(); return _is->getInstances(lit, complementary, retrieveSubstitutions); }
 
   size_t getUnificationCount(Literal* lit, bool complementary)
-  { return _is->getUnificationCount(lit, complementary); }
+  { noteQuery(); return _is->getUnificationCount(lit, complementary); }
 
   friend std::ostream& operator<<(std::ostream& out,                 LiteralIndex const& self) { return out << *self._is; }
   friend std::ostream& operator<<(std::ostream& out, Output::Multiline<LiteralIndex>const& self) { return out << Output::multiline(*self.self._is, self.indent); }
 
 protected:
   LiteralIndex() : _is(new LiteralSubstitutionTree<LiteralClause>()) {}
+  LiteralIndex(LiteralIndexingStructure<Data>* is) : _is(is) {}
 
   void handle(Data data, bool add)
   { _is->handle(std::move(data), add); }
@@ -100,7 +102,8 @@ class UnitClauseLiteralIndex
 : public LiteralIndex<LiteralClause>
 {
 public:
-  UnitClauseLiteralIndex(SaturationAlgorithm&) {}
+  UnitClauseLiteralIndex(SaturationAlgorithm&)
+    : LiteralIndex(new GroundHashLIS<LiteralClause>(new LiteralSubstitutionTree<LiteralClause>())) {}
 protected:
   void handleClause(Clause* c, bool adding) override;
 };
@@ -157,7 +160,7 @@ class UnitIntegerComparisonLiteralIndex
 : public LiteralIndex<LiteralClause>
 {
 public:
-  UnitIntegerComparisonLiteralIndex(SaturationAlgorithm&) {}
+  UnitIntegerComparisonLiteralIndex(SaturationAlgorithm&) { deferInsertions(); }
 protected:
   void handleClause(Clause* c, bool adding) override;
 };
@@ -34,6 +34,14 @@ public:
   void insert(LeafData ld) { handle(std::move(ld), /* insert = */ true ); }
   void remove(LeafData ld) { handle(std::move(ld), /* insert = */ false); }
 
+  /** Insert or remove all of @b lds; structures may reorder them to do it faster */
+  virtual void handleBatch(Stack<LeafData>& lds, bool insert)
+  {
+    for (LeafData& ld : lds) {
+      handle(std::move(ld), insert);
+    }
+  }
+
   virtual VirtualIterator<LeafData> getAll() { NOT_IMPLEMENTED; }
   virtual VirtualIterator<QueryRes<ResultSubstitutionSP, LeafData>> getUnifications(Literal* lit, bool complementary, bool retrieveSubstitutions = true) { NOT_IMPLEMENTED; }
   virtual VirtualIterator<QueryRes<AbstractingUnifier*, LeafData>> getUwa(Literal* lit, bool complementary, Options::UnificationWithAbstraction uwa, bool fixedPointIteration) = 0;
@@ -14,6 +14,8 @@
 
 #include <algorithm>
 
+#include "Lib/Stack.hpp"
+
 #include "LiteralMiniIndex.hpp"
 
 namespace Indexing
@@ -26,26 +28,20 @@ using namespace Kernel;
 int LiteralMiniIndex::badPred=0;*/
 
 
-bool LiteralMiniIndex::literalHeaderComparator(const Entry& e1, const Entry& e2)
-{
-  return e1._header<e2._header || ( e1._header==e2._header && e1._weight<e2._weight );
-}
-
 void LiteralMiniIndex::init(Clause* cl)
 {
   _cnt = cl->length();
-  _entries.ensure(cl->length()+1);
   init(cl->literals());
 }
 
 LiteralMiniIndex::LiteralMiniIndex(Clause* cl)
-: _cnt(cl->length()), _entries(cl->length()+1)
+: _cnt(cl->length())
 {
   init(cl->literals());
 }
 
 LiteralMiniIndex::LiteralMiniIndex(Literal* const * lits, unsigned length)
-: _cnt(length), _entries(length+1)
+: _cnt(length)
 {
   init(lits);
 }
@@ -53,11 +49,36 @@ LiteralMiniIndex::LiteralMiniIndex(Literal* const * lits, unsigned length)
 void LiteralMiniIndex::init(Literal* const * lits)
 {
   ASS_G(_cnt, 0);
-  for(unsigned i=0;i<_cnt;i++) {
-    _entries[i].init(lits[i]);
+  _keys.ensure(_cnt+1);
+  _lits.ensure(_cnt);
+
+  if(_cnt<=16) {
+    // insertion sort for the usual short clauses, moving both arrays
+    for(unsigned i=0;i<_cnt;i++) {
+      Literal* lit=lits[i];
+      uint64_t k=key(lit->header(), lit->weight());
+      unsigned j=i;
+      for(;j>0 && _keys[j-1]>k;j--) {
+        _keys[j]=_keys[j-1];
+        _lits[j]=_lits[j-1];
+      }
+      _keys[j]=k;
+      _lits[j]=lit;
+    }
+  } else {
+    static Stack<std::pair<uint64_t,Literal*>> entries;
+    entries.reset();
+    for(unsigned i=0;i<_cnt;i++) {
+      entries.push(std::make_pair(key(lits[i]->header(), lits[i]->weight()), lits[i]));
+    }
+    std::sort(entries.begin(), entries.end(),
+        [](auto& e1, auto& e2) { return e1.first<e2.first; });
+    for(unsigned i=0;i<_cnt;i++) {
+      _keys[i]=entries[i].first;
+      _lits[i]=entries[i].second;
+    }
   }
-  _entries[_cnt].initTerminal();
-  std::sort(_entries.begin(), _entries.end()-1,literalHeaderComparator);
+  _keys[_cnt]=TERMINAL_KEY;
 }
 
 }
@@ -16,6 +16,9 @@
 #ifndef __LiteralMiniIndex__
 #define __LiteralMiniIndex__
 
+#include <algorithm>
+#include <cstdint>
+
 #include "Forwards.hpp"
 #include "Lib/DArray.hpp"
 #include "Kernel/Clause.hpp"
@@ -27,6 +30,14 @@ using namespace Lib;
 using namespace Kernel;
 
 
+/**
+ * A sorted array of the literals of a clause, to look up the literals with
+ * a given header.
+ *
+ * The literals are kept apart from their sort keys, which pack the header
+ * and the weight of a literal into one word, so that looking up the start
+ * of a query's run reads only the keys.
+ */
 class LiteralMiniIndex
 {
 public:
@@ -38,67 +49,54 @@ public:
   LiteralMiniIndex(Clause* cl);
   LiteralMiniIndex(Literal* const * lits, unsigned length);
 
+  /** for Recycled, the arrays are kept for the next init() */
+  void reset() { _cnt = 0; }
+  bool keepRecycled() const { return _keys.keepRecycled(); }
+
 private:
   void init(Literal* const * lits);
 
   friend std::ostream& operator<<(std::ostream& out, LiteralMiniIndex const& idx)
-  {  return out << "[" << Output::interleaved(", ", arrayIter(idx._entries, idx._cnt).map([](auto& e) -> Literal& { return *e._lit; }))<< "]"; }
+  {  return out << "[" << Output::interleaved(", ", arrayIter(idx._lits, idx._cnt).map([](auto& l) -> Literal& { return *l; }))<< "]"; }
 
-  struct Entry
-  {
-    Entry() {}
-    void initTerminal() { _header=0xFFFFFFFF; _lit=0; }
-    void init(Literal* lit) { _header=lit->header(); _weight=lit->weight(); _lit=lit; }
-    unsigned _header;
-    unsigned _weight;
-    Literal* _lit;
-  };
+  /** literals are ordered by header, and by weight within a header */
+  static uint64_t key(unsigned header, unsigned weight)
+  { return (static_cast<uint64_t>(header) << 32) | weight; }
+  static unsigned keyHeader(uint64_t key) { return key >> 32; }
 
-  static bool literalHeaderComparator(const Entry& e1, const Entry& e2);
+  /** key of the entry after the last one, its header matches no literal */
+  static constexpr uint64_t TERMINAL_KEY = ~static_cast<uint64_t>(0);
 
   unsigned _cnt = 0;
-  DArray<Entry> _entries;
+  /** sorted keys of the literals, followed by TERMINAL_KEY */
+  DArray<uint64_t> _keys;
+  /** the literals, in the order of their keys */
+  DArray<Literal*> _lits;
 
   struct IteratorBase
   {
     IteratorBase(LiteralMiniIndex const& index, Literal* query, bool complementary)
     : _ready(false), _hdr(complementary?query->complementaryHeader():query->header()),
-    _query(query), _compl(complementary)
+    _query(query), _compl(complementary), _keys(index._keys.array()), _lits(index._lits.array())
     {
-      Entry const* arr=index._entries.array();
-      unsigned weight=query->weight();
-      if(arr[0]._header>=_hdr || index._cnt==1) {
-	_curr=arr;
-	return;
-      }
-      unsigned left=1;
-      unsigned right=index._cnt-1;
-      while(left<right) {
-	unsigned mid=(left+right)/2;
-	if(arr[mid]._header<_hdr || (arr[mid]._header==_hdr && arr[mid]._weight<weight)) {
-	  left=mid+1;
-	} else {
-	  right=mid;
-	}
-      }
-      ASS_EQ(left,right);
-      _curr=&arr[right];
-      ASS(_curr->_header==_hdr ||
-	      (_curr->_header<_hdr && (_curr+1)->_header>_hdr) ||
-	      (_curr->_header>_hdr && (_curr==arr || (_curr-1)->_header<_hdr || (_curr-1)->_weight<weight)) );
+      // instances and variants are not lighter than the query
+      _curr = std::lower_bound(_keys, _keys+index._cnt, key(_hdr, query->weight())) - _keys;
     }
     Literal* next()
     {
       ASS(_ready);
       _ready=false;
-      return (_curr++)->_lit;
+      return _lits[_curr++];
     }
+    bool inRun() const { return keyHeader(_keys[_curr])==_hdr; }
 
     bool _ready;
     unsigned _hdr;
     Literal* _query;
     bool _compl;
-    Entry const* _curr;
+    uint64_t const* _keys;
+    Literal* const* _lits;
+    unsigned _curr;
   };
 
 public:
@@ -114,8 +112,8 @@ public:
     bool hasNext()
     {
       if(_ready) { return true; }
-      while(_curr->_header==_hdr) {
-        if(MatchingUtils::match(_query, _curr->_lit, _compl)) {
+      while(inRun()) {
+        if(MatchingUtils::match(_query, _lits[_curr], _compl)) {
           _ready=true;
           return true;
         }
@@ -133,8 +131,8 @@ public:
       if (_ready) {
         return true;
       }
-      while (_curr->_header == _hdr) {
-        if (MatchingUtils::match(_query, _curr->_lit, _compl, binder)) {
+      while (inRun()) {
+        if (MatchingUtils::match(_query, _lits[_curr], _compl, binder)) {
           _ready = true;
           return true;
         }
@@ -160,8 +158,8 @@ public:
     bool hasNext()
     {
       if(_ready) { return true; }
-      while(_curr->_header==_hdr) {
-	if(MatchingUtils::isVariant(_query, _curr->_lit)) {
+      while(inRun()) {
+	if(MatchingUtils::isVariant(_query, _lits[_curr])) {
 	  _ready=true;
 	  return true;
 	}
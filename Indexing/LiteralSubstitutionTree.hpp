@@ -50,6 +50,14 @@ public:
   void handle(LeafData ld, bool insert) final
   { getTree(ld.key(), /* complementary */ false).handle(std::move(ld), insert); }
 
+  /** The order of SubstitutionTree::handleBatch() groups the entries by tree, too */
+  void handleBatch(Stack<LeafData>& lds, bool insert) final
+  {
+    for (unsigned i : SubstitutionTree::batchOrder(lds)) {
+      handle(std::move(lds[i]), insert);
+    }
+  }
+
   VirtualIterator<LeafData> getAll() final
   {
     return pvi(
@@ -95,7 +103,7 @@ private:
       { return tree->template iterator<Iterator>(lit, retrieveSubstitutions, reversed, args...); };
 
     return ifElseIter(
-        tree->isEmpty(), [&]() { return VirtualIterator<ELEMENT_TYPE(Iterator)>::getEmpty(); },
+        tree->isEmpty(), [&]() { return EmptyIter<ELEMENT_TYPE(Iterator)>(); },
                          [&]() { return ifElseIter(!lit->isEquality(),
                                  [&]() { return iter(/* reverse */ false); },
                                  [&]() { return concatIters(iter(/* reverse */ false), iter(/* reverse */ true)); }); }
@@ -136,6 +136,28 @@ public:
   { self.output(out); return out; }
 };
 
+/**
+ * The substitution retrieved for a result that is identical to the
+ * (ground) query; it is the identity on both sides.
+ */
+class IdentitySubstitution
+: public ResultSubstitution
+{
+public:
+  using ResultSubstitution::applyToQuery;
+  using ResultSubstitution::applyToResult;
+
+  TermList applyToQuery(TermList t) override { return t; }
+  Literal* applyToQuery(Literal* l) override { return l; }
+  TermList applyToResult(TermList t) override { return t; }
+  Literal* applyToResult(Literal* l) override { return l; }
+
+  bool isIdentityOnQueryWhenResultBound() override { return true; }
+  bool isIdentityOnResultWhenQueryBound() override { return true; }
+
+  void output(std::ostream& out) const override { out << "identity"; }
+};
+
 }; // namespace Indexing
 
 #endif /* __ResultSubstitution__ */
@@ -21,6 +21,7 @@
 #define DEBUG_INSERT(lvl, ...) if (lvl < 0) DBG(__VA_ARGS__)
 #define DEBUG_REMOVE(lvl, ...) if (lvl < 0) DBG(__VA_ARGS__)
 
+#include <algorithm>
 #include <utility>
 
 #include "Forwards.hpp"
@@ -52,6 +53,7 @@
 #include "Lib/Option.hpp"
 #include "Kernel/Signature.hpp"
 #include "Lib/Output.hpp"
+#include "Lib/Portability.hpp"
 
 #include "Lib/Allocator.hpp"
 
@@ -225,10 +227,17 @@ public:
   typedef VirtualIterator<LeafData*> LDIterator;
 
   template<class I> using QueryResultIter = VirtualIterator<QueryRes<LeafData, typename I::Unifier>>;
+  /**
+   * The retrieval iterator of type @b I for @b query. It is statically
+   * typed, so that the callers wrap it in a VirtualIterator only once
+   * (if at all), instead of paying for an allocation and an indirect call
+   * per element at every level.
+   */
   template<class I, class TermOrLit, class... Args>
   auto iterator(TermOrLit query, bool retrieveSubstitutions, bool reversed, Args... args)
-  { return isEmpty() ? VirtualIterator<ELEMENT_TYPE(I)>::getEmpty()
-                     : pvi(iterPointer(Recycled<I>(this, _root, query, retrieveSubstitutions, reversed, std::move(args)...)));
+  { return ifElseIter(isEmpty(),
+                      [&]() { return EmptyIter<ELEMENT_TYPE(I)>(); },
+                      [&]() { return iterPointer(Recycled<I>(this, _root, query, retrieveSubstitutions, reversed, std::move(args)...)); });
   }
 
   class LDComparator
@@ -438,6 +447,27 @@ public:
         _nodes[0]=0;
       }
 
+      /**
+       * Encode the top of a child term as a single word, so that children
+       * can be told apart from @b _tops without touching the child nodes
+       * or the terms they hold. Terms and variables differ in the lowest bit.
+       */
+      static uint64_t topKey(TermList t)
+      {
+        return t.isVar() ? varKey(t.var(), t.isSpecialVar())
+                         : functorKey(t.term()->functor(), t.term()->kind());
+      }
+      static uint64_t topKey(TermList::Top t)
+      {
+        auto v = t.var();
+        if (v.isSome()) {
+          return varKey(v.unwrap().number, v.unwrap().special);
+        }
+        auto f = t.functor().unwrap();
+        return functorKey(f.functor, f.kind);
+      }
+      static bool isTermKey(uint64_t key) { return !(key & 1); }
+
       NodeAlgorithm algorithm() const override { return UNSORTED_LIST; }
       bool isEmpty() const override { return !_size; }
       int size() const override { return _size; }
@@ -453,10 +483,18 @@ public:
       Node** childByTop(TermList::Top t, bool canCreate) override;
       void remove(TermList::Top t) override;
 
-      USE_ALLOCATOR(UArrIntermediateNode);
+      USE_ACCOUNTED_ALLOCATOR(UArrIntermediateNode, INDEXING);
 
       int _size;
       Node* _nodes[UARR_INTERMEDIATE_NODE_MAX_SIZE+1];
+      /** topKey() of the term of each child in @b _nodes */
+      uint64_t _tops[UARR_INTERMEDIATE_NODE_MAX_SIZE];
+
+    private:
+      static uint64_t varKey(unsigned var, bool special)
+      { return (uint64_t(var) << 2) | (uint64_t(special) << 1) | 1; }
+      static uint64_t functorKey(unsigned functor, TermKind kind)
+      { return (uint64_t(functor) << 3) | (uint64_t(kind) << 1); }
     };
 
     class SListIntermediateNode
@@ -516,7 +554,7 @@ public:
       inline void remove(TermList::Top t) override
       { _nodes.remove(t); }
 
-      USE_ALLOCATOR(SListIntermediateNode);
+      USE_ACCOUNTED_ALLOCATOR(SListIntermediateNode, INDEXING);
 
       class NodePtrComparator
       {
@@ -584,6 +622,61 @@ public:
       else          remove(*bindings, ld);
     }
 
+    /**
+     * Insert or remove all of @b lds. The entries are handled in the order
+     * of the preorder traversals of their keys, so that consecutive ones
+     * follow shared paths from the root, whose nodes are still in cache.
+     */
+    void handleBatch(Stack<LeafData>& lds, bool doInsert)
+    {
+      for (unsigned i : batchOrder(lds)) {
+        handle(std::move(lds[i]), doInsert);
+      }
+    }
+
+    /**
+     * Positions of @b lds sorted by the preorder traversals of their keys
+     * (top symbols as in UArrIntermediateNode::topKey()).
+     */
+    static Stack<unsigned> batchOrder(Stack<LeafData> const& lds)
+    {
+      Stack<unsigned> order;
+      Stack<Stack<uint64_t>> keys;
+      for (unsigned i = 0; i < lds.size(); i++) {
+        order.push(i);
+        keys.push(Stack<uint64_t>());
+        appendPreorderKeys(lds[i].key(), keys.top());
+      }
+      std::stable_sort(order.begin(), order.end(), [&](unsigned i, unsigned j) {
+        return std::lexicographical_compare(keys[i].begin(), keys[i].end(), keys[j].begin(), keys[j].end());
+      });
+      return order;
+    }
+
+  private:
+    static void appendPreorderKeys(TermList t, Stack<uint64_t>& out)
+    {
+      Recycled<Stack<TermList>> todo;
+      todo->push(t);
+      while (todo->isNonEmpty()) {
+        TermList s = todo->pop();
+        out.push(UArrIntermediateNode::topKey(s));
+        if (s.isTerm()) {
+          for (unsigned i = s.term()->arity(); i > 0; i--) {
+            todo->push(*s.term()->nthArgument(i - 1));
+          }
+        }
+      }
+    }
+
+    static void appendPreorderKeys(Literal* l, Stack<uint64_t>& out)
+    {
+      out.push(l->header());
+      for (unsigned i = 0; i < l->arity(); i++) {
+        appendPreorderKeys(*l->nthArgument(i), out);
+      }
+    }
+
   private:
     void insert(BindingMap& binding,LeafData ld);
     void remove(BindingMap& binding,LeafData ld);
@@ -422,39 +422,48 @@ bool SubstitutionTree<LeafData_>::FastGeneralizationsIterator::enterNode(Node*&
   curr=0;
 
   if(currType==UNSORTED_LIST) {
-    Node** nl=static_cast<UArrIntermediateNode*>(inode)->_nodes;
+    UArrIntermediateNode* unode=static_cast<UArrIntermediateNode*>(inode);
+    Node** nl=unode->_nodes;
+    // the tops of the children are read from the parent, so that we don't
+    // have to visit the child nodes (and their terms) that we don't enter
+    const uint64_t* tops=unode->_tops;
     if(binding.isTerm()) {
-      unsigned bindingFunctor=binding.term()->functor();
+      uint64_t bindingKey=UArrIntermediateNode::topKey(binding);
       //let's first skip proper term nodes at the beginning...
-      while(*nl && (*nl)->term().isTerm()) {
+      while(*nl && UArrIntermediateNode::isTermKey(*tops)) {
         //...and have the one that interests us, if we encounter it.
-        if(!curr && (*nl)->term().term()->functor()==bindingFunctor) {
+        if(!curr && *tops==bindingKey) {
           curr=*nl;
+          VAMPIRE_PREFETCH(curr);
         }
         nl++;
+        tops++;
       }
       if(!curr && *nl) {
         //we've encountered a variable node, but we still have to check, whether
         //the one proper term node, that interests us, isn't here
-        Node** nl2=nl+1;
-        while(*nl2) {
-          if((*nl2)->term().isTerm() && (*nl2)->term().term()->functor()==bindingFunctor) {
-            curr=*nl2;
+        for(int i=(nl-unode->_nodes)+1;i<unode->_size;i++) {
+          if(unode->_tops[i]==bindingKey) {
+            curr=unode->_nodes[i];
+            VAMPIRE_PREFETCH(curr);
             break;
           }
-          nl2++;
         }
       }
     } else {
       //let's first skip proper term nodes at the beginning
-      while(*nl && (*nl)->term().isTerm()) {
+      while(*nl && UArrIntermediateNode::isTermKey(*tops)) {
         nl++;
+        tops++;
       }
     }
     if(!curr && *nl) {
       curr=*(nl++);
-      while(*nl && (*nl)->term().isTerm()) {
+      tops++;
+      VAMPIRE_PREFETCH(curr);
+      while(*nl && UArrIntermediateNode::isTermKey(*tops)) {
 	nl++;
+	tops++;
       }
     }
     if(curr) {
@@ -463,6 +472,8 @@ bool SubstitutionTree<LeafData_>::FastGeneralizationsIterator::enterNode(Node*&
     if(*nl) {
       _alternatives.push(nl);
       _nodeTypes.push(currType);
+      // the first sibling to be tried once the subtree of curr is done
+      VAMPIRE_PREFETCH(*nl);
       return true;
     }
   } else {
@@ -422,6 +422,7 @@ main_loop_start:
 	curr=*(alts++);
 	if(*alts) {
 	  _alternatives.push(alts);
+	  VAMPIRE_PREFETCH(*alts);
 	  sibilingsRemain=true;
 	} else {
 	  sibilingsRemain=false;
@@ -434,6 +435,7 @@ main_loop_start:
 	curr=alts->head();
 	if(alts->tail()) {
 	  _alternatives.push(alts->tail());
+	  VAMPIRE_PREFETCH(alts->tail());
 	  sibilingsRemain=true;
 	} else {
 	  sibilingsRemain=false;
@@ -530,19 +532,23 @@ bool SubstitutionTree<LeafData_>::FastInstancesIterator::enterNode(Node*& curr)
   curr=0;
 
   if(currType==UNSORTED_LIST) {
-    Node** nl=static_cast<UArrIntermediateNode*>(inode)->_nodes;
+    UArrIntermediateNode* unode=static_cast<UArrIntermediateNode*>(inode);
+    Node** nl=unode->_nodes;
     ASS(*nl); //inode is not empty
     bool noAlternatives=false;
     if(query.isTerm()) {
-      unsigned bindingFunctor=query.term()->functor();
+      uint64_t queryKey=UArrIntermediateNode::topKey(query);
       //let's skip terms that don't have the same top functor...
-      while(*nl && (!(*nl)->term().isTerm() || (*nl)->term().term()->functor()!=bindingFunctor)) {
+      //(their tops are kept in the parent, so we don't visit the children)
+      const uint64_t* tops=unode->_tops;
+      while(*nl && *tops!=queryKey) {
         nl++;
+        tops++;
       }
 
       if(*nl) {
 	//we've found the term with the same top functor
-	ASS_EQ((*nl)->term().term()->functor(),bindingFunctor);
+	ASS_EQ((*nl)->top(),query.top());
         curr=*nl;
         noAlternatives=true; //there is at most one term with each top functor
       }
@@ -559,6 +565,8 @@ bool SubstitutionTree<LeafData_>::FastInstancesIterator::enterNode(Node*& curr)
     if(*nl && !noAlternatives) {
       _alternatives.push(nl);
       _nodeTypes.push(currType);
+      // the first sibling to be tried once the subtree of curr is done
+      VAMPIRE_PREFETCH(*nl);
       return true;
     }
   } else {
@@ -586,6 +594,7 @@ bool SubstitutionTree<LeafData_>::FastInstancesIterator::enterNode(Node*& curr)
     if(nl) {
       _alternatives.push(nl);
       _nodeTypes.push(currType);
+      VAMPIRE_PREFETCH(nl);
       return true;
     }
   }
@@ -68,7 +68,7 @@ public:
     _size--;
   }
 
-  USE_ALLOCATOR(UListLeaf);
+  USE_ACCOUNTED_ALLOCATOR(UListLeaf, INDEXING);
 private:
   typedef List<LeafData> LDList;
   LDList* _children;
@@ -100,7 +100,7 @@ public:
   void insert(LeafData ld) override { _children.insert(ld); }
   void remove(LeafData ld) override { _children.remove(ld); }
 
-  USE_ALLOCATOR(SListLeaf);
+  USE_ACCOUNTED_ALLOCATOR(SListLeaf, INDEXING);
 private:
   typedef SkipList<LeafData,LDComparator> LDSkipList;
   LDSkipList _children;
@@ -159,14 +159,17 @@ template<class LeafData_>
 typename SubstitutionTree<LeafData_>::Node** SubstitutionTree<LeafData_>::UArrIntermediateNode::
 	childByTop(TermList::Top t, bool canCreate)
 {
+  uint64_t key=topKey(t);
   for(int i=0;i<_size;i++) {
-    if(t == _nodes[i]->top()) {
+    if(key == _tops[i]) {
+      ASS_EQ(t, _nodes[i]->top());
       return &_nodes[i];
     }
   }
   if(canCreate) {
     ASS_L(_size,UARR_INTERMEDIATE_NODE_MAX_SIZE);
     ASS_EQ(_nodes[_size],0);
+    _tops[_size]=key;
     _nodes[++_size]=0;
     return &_nodes[_size-1];
   }
@@ -176,10 +179,12 @@ typename SubstitutionTree<LeafData_>::Node** SubstitutionTree<LeafData_>::UArrIn
 template<class LeafData_>
 void SubstitutionTree<LeafData_>::UArrIntermediateNode::remove(TermList::Top t)
 {
+  uint64_t key=topKey(t);
   for(int i=0;i<_size;i++) {
-    if(t == _nodes[i]->top()) {
+    if(key == _tops[i]) {
       _size--;
       _nodes[i]=_nodes[_size];
+      _tops[i]=_tops[_size];
       _nodes[_size]=0;
       return;
     }
@@ -24,6 +24,7 @@
 
 #include "TermSubstitutionTree.hpp"
 #include "CodeTreeInterfaces.hpp"
+#include "GroundHashIndexingStructure.hpp"
 
 #include "Saturation/SaturationAlgorithm.hpp"
 
@@ -35,6 +36,23 @@ using namespace Lib;
 using namespace Kernel;
 using namespace Inferences;
 
+void TopFunctorFilter::handle(TermList t, bool adding)
+{
+  if (t.isVar()) {
+    ASS(adding || _variableCnt > 0);
+    adding ? _variableCnt++ : _variableCnt--;
+    return;
+  }
+  unsigned* cnt;
+  _functors.getValuePtr(t.term()->functor(), cnt, 0);
+  ASS(adding || *cnt > 0);
+  if (adding) {
+    (*cnt)++;
+  } else if (--(*cnt) == 0) {
+    _functors.remove(t.term()->functor());
+  }
+}
+
 SuperpositionSubtermIndex::SuperpositionSubtermIndex(SaturationAlgorithm& salg)
 : TermIndex(new TermSubstitutionTree<TermLiteralClause>), _ord(salg.getOrdering()) {}
 
@@ -49,6 +67,7 @@ void SuperpositionSubtermIndex::handleClause(Clause* c, bool adding)
     while (rsti.hasNext()) {
       auto tt = TypedTermList(rsti.next());
       ((TermSubstitutionTree<TermLiteralClause>*)&*_is)->handle(TermLiteralClause{ tt, lit, c }, adding);
+      _subtermFilter.handle(tt, adding);
     }
   }
 }
@@ -66,7 +85,9 @@ void SuperpositionLHSIndex::handleClause(Clause* c, bool adding)
     Literal* lit=(*c)[i];
     auto lhsi = EqHelper::getSuperpositionLHSIterator(lit, _ord, _opt);
     while (lhsi.hasNext()) {
-	    _is->handle(TermLiteralClause{ lhsi.next(), lit, c }, adding);
+      auto lhs = lhsi.next();
+      _is->handle(TermLiteralClause{ lhs, lit, c }, adding);
+      _lhsFilter.handle(lhs, adding);
     }
   }
 }
@@ -80,6 +101,8 @@ void DemodulationSubtermIndex::handleClause(Clause* c, bool adding)
   TIME_TRACE("backward demodulation index maintenance");
 
   static DHSet<Term*> inserted;
+  static Stack<TermLiteralClause> entries;
+  entries.reset();
 
   unsigned cLen=c->length();
   for (unsigned i=0; i<cLen; i++) {
@@ -106,17 +129,14 @@ void DemodulationSubtermIndex::handleClause(Clause* c, bool adding)
         it.right();
         continue;
       }
-      if (adding) {
-        _is->insert(TermLiteralClause{ t, lit, c });
-      } else {
-        _is->remove(TermLiteralClause{ t, lit, c });
-      }
+      entries.push(TermLiteralClause{ t, lit, c });
     }
   }
+  _is->handleBatch(entries, adding);
 }
 
 DemodulationLHSIndex::DemodulationLHSIndex(SaturationAlgorithm& salg)
-: TermIndex(new CodeTreeTIS<DemodulatorData>()), _ord(salg.getOrdering()),
+: TermIndex(new GroundHashTIS<DemodulatorData>(new CodeTreeTIS<DemodulatorData>())), _ord(salg.getOrdering()),
   _preordered(salg.getOptions().forwardDemodulation()==Options::Demodulation::PREORDERED) {};
 
 void DemodulationLHSIndex::handleClause(Clause* c, bool adding)
@@ -127,6 +147,10 @@ void DemodulationLHSIndex::handleClause(Clause* c, bool adding)
 
   TIME_TRACE("forward demodulation index maintenance");
 
+  if (adding) {
+    _generation++;
+  }
+
   Literal* lit=(*c)[0];
   auto [lhsi, preordered] = EqHelper::getDemodulationLHSIterator(lit, _preordered, _ord);
 
@@ -143,11 +167,16 @@ void DemodulationLHSIndex::handleClause(Clause* c, bool adding)
       c, preordered, _ord
     );
     _is->handle(std::move(dd), adding);
+    _lhsFilter.handle(lhs, adding);
   }
 }
 
 InductionTermIndex::InductionTermIndex(SaturationAlgorithm& salg)
-: TermIndex(new TermSubstitutionTree<TermLiteralClause>()), _inductionGroundOnly(salg.getOptions().inductionGroundOnly()) {}
+: TermIndex(new TermSubstitutionTree<TermLiteralClause>()), _inductionGroundOnly(salg.getOptions().inductionGroundOnly())
+{
+  // only queried for the few clauses that induction is applied to
+  deferInsertions();
+}
 
 void InductionTermIndex::handleClause(Clause* c, bool adding)
 {
@@ -188,7 +217,11 @@ void InductionTermIndex::handleClause(Clause* c, bool adding)
 }
 
 StructInductionTermIndex::StructInductionTermIndex(SaturationAlgorithm& salg)
-: TermIndex(new TermSubstitutionTree<TermLiteralClause>()), _inductionGroundOnly(salg.getOptions().inductionGroundOnly()) {}
+: TermIndex(new TermSubstitutionTree<TermLiteralClause>()), _inductionGroundOnly(salg.getOptions().inductionGroundOnly())
+{
+  // only queried for the few clauses that induction is applied to
+  deferInsertions();
+}
 
 void StructInductionTermIndex::handleClause(Clause* c, bool adding)
 {
@@ -19,6 +19,8 @@
 #include "Index.hpp"
 #include "TermIndexingStructure.hpp"
 
+#include "Lib/DHMap.hpp"
+
 namespace Indexing {
 
 template<class Data>
@@ -29,16 +31,16 @@ public:
   ~TermIndex() override {}
 
   VirtualIterator<QueryRes<AbstractingUnifier*, Data>> getUwa(TypedTermList t, Options::UnificationWithAbstraction uwa, bool fixedPointIteration)
-  { return _is->getUwa(t, uwa, fixedPointIteration); }
+  { noteQuery(); return _is->getUwa(t, uwa, fixedPointIteration); }
 
   VirtualIterator<QueryRes<ResultSubstitutionSP, Data>> getUnifications(TypedTermList t, bool retrieveSubstitutions = true)
-  { return _is->getUnifications(t, retrieveSubstitutions); }
+  { noteQuery(); return _is->getUnifications(t, retrieveSubstitutions); }
 
   VirtualIterator<QueryRes<ResultSubstitutionSP, Data>> getGeneralizations(TypedTermList t, bool retrieveSubstitutions = true)
-  { return _is->getGeneralizations(t, retrieveSubstitutions); }
+  { noteQuery(); return _is->getGeneralizations(t, retrieveSubstitutions); }
 
   VirtualIterator<QueryRes<ResultSubstitutionSP, Data>> getInstances(TypedTermList t, bool retrieveSubstitutions = true)
-  { return _is->getInstances(t, retrieveSubstitutions); }
+  { noteQuery(); return _is->getInstances(t, retrieveSubstitutions); }
 
   friend std::ostream& operator<<(std::ostream& out, TermIndex const& self)
   { return out << *self._is; }
@@ -48,15 +50,42 @@ protected:
   std::unique_ptr<TermIndexingStructure<Data>> _is;
 };
 
+/**
+ * Counts the top functors of the terms stored in an index. Lets callers
+ * skip a retrieval for a query that certainly has no matching or unifying
+ * partner there (syntactically, a non-variable term can only match or
+ * unify with a variable or a term of the same top functor).
+ */
+class TopFunctorFilter
+{
+public:
+  void handle(TermList t, bool adding);
+
+  bool mayPair(const Term* t) const
+  { return _variableCnt > 0 || _functors.find(t->functor()).isSome(); }
+private:
+  /** number of indexed terms by their top functor */
+  DHMap<unsigned, unsigned> _functors;
+  /** number of indexed terms which are variables */
+  unsigned _variableCnt = 0;
+};
+
 class SuperpositionSubtermIndex
 : public TermIndex<TermLiteralClause>
 {
 public:
   SuperpositionSubtermIndex(SaturationAlgorithm& salg);
+
+  /**
+   * False if no subterm in the index can syntactically unify with @b t.
+   * Only meaningful without unification with abstraction.
+   */
+  bool mayHaveUnifications(const Term* t) const { return _subtermFilter.mayPair(t); }
 protected:
   void handleClause(Clause* c, bool adding) override;
 private:
   Ordering& _ord;
+  TopFunctorFilter _subtermFilter;
 };
 
 class SuperpositionLHSIndex
@@ -64,11 +93,18 @@ class SuperpositionLHSIndex
 {
 public:
   SuperpositionLHSIndex(SaturationAlgorithm& salg);
+
+  /**
+   * False if no left-hand side in the index can syntactically unify with @b t.
+   * Only meaningful without unification with abstraction.
+   */
+  bool mayHaveUnifications(const Term* t) const { return _lhsFilter.mayPair(t); }
 protected:
   void handleClause(Clause* c, bool adding) override;
 private:
   Ordering& _ord;
   const Options& _opt;
+  TopFunctorFilter _lhsFilter;
 };
 
 /**
@@ -93,11 +129,24 @@ class DemodulationLHSIndex
 {
 public:
   DemodulationLHSIndex(SaturationAlgorithm& salg);
+
+  /**
+   * False if no left-hand side in the index can be a generalization of @b t.
+   * Forward demodulation queries every non-variable subterm of a clause, and
+   * most of them fail already on the top functor; this check is done before
+   * setting up a retrieval for them.
+   */
+  bool mayHaveGeneralizations(const Term* t) const { return _lhsFilter.mayPair(t); }
+
+  /** Changes whenever a demodulator is inserted, so that results cached by the callers can be dropped */
+  unsigned generation() const { return _generation; }
 protected:
   void handleClause(Clause* c, bool adding) override;
 private:
   Ordering& _ord;
   const bool _preordered;
+  TopFunctorFilter _lhsFilter;
+  unsigned _generation = 0;
 };
 
 /**
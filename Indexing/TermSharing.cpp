@@ -20,6 +20,12 @@
 #include "Kernel/Signature.hpp"
 #include "Kernel/SortHelper.hpp"
 #include "Kernel/Term.hpp"
+#include "Kernel/Clause.hpp"
+#include "Kernel/FormulaUnit.hpp"
+#include "Kernel/Inference.hpp"
+#include "Kernel/SubformulaIterator.hpp"
+
+#include "Shell/Statistics.hpp"
 
 #include "Debug/TimeProfiling.hpp"
 
@@ -45,15 +51,15 @@ TermSharing::TermSharing()
 TermSharing::~TermSharing()
 {
 #if CHECK_LEAKS
-  Set<Term*,TermSharing>::Iterator ts(_terms);
+  SwissSet<Term*,TermSharing>::Iterator ts(_terms);
   while (ts.hasNext()) {
     ts.next()->destroy();
   }
-  Set<Literal*,TermSharing>::Iterator ls(_literals);
+  SwissSet<Literal*,TermSharing>::Iterator ls(_literals);
   while (ls.hasNext()) {
     ls.next()->destroy();
   }
-  Set<AtomicSort*,TermSharing>::Iterator ss(_sorts);
+  SwissSet<AtomicSort*,TermSharing>::Iterator ss(_sorts);
   while (ss.hasNext()) {
     ss.next()->destroy();
   }
@@ -81,6 +87,7 @@ void TermSharing::computeAndSetSharedTermData(Term* t)
     bool hasInterpretedConstants=t->arity()==0 &&
 	env.signature->getFunction(t->functor())->interpreted();
     bool hasTermVar = false;
+    bool hasInterpretedSymbols = false;
     bool hasDeBruijnIndex = t->deBruijnIndex().isSome();
     bool hasRedex = t->isRedex();
     bool hasLambda = t->isLambdaTerm();
@@ -115,8 +122,13 @@ void TermSharing::computeAndSetSharedTermData(Term* t)
         if(!hasInterpretedConstants && r->hasInterpretedConstants()) {
           hasInterpretedConstants=true; 
         }
+        hasInterpretedSymbols |= !r->isSort() && r->hasInterpretedSymbols();
       }
     }
+    if (!hasInterpretedSymbols) {
+      Signature::Symbol* sym = env.signature->getFunction(t->functor());
+      hasInterpretedSymbols = sym->interpreted() || sym->termAlgebraCons() || sym->linMul();
+    }
     t->markShared();
     t->setId(_terms.size());
     t->setNumVarOccs(vars);
@@ -132,6 +144,7 @@ void TermSharing::computeAndSetSharedTermData(Term* t)
     t->setHasDeBruijnIndex(hasDeBruijnIndex);
     t->setHasLambda(hasLambda);
     t->setInterpretedConstantsPresence(hasInterpretedConstants);
+    t->setInterpretedSymbolsPresence(hasInterpretedSymbols);
 
     //poly function works for mono as well, but is slow
     //it is fine to use for debug
@@ -340,20 +353,17 @@ bool TermSharing::argNormGt(TermList t1, TermList t2)
  */
 void TermSharing::resetEqualityArgumentOrders()
 {
-  // Reset the cached equality argument order on every shared equality literal.
-  // This cached value (AO_GREATER / AO_LESS / …) is computed by the global
-  // ordering and stored directly on the literal so that subsequent calls to
-  // getEqualityArgumentOrder() can skip the ordering comparison.  When a new
+  // Invalidate the cached equality argument order on every shared equality
+  // literal. This cached value (AO_GREATER / AO_LESS / …) is computed by the
+  // global ordering and stored directly on the literal so that subsequent calls
+  // to getEqualityArgumentOrder() can skip the ordering comparison.  When a new
   // ordering is installed for the next proof the stale cached values must be
-  // cleared; otherwise the new ordering silently reuses the old orientation,
+  // ignored; otherwise the new ordering silently reuses the old orientation,
   // which can block or mis-direct superposition inferences.
-  Set<Literal*,TermSharing>::Iterator lit_it(_literals);
-  while (lit_it.hasNext()) {
-    Literal* lit = lit_it.next();
-    if (lit->isEquality()) {
-      lit->setArgumentOrderValue(AO_UNKNOWN);
-    }
-  }
+  //
+  // The values carry an epoch, so this is constant time rather than a walk
+  // over all shared literals.
+  Literal::invalidateArgumentOrderCache();
 }
 
 bool TermSharing::equals(const Term* s, const Term* t)
@@ -372,3 +382,162 @@ bool TermSharing::equals(const Term* s, const Term* t)
   }
   return true;
 } // TermSharing::equals
+
+namespace {
+
+/**
+ * Collects the shared terms and literals reachable from a set of units.
+ * Terms are marked when first seen and then walked from an explicit stack,
+ * so deep terms do not exhaust the C++ stack.
+ */
+class LiveTermMarker
+{
+public:
+  void markUnit(Unit* root)
+  {
+    _units.push(root);
+    while (_units.isNonEmpty()) {
+      Unit* u = _units.pop();
+      if (!_seenUnits.insert(u)) {
+        continue;
+      }
+      if (u->isClause()) {
+        for (Literal* l : static_cast<Clause*>(u)->iterLits()) {
+          markTerm(l);
+        }
+      } else {
+        markFormula(static_cast<FormulaUnit*>(u)->formula());
+      }
+      Inference& inf = u->inference();
+      Inference::Iterator it = inf.iterator();
+      while (inf.hasNext(it)) {
+        _units.push(inf.next(it));
+      }
+      drain();
+    }
+  }
+
+  void markLiteral(Literal* l)
+  {
+    markTerm(l);
+    drain();
+  }
+
+  bool isLive(Term* t) const { return _live.find(t); }
+
+private:
+  void markTerm(Term* t)
+  {
+    if (t->shared()) {
+      // sorts are kept anyway and only have sorts as arguments
+      if (t->isSort() || !_live.insert(t)) {
+        return;
+      }
+    }
+    _todo.push(t);
+  }
+
+  void markTerm(TermList t)
+  {
+    if (t.isTerm()) {
+      markTerm(t.term());
+    }
+  }
+
+  void markFormula(Formula* f)
+  {
+    SubformulaIterator sfi(f);
+    while (sfi.hasNext()) {
+      Formula* sf = sfi.next();
+      if (sf->connective() == LITERAL) {
+        markTerm(sf->literal());
+      } else if (sf->connective() == BOOL_TERM) {
+        markTerm(sf->getBooleanTerm());
+      }
+    }
+  }
+
+  void drain()
+  {
+    while (_todo.isNonEmpty()) {
+      Term* t = _todo.pop();
+      if (t->isSpecial()) {
+        const Term::SpecialTermData* sd = t->getSpecialData();
+        switch (sd->specialFunctor()) {
+          case SpecialFunctor::ITE:
+            markFormula(sd->getITECondition());
+            break;
+          case SpecialFunctor::LET:
+            markFormula(sd->getLetBinding());
+            break;
+          case SpecialFunctor::FORMULA:
+            markFormula(sd->getFormula());
+            break;
+          case SpecialFunctor::LAMBDA:
+            markTerm(sd->getLambdaExp());
+            break;
+          default:
+            break;
+        }
+      }
+      for (unsigned i = 0; i < t->arity(); i++) {
+        markTerm(*t->nthArgument(i));
+      }
+    }
+  }
+
+  DHSet<Unit*> _seenUnits;
+  Stack<Unit*> _units;
+  DHSet<Term*> _live;
+  Stack<Term*> _todo;
+};
+
+} // namespace
+
+size_t TermSharing::collectGarbage(const Stack<Unit*>& roots, const Stack<Literal*>& literalRoots)
+{
+  LiveTermMarker marker;
+  for (Unit* u : roots) {
+    marker.markUnit(u);
+  }
+  for (Literal* l : literalRoots) {
+    marker.markLiteral(l);
+  }
+
+  // everything is unlinked before anything is destroyed: removing an entry
+  // hashes it, which reads the arguments of the term being removed
+  Stack<Term*> dead;
+  SwissSet<Term*,TermSharing>::Iterator ts(_terms);
+  while (ts.hasNext()) {
+    Term* t = ts.next();
+    if (t->_arity && !marker.isLive(t)) {
+      dead.push(t);
+    }
+  }
+  unsigned deadTerms = dead.size();
+  for (Term* t : dead) {
+    _terms.remove(t);
+  }
+  SwissSet<Literal*,TermSharing>::Iterator ls(_literals);
+  while (ls.hasNext()) {
+    Literal* l = ls.next();
+    if (l->_arity && !marker.isLive(l)) {
+      dead.push(l);
+    }
+  }
+  for (unsigned i = deadTerms; i < dead.size(); i++) {
+    _literals.remove(static_cast<Literal*>(dead[i]));
+  }
+
+  size_t reclaimed = 0;
+  for (Term* t : dead) {
+    reclaimed += sizeof(Term) + t->_arity * sizeof(TermList) + t->getPreDataSize();
+    t->_args[0]._setShared(false);
+    t->destroy();
+  }
+
+  env.statistics->collectedTerms += deadTerms;
+  env.statistics->collectedLiterals += dead.size() - deadTerms;
+  env.statistics->collectedTermKB += reclaimed / 1024;
+  return reclaimed;
+}
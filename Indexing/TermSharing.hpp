@@ -17,8 +17,9 @@
 #ifndef __TermSharing__
 #define __TermSharing__
 
-#include "Lib/Set.hpp"
+#include "Lib/SwissSet.hpp"
 #include "Lib/DHSet.hpp"
+#include "Lib/Stack.hpp"
 #include "Kernel/Term.hpp"
 
 using namespace Lib;
@@ -71,6 +72,18 @@ public:
    * would otherwise be silently reused, causing wrong superposition inferences. */
   void resetEqualityArgumentOrders();
 
+  /**
+   * Destroy all shared terms and literals that cannot be reached from
+   * @b roots, the premises of their inferences, the formulas and special
+   * terms they contain, or @b literalRoots. Sorts and constants are never
+   * collected.
+   *
+   * Anything else that still points to a collected term becomes dangling,
+   * so this may only be called between proofs, after the static caches were
+   * reset. Return the number of bytes reclaimed.
+   */
+  size_t collectGarbage(const Stack<Unit*>& roots, const Stack<Literal*>& literalRoots);
+
   struct OpLitWrapper {
     OpLitWrapper(Literal* l) : l(l) {}
     Literal* l;
@@ -105,11 +118,11 @@ private:
   static bool argNormGt(TermList t1, TermList t2);
 
   /** The set storing all terms */
-  Set<Term*,TermSharing> _terms;
+  SwissSet<Term*,TermSharing> _terms;
   /** The set storing all literals */
-  Set<Literal*,TermSharing> _literals;
+  SwissSet<Literal*,TermSharing> _literals;
   /** The set storing all sorts */
-  Set<AtomicSort*,TermSharing> _sorts;
+  SwissSet<AtomicSort*,TermSharing> _sorts;
   /* Set containing all array sorts. 
    * Can be deleted once array axioms are made truly poltmorphic
    */  
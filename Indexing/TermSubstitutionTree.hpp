@@ -60,6 +60,9 @@ public:
   void handle(LeafData d, bool insert) final
   { _inner.handle(std::move(d), insert); }
 
+  void handleBatch(Stack<LeafData>& ds, bool insert) final
+  { _inner.handleBatch(ds, insert); }
+
 private:
 
   template<class Iterator, class... Args>
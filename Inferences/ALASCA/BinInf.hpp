@@ -223,6 +223,9 @@ public:
       DEBUG(0, "prem0: ", prem0)
       for (auto prem1_sigma : _prem1->template find<QueryBank<0, 1>>(&sigma, prem0.key())) {
         auto& prem1   = *prem1_sigma.data;
+        if (!_rule.compatible(prem0, prem1)) {
+          continue;
+        }
         DEBUG(0, "  prem1: ", prem1)
         for (auto prem2_sigma : _prem2->template find<QueryBank<0, 2>>(&sigma, prem0.key())) {
           auto& prem2   = *prem2_sigma.data;
@@ -245,7 +248,8 @@ public:
       DEBUG(0, "prem1: ", prem1)
       for (auto prem0_sigma : _prem0->template find<QueryBank<1, 0>>(&sigma, prem1.key())) {
         auto& prem0   = *prem0_sigma.data;
-        if (prem0.clause() != premise) { // <- self application. the same one has been run already in the previous loop
+        if (prem0.clause() != premise // <- self application. the same one has been run already in the previous loop
+            && _rule.compatible(prem0, prem1)) {
           DEBUG(0, "  prem0: ", prem0)
           for (auto prem2_sigma : _prem2->template find<QueryBank<0, 2>>(&sigma, prem0.key())) {
             auto& prem2   = *prem2_sigma.data;
@@ -271,6 +275,9 @@ public:
           DEBUG(0, "  prem0: ", prem0)
           for (auto prem1_sigma : _prem1->template find<QueryBank<0, 1>>(&sigma, prem0.key())) {
             auto& prem1   = *prem1_sigma.data;
+            if (!_rule.compatible(prem0, prem1)) {
+              continue;
+            }
             DEBUG(0, "    prem1: ", prem1)
             for (Clause* res : iterTraits(_rule.applyRule(prem0, bank(0), 
                                                           prem1, bank(1), 
@@ -30,7 +30,6 @@ Option<Clause*> FourierMotzkinConf::applyRule_(
 #define __ALASCA_Inferences_FM_DERIVE_EQUALITIES 1
 
   TIME_TRACE("fourier motzkin")
-  auto cnst = uwa.computeConstraintLiterals();
   auto sigma = [&](auto t, auto bank) { return uwa.subs().apply(t,bank); };
 
 
@@ -66,7 +65,7 @@ Option<Clause*> FourierMotzkinConf::applyRule_(
 #if __ALASCA_Inferences_FM_DERIVE_EQUALITIES
                        + (tight ? 1 : 0)          // <- -k s₂ + t₂ ≈ 0
 #endif // __ALASCA_Inferences_FM_DERIVE_EQUALITIES
-                       + cnst->size());      // Cnst
+                       );                    // + Cnst, computed once the side conditions hold
 
     auto s1 = lhs.selectedAtom();
     auto s2 = rhs.selectedAtom();
@@ -162,6 +161,7 @@ Option<Clause*> FourierMotzkinConf::applyRule_(
 
 #endif
 
+    auto cnst = uwa.computeConstraintLiterals();
     out.loadFromIterator(cnst->iterFifo());
 
     Inference inf(GeneratingInference2(Kernel::InferenceRule::ALASCA_FOURIER_MOTZKIN, lhs.clause(), rhs.clause()));
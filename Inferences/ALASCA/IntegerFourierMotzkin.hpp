@@ -38,6 +38,19 @@ struct IntegerFourierMotzkinConf
   // TODO rewrites in the second-maximal term of this
   using Premise2 = typename Coherence<NumTraits>::Lhs;
 
+  /**
+   * Cheap necessary condition for applyRule to derive anything from the
+   * premises @b prem0 and @b prem1, checked before looking up the third
+   * premise.
+   */
+  bool compatible(Premise0 const& prem0, Premise1 const& prem1) const
+  {
+    return prem0.numTraitsIs<NumTraits>()
+        // with two non-strict inequalities the rule is the same as the ordinary FM
+        && !(prem0.alascaPredicate().unwrap() == AlascaPredicate::GREATER_EQ
+          && prem1.alascaPredicate().unwrap() == AlascaPredicate::GREATER_EQ);
+  }
+
   auto applyRule(
       Premise0 const& prem0, unsigned varBank0,
       Premise1 const& prem1, unsigned varBank1,
@@ -12,8 +12,10 @@
 #include "VIRAS.hpp"
 #include "Kernel/Inference.hpp"
 #include "Kernel/NumTraits.hpp"
+#include "Lib/Environment.hpp"
 #include "Lib/Reflection.hpp"
 #include "Lib/Option.hpp"
+#include "Shell/Options.hpp"
 #define DEBUG(lvl, ...) if (lvl < 0) { DBG(__VA_ARGS__) }
 
 using namespace Kernel;
@@ -117,6 +119,11 @@ Option<SimplifyingGeneratingInference::ClauseGenerationResult> VirasQuantifierEl
     }
   }
 
+  auto maxLiterals = env.options->virasMaxLiterals();
+  if (maxLiterals && toElim->size() > maxLiterals) {
+    return {};
+  }
+
   auto unshielded = iterTraits(candidateVars->iterator())
     .filter([&](auto x) { return !shieldedVars->contains(x); })
     .tryNext();
@@ -159,11 +159,26 @@ struct BackwardDemodulation::ResultFn
 
     resLits->push(resLit);
 
+    // rewrite the other literals containing lhsS with the same instance too,
+    // rather than leaving that to forward demodulation of the replacement
     for(unsigned i=0;i<cLen;i++) {
       Literal* curr=(*qr.data->clause)[i];
-      if(curr!=qr.data->literal) {
-        resLits->push(curr);
+      if(curr==qr.data->literal) {
+        continue;
       }
+      if(curr->containsSubterm(lhsS) &&
+        (!_helper.redundancyCheckNeededForPremise(qr.data->clause,curr,lhsS) ||
+          _helper.isPremiseRedundant(qr.data->clause,curr,lhsS,rhsS,lhs,&appl)))
+      {
+        Literal* currS=EqHelper::replace(curr,lhsS,rhsS);
+        if(EqHelper::isEqTautology(currS)) {
+          env.statistics->backwardDemodulationsToEqTaut++;
+          _removed->insert(qr.data->clause);
+          return BwSimplificationRecord(qr.data->clause);
+        }
+        curr=currS;
+      }
+      resLits->push(curr);
     }
 
     _removed->insert(qr.data->clause);
@@ -12,8 +12,6 @@
  * Implements class BinaryResolution.
  */
 
-#include "Debug/RuntimeStatistics.hpp"
-
 #include "Indexing/ResultSubstitution.hpp"
 #include "Kernel/UnificationWithAbstraction.hpp"
 #include "Lib/Environment.hpp"
@@ -102,7 +100,7 @@ Clause* BinaryResolution::generateClause(Clause* queryCl, Literal* queryLit, Cla
   bool hasAgeLimitStrike = passiveClauseContainer && passiveClauseContainer->mayBeAbleToDiscriminateClausesUnderConstructionOnLimits()
                                                   && passiveClauseContainer->exceedsAgeLimit(numPositiveLiteralsLowerBound, inf, andThatsIt);
   if (hasAgeLimitStrike && andThatsIt) { // we are dealing with purely age-limited container (no need for weight-related investigations)
-    RSTAT_CTR_INC("binary resolutions skipped for (pure) age limit before building clause");
+    env.statistics->inc(Counter::BR_AGE_LIMIT_EARLY);
     env.statistics->discardedNonRedundantClauses++;
     return 0;
   }
@@ -121,7 +119,7 @@ Clause* BinaryResolution::generateClause(Clause* queryCl, Literal* queryLit, Cla
       }
     }
     if(passiveClauseContainer->exceedsWeightLimit(wlb, numPositiveLiteralsLowerBound, inf)) {
-      RSTAT_CTR_INC("binary resolutions skipped for weight limit before building clause");
+      env.statistics->inc(Counter::BR_WEIGHT_LIMIT_EARLY);
       env.statistics->discardedNonRedundantClauses++;
       return 0;
     }
@@ -143,12 +141,12 @@ Clause* BinaryResolution::generateClause(Clause* queryCl, Literal* queryLit, Cla
       if(hasAgeLimitStrike) {
         wlb+=newLit->weight() - curr->weight();
         if(passiveClauseContainer->exceedsWeightLimit(wlb, numPositiveLiteralsLowerBound, inf)) {
-          RSTAT_CTR_INC("binary resolutions skipped for weight limit while building clause");
+          env.statistics->inc(Counter::BR_WEIGHT_LIMIT_BUILDING);
           env.statistics->discardedNonRedundantClauses++;
           return nullptr;
         }
       }
-      if (queryLitAfter && i < queryCl->numSelected()) {
+      if (queryLitAfter && i < queryCl->numSelected() && !ord->lessUnderAllSubstitutions(curr, queryLit)) {
         TIME_TRACE(TimeTrace::LITERAL_ORDER_AFTERCHECK);
 
         Ordering::Result o = ord->compare(newLit,queryLitAfter);
@@ -177,12 +175,12 @@ Clause* BinaryResolution::generateClause(Clause* queryCl, Literal* queryLit, Cla
       if(hasAgeLimitStrike) {
         wlb+=newLit->weight() - curr->weight();
         if(passiveClauseContainer->exceedsWeightLimit(wlb, numPositiveLiteralsLowerBound, inf)) {
-          RSTAT_CTR_INC("binary resolutions skipped for weight limit while building clause");
+          env.statistics->inc(Counter::BR_WEIGHT_LIMIT_BUILDING);
           env.statistics->discardedNonRedundantClauses++;
           return nullptr;
         }
       }
-      if (qrLitAfter && i < resultCl->numSelected()) {
+      if (qrLitAfter && i < resultCl->numSelected() && !ord->lessUnderAllSubstitutions(curr, resultLit)) {
         TIME_TRACE(TimeTrace::LITERAL_ORDER_AFTERCHECK);
 
         Ordering::Result o = ord->compare(newLit,qrLitAfter);
@@ -14,6 +14,7 @@
 
 #include "Lib/DArray.hpp"
 #include "Lib/Metaiterators.hpp"
+#include "Lib/Recycled.hpp"
 #include "Debug/TimeProfiling.hpp"
 
 #include "Kernel/Term.hpp"
@@ -34,12 +35,32 @@ using namespace Kernel;
 using namespace Indexing;
 using namespace Saturation;
 
+/**
+ * False if @b cl cannot be condensed: a condensation needs two literals that
+ * unify, hence have the same predicate and polarity, and of which at least
+ * one is not ground, as the clause has no duplicate literals.
+ */
+bool Condensation::mayCondense(Clause* cl)
+{
+  unsigned clen=cl->length();
+  for(unsigned i=0;i<clen;i++) {
+    Literal* l1=(*cl)[i];
+    for(unsigned j=i+1;j<clen;j++) {
+      Literal* l2=(*cl)[j];
+      if(l1->header()==l2->header() && (!l1->ground() || !l2->ground())) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 Clause* Condensation::simplify(Clause* cl)
 {
   TIME_TRACE("condensation");
 
   unsigned clen=cl->length();
-  if(clen<=1) {
+  if(clen<=1 || !mayCondense(cl) || _failures.contains(cl->number())) {
     return cl;
   }
   unsigned newLen=clen-1;
@@ -49,7 +70,8 @@ Clause* Condensation::simplify(Clause* cl)
   //
   static DArray<LiteralList*> alts(32);
 
-  LiteralMiniIndex cmi(cl);
+  Recycled<LiteralMiniIndex> cmiBuf(cl);
+  LiteralMiniIndex const& cmi = *cmiBuf;
 
   // For each pair of non-equal literals l1 and l2
   //
@@ -126,6 +148,10 @@ Clause* Condensation::simplify(Clause* cl)
       }
     }
   }
+  if(_failures.size()>MAX_FAILURES) {
+    _failures.reset();
+  }
+  _failures.insert(cl->number());
   return cl;
 }
 
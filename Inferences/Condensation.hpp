@@ -18,6 +18,8 @@
 
 #include "Forwards.hpp"
 
+#include "Lib/DHSet.hpp"
+
 #include "InferenceEngine.hpp"
 
 namespace Inferences
@@ -35,6 +37,18 @@ class Condensation
 {
 public:
   Clause* simplify(Clause* cl) override;
+
+  static bool mayCondense(Clause* cl);
+
+private:
+  /** above this number of remembered clauses the set is emptied */
+  static constexpr unsigned MAX_FAILURES = 1 << 16;
+
+  /**
+   * Numbers of clauses that passed mayCondense() but could not be
+   * condensed, e.g. to skip them when AVATAR reactivates them
+   */
+  DHSet<unsigned> _failures;
 };
 
 };
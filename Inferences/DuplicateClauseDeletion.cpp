@@ -0,0 +1,50 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file DuplicateClauseDeletion.cpp
+ * Implements class DuplicateClauseDeletion.
+ */
+
+#include "Debug/RuntimeStatistics.hpp"
+
+#include "Lib/Metaiterators.hpp"
+
+#include "Kernel/Clause.hpp"
+
+#include "Saturation/SaturationAlgorithm.hpp"
+
+#include "DuplicateClauseDeletion.hpp"
+
+namespace Inferences {
+
+void DuplicateClauseDeletion::attach(SaturationAlgorithm* salg)
+{
+  ForwardSimplificationEngine::attach(salg);
+  _index = salg->getSimplifyingIndex<ClauseBodyIndex>();
+}
+
+void DuplicateClauseDeletion::detach()
+{
+  _index = nullptr;
+  ForwardSimplificationEngine::detach();
+}
+
+bool DuplicateClauseDeletion::perform(Clause* cl, Clause*& replacement, ClauseIterator& premises)
+{
+  Clause* premise = _index->findDuplicate(cl);
+  if (!premise) {
+    return false;
+  }
+  RSTAT_CTR_INC("forward duplicate deletions");
+  premises = pvi(getSingletonIterator(premise));
+  return true;
+}
+
+}
@@ -0,0 +1,52 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file DuplicateClauseDeletion.hpp
+ * Defines class DuplicateClauseDeletion.
+ */
+
+#ifndef __DuplicateClauseDeletion__
+#define __DuplicateClauseDeletion__
+
+#include "Forwards.hpp"
+
+#include "Indexing/ClauseBodyIndex.hpp"
+
+#include "InferenceEngine.hpp"
+
+namespace Inferences {
+
+using namespace Kernel;
+using namespace Indexing;
+using namespace Saturation;
+
+/**
+ * Deletes a clause if a clause with the same literals is already kept.
+ *
+ * Forward subsumption deletes such clauses as well, but exact duplicates
+ * (from AVATAR component reintroduction, symmetric inferences or repeated
+ * proofs in one process) are found here by one lookup in a hash set of
+ * clause bodies, before the subsumption index is matched against them.
+ */
+class DuplicateClauseDeletion
+: public ForwardSimplificationEngine
+{
+public:
+  void attach(SaturationAlgorithm* salg) override;
+  void detach() override;
+  bool perform(Clause* cl, Clause*& replacement, ClauseIterator& premises) override;
+
+private:
+  std::shared_ptr<ClauseBodyIndex> _index;
+};
+
+};
+
+#endif /*__DuplicateClauseDeletion__*/
@@ -21,6 +21,7 @@
 #include "Kernel/Term.hpp"
 #include "Kernel/TermIterators.hpp"
 
+#include "Condensation.hpp"
 #include "FastCondensation.hpp"
 
 #undef LOGGING
@@ -67,7 +68,7 @@ Clause* FastCondensation::simplify(Clause* cl)
   TIME_TRACE("fast condensation");
 
   unsigned clen=cl->length();
-  if(clen<=1) {
+  if(clen<=1 || !Condensation::mayCondense(cl)) {
     return cl;
   }
 
@@ -78,6 +78,9 @@ void ForwardDemodulation::attach(SaturationAlgorithm* salg)
   _encompassing = opt.demodulationRedundancyCheck()==Options::DemodulationRedundancyCheck::ENCOMPASS;
   _useTermOrderingDiagrams = opt.forwardDemodulationTermOrderingDiagrams();
   _skipNonequationalLiterals = opt.demodulationOnlyEquational();
+  _cacheIrreducible = opt.forwardDemodulationIrreducibleCache();
+  _cacheOrderedRewrites = opt.forwardDemodulationOrderingCache();
+  _orderedRewrites.reset();
   _helper = DemodulationHelper(opt, &_salg->getOrdering());
 }
 
@@ -100,6 +103,11 @@ bool ForwardDemodulation::perform(Clause* cl, Clause*& replacement, ClauseIterat
   static DHSet<TermList> attempted;
   attempted.reset();
 
+  if (_cacheIrreducible && _irreducibleGeneration != _index->generation()) {
+    _irreducible.reset();
+    _irreducibleGeneration = _index->generation();
+  }
+
   unsigned cLen=cl->length();
   for(unsigned li=0;li<cLen;li++) {
     Literal* lit=(*cl)[li];
@@ -121,6 +129,17 @@ bool ForwardDemodulation::perform(Clause* cl, Clause*& replacement, ClauseIterat
         continue;
       }
 
+      if (!_index->mayHaveGeneralizations(trm.term())) {
+        continue;
+      }
+      // an irreducible term may still have reducible subterms, so unlike
+      // above they are not skipped
+      if (_cacheIrreducible && _irreducible.contains(trm.term())) {
+        continue;
+      }
+      // whether a demodulator was rejected only for reasons depending on @b cl
+      bool clauseDependent = false;
+
       bool redundancyCheck = _helper.redundancyCheckNeededForPremise(cl, lit, trm);
 
       auto git = _index->getGeneralizations(trm.term(), /* retrieveSubstitutions */ true);
@@ -129,6 +148,7 @@ bool ForwardDemodulation::perform(Clause* cl, Clause*& replacement, ClauseIterat
         ASS_EQ(qr.data->clause->length(),1);
 
         if(!ColorHelper::compatible(cl->color(), qr.data->clause->color())) {
+          clauseDependent = true;
           continue;
         }
 
@@ -163,22 +183,37 @@ bool ForwardDemodulation::perform(Clause* cl, Clause*& replacement, ClauseIterat
 
         ASS_EQ(ordering.compare(trm,rhsApplied),Ordering::reverse(ordering.compare(rhsApplied,trm)));
 
-        if (_useTermOrderingDiagrams) {
-#if VDEBUG
-          auto dcomp = ordering.compareUnidirectional(trm,rhsApplied);
-#endif
-          qr.data->tod->init(appl);
-          if (!preordered && (_preorderedOnly || !qr.data->tod->next())) {
-            ASS_NEQ(dcomp,Ordering::GREATER);
+        if (!preordered) {
+          if (_preorderedOnly) {
             continue;
           }
-          ASS_EQ(dcomp,Ordering::GREATER);
-        } else {
-          if (!preordered && (_preorderedOnly || ordering.compareUnidirectional(trm,rhsApplied)!=Ordering::GREATER)) {
+          // the instance of the demodulator is determined by trm,
+          // and so is whether it rewrites trm to a smaller term
+          bool cache = _cacheOrderedRewrites && trm.term()->shared();
+          OrderedRewriteKey key(qr.data->clause->number(), lhs.content(), trm.term());
+          bool greater;
+          if (!cache || !_orderedRewrites.find(key, greater)) {
+            if (_useTermOrderingDiagrams) {
+              qr.data->tod->init(appl);
+              greater = qr.data->tod->next() != nullptr;
+            } else {
+              greater = ordering.compareUnidirectional(trm,rhsApplied)==Ordering::GREATER;
+            }
+            if (cache) {
+              if (_orderedRewrites.size() >= MAX_ORDERED_REWRITES) {
+                _orderedRewrites.reset();
+              }
+              _orderedRewrites.insert(key, greater);
+            }
+          }
+          ASS_EQ(greater, ordering.compareUnidirectional(trm,rhsApplied)==Ordering::GREATER);
+          if (!greater) {
             continue;
           }
         }
 
+        clauseDependent = true;
+
         // encompassing demodulation is fine when rewriting the smaller guy
         if (redundancyCheck && _encompassing) {
           // this will only run at most once;
@@ -220,6 +255,9 @@ bool ForwardDemodulation::perform(Clause* cl, Clause*& replacement, ClauseIterat
           env.proofExtra.insert(replacement, new ForwardDemodulationExtra(lhs, trm));
         return true;
       }
+      if (_cacheIrreducible && !clauseDependent && trm.term()->shared()) {
+        _irreducible.insert(trm.term());
+      }
     }
   }
 
@@ -16,7 +16,11 @@
 #ifndef __ForwardDemodulation__
 #define __ForwardDemodulation__
 
+#include <tuple>
+
 #include "Forwards.hpp"
+#include "Lib/DHMap.hpp"
+#include "Lib/DHSet.hpp"
 #include "Indexing/TermIndex.hpp"
 
 #include "DemodulationHelper.hpp"
@@ -44,6 +48,31 @@ protected:
   bool _skipNonequationalLiterals;
   DemodulationHelper _helper;
   std::shared_ptr<DemodulationLHSIndex> _index;
+
+  bool _cacheIrreducible;
+  /**
+   * Shared terms that no demodulator in the index rewrites to a smaller
+   * term, whatever the clause; valid while the index is at generation
+   * @b _irreducibleGeneration, as removed demodulators cannot make a
+   * term reducible
+   */
+  DHSet<Term*> _irreducible;
+  unsigned _irreducibleGeneration = 0;
+
+  bool _cacheOrderedRewrites;
+  /**
+   * A demodulator, as the number of its clause and its lhs, and a shared
+   * term matched by the lhs
+   */
+  using OrderedRewriteKey = std::tuple<unsigned, uint64_t, Term*>;
+  /**
+   * Whether the instances of non-preordered demodulators that match terms
+   * rewrite them to a smaller term. Clause numbers are not reused, so the
+   * entries of removed demodulators are never found again; they are
+   * dropped with the rest when the cache reaches @b MAX_ORDERED_REWRITES
+   */
+  DHMap<OrderedRewriteKey, bool> _orderedRewrites;
+  static const unsigned MAX_ORDERED_REWRITES = 1 << 18;
 };
 
 using ForwardDemodulationExtra = RewriteInferenceExtra;
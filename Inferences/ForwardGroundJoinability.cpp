@@ -118,6 +118,10 @@ bool ForwardGroundJoinability::perform(Clause* cl, Clause*& replacement, ClauseI
         continue;
       }
 
+      if (!_index->mayHaveGeneralizations(trm.term())) {
+        continue;
+      }
+
       auto git = _index->getGeneralizations(trm.term(), /* retrieveSubstitutions */ true);
       while(git.hasNext()) {
         auto qr=git.next();
@@ -157,11 +161,19 @@ bool ForwardGroundJoinability::perform(Clause* cl, Clause*& replacement, ClauseI
 #endif
 
         POStruct po_struct(tpo);
-        if (!TermOrderingDiagram::extendVarsGreater(qr.data->tod.get(), &appl, po_struct)) {
-          // TODO this check sometimes fails when the debug code can detect the
-          // extension to get GREATER due to elimination of linear expressions
-          // ASS(!success);
-          continue;
+        // a preordered demodulator rewrites under any ordering constraints,
+        // otherwise the diagram stored with it is traversed, which expands
+        // its nodes only once for all the queries against this demodulator
+        if (qr.data->preordered) {
+          env.statistics->groundJoinabilityPreorderedRewrites++;
+        } else {
+          env.statistics->groundJoinabilityDiagramChecks++;
+          if (!TermOrderingDiagram::extendVarsGreater(qr.data->tod.get(), &appl, po_struct)) {
+            // TODO this check sometimes fails when the debug code can detect the
+            // extension to get GREATER due to elimination of linear expressions
+            // ASS(!success);
+            continue;
+          }
         }
         ASS(success);
 
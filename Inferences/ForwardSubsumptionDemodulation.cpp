@@ -22,6 +22,8 @@
 #include "Kernel/Matcher.hpp"
 #include "Kernel/Ordering.hpp"
 #include "Kernel/Term.hpp"
+#include "Kernel/TermIterators.hpp"
+#include "Lib/Recycled.hpp"
 #include "Lib/ScopeGuard.hpp"
 #include "Saturation/SaturationAlgorithm.hpp"
 #include <vector>
@@ -51,10 +53,41 @@ void ForwardSubsumptionDemodulation::detach()
 {
   _index = nullptr;
   _unitIndex = nullptr;
+  _summaries.reset();
   ForwardSimplificationEngine::detach();
 }
 
 
+/**
+ * Summarize the literals of @b cl, leaving out the positive equalities
+ * if @b skipPositiveEqualities is true.
+ *
+ * If the literals of a clause D are matched to distinct literals of an
+ * instance, the symbols of D occur in the instance and the weight of D
+ * is at most that of the instance. In an FSD inference, all literals of
+ * the side premise apart from the positive equality used for demodulation
+ * are matched in this way.
+ */
+ForwardSubsumptionDemodulation::Summary ForwardSubsumptionDemodulation::summarize(Clause* cl, bool skipPositiveEqualities)
+{
+  Summary res { 0, 0 };
+  for (Literal* lit : cl->iterLits()) {
+    if (skipPositiveEqualities && lit->isEquality() && lit->isPositive()) {
+      continue;
+    }
+    res.weight += lit->weight();
+    // predicates with polarity and functions go to different halves of the
+    // bitmap, though collisions only weaken the filter
+    res.symbols |= uint64_t(1) << (lit->header() % 32);
+    NonVariableIterator it(lit);
+    while (it.hasNext()) {
+      res.symbols |= uint64_t(1) << (32 + it.next().term()->functor() % 32);
+    }
+  }
+  return res;
+}
+
+
 bool ForwardSubsumptionDemodulation::perform(Clause* cl, Clause*& replacement, ClauseIterator& premises)
 {
   //                        cl
@@ -114,10 +147,16 @@ bool ForwardSubsumptionDemodulation::perform(Clause* cl, Clause*& replacement, C
     }
   }
 
-  LiteralMiniIndex const cl_miniIndex(cl);
+  Recycled<LiteralMiniIndex> miniIndex(cl);
+  LiteralMiniIndex const& cl_miniIndex = *miniIndex;
 
   unsigned int const cl_maxVar = cl->maxVar();
 
+  Summary const cl_summary = summarize(cl, false);
+  if (_summaries.size() > MAX_SUMMARIES) {
+    _summaries.reset();
+  }
+
   for (unsigned sqli = 0; sqli < cl->length(); ++sqli) {
     Literal* subsQueryLit = (*cl)[sqli];  // this literal is only used to query the subsumption index
 
@@ -148,6 +187,16 @@ bool ForwardSubsumptionDemodulation::perform(Clause* cl, Clause*& replacement, C
         continue;
       }
 
+      // (this check exists only to improve performance and does not affect correctness)
+      Summary* mcl_summary;
+      if (_summaries.getValuePtr(mcl->number(), mcl_summary)) {
+        *mcl_summary = summarize(mcl, true);
+      }
+      if ((mcl_summary->symbols & ~cl_summary.symbols) || mcl_summary->weight > cl_summary.weight) {
+        RSTAT_CTR_INC("FSD, skipped side premise due to summary");
+        continue;
+      }
+
       /**
        * Step 2: choose a positive equality in mcl to use for demodulation and try to instantiate the rest to some subset of cl
        */
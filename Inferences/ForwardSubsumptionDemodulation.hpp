@@ -13,6 +13,7 @@
 
 #include "InferenceEngine.hpp"
 #include "Indexing/LiteralIndex.hpp"
+#include "Lib/DHMap.hpp"
 
 namespace Inferences {
 
@@ -57,6 +58,19 @@ class ForwardSubsumptionDemodulation
     bool perform(Clause* cl, Clause*& replacement, ClauseIterator& premises) override;
 
   private:
+    /**
+     * A necessary condition for the literals of a clause to be matched
+     * by literals of another: the symbols occurring in them, hashed into
+     * a bitmap, and the sum of their weights.
+     */
+    struct Summary {
+      uint64_t symbols;
+      unsigned weight;
+    };
+    static Summary summarize(Clause* cl, bool skipPositiveEqualities);
+    /** above this number of summaries the cache is emptied */
+    static constexpr unsigned MAX_SUMMARIES = 1 << 16;
+
     std::shared_ptr<UnitClauseLiteralIndex> _unitIndex;
     std::shared_ptr<FSDLiteralIndex> _index;
 
@@ -65,6 +79,8 @@ class ForwardSubsumptionDemodulation
 
     bool _doSubsumption;
     const bool _enableOrderingOptimizations;
+    /** summaries of the side premises without their positive equalities, by clause number */
+    DHMap<unsigned, Summary> _summaries;
 };
 
 
@@ -19,14 +19,44 @@ namespace Inferences {
 
 using Balancer = Kernel::Rebalancing::Balancer<Kernel::Rebalancing::Inverters::NumberTheoryInverter>;
 
+/**
+ * Eliminate the variables of all the negative equalities of @b in that can
+ * be solved for a variable, one after another. The literals are rewritten
+ * in place, so a clause with many such equalities gives a single clause
+ * rather than one per eliminated variable.
+ */
 SimplifyingGeneratingInference1::Result GaussianVariableElimination::simplify(Clause* in, bool doCheckOrdering) 
 {
   ASS(in)
 
-  auto& cl = *in;
-  
-  for(unsigned i = 0; i < cl.size(); i++) {
-    auto& lit = *cl[i];
+  RStack<Literal*> lits;
+  lits->loadFromIterator(in->iterLits());
+
+  bool premiseRedundant = true;
+  bool eliminated = false;
+  while (eliminate(*lits, doCheckOrdering, premiseRedundant)) {
+    eliminated = true;
+  }
+  if (!eliminated) {
+    return SimplifyingGeneratingInference1::Result{in, false};
+  }
+
+  Inference inf(SimplifyingInference1(Kernel::InferenceRule::GAUSSIAN_VARIABLE_ELIMINIATION, in));
+  return SimplifyingGeneratingInference1::Result{Clause::fromStack(*lits, inf), premiseRedundant};
+}
+
+/**
+ * Solve one negative equality of @b lits for a variable x, remove it and
+ * replace x by its solution in the other literals. Return false if there
+ * is no such equality.
+ *
+ * @b premiseRedundant is reset if the ordering has to be checked and some
+ * literal was changed.
+ */
+bool GaussianVariableElimination::eliminate(Stack<Literal*>& lits, bool doCheckOrdering, bool& premiseRedundant) const
+{
+  for (unsigned i = 0; i < lits.size(); i++) {
+    auto& lit = *lits[i];
     if (lit.isEquality() && lit.isNegative()) { 
       for (auto b : Balancer(lit)) {
 
@@ -39,42 +69,32 @@ SimplifyingGeneratingInference1::Result GaussianVariableElimination::simplify(Cl
           /* lhs = rhs[...] */
           DEBUG(lhs, " -> ", rhs);
 
-          return rewrite(cl, lhs, rhs, i, doCheckOrdering);
+          rewrite(lits, lhs, rhs, i, doCheckOrdering, premiseRedundant);
+          return true;
         }
       }
     }
   }
-
-  return SimplifyingGeneratingInference1::Result{in, false};
+  return false;
 }
 
-SimplifyingGeneratingInference1::Result GaussianVariableElimination::rewrite(Clause& cl, TermList find, TermList replace, unsigned skipLiteral, bool doCheckOrdering) const 
+void GaussianVariableElimination::rewrite(Stack<Literal*>& lits, TermList find, TermList replace, unsigned skipLiteral, bool doCheckOrdering, bool& premiseRedundant) const 
 {
-  Inference inf(SimplifyingInference1(Kernel::InferenceRule::GAUSSIAN_VARIABLE_ELIMINIATION, &cl));
-
-  bool premiseRedundant = true;
-
-  auto checkLeq = [&](Literal* orig, Literal* rewritten) 
-  { 
-    if (doCheckOrdering) {
-      if (rewritten != orig) {
+  unsigned j = 0;
+  for (unsigned i = 0; i < lits.size(); i++) {
+    if (i != skipLiteral) {
+      Literal* orig = lits[i];
+      Literal* rewritten = EqHelper::replace(orig, find, replace);
+      if (doCheckOrdering && rewritten != orig) {
         // as soon as we rewrite some clause x /= t \/ C[x] into C[t], the result will be incomparable
         // since the weight of t will be at least as big as the weight of x, hence we C[t] won't be smaller 
         // than C[x]
         premiseRedundant = false;
       }
-    }
-    return rewritten;
-  };
-
-  RStack<Literal*> resLits;
-  for (unsigned i = 0; i < cl.size(); i++) {
-    if (i != skipLiteral) {
-      resLits->push(checkLeq(cl[i], EqHelper::replace(cl[i], find, replace)));
+      lits[j++] = rewritten;
     }
   }
-
-  return SimplifyingGeneratingInference1::Result{Clause::fromStack(*resLits, inf), premiseRedundant};
+  lits.truncate(j);
 }
 
 } // namespace Inferences 
@@ -19,8 +19,9 @@ class GaussianVariableElimination
 public:
   SimplifyingGeneratingInference1::Result simplify(Clause *cl, bool doCheckOrdering) override;
 private:
-  SimplifyingGeneratingInference1::Result rewrite(Clause &cl, TermList find, TermList replace,
-                  unsigned skipLiteral, bool doOrderingCheck) const;
+  bool eliminate(Stack<Literal*>& lits, bool doOrderingCheck, bool& premiseRedundant) const;
+  void rewrite(Stack<Literal*>& lits, TermList find, TermList replace,
+                  unsigned skipLiteral, bool doOrderingCheck, bool& premiseRedundant) const;
 
 };
 
@@ -92,9 +92,11 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
   _grounder->groundNonProp(cl, plits);
 
   unsigned clen = plits.size();
+  bool allFresh = true;
   for (unsigned i = 0; i < clen; i++) {
     lookup.insert(plits[i],(*cl)[i]);
     assumps.push(plits[i].opposite());
+    allFresh &= plits[i].var() > _maxUsedVar;
   }
 
   // then add literals corresponding to cl's split levels
@@ -122,6 +124,16 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
   scl->setInference(inf);
   _solver->addClause(scl);
 
+  for (unsigned i = 0; i < plits.size(); i++) {
+    _maxUsedVar = std::max(_maxUsedVar, plits[i].var());
+  }
+  // no other clause mentions the literals of cl, so they cannot be part
+  // of a proper subset of the assumptions that is unsatisfiable
+  if (allFresh && plits.size() == clen) {
+    RSTAT_CTR_INC("global_subsumption_skipped_for_fresh_literals");
+    return cl;
+  }
+
   // check for subsuming clause by looking for a subset of used assumptions
   Status res = _solver->solveUnderAssumptions(assumps, /* onlyPropagate = */ true);
 
@@ -63,6 +63,12 @@ private:
    * An inverse of the above map, for convenience.
    */
   DHMap<unsigned, unsigned> _vars2splits;
+
+  /**
+   * The largest SAT variable in the clauses given to the solver so far.
+   * Variables are allocated in increasing order, so larger ones are fresh.
+   */
+  unsigned _maxUsedVar = 0;
 protected:
   unsigned splitLevelToVar(SplitLevel lev) {
     unsigned* pvar;
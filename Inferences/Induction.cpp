@@ -510,7 +510,7 @@ void Induction::detach() {
 ClauseIterator Induction::generateClauses(Clause* premise)
 {
   return pvi(InductionClauseIterator(premise, InductionHelper(_comparisonIndex.get(), _inductionTermIndex.get()),
-    _salg, _structInductionTermIndex.get(), _formulaIndex));
+    _salg, _structInductionTermIndex.get(), _formulaIndex, _candidates));
 }
 
 void InductionClauseIterator::processClause(Clause* premise)
@@ -636,6 +636,50 @@ private:
   Literal* _lit;
 };
 
+/**
+ * The induction candidates of @b lit, collected when the literal is seen
+ * first. The candidates of literals of earlier premises are dropped once
+ * there are too many of them.
+ */
+const InductionCandidates& InductionClauseIterator::getCandidates(Literal* lit)
+{
+  static const size_t MAX_CACHED_LITERALS = 1 << 16;
+
+  auto found = _candidates.find(lit);
+  if (found != _candidates.end()) {
+    return found->second;
+  }
+  if (_candidates.size() >= MAX_CACHED_LITERALS) {
+    _candidates.clear();
+  }
+  InductionCandidates& res = _candidates[lit];
+  typedef std::set<const InductionTemplate*> TemplateTypeArgsSet;
+
+  VirtualIterator<Term*> it;
+  if (_opt.inductionOnActiveOccurrences()) {
+    it = vi(new ActiveOccurrenceIterator(lit, _fnDefHandler));
+  } else {
+    it = vi(new NonVariableNonTypeIterator(lit, /*includeSelf=*/true));
+  }
+  for (const auto& t : iterTraits(std::move(it))) {
+    if (!t->isLiteral() && InductionHelper::isInductionTerm(t)){
+      if(InductionHelper::isStructInductionOn() && InductionHelper::isStructInductionTerm(t)){
+        res.taTerms.emplace(Stack<Term*>{ t }, TemplateTypeArgsSet());
+      }
+      if(InductionHelper::isIntInductionOn() && InductionHelper::isIntInductionTermListInLiteral(t, lit)){
+        res.intTerms.insert(t);
+      }
+    }
+    Stack<Term*> indTerms;
+    auto templ = _fnDefHandler.matchesTerm(t, indTerms);
+    if (templ) {
+      auto it = res.taTerms.emplace(std::move(indTerms), TemplateTypeArgsSet()).first;
+      it->second.emplace(templ);
+    }
+  }
+  return res;
+}
+
 void InductionClauseIterator::processLiteral(Clause* premise, Literal* lit)
 {
   if(_opt.showInduction()){
@@ -647,32 +691,9 @@ void InductionClauseIterator::processLiteral(Clause* premise, Literal* lit)
   }
 
   if (_opt.questionAnswering() != Options::QuestionAnsweringMode::SYNTHESIS) {
-    Set<Term*,SharedTermHash> int_terms;
-    typedef std::set<const InductionTemplate*> TemplateTypeArgsSet;
-    std::map<Stack<Term*>,TemplateTypeArgsSet> ta_terms;
-
-    VirtualIterator<Term*> it;
-    if (_opt.inductionOnActiveOccurrences()) {
-      it = vi(new ActiveOccurrenceIterator(lit, _fnDefHandler));
-    } else {
-      it = vi(new NonVariableNonTypeIterator(lit, /*includeSelf=*/true));
-    }
-    for (const auto& t : iterTraits(std::move(it))) {
-      if (!t->isLiteral() && InductionHelper::isInductionTerm(t)){
-        if(InductionHelper::isStructInductionOn() && InductionHelper::isStructInductionTerm(t)){
-          ta_terms.emplace(Stack<Term*>{ t }, TemplateTypeArgsSet());
-        }
-        if(InductionHelper::isIntInductionOn() && InductionHelper::isIntInductionTermListInLiteral(t, lit)){
-          int_terms.insert(t);
-        }
-      }
-      Stack<Term*> indTerms;
-      auto templ = _fnDefHandler.matchesTerm(t, indTerms);
-      if (templ) {
-        auto it = ta_terms.emplace(std::move(indTerms), TemplateTypeArgsSet()).first;
-        it->second.emplace(templ);
-      }
-    }
+    const InductionCandidates& candidates = getCandidates(lit);
+    const auto& int_terms = candidates.intTerms;
+    const auto& ta_terms = candidates.taTerms;
 
     if (InductionHelper::isInductionLiteral(lit)) {
       Set<Term*,SharedTermHash>::Iterator citer1(int_terms);
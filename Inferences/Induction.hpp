@@ -16,6 +16,8 @@
 #ifndef __Induction__
 #define __Induction__
 
+#include <map>
+#include <set>
 #include <unordered_map>
 
 #include "Forwards.hpp"
@@ -29,6 +31,7 @@
 #include "Kernel/TermTransformer.hpp"
 
 #include "Lib/DHMap.hpp"
+#include "Lib/Set.hpp"
 
 #include "Saturation/SaturationAlgorithm.hpp"
 
@@ -260,6 +263,20 @@ private:
   bool _done;
 };
 
+/**
+ * The terms of a literal that induction may be applied on: the integer
+ * induction terms and, for structural and recursion induction, the tuples
+ * of induction terms with the recursion templates matching them.
+ *
+ * They only depend on the literal, so they are computed once per shared
+ * literal and kept by @b Induction.
+ */
+struct InductionCandidates
+{
+  Set<Term*,SharedTermHash> intTerms;
+  std::map<Stack<Term*>,std::set<const InductionTemplate*>> taTerms;
+};
+
 /**
  * The induction inference.
  */
@@ -280,6 +297,8 @@ private:
   std::shared_ptr<StructInductionTermIndex> _structInductionTermIndex;
   InductionFormulaIndex _formulaIndex;
   InductionFormulaIndex _recFormulaIndex;
+  /** the induction candidates of the literals of the premises seen so far */
+  std::unordered_map<Literal*, InductionCandidates> _candidates;
 };
 
 /**
@@ -292,9 +311,10 @@ class InductionClauseIterator
 public:
   // all the work happens in the constructor!
   InductionClauseIterator(Clause* premise, InductionHelper helper, SaturationAlgorithm* salg,
-    TermIndex* structInductionTermIndex, InductionFormulaIndex& formulaIndex)
+    TermIndex* structInductionTermIndex, InductionFormulaIndex& formulaIndex,
+    std::unordered_map<Literal*, InductionCandidates>& candidates)
       : _helper(helper), _opt(salg->getOptions()), _structInductionTermIndex(structInductionTermIndex),
-      _formulaIndex(formulaIndex), _fnDefHandler(salg->getFunctionDefinitionHandler())
+      _formulaIndex(formulaIndex), _candidates(candidates), _fnDefHandler(salg->getFunctionDefinitionHandler())
   {
     processClause(premise);
   }
@@ -310,6 +330,7 @@ private:
   void processClause(Clause* premise);
   void processLiteral(Clause* premise, Literal* lit);
   void processIntegerComparison(Clause* premise, Literal* lit);
+  const InductionCandidates& getCandidates(Literal* lit);
 
   ClauseStack produceClauses(Formula* hypothesis, InferenceRule rule, const InductionContext& context, Substitution& cnfSubst);
   void resolveClauses(const InductionContext& context, InductionFormulaIndex::Entry* e, const TermLiteralClause* bound1, const TermLiteralClause* bound2);
@@ -358,6 +379,7 @@ private:
   const Options& _opt;
   TermIndex* _structInductionTermIndex;
   InductionFormulaIndex& _formulaIndex;
+  std::unordered_map<Literal*, InductionCandidates>& _candidates;
   FunctionDefinitionHandler& _fnDefHandler;
 };
 
@@ -141,12 +141,41 @@ void CompositeISE::detach()
 //  ForwardSimplificationEngine::detach();
 //}
 
+/**
+ * Iterator over the clauses of @b inner, charging the time spent producing
+ * them to the engine named @b name. Generated clauses are mostly built
+ * lazily, so timing only the call that returns the iterator would miss them.
+ */
+class CostChargingIterator
+{
+public:
+  DECL_ELEMENT_TYPE(Clause*);
+  CostChargingIterator(const char* name, ClauseIterator inner) : _name(name), _inner(std::move(inner)) {}
+  bool hasNext() { EngineCostTimer timer(_name, /*call=*/false); return _inner.hasNext(); }
+  Clause* next() { EngineCostTimer timer(_name, /*call=*/false); return _inner.next(); }
+private:
+  const char* _name;
+  ClauseIterator _inner;
+};
+
+/** @b clauses, charged to @b engine if engine costs are measured */
+static ClauseIterator chargeCost(InferenceEngine* engine, ClauseIterator clauses)
+{
+  if (!EngineCostTimer::enabled() || !engine->costName()) {
+    return clauses;
+  }
+  return pvi(CostChargingIterator(engine->costName(), std::move(clauses)));
+}
+
 struct GeneratingFunctor
 {
 
   GeneratingFunctor(Clause* cl) : cl(cl) {}
   ClauseIterator operator() (GeneratingInferenceEngine* gie)
-  { return gie->generateClauses(cl); }
+  {
+    EngineCostTimer timer(gie->costName());
+    return chargeCost(gie, gie->generateClauses(cl));
+  }
   Clause* cl;
 };
 CompositeGIE::~CompositeGIE()
@@ -215,8 +244,9 @@ CompositeSGI::ClauseGenerationResult CompositeSGI::generateSimplify(Kernel::Clau
   Stack<ClauseIterator> clauses;
   /* apply generations as until a redundancy is discovered */
   for (auto simpl : _simplifiers) {
+    EngineCostTimer timer(simpl->costName());
     auto res = simpl->generateSimplify(cl);
-    clauses.push(std::move(res.clauses));
+    clauses.push(chargeCost(simpl, std::move(res.clauses)));
     if (res.premiseRedundant) {
       redundant = true;
       break;
@@ -67,8 +67,17 @@ public:
   bool attached() const { return _salg; }
 
   virtual const Options& getOptions() const;
+
+  /**
+   * Name under which the cost of the engine is reported, see
+   * Shell::EngineCostTimer; unnamed engines are not measured.
+   */
+  void setCostName(const char* name) { _costName = name; }
+  const char* costName() const { return _costName; }
 protected:
   SaturationAlgorithm* _salg;
+private:
+  const char* _costName = nullptr;
 };
 
 /** A generating inference that might make its major premise redundant. */
@@ -306,6 +315,42 @@ template<class... Args>
 TupleISE<Args...> tupleISE(Args... args) 
 { return TupleISE<Args...>(std::move(args)...); }
 
+/**
+ * A chain of immediate simplification engines fixed at compile time.
+ *
+ * Like CompositeISE, the engines are tried in order until one changes the
+ * clause, but they are held by value and called without virtual dispatch,
+ * so a chain run on every new clause costs one virtual call, and the calls
+ * can be inlined where the engines are defined in headers.
+ */
+template<class... Engines>
+class FusedISE
+: public ImmediateSimplificationEngine
+{
+  std::tuple<Engines...> _engines;
+
+  template<class E>
+  static Clause* simplifyWith(E& engine, Clause* cl)
+  { return engine.E::simplify(cl); }
+public:
+  Clause* simplify(Clause* premise) override
+  {
+    Clause* res = premise;
+    std::apply([&](auto&... engines) { (((res = simplifyWith(engines, premise)) != premise) || ...); }, _engines);
+    return res;
+  }
+  void attach(SaturationAlgorithm* salg) override
+  {
+    ImmediateSimplificationEngine::attach(salg);
+    std::apply([&](auto&... engines) { (engines.attach(salg), ...); }, _engines);
+  }
+  void detach() override
+  {
+    std::apply([](auto&... engines) { (engines.detach(), ...); }, _engines);
+    ImmediateSimplificationEngine::detach();
+  }
+};
+
 
 
 
@@ -47,4 +47,8 @@ void TwoLiteralRewriteInferenceExtra::output(std::ostream &out) const {
   rewrite.output(out);
 }
 
+void PortfolioImportExtra::output(std::ostream &out) const {
+  out << "worker=" << worker << ",clause=" << clause;
+}
+
 } // namespace Inferences
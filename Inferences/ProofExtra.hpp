@@ -85,6 +85,19 @@ struct TwoLiteralRewriteInferenceExtra : public InferenceExtra {
   // rewrite information
   RewriteInferenceExtra rewrite;
 };
+
+// clauses imported from another worker of a portfolio run
+struct PortfolioImportExtra : public InferenceExtra {
+  PortfolioImportExtra(unsigned worker, unsigned clause)
+    : worker(worker), clause(clause) {}
+
+  void output(std::ostream &out) const override;
+
+  // the pid of the exporting worker
+  unsigned worker;
+  // the number of the clause in the exporting worker
+  unsigned clause;
+};
 }
 
 #endif
@@ -12,10 +12,9 @@
  * Implements class Superposition.
  */
 
-#include "Debug/RuntimeStatistics.hpp"
-
 #include "Forwards.hpp"
 #include "Lib/Environment.hpp"
+#include "Lib/Hash.hpp"
 #include "Lib/Metaiterators.hpp"
 #include "Lib/PairUtils.hpp"
 #include "Lib/Recycled.hpp"
@@ -58,12 +57,15 @@ void Superposition::attach(SaturationAlgorithm* salg)
   GeneratingInferenceEngine::attach(salg);
   _subtermIndex = salg->getGeneratingIndex<SuperpositionSubtermIndex>();
   _lhsIndex = salg->getGeneratingIndex<SuperpositionLHSIndex>();
+  _filterRepeats = getOptions().superpositionRepeatFilter();
 }
 
 void Superposition::detach()
 {
   _subtermIndex = nullptr;
   _lhsIndex = nullptr;
+  _filterRepeats = false;
+  _performed.reset();
   GeneratingInferenceEngine::detach();
 }
 
@@ -113,9 +115,16 @@ ClauseIterator Superposition::generateClauses(Clause* premise)
       // returns an iterator over the rewritable subterms
       { return pushPairIntoRightIterator(lit, EqHelper::getSubtermIterator(lit,  _salg->getOrdering())); });
 
+  // Without abstraction, only LHSs with the same top functor (or variables) can unify
+  // with a subterm, so we don't set up retrievals that are bound to come back empty
+  bool syntactic = env.options->unificationWithAbstraction() == Options::UnificationWithAbstraction::OFF;
+  auto itf2f = getFilteredIterator(std::move(itf2),
+      [this, syntactic](pair<Literal*, TypedTermList> const& arg)
+      { return !syntactic || _lhsIndex->mayHaveUnifications(arg.second.term()); });
+
   // Get clauses with a literal whose complement unifies with the rewritable subterm,
   // returns a pair with the original pair and the unification result (includes substitution)
-  auto itf3 = getMapAndFlattenIterator(std::move(itf2),
+  auto itf3 = getMapAndFlattenIterator(std::move(itf2f),
       [this](pair<Literal*, TypedTermList> arg)
       { return pushPairIntoRightIterator(arg, _lhsIndex->getUwa(arg.second, env.options->unificationWithAbstraction(), env.options->unificationWithAbstractionFixedPointIteration())); });
 
@@ -124,7 +133,10 @@ ClauseIterator Superposition::generateClauses(Clause* premise)
 
   auto itb1 = premise->getSelectedLiteralIterator();
   auto itb2 = getMapAndFlattenIterator(itb1,EqHelper::SuperpositionLHSIteratorFn(_salg->getOrdering(), _salg->getOptions()));
-  auto itb3 = getMapAndFlattenIterator(std::move(itb2),
+  auto itb2f = getFilteredIterator(std::move(itb2),
+      [this, syntactic](pair<Literal*, TermList> const& arg)
+      { return !syntactic || arg.second.isVar() || _subtermIndex->mayHaveUnifications(arg.second.term()); });
+  auto itb3 = getMapAndFlattenIterator(std::move(itb2f),
       [this] (pair<Literal*, TermList> arg)
       { return pushPairIntoRightIterator(
               arg,
@@ -145,6 +157,27 @@ ClauseIterator Superposition::generateClauses(Clause* premise)
   return pvi( std::move(it7) );
 }
 
+/**
+ * Return true if the superposition of @c eqLHS of @c eqClause into @c rwTerm
+ * of @c rwClause has been performed already, and record it otherwise.
+ *
+ * Clause numbers are never reused and a clause keeps its splits, so an
+ * inference between the same premises at the same positions has the same
+ * (syntactic) unifier and conclusion as before. This happens to clauses put
+ * back by AVATAR backtracking, whose earlier conclusions may still be around.
+ */
+bool Superposition::performedAlready(Clause* rwClause, Literal* rwLit, TermList rwTerm,
+    Clause* eqClause, Literal* eqLit, TermList eqLHS, bool eqIsResult)
+{
+  // forgetting is safe, it only lets repeats through again
+  static const unsigned maxRemembered = 1u << 22;
+  if (_performed.size() >= maxRemembered) {
+    _performed.reset();
+  }
+  return !_performed.insert(PerformedKey(rwClause->number(), eqClause->number(), rwLit->getId(),
+      eqLit->getId(), rwTerm.content(), eqLHS.content(), eqIsResult));
+}
+
 /**
  * Return true iff superposition of @c eqClause into @c rwClause can be performed
  * with respect to colors of the clauses. If the inference is not possible, based
@@ -236,7 +269,7 @@ bool Superposition::earlyWeightLimitCheck(Clause* eqClause, Literal* eqLit,
   //we assume that there will be at least one rewrite in the rwLit
   if(passiveClauseContainer->exceedsWeightLimit(nonInvolvedLiteralWLB + eqRHS.weight(), numPositiveLiteralsLowerBound, inf)) {
     env.statistics->discardedNonRedundantClauses++;
-    RSTAT_CTR_INC("superpositions weight skipped early");
+    env.statistics->inc(Counter::SUP_WEIGHT_LIMIT_EARLY);
     return false;
   }
 
@@ -249,7 +282,7 @@ bool Superposition::earlyWeightLimitCheck(Clause* eqClause, Literal* eqLit,
     unsigned approxWeight = rwLit->weight()+rwrBalance;
     if(passiveClauseContainer->exceedsWeightLimit(nonInvolvedLiteralWLB + approxWeight, numPositiveLiteralsLowerBound, inf)) {
       env.statistics->discardedNonRedundantClauses++;
-      RSTAT_CTR_INC("superpositions weight skipped after rewriter weight retrieval");
+      env.statistics->inc(Counter::SUP_WEIGHT_LIMIT_REWRITER);
       return false;
     }
   }
@@ -260,7 +293,7 @@ bool Superposition::earlyWeightLimitCheck(Clause* eqClause, Literal* eqLit,
     unsigned approxWeight = rwLit->weight()+(rwrBalance*rwrCnt);
     if(passiveClauseContainer->exceedsWeightLimit(nonInvolvedLiteralWLB + approxWeight, numPositiveLiteralsLowerBound, inf)) {
       env.statistics->discardedNonRedundantClauses++;
-      RSTAT_CTR_INC("superpositions weight skipped after rewriter weight retrieval with occurrence counting");
+      env.statistics->inc(Counter::SUP_WEIGHT_LIMIT_REWRITER_OCCURRENCES);
       return false;
     }
   }
@@ -270,7 +303,7 @@ bool Superposition::earlyWeightLimitCheck(Clause* eqClause, Literal* eqLit,
   unsigned finalLitWeight = rwLitSWeight+(rwrBalance*rwrCnt);
   if(passiveClauseContainer->exceedsWeightLimit(nonInvolvedLiteralWLB + finalLitWeight, numPositiveLiteralsLowerBound, inf)) {
     env.statistics->discardedNonRedundantClauses++;
-    RSTAT_CTR_INC("superpositions weight skipped after rewritten literal weight retrieval");
+    env.statistics->inc(Counter::SUP_WEIGHT_LIMIT_REWRITTEN);
     return false;
   }
 
@@ -291,6 +324,13 @@ Clause* Superposition::performSuperposition(
   ASS(rwClause->store()==Clause::ACTIVE);
   ASS(eqClause->store()==Clause::ACTIVE);
 
+  // with abstraction, the unifier is not determined by the positions
+  if (_filterRepeats && !unifier->usesUwa()
+      && performedAlready(rwClause, rwLit, rwTerm, eqClause, eqLit, eqLHS, eqIsResult)) {
+    env.statistics->skippedRepeatedSuperposition++;
+    return 0;
+  }
+
   // the first checks the reference and the second checks the stack
   auto subst = ResultSubstitution::fromSubstitution(&unifier->subs(), RetrievalAlgorithms::DefaultVarBanks::query, RetrievalAlgorithms::DefaultVarBanks::internal);
   TermList eqLHSsort = SortHelper::getEqualityArgumentSort(eqLit);
@@ -327,7 +367,7 @@ Clause* Superposition::performSuperposition(
 
   if(hasAgeLimitStrike && andThatsIt) { // we are dealing with purely age-limited container (no need for weight-related investigations)
     env.statistics->discardedNonRedundantClauses++;
-    RSTAT_CTR_INC("superpositions skipped for (pure) age limit before building clause");
+    env.statistics->inc(Counter::SUP_AGE_LIMIT_EARLY);
     return 0;
   }
 
@@ -420,7 +460,7 @@ Clause* Superposition::performSuperposition(
       if(hasAgeLimitStrike) {
         weight+=currAfter->weight();
         if(passiveClauseContainer->exceedsWeightLimit(weight, numPositiveLiteralsLowerBound, inf)) {
-          RSTAT_CTR_INC("superpositions skipped for weight limit while constructing other literals");
+          env.statistics->inc(Counter::SUP_WEIGHT_LIMIT_BUILDING);
           env.statistics->discardedNonRedundantClauses++;
           return nullptr;
         }
@@ -428,7 +468,8 @@ Clause* Superposition::performSuperposition(
 
       if (afterCheck) {
         TIME_TRACE(TimeTrace::LITERAL_ORDER_AFTERCHECK)
-        if (i < rwClause->numSelected() && ordering.compare(currAfter,rwLitS) == Ordering::GREATER) {
+        if (i < rwClause->numSelected() && !ordering.lessUnderAllSubstitutions(curr, rwLit)
+            && ordering.compare(currAfter,rwLitS) == Ordering::GREATER) {
           env.statistics->inferencesBlockedDueToOrderingAftercheck++;
           return nullptr;
         }
@@ -456,13 +497,14 @@ Clause* Superposition::performSuperposition(
         if(hasAgeLimitStrike) {
           weight+=currAfter->weight();
           if(passiveClauseContainer->exceedsWeightLimit(weight, numPositiveLiteralsLowerBound, inf)) {
-            RSTAT_CTR_INC("superpositions skipped for weight limit while constructing other literals");
+            env.statistics->inc(Counter::SUP_WEIGHT_LIMIT_BUILDING);
             env.statistics->discardedNonRedundantClauses++;
             return nullptr;
           }
         }
 
-        if (eqLitS && i < eqClause->numSelected()) {
+        // eqLitS is the instance of eqLit
+        if (eqLitS && i < eqClause->numSelected() && !ordering.lessUnderAllSubstitutions(curr, eqLit)) {
           TIME_TRACE(TimeTrace::LITERAL_ORDER_AFTERCHECK);
 
           Ordering::Result o = ordering.compare(currAfter,eqLitS);
@@ -486,7 +528,7 @@ Clause* Superposition::performSuperposition(
   res->loadFromIterator(unifier->computeConstraintLiterals()->iter());
 
   if(hasAgeLimitStrike && passiveClauseContainer->exceedsWeightLimit(weight, numPositiveLiteralsLowerBound, inf)) {
-    RSTAT_CTR_INC("superpositions skipped for weight limit after the clause was built");
+    env.statistics->inc(Counter::SUP_WEIGHT_LIMIT_BUILT);
     env.statistics->discardedNonRedundantClauses++;
     return nullptr;
   }
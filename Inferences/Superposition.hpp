@@ -16,7 +16,10 @@
 #ifndef __Superposition__
 #define __Superposition__
 
+#include <tuple>
+
 #include "Forwards.hpp"
+#include "Lib/DHSet.hpp"
 #include "Indexing/TermIndex.hpp"
 
 #include "InferenceEngine.hpp"
@@ -52,6 +55,9 @@ private:
 
   static bool checkSuperpositionFromVariable(Clause* eqClause, Literal* eqLit, TermList eqLHS);
 
+  bool performedAlready(Clause* rwClause, Literal* rwLit, TermList rwTerm,
+    Clause* eqClause, Literal* eqLit, TermList eqLHS, bool eqIsResult);
+
   struct ForwardResultFn;
 
   struct LHSsFn;
@@ -60,6 +66,14 @@ private:
 
   std::shared_ptr<SuperpositionSubtermIndex> _subtermIndex;
   std::shared_ptr<SuperpositionLHSIndex> _lhsIndex;
+
+  /** premise numbers, literal ids, rewritten term, left-hand side and direction of a superposition */
+  typedef std::tuple<unsigned,unsigned,unsigned,unsigned,uint64_t,uint64_t,bool> PerformedKey;
+
+  /** true iff superposition_repeat_filter is on */
+  bool _filterRepeats = false;
+  /** the superpositions performed since the set was last cleared */
+  DHSet<PerformedKey> _performed;
 };
 
 using SuperpositionExtra = TwoLiteralRewriteInferenceExtra;
@@ -35,6 +35,7 @@
 #include "Saturation/Splitter.hpp"
 
 #include "Shell/Options.hpp"
+#include "Shell/Statistics.hpp"
 #include "Shell/UIHelper.hpp"
 
 #include "SAT/SATLiteral.hpp"
@@ -66,7 +67,12 @@ TheoryInstAndSimp::TheoryInstAndSimp(Options& opts) : TheoryInstAndSimp(
     opts.thiGeneralise(),
     opts.exportThiProblem(),
     opts.problemExportSyntax()
-    ) {}
+    )
+{
+  if (opts.thiTimeout()) {
+    _solver->setTimeout(opts.thiTimeout());
+  }
+}
 
 
 Options::TheoryInstSimp manageDeprecations(Options::TheoryInstSimp mode) 
@@ -576,10 +582,16 @@ Option<Substitution> TheoryInstAndSimp::instantiateGeneralised(
 };
 
 
-Option<Substitution> TheoryInstAndSimp::instantiateWithModel(SkolemizedLiterals skolem)
+Option<Substitution> TheoryInstAndSimp::instantiateWithModel(SkolemizedLiterals skolem, ModelValues const& model)
 {
   for (auto var : skolem.vars) {
-    auto ev = _solver->evaluateInModel(skolem.subst.apply(var).term());
+    Term* sk = skolem.subst.apply(var).term();
+    Term* ev = nullptr;
+    for (auto& entry : model) {
+      if (entry.first == sk) {
+        ev = entry.second;
+      }
+    }
     if (ev) {
       skolem.subst.rebind(var, ev);
     } else {
@@ -632,6 +644,43 @@ template<class IterLits> TheoryInstAndSimp::SkolemizedLiterals TheoryInstAndSimp
   };
 }
 
+/**
+ * Solve the conjunction of the skolemized literals, or take the verdict from
+ * an earlier call on the same set. If the result is SATISFIABLE and we do not
+ * generalise, @b model receives the values of the skolem constants; with
+ * generalisation the live z3 model is needed, so only unsatisfiable sets are
+ * answered from the cache then.
+ */
+Status TheoryInstAndSimp::check(SkolemizedLiterals const& skolemized, ModelValues& model)
+{
+  static const int MAX_CACHED_CHECKS = 1 << 14;
+
+  Stack<SATLiteral> key = skolemized.lits;
+  key.sort();
+  auto cached = _checkCache.tryGet(key);
+  if (cached.isSome() && (cached->status == Status::UNSATISFIABLE || !_generalisation)) {
+    env.statistics->theoryInstCacheHits++;
+    model = cached->model;
+    return cached->status;
+  }
+
+  Status status = _solver->solveUnderAssumptionsLimited(skolemized.lits, 0);
+  if (status == Status::UNKNOWN || (status == Status::SATISFIABLE && _generalisation)) {
+    return status;
+  }
+  if (status == Status::SATISFIABLE) {
+    for (auto var : skolemized.vars) {
+      Term* sk = skolemized.subst.apply(var).term();
+      model.push(std::make_pair(sk, _solver->evaluateInModel(sk)));
+    }
+  }
+  if (_checkCache.size() >= MAX_CACHED_CHECKS) {
+    _checkCache.reset();
+  }
+  _checkCache.insert(std::move(key), CheckResult { .status = status, .model = model });
+  return status;
+}
+
 VirtualIterator<Solution> TheoryInstAndSimp::getSolutions(Stack<Literal*> const& theoryLiterals, Stack<Literal*> const& guards, unsigned freshVar) {
   auto skolemized = skolemize(concatIters(
         theoryLiterals.iterFifo(),
@@ -640,7 +689,8 @@ VirtualIterator<Solution> TheoryInstAndSimp::getSolutions(Stack<Literal*> const&
   DEBUG("skolemized: ", iterTraits(skolemized.lits.iterFifo()).map([&](SATLiteral l){ return _naming.toFO(l)->toString(); }).collect<Stack>())
 
   // now we can call the solver
-  Status status = _solver->solveUnderAssumptionsLimited(skolemized.lits, 0);
+  ModelValues model;
+  Status status = check(skolemized, model);
 
   if(status == Status::UNSATISFIABLE) {
     DEBUG("unsat")
@@ -649,7 +699,7 @@ VirtualIterator<Solution> TheoryInstAndSimp::getSolutions(Stack<Literal*> const&
   } else if(status == Status::SATISFIABLE) {
     DEBUG("found model: ", _solver->getModel())
     auto subst = _generalisation ? instantiateGeneralised(skolemized, freshVar)
-                                 : instantiateWithModel(skolemized);
+                                 : instantiateWithModel(skolemized, model);
     if (subst.isSome()) {
       return pvi(getSingletonIterator(Solution(std::move(subst).unwrap())));
     } else {
@@ -710,7 +760,8 @@ struct InstanceFn
         redundant = true;
       } else {
         auto skolem = parent->skolemize(iterTraits(invertedLits.iterFifo() /* without guards !! */));
-        auto status = parent->_solver->solveUnderAssumptionsLimited(skolem.lits, 0);
+        TheoryInstAndSimp::ModelValues model;
+        auto status = parent->check(skolem, model);
         // we have an unsat solution without guards
         redundant = status == Status::UNSATISFIABLE;
       }
@@ -74,10 +74,17 @@ private:
     Stack<unsigned> vars;
     Substitution subst;
   };
+  /** values the skolem constants got in a model, nullptr where z3 gave none we can use */
+  using ModelValues = Stack<std::pair<Term*, Term*>>;
+  struct CheckResult {
+    SAT::Status status;
+    ModelValues model;
+  };
   template<class IterLits> SkolemizedLiterals skolemize(IterLits lits);
+  SAT::Status check(SkolemizedLiterals const& skolemized, ModelValues& model);
   VirtualIterator<Solution> getSolutions(Stack<Literal*> const& theoryLiterals, Stack<Literal*> const& guards, unsigned freshVar);
 
-  Option<Substitution> instantiateWithModel(SkolemizedLiterals skolemized);
+  Option<Substitution> instantiateWithModel(SkolemizedLiterals skolemized, ModelValues const& model);
   Option<Substitution> instantiateGeneralised(SkolemizedLiterals skolemized, unsigned freshVar);
 
   Stack<Literal*> selectTheoryLiterals(Clause* cl);
@@ -149,6 +156,12 @@ private:
   bool _generalisation;
   ConstantCache _instantiationConstants;
   ConstantCache _generalizationConstants;
+  /**
+   * Results of earlier checks by their sorted skolemized literals. Skolemization
+   * picks the constants in order of first occurrence, so variants of a literal
+   * set get the same key.
+   */
+  Map<Stack<SATLiteral>, CheckResult> _checkCache;
   friend struct InstanceFn;
 };
 
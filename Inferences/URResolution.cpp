@@ -13,6 +13,7 @@
  */
 
 #include "Lib/DArray.hpp"
+#include "Lib/Environment.hpp"
 #include "Lib/Metaiterators.hpp"
 #include "Lib/VirtualIterator.hpp"
 
@@ -27,6 +28,7 @@
 
 #include "Shell/AnswerLiteralManager.hpp"
 #include "Shell/Options.hpp"
+#include "Shell/Statistics.hpp"
 
 #include "URResolution.hpp"
 
@@ -41,7 +43,7 @@ using namespace Saturation;
 
 template<bool synthesis>
 URResolution<synthesis>::URResolution(bool full)
-: _full(full), _selectedOnly(false) {}
+: _full(full), _selectedOnly(false), _failFirst(false), _budget(0), _budgetLeft(0), _budgetExceeded(false) {}
 
 template<bool synthesis>
 void URResolution<synthesis>::attach(SaturationAlgorithm* salg)
@@ -54,6 +56,8 @@ void URResolution<synthesis>::attach(SaturationAlgorithm* salg)
   Options::URResolution optSetting = _salg->getOptions().unitResultingResolution();
   ASS_NEQ(optSetting,  Options::URResolution::OFF);
   _emptyClauseOnly = optSetting==Options::URResolution::EC_ONLY;
+  _failFirst = _salg->getOptions().unitResultingResolutionFailFirst();
+  _budget = _salg->getOptions().unitResultingResolutionBudget();
 }
 
 template<bool synthesis>
@@ -186,11 +190,36 @@ struct URResolution<synthesis>::Item
     return lit->weight() - lit->getDistinctVars();
   }
 
+  /**
+   * The number of unit clauses @b lit can be resolved with, up to CANDIDATE_CAP
+   *
+   * The unit index does not change during a search, so the counts are
+   * remembered until the next one.
+   */
+  unsigned getCandidateCount(Literal* lit)
+  {
+    unsigned* res;
+    if(!_parent._candidateCounts.getValuePtr(lit, res)) {
+      return *res;
+    }
+    auto unifs = _parent._unitIndex->getUnifications(lit, true, false);
+    *res = 0;
+    while(*res<CANDIDATE_CAP && unifs.hasNext()) {
+      unifs.next();
+      (*res)++;
+    }
+    return *res;
+  }
+
   /**
    * From among the remaining literals (i.e. those with index at
    * least @c idx), select the one most suitable for resolving
-   * (according to the @c getGoodness() function) and move it to
-   * the @c idx position (so that it is resolved next).
+   * and move it to the @c idx position (so that it is resolved next).
+   *
+   * With unit_resulting_resolution_fail_first, the literals with the fewest
+   * unit clauses to resolve with go first, so that the items that cannot be
+   * completed fail early and the search branches little. Otherwise, and to
+   * break ties, the @c getGoodness() function decides.
    */
   void getBestLiteralReady(unsigned idx)
   {
@@ -201,14 +230,18 @@ struct URResolution<synthesis>::Item
       return;
     }
 
+    bool failFirst = _parent._failFirst;
     unsigned bestIdx = idx;
     ASS(_lits[bestIdx]);
+    unsigned bestCnt = failFirst ? getCandidateCount(_lits[bestIdx]) : 0;
     int bestVal = getGoodness(_lits[bestIdx]);
 
-    for(unsigned i=idx+1; i<_activeLength; i++) {
+    for(unsigned i=idx+1; i<_activeLength && (bestCnt || !failFirst); i++) {
       ASS(_lits[i]);
+      unsigned cnt = failFirst ? getCandidateCount(_lits[i]) : 0;
       int val = getGoodness(_lits[i]);
-      if(val>bestVal) {
+      if(cnt<bestCnt || (cnt==bestCnt && val>bestVal)) {
+        bestCnt = cnt;
         bestVal = val;
         bestIdx = i;
       }
@@ -274,6 +307,10 @@ void URResolution<synthesis>::processLiteral(ItemList*& itms, unsigned idx)
         continue;
       }
 
+      if(_budget && !_budgetLeft--) {
+        _budgetExceeded = true;
+        break;
+      }
       Item* itm2 = new Item(*itm);
       itm2->resolveLiteral(idx, unif, unif.data->clause, true);
       iit.insert(itm2);
@@ -289,6 +326,9 @@ void URResolution<synthesis>::processLiteral(ItemList*& itms, unsigned idx)
 
     iit.del();
     delete itm;
+    if(_budgetExceeded) {
+      return;
+    }
   }
 }
 
@@ -296,6 +336,8 @@ void URResolution<synthesis>::processLiteral(ItemList*& itms, unsigned idx)
  * Explore possible ways of resolving away literals in @c itm,
  * and from the successful ones add the resulting clause into
  * @c acc. The search starts at literal with index @c startIdx.
+ * If the search creates more items than the budget allows, it is
+ * abandoned without any results.
  *
  * What we do is a BFS traversal of all possible resolutions
  * on the clause represented in @c itm. In the @c itms list we
@@ -310,9 +352,19 @@ void URResolution<synthesis>::processAndGetClauses(Item* itm, unsigned startIdx,
 
   ItemList* itms = 0;
   ItemList::push(itm, itms);
-  for(unsigned i = startIdx; itms && i<activeLen; i++) {
+  _budgetLeft = _budget;
+  _budgetExceeded = false;
+  _candidateCounts.reset();
+  for(unsigned i = startIdx; itms && i<activeLen && !_budgetExceeded; i++) {
     processLiteral(itms, i);
   }
+  if(_budgetExceeded) {
+    // the items left are not all resolved to the end
+    env.statistics->inc(Counter::URR_BUDGET_CUTS);
+    while(itms) {
+      delete ItemList::pop(itms);
+    }
+  }
 
   while(itms) {
     Item* itm = ItemList::pop(itms);
@@ -324,9 +376,13 @@ void URResolution<synthesis>::processAndGetClauses(Item* itm, unsigned startIdx,
 /**
  * Perform URR inferences between a newly derived unit clause
  * @c cl and non-unit active clauses
+ *
+ * The inferences with a non-unit clause are only performed once the
+ * conclusions of the previous ones have been taken from the iterator, so
+ * that the saturation loop can stop generating early.
  */
 template<bool synthesis>
-void URResolution<synthesis>::doBackwardInferences(Clause* cl, ClauseList*& acc)
+ClauseIterator URResolution<synthesis>::doBackwardInferences(Clause* cl)
 {
   ASS((cl->size() == 1) || (cl->size() == 2 && cl->hasAnswerLiteral()));
 
@@ -335,33 +391,31 @@ void URResolution<synthesis>::doBackwardInferences(Clause* cl, ClauseList*& acc)
     lit = (*cl)[1];
   }
 
-  auto unifs = _nonUnitIndex->getUnifications(lit, true, true);
-  while(unifs.hasNext()) {
-    auto unif = unifs.next();
-    Clause* ucl = unif.data->clause;
-
-    if( !ColorHelper::compatible(cl->color(), ucl->color()) ) {
-      continue;
-    }
-
-    Item* itm = new Item(ucl, _selectedOnly, *this, _emptyClauseOnly);
-    unsigned pos = UINT_MAX;
-    if (!itm->_ansLit) {
-      pos = ucl->getLiteralPosition(unif.data->literal);
-    } else {
-      for (unsigned i = 0; i < itm->_lits.size(); ++i) {
-        if (itm->_lits[i] == unif.data->literal) {
-          pos = i;
-          break;
+  return pvi(iterTraits(_nonUnitIndex->getUnifications(lit, true, true))
+    .filter([cl](auto const& unif) { return ColorHelper::compatible(cl->color(), unif.data->clause->color()); })
+    .flatMap([this, cl](auto unif) {
+      Clause* ucl = unif.data->clause;
+
+      Item* itm = new Item(ucl, _selectedOnly, *this, _emptyClauseOnly);
+      unsigned pos = UINT_MAX;
+      if (!itm->_ansLit) {
+        pos = ucl->getLiteralPosition(unif.data->literal);
+      } else {
+        for (unsigned i = 0; i < itm->_lits.size(); ++i) {
+          if (itm->_lits[i] == unif.data->literal) {
+            pos = i;
+            break;
+          }
         }
       }
-    }
-    ASS(!_selectedOnly || pos<ucl->numSelected());
-    swap(itm->_lits[0], itm->_lits[pos]);
-    itm->resolveLiteral(0, unif, cl, /* useQuerySubstitution */ false);
-
-    processAndGetClauses(itm, 1, acc);
-  }
+      ASS(!_selectedOnly || pos<ucl->numSelected());
+      swap(itm->_lits[0], itm->_lits[pos]);
+      itm->resolveLiteral(0, unif, cl, /* useQuerySubstitution */ false);
+
+      ClauseList* acc = 0;
+      processAndGetClauses(itm, 1, acc);
+      return getPersistentIterator(ClauseList::DestructiveIterator(acc));
+    }));
 }
 
 template<bool synthesis>
@@ -377,12 +431,13 @@ ClauseIterator URResolution<synthesis>::generateClauses(Clause* cl)
   ClauseList* res = 0;
   processAndGetClauses(new Item(cl, _selectedOnly, *this, _emptyClauseOnly), 0, res);
 
+  auto forward = getPersistentIterator(ClauseList::DestructiveIterator(res));
   if (clen==1 ||
       (synthesis && clen==2 && cl->hasAnswerLiteral())) {
-    doBackwardInferences(cl, res);
+    return pvi(concatIters(std::move(forward),
+      TIME_TRACE_ITER("unit resulting resolution", doBackwardInferences(cl))));
   }
-
-  return getPersistentIterator(ClauseList::DestructiveIterator(res));
+  return forward;
 }
 
 template class URResolution<true>;
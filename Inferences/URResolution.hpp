@@ -17,6 +17,8 @@
 
 #include "Forwards.hpp"
 
+#include "Lib/DHMap.hpp"
+
 #include "Indexing/LiteralIndex.hpp"
 #include "InferenceEngine.hpp"
 
@@ -47,11 +49,22 @@ private:
 
   void processLiteral(ItemList*& itms, unsigned idx);
 
-  void doBackwardInferences(Clause* cl, ClauseList*& acc);
+  ClauseIterator doBackwardInferences(Clause* cl);
+
+  /** getBestLiteralReady() counts the unit clauses a literal resolves with up to this number */
+  static constexpr unsigned CANDIDATE_CAP = 4;
 
   bool _full;
   bool _emptyClauseOnly;
   bool _selectedOnly;
+  /** resolve the literals with the fewest unit clauses to resolve with first */
+  bool _failFirst;
+  /** the candidate counts of the literals seen by the current search */
+  DHMap<Literal*, unsigned> _candidateCounts;
+  /** the number of items one search may create, 0 for no limit */
+  unsigned _budget;
+  unsigned _budgetLeft;
+  bool _budgetExceeded;
   using UnitIndexType = std::conditional_t<synthesis, UnitClauseWithALLiteralIndex, UnitClauseLiteralIndex>;
   using NonUnitIndexType = std::conditional_t<synthesis, NonUnitClauseWithALLiteralIndex, NonUnitClauseLiteralIndex>;
   std::shared_ptr<UnitIndexType> _unitIndex;
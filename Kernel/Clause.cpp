@@ -48,7 +48,7 @@ using namespace Lib;
 using namespace Saturation;
 using namespace Shell;
 
-size_t Clause::_auxCurrTimestamp = 0;
+unsigned Clause::_auxCurrTimestamp = 0;
 #if VDEBUG
 bool Clause::_auxInUse = false;
 #endif
@@ -63,6 +63,8 @@ Clause::Clause(Literal* const* lits, unsigned length, Inference inf)
     _component(false),
     _store(NONE),
     _numSelected(0),
+    _numPositiveLiterals(POSITIVE_LITERALS_UNKNOWN),
+    _literalClasses(0),
     _weight(0),
     _weightForClauseSelection(0),
     _refCnt(0),
@@ -85,6 +87,68 @@ Clause::Clause(Literal* const* lits, unsigned length, Inference inf)
   doUnitTracing();
 }
 
+#ifndef INDIVIDUAL_ALLOCATIONS
+/**
+ * Even a unit clause is too large for the global small-object allocator,
+ * so clauses would all come from the system allocator. Most conclusions
+ * of generating inferences are deleted right after forward simplification,
+ * so clauses of up to 19 literals (on 64-bit) are kept in free lists of
+ * their own instead, by size. Unit clauses get an exact fit.
+ */
+static FixedSizeAllocator<14 * sizeof(void *)> s_clauseAllocator14;
+static FixedSizeAllocator<16 * sizeof(void *)> s_clauseAllocator16;
+static FixedSizeAllocator<20 * sizeof(void *)> s_clauseAllocator20;
+static FixedSizeAllocator<24 * sizeof(void *)> s_clauseAllocator24;
+static FixedSizeAllocator<32 * sizeof(void *)> s_clauseAllocator32;
+
+static void* allocClauseMemory(size_t size)
+{
+  memoryUsage(MemoryCategory::CLAUSES).allocated(size);
+  if (size <= 14 * sizeof(void *))
+    return s_clauseAllocator14.alloc();
+  if (size <= 16 * sizeof(void *))
+    return s_clauseAllocator16.alloc();
+  if (size <= 20 * sizeof(void *))
+    return s_clauseAllocator20.alloc();
+  if (size <= 24 * sizeof(void *))
+    return s_clauseAllocator24.alloc();
+  if (size <= 32 * sizeof(void *))
+    return s_clauseAllocator32.alloc();
+  return ALLOC_KNOWN(size,"Clause");
+}
+
+static void freeClauseMemory(void* ptr, size_t size)
+{
+  memoryUsage(MemoryCategory::CLAUSES).freed(size);
+  if (size <= 14 * sizeof(void *))
+    return s_clauseAllocator14.free(ptr);
+  if (size <= 16 * sizeof(void *))
+    return s_clauseAllocator16.free(ptr);
+  if (size <= 20 * sizeof(void *))
+    return s_clauseAllocator20.free(ptr);
+  if (size <= 24 * sizeof(void *))
+    return s_clauseAllocator24.free(ptr);
+  if (size <= 32 * sizeof(void *))
+    return s_clauseAllocator32.free(ptr);
+  DEALLOC_KNOWN(ptr, size,"Clause");
+}
+
+size_t Clause::releaseUnusedMemory()
+{
+  return s_clauseAllocator14.trim() + s_clauseAllocator16.trim() + s_clauseAllocator20.trim()
+    + s_clauseAllocator24.trim() + s_clauseAllocator32.trim();
+}
+#else
+static void* allocClauseMemory(size_t size)
+{ return ALLOC_ACCOUNTED(size, CLAUSES); }
+
+static void freeClauseMemory(void* ptr, size_t size)
+{ DEALLOC_ACCOUNTED(ptr, size, CLAUSES); }
+
+size_t Clause::releaseUnusedMemory()
+{ return 0; }
+#endif
+
 /**
  * Allocate a clause having lits literals.
  * @since 18/05/2007 Manchester
@@ -101,7 +165,7 @@ void* Clause::operator new(size_t sz, unsigned lits)
   size_t size = sizeof(Clause) + lits * sizeof(Literal*);
   size -= sizeof(Literal*);
 
-  return ALLOC_KNOWN(size,"Clause");
+  return allocClauseMemory(size);
 }
 
 void Clause::operator delete(void* ptr,unsigned length)
@@ -114,7 +178,7 @@ void Clause::operator delete(void* ptr,unsigned length)
   size_t size = sizeof(Clause) + length * sizeof(Literal*);
   size -= sizeof(Literal*);
 
-  DEALLOC_KNOWN(ptr, size,"Clause");
+  freeClauseMemory(ptr, size);
 }
 
 void Clause::destroyExceptInferenceObject()
@@ -133,7 +197,7 @@ void Clause::destroyExceptInferenceObject()
   size_t size = sizeof(Clause) + _length * sizeof(Literal*);
   size -= sizeof(Literal*);
 
-  DEALLOC_KNOWN(this, size,"Clause");
+  freeClauseMemory(this, size);
 }
 
 
@@ -498,6 +562,26 @@ unsigned Clause::computeWeight() const
   return result;
 } // Clause::computeWeight
 
+/**
+ * Cache the weight and the number of positive literals, which are both
+ * needed when the clause is inserted into passive, in one pass over the
+ * literals.
+ */
+void Clause::computeLiteralFeatures() const
+{
+  unsigned weight = 0;
+  unsigned positive = 0;
+  for (int i = _length-1; i >= 0; i--) {
+    ASS_REP(_literals[i]->shared(), *_literals[i]);
+    weight += _literals[i]->weight();
+    positive += _literals[i]->isPositive();
+  }
+  _weight = weight;
+  if (positive < POSITIVE_LITERALS_UNKNOWN) {
+    _numPositiveLiterals = positive;
+  }
+} // Clause::computeLiteralFeatures
+
 
 /**
  * Return weight of the split part of the clause
@@ -663,20 +747,34 @@ unsigned Clause::maxVar()
   return max;
 }
 
-unsigned Clause::numPositiveLiterals()
+unsigned Clause::computeNumPositiveLiterals() const
 {
   unsigned count = 0;
-  for (int i = 0; i < _length; i++)
-  {
-    Literal *lit = (*this)[i];
-    if (lit->isPositive())
-    {
-      count++;
-    }
+  for (unsigned i = 0; i < _length; i++) {
+    count += _literals[i]->isPositive();
+  }
+  if (count < POSITIVE_LITERALS_UNKNOWN) {
+    _numPositiveLiterals = count;
   }
   return count;
 }
 
+void Clause::computeLiteralClasses() const
+{
+  unsigned classes = LITERAL_CLASSES_KNOWN;
+  for (unsigned i = 0; i < _length; i++) {
+    Literal* l = _literals[i];
+    if (l->isEquality()) {
+      if (l->isPositive() && l->isTwoVarEquality()) {
+        classes |= VARIABLE_EQUALITY;
+      }
+    } else if (env.signature->getPredicate(l->functor())->label()) {
+      classes |= LABEL_LITERAL;
+    }
+  }
+  _literalClasses = classes;
+}
+
 /**
  * Return index of @b lit in the clause
  *
@@ -87,6 +87,8 @@ private:
   void* operator new(size_t,unsigned length);
 public:
   void operator delete(void* ptr,unsigned length);
+  /** Return memory of the clause free lists that is not in use to the system */
+  static size_t releaseUnusedMemory();
 
   static Clause* fromArray(Literal*const* lits, unsigned size, Inference inf)
   { return new(size) Clause(lits, size, std::move(inf)); }
@@ -178,7 +180,7 @@ public:
   unsigned weight() const
   {
     if(!_weight) {
-      _weight = computeWeight();
+      computeLiteralFeatures();
     }
     return _weight;
   }
@@ -356,6 +358,20 @@ public:
     _auxInUse=false;
 #endif
   }
+  /**
+   * Restart the timestamps from zero, so that a long series of proofs does
+   * not run into the overflow of the 32-bit timestamp. Stale timestamps of
+   * clauses left from earlier proofs would match again later, so every such
+   * clause that can meet requestAux() users again has to be passed to
+   * clearAux().
+   */
+  static void resetAuxTimestamp()
+  {
+    ASS(!_auxInUse);
+    _auxCurrTimestamp = 0;
+  }
+  /** Forget the auxiliary value, see resetAuxTimestamp() */
+  void clearAux() { _auxTimestamp = 0; }
 
   unsigned splitWeight() const;
   unsigned getNumeralWeight() const;
@@ -366,7 +382,34 @@ public:
   unsigned varCnt();
   unsigned maxVar(); // useful to create fresh variables w.r.t. the clause
 
-  unsigned numPositiveLiterals(); // number of positive literals in the clause
+  /** Return the number of positive literals in the clause */
+  unsigned numPositiveLiterals() const
+  {
+    if (_numPositiveLiterals == POSITIVE_LITERALS_UNKNOWN) {
+      return computeNumPositiveLiterals();
+    }
+    return _numPositiveLiterals;
+  }
+
+  /** Classes of literals that some saturation components look for in every clause */
+  enum LiteralClass : unsigned {
+    /** a literal of a label predicate, see Signature::Symbol::label() */
+    LABEL_LITERAL = 1,
+    /** a positive equality between two variables */
+    VARIABLE_EQUALITY = 2,
+  };
+
+  /**
+   * True if the clause has a literal of class @b c. The classes of all
+   * literals are computed in one pass, the first time one is asked for.
+   */
+  bool hasLiteralClass(LiteralClass c) const
+  {
+    if (!(_literalClasses & LITERAL_CLASSES_KNOWN)) {
+      computeLiteralClasses();
+    }
+    return _literalClasses & c;
+  }
 
   Literal* getAnswerLiteral();
 
@@ -392,6 +435,17 @@ protected:
   Store _store : 3;
   /** number of selected literals */
   unsigned _numSelected : 20;
+  /** cached number of positive literals, POSITIVE_LITERALS_UNKNOWN if not
+   * computed yet or too large to be cached */
+  mutable unsigned _numPositiveLiterals : 9;
+  static constexpr unsigned POSITIVE_LITERALS_UNKNOWN = (1u << 9) - 1;
+  /** the LiteralClass bits of the literals, and LITERAL_CLASSES_KNOWN once they are computed */
+  mutable unsigned _literalClasses : 3;
+  static constexpr unsigned LITERAL_CLASSES_KNOWN = 4;
+
+  void computeLiteralFeatures() const;
+  unsigned computeNumPositiveLiterals() const;
+  void computeLiteralClasses() const;
 
   /** weight */
   mutable unsigned _weight;
@@ -406,11 +460,16 @@ protected:
   InverseLookup<Literal>* _literalPositions;
 
   int _numActiveSplits;
-
-  size_t _auxTimestamp;
+  /**
+   * 32 bits are enough here (requestAux() is called at most a few times per
+   * processed clause, and the API restarts the timestamps for each proof)
+   * and let the timestamp share a word with _numActiveSplits, which keeps
+   * an extra 8 bytes out of every clause.
+   */
+  unsigned _auxTimestamp;
   void* _auxData;
 
-  static size_t _auxCurrTimestamp;
+  static unsigned _auxCurrTimestamp;
 #if VDEBUG
   static bool _auxInUse;
 #endif
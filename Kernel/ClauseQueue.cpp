@@ -14,6 +14,8 @@
  */
 
 
+#include <climits>
+
 #include "Lib/Allocator.hpp"
 #include "Lib/Random.hpp"
 #include "Clause.hpp"
@@ -28,8 +30,7 @@ using namespace Kernel;
 ClauseQueue::ClauseQueue()
     : _height(0)
 {
-  void* mem = ALLOC_KNOWN(sizeof(Node)+MAX_HEIGHT*sizeof(Node*),
-          "ClauseQueue::Node");
+  void* mem = ALLOC_ACCOUNTED(sizeof(Node)+MAX_HEIGHT*sizeof(Node*), PASSIVE);
   _left = reinterpret_cast<Node*>(mem);
   _left->nodes[0] = 0;
 }
@@ -39,9 +40,21 @@ ClauseQueue::~ClauseQueue ()
 {
   removeAll();
 
-  DEALLOC_KNOWN(_left,sizeof(Node)+MAX_HEIGHT*sizeof(Node*),"ClauseQueue::Node");
+  DEALLOC_ACCOUNTED(_left,sizeof(Node)+MAX_HEIGHT*sizeof(Node*), PASSIVE);
 } // ClauseQueue::~ClauseQueue
 
+/**
+ * Key ordering clauses by @b first, then by @b second, then preferring
+ * larger input types and then smaller numbers.
+ */
+ClauseQueue::Key ClauseQueue::makeKey(unsigned first, unsigned second, Clause* cl)
+{
+  unsigned inputType = static_cast<unsigned>(toNumber(cl->inputType()));
+  return Key{
+    (uint64_t(first) << 32) | second,
+    (uint64_t(UINT_MAX - inputType) << 32) | cl->number() };
+}
+
 /**
  * Bind @b v to @b t.
  * @pre @b v must previously be unbound
@@ -60,10 +73,10 @@ void ClauseQueue::insert(Clause* c)
     h = _height;
     _left->nodes[h] = 0;
   }
-  void* mem = ALLOC_KNOWN(sizeof(Node)+h*sizeof(Node*),
-			  "ClauseQueue::Node");
+  void* mem = ALLOC_ACCOUNTED(sizeof(Node)+h*sizeof(Node*), PASSIVE);
   Node* newNode = reinterpret_cast<Node*>(mem);
   newNode->clause = c;
+  newNode->key = key(c);
 
   // left is a node with a value smaller than that of newNode and having
   // a large enough height.
@@ -73,7 +86,7 @@ void ClauseQueue::insert(Clause* c)
   unsigned lh = _height;
   for (;;) {
     Node* next = left->nodes[lh];
-    if (next == 0 || lessThan(c,next->clause)) {
+    if (next == 0 || newNode->key < next->key) {
       if (lh <= h) {
 	left->nodes[lh] = newNode;
 	newNode->nodes[lh] = next;
@@ -94,6 +107,7 @@ void ClauseQueue::insert(Clause* c)
  */
 bool ClauseQueue::remove(Clause* c)
 {
+  Key k = key(c);
   unsigned h = _height;
   Node* left = _left;
 
@@ -113,16 +127,15 @@ bool ClauseQueue::remove(Clause* c)
 	}
       }
       // deallocate the node
-      DEALLOC_KNOWN(next,
-		    sizeof(Node)+height*sizeof(Node*),
-		    "ClauseQueue::Node");
+      DEALLOC_ACCOUNTED(next,
+		    sizeof(Node)+height*sizeof(Node*), PASSIVE);
       while (_height > 0 && ! _left->nodes[_height]) {
 	_height--;
       }
       return true;
     }
 
-    if (next == 0 || lessThan(c,next->clause)) {
+    if (next == 0 || k < next->key) {
       if(h==0) {
 
 #if VDEBUG
@@ -163,9 +176,8 @@ Clause* ClauseQueue::pop()
   Clause* c = node->clause;
 
   // deallocate the node
-  DEALLOC_KNOWN(node,
-		sizeof(Node)+h*sizeof(Node*),
-		"ClauseQueue::Node");
+  DEALLOC_ACCOUNTED(node,
+		sizeof(Node)+h*sizeof(Node*), PASSIVE);
   while (_height > 0 && ! _left->nodes[_height]) {
     _height--;
   }
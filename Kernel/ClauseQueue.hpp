@@ -21,6 +21,8 @@
 #include <ostream>
 #endif
 
+#include <cstdint>
+
 #include "Debug/Assertion.hpp"
 
 #include "Lib/Reflection.hpp"
@@ -30,8 +32,10 @@ namespace Kernel {
 class Clause;
 
 /**
- * A clause queue organised as a skip list. The comparison of elements
- * is made using the virtual function compare.
+ * A clause queue organised as a skip list. Clauses are ordered by a key
+ * obtained from the virtual function key when they are inserted. The key
+ * is stored in the node, so walking the list compares integers instead of
+ * dereferencing the clauses.
  * @since 30/12/2007 Manchester
  */
 class ClauseQueue
@@ -50,11 +54,21 @@ public:
 
   friend class Iterator;
 protected:
-  /** comparison of clauses */
-  virtual bool lessThan(Clause*,Clause*) = 0;
+  /** Sort key of a clause, compared lexicographically */
+  struct Key {
+    uint64_t major;
+    uint64_t minor;
+    bool operator<(const Key& o) const
+    { return major < o.major || (major == o.major && minor < o.minor); }
+  };
+  /** the key of a clause, must not change while the clause is in the queue */
+  virtual Key key(Clause*) = 0;
+  static Key makeKey(unsigned first, unsigned second, Clause* cl);
   /** Nodes in the skip list */
   class Node {
   public:
+    /** Key of the clause */
+    Key key;
     /** Clause at this node */
     Clause* clause;
     /** Links to other nodes on the right, can be of any length */
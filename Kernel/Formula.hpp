@@ -124,12 +124,11 @@ class NamedFormula
   : public Formula
 {
 public:
-  explicit NamedFormula(std::string name) : Formula(NAME), _name(name) {}
+  explicit NamedFormula(std::string name) : Formula(NAME), _name(std::move(name)) {}
 
   USE_ALLOCATOR(NamedFormula);
 
-  std::string name(){ return _name; }
-  const std::string name() const { return _name;}
+  const std::string& name() const { return _name; }
 
 protected:
   std::string _name;
@@ -32,6 +32,31 @@ void GlobalSubsumptionGrounder::groundNonProp(Clause* cl, SATLiteralStack& acc)
 
   unsigned clen = cl->length();
 
+  unsigned* start;
+  if (!_cached.getValuePtr(cl->number(), start)) {
+    // literal selection may have reordered the literals since they were
+    // cached, so each one is looked up by the literal it grounds
+    for (unsigned i = 0; i < clen; i++) {
+      Literal* lit = (*cl)[i];
+      unsigned j = *start + i;
+      if (_groundings[j].first != lit) {
+        j = *start;
+        while (_groundings[j].first != lit) {
+          j++;
+          ASS_L(j, *start + clen);
+        }
+      }
+      acc.push(_groundings[j].second);
+    }
+    return;
+  }
+  if (_groundings.size() + clen > MAX_CACHED) {
+    _groundings.reset();
+    _cached.reset();
+    ALWAYS(_cached.getValuePtr(cl->number(), start));
+  }
+  *start = _groundings.size();
+
   lits.initFromArray(clen, *cl);
   Literal **normLits = lits.array();
 
@@ -40,6 +65,7 @@ void GlobalSubsumptionGrounder::groundNonProp(Clause* cl, SATLiteralStack& acc)
   for(unsigned i=0; i<clen; i++) {
     SATLiteral lit = groundNormalized(normLits[i]);
     acc.push(lit);
+    _groundings.push(std::make_pair((*cl)[i], lit));
   }
 }
 
@@ -56,11 +82,14 @@ SATLiteral GlobalSubsumptionGrounder::groundNormalized(Literal* lit)
   bool isPos = lit->isPositive();
   Literal* posLit = Literal::positiveLiteral(lit);
 
-  unsigned* pvar;
-  if(_asgn.getValuePtr(posLit, pvar)) {
-    *pvar = _satSolver.newVar();
+  unsigned id = posLit->getId();
+  if(id >= _asgn.size()) {
+    _asgn.expand(id + 1, 0);
+  }
+  if(!_asgn[id]) {
+    _asgn[id] = _satSolver.newVar();
   }
-  return SATLiteral(*pvar, isPos);
+  return SATLiteral(_asgn[id], isPos);
 }
 
 struct GlobalSubsumptionGrounder::OrderNormalizingComparator
@@ -17,7 +17,11 @@
 
 #include "Forwards.hpp"
 
+#include "Lib/DArray.hpp"
 #include "Lib/DHMap.hpp"
+#include "Lib/Stack.hpp"
+
+#include "SAT/SATLiteral.hpp"
 
 namespace Kernel {
 
@@ -34,7 +38,10 @@ public:
    * Return SATClause that is a result of grounding of the
    * non-propositional part of @c cl.
    *
-   * The order of literals in @c cl is preserved.
+   * The order of literals in @c cl is preserved. The grounding is cached
+   * by the number of @c cl, with the literal each SAT literal grounds, so a
+   * clause that comes back, e.g. when AVATAR reactivates it, is not
+   * normalized again even if its literals were reordered meanwhile.
    *
    * @param cl the clause
    * @param acc previously accumulated literals
@@ -59,8 +66,19 @@ private:
    */
   SATLiteral groundNormalized(Literal*);
 
-  /** Map from positive literals to SAT variable numbers */
-  DHMap<Literal*, unsigned> _asgn;
+  /** above this number of cached SAT literals the cache is emptied */
+  static constexpr unsigned MAX_CACHED = 1 << 22;
+
+  /**
+   * SAT variable numbers of normalized positive literals, indexed
+   * by the literal ids, 0 for literals not grounded yet
+   */
+  DArray<unsigned> _asgn;
+
+  /** where the grounding of each cached clause starts in _groundings, by clause number */
+  DHMap<unsigned, unsigned> _cached;
+  /** groundings of the literals of the cached clauses, one clause after another */
+  Stack<std::pair<Literal*, SATLiteral>> _groundings;
 
   /** Reference to a SATSolver instance for which the grounded clauses
    * are being prepared. Used to request new variables from the Solver.
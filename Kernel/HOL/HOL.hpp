@@ -109,6 +109,9 @@ namespace HOL::reduce {
 TermList betaNF(TermList t, unsigned* reductions = nullptr);
 TermList etaNF(TermList t);
 TermList betaEtaNF(TermList t);
+
+/** forget the normal forms cached by the functions above */
+void resetCaches();
 } // namespace HOL::reduce
 
 #endif // HOL_HPP
@@ -11,26 +11,71 @@
  * @file Reduce.cpp
  */
 
+#include "Lib/DHMap.hpp"
+
 #include "BetaNormaliser.hpp"
 #include "EtaNormaliser.hpp"
 #include "Kernel/HOL/HOL.hpp"
 
 using Kernel::Term;
 
+namespace {
+
+/**
+ * Normal forms of the shared terms normalised in this run, with the number
+ * of beta reductions leading to the beta normal form. Only terms with a
+ * redex (resp. a lambda) are stored, the others are their own normal form.
+ */
+DHMap<Term*, std::pair<TermList, unsigned>> s_betaNFs;
+DHMap<Term*, TermList> s_etaNFs;
+
+/** true if the normal forms of @b t may be cached */
+bool cacheable(TermList t) {
+  return t.isTerm() && t.term()->shared() && !t.term()->isSort();
+}
+
+} // namespace
 
 TermList HOL::reduce::betaNF(TermList t, unsigned *reductions) {
-  auto bn = BetaNormaliser();
-  const auto term = bn.normalise(t);
+  if (cacheable(t) && !t.term()->hasRedex()) {
+    if (reductions != nullptr)
+      *reductions = 0;
+    return t;
+  }
+
+  std::pair<TermList, unsigned> res;
+  if (!cacheable(t) || !s_betaNFs.find(t.term(), res)) {
+    auto bn = BetaNormaliser();
+    res = std::make_pair(bn.normalise(t), bn.getReductions());
+    if (cacheable(t))
+      s_betaNFs.insert(t.term(), res);
+  }
   if (reductions != nullptr)
-    *reductions = bn.getReductions();
+    *reductions = res.second;
 
-  return term;
+  return res.first;
 }
 
 TermList HOL::reduce::etaNF(TermList t) {
-  return EtaNormaliser::normalise(t);
+  if (!cacheable(t)) {
+    return EtaNormaliser::normalise(t);
+  }
+  if (!t.term()->hasLambda()) {
+    return t;
+  }
+  TermList res;
+  if (!s_etaNFs.find(t.term(), res)) {
+    res = EtaNormaliser::normalise(t);
+    s_etaNFs.insert(t.term(), res);
+  }
+  return res;
 }
 
-inline TermList HOL::reduce::betaEtaNF(TermList t) {
+TermList HOL::reduce::betaEtaNF(TermList t) {
   return etaNF(betaNF(t));
 }
+
+void HOL::reduce::resetCaches() {
+  s_betaNFs.reset();
+  s_etaNFs.reset();
+}
@@ -15,6 +15,11 @@
 #include "Kernel/HOL/HOL.hpp"
 
 std::pair<TermList, Option<unsigned>> TermShifter::shift(TermList term, int shiftBy) {
+  // a shared term without De Bruijn indices has no loose ones
+  if (term.isVar() || (term.term()->shared() && !term.term()->isSort() && !term.term()->hasDeBruijnIndex())) {
+    return {term, Option<unsigned>()};
+  }
+
   TermShifter ts = TermShifter(shiftBy);
   TermList result = ts.transform(term);
 
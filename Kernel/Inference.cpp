@@ -107,6 +107,30 @@ void Inference::destroy()
   }
 }
 
+/**
+ * Release the premises, leaving an inference with the same rule and
+ * properties but no premises (see InferenceLog).
+ */
+void Inference::dropPremises()
+{
+  ASS(canDropPremises());
+
+  if (_kind == Kind::INFERENCE_012) {
+    if (_ptr1) static_cast<Unit*>(_ptr1)->decRefCnt();
+    if (_ptr2) static_cast<Unit*>(_ptr2)->decRefCnt();
+    _ptr1 = nullptr;
+    _ptr2 = nullptr;
+    return;
+  }
+  UnitList* it=static_cast<UnitList*>(_ptr1);
+  while(it) {
+    it->head()->decRefCnt();
+    it=it->tail();
+  }
+  UnitList::destroy(static_cast<UnitList*>(_ptr1));
+  _ptr1 = nullptr;
+}
+
 Inference::Inference(const NeedsMinimization& fsr) {
   initMany(fsr._rule,fsr._premises);
 
@@ -727,6 +751,8 @@ std::string Kernel::ruleName(InferenceRule rule)
     return "distinctness axiom";
   case InferenceRule::THEORY_TAUTOLOGY_SAT_CONFLICT:
     return "theory tautology sat conflict";
+  case InferenceRule::PORTFOLIO_IMPORT:
+    return "portfolio import";
   case InferenceRule::THA_COMMUTATIVITY:
     return "tha commutativity";
   case InferenceRule::THA_ASSOCIATIVITY:
@@ -432,6 +432,9 @@ enum class InferenceRule : unsigned char {
    * whose propositional counterpart becomes a conflict clause in a sat solver */
   THEORY_TAUTOLOGY_SAT_CONFLICT,
 
+  /** clause derived by another strategy of the same portfolio run */
+  PORTFOLIO_IMPORT,
+
   GENERIC_AVATAR_INFERENCE,
   /** definition introduced by AVATAR */
   AVATAR_DEFINITION,
@@ -769,6 +772,10 @@ public:
    */
   void destroy();
 
+  /** True if the premises can be dropped by dropPremises() */
+  bool canDropPremises() const { return _kind == Kind::INFERENCE_012 || _kind == Kind::INFERENCE_MANY; }
+  void dropPremises();
+
   /**
    * Since we treat Inferences as PODs, this is intentionally left empty.
    *
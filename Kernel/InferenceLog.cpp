@@ -0,0 +1,241 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file InferenceLog.cpp
+ * Implements class InferenceLog.
+ */
+
+#include <sstream>
+#include <unistd.h>
+#include <utility>
+
+#include "Debug/TimeProfiling.hpp"
+
+#include "Lib/Int.hpp"
+#include "Lib/Stack.hpp"
+
+#include "Kernel/Clause.hpp"
+#include "Kernel/Inference.hpp"
+#include "Kernel/Term.hpp"
+#include "Kernel/Unit.hpp"
+
+#include "InferenceLog.hpp"
+
+namespace Kernel
+{
+
+using namespace std;
+
+InferenceLog InferenceLog::s_default;
+InferenceLog* InferenceLog::s_installed = nullptr;
+
+namespace {
+
+/** True if the premises of @b u may be dropped */
+bool prunable(Unit* u)
+{
+  return u->isClause() && !u->isFromPreprocessing() && u->inference().canDropPremises();
+}
+
+} // namespace
+
+/**
+ * The units kept for the proof are not released, as the environment they
+ * belong to may be gone already.
+ */
+InferenceLog::~InferenceLog()
+{
+  if (_out.is_open()) {
+    _out.close();
+  }
+}
+
+InferenceLog* InferenceLog::installInstance(InferenceLog* log)
+{
+  InferenceLog* prev = s_installed;
+  s_installed = log;
+  return prev;
+}
+
+/**
+ * Start moving the derivation records to @b file, followed by '.' and the
+ * process id so that the workers of a portfolio each have their own,
+ * discarding the records of a previous run.
+ */
+void InferenceLog::open(const string& file)
+{
+  close();
+  InferenceLog& log = current();
+  log._fileName = file + "." + Int::toString(getpid());
+  log._out.open(log._fileName, ios::trunc);
+  if (!log._out) {
+    USER_ERROR("Cannot open inference log file: " + log._fileName);
+  }
+  log._enabled = true;
+}
+
+/**
+ * Stop moving the derivation records and release the units kept for
+ * the proof.
+ */
+void InferenceLog::close()
+{
+  InferenceLog& log = current();
+  if (log._out.is_open()) {
+    log._out.close();
+  }
+  log._pruned.reset();
+  decltype(log._kept)::Iterator kit(log._kept);
+  while (kit.hasNext()) {
+    kit.next()->decRefCnt();
+  }
+  log._kept.reset();
+  log._enabled = false;
+}
+
+/**
+ * Write the record of @b cl and of its premises not pruned yet to the
+ * file and drop their premises.
+ *
+ * A record is a line with the number of the clause, the numbers of its
+ * premises, '|' and the clause as it appears in a proof.
+ */
+void InferenceLog::prune(Clause* cl)
+{
+  ASS(enabled());
+  InferenceLog& log = current();
+
+  if (!prunable(cl) || !log._pruned.insert(cl->number())) {
+    return;
+  }
+
+  TIME_TRACE("inference log");
+
+  static Stack<Clause*> todo;
+  // each clause on the stack holds a reference, as dropping the premises of
+  // its descendant may release the last one
+  cl->incRefCnt();
+  todo.push(cl);
+  while (todo.isNonEmpty()) {
+    Clause* c = todo.pop();
+    Inference& inf = c->inference();
+    log._out << c->number();
+    Inference::Iterator it = inf.iterator();
+    while (inf.hasNext(it)) {
+      Unit* prem = inf.next(it);
+      log._out << ' ' << prem->number();
+      if (!prunable(prem)) {
+        if (log._kept.insert(prem->number(), prem)) {
+          prem->incRefCnt();
+        }
+      } else if (log._pruned.insert(prem->number())) {
+        prem->incRefCnt();
+        todo.push(static_cast<Clause*>(prem));
+      }
+    }
+    log._out << " | " << c->toString() << '\n';
+    inf.dropPremises();
+    c->decRefCnt();
+  }
+}
+
+/**
+ * Call @b step with the number and proof line of every unit of the
+ * derivation of @b refutation, reading the records of the pruned clauses
+ * back from the file.
+ */
+template<class StepFn>
+void InferenceLog::walk(Unit* refutation, StepFn step)
+{
+  _out.flush();
+  ifstream in(_fileName);
+  if (!in) {
+    USER_ERROR("Cannot read inference log file: " + _fileName);
+  }
+  // where the record of each pruned clause starts
+  DHMap<unsigned, streamoff> offsets;
+  string line;
+  for (streamoff pos = in.tellg(); getline(in, line); pos = in.tellg()) {
+    offsets.insert(stoul(line), pos);
+  }
+
+  DHSet<unsigned> done;
+  Stack<pair<unsigned, Unit*>> todo;
+  todo.push(make_pair(refutation->number(), refutation));
+  while (todo.isNonEmpty()) {
+    auto [number, unit] = todo.pop();
+    if (!done.insert(number)) {
+      continue;
+    }
+    streamoff offset;
+    if (offsets.find(number, offset)) {
+      in.clear();
+      in.seekg(offset);
+      getline(in, line);
+      istringstream record(line);
+      record >> number;
+      string premise;
+      while (record >> premise && premise != "|") {
+        todo.push(make_pair(static_cast<unsigned>(stoul(premise)), nullptr));
+      }
+      getline(record >> ws, line);
+      step(number, line);
+      continue;
+    }
+    if (!unit && !_kept.find(number, unit)) {
+      ASSERTION_VIOLATION_REP(number);
+      continue;
+    }
+    step(number, unit->toString());
+    Inference& inf = unit->inference();
+    Inference::Iterator it = inf.iterator();
+    while (inf.hasNext(it)) {
+      Unit* prem = inf.next(it);
+      todo.push(make_pair(prem->number(), prem));
+    }
+  }
+}
+
+/**
+ * Print the derivation of @b refutation to @b out in the default proof
+ * format.
+ */
+void InferenceLog::outputProof(ostream& out, Unit* refutation)
+{
+  ASS(enabled());
+
+  DHMap<unsigned, string> steps;
+  current().walk(refutation, [&](unsigned number, const string& line) {
+    steps.insert(number, line);
+  });
+
+  auto numbers = Stack<unsigned>::fromIterator(steps.domain());
+  numbers.sort();
+  for (unsigned number : numbers) {
+    out << steps.get(number) << '\n';
+  }
+  out.flush();
+}
+
+/**
+ * Add the numbers of the units of the derivation of @b refutation,
+ * including its own, to @b numbers. The premises of pruned clauses are
+ * gone from memory, so walking their inferences would miss them.
+ */
+void InferenceLog::collectAncestors(Unit* refutation, DHSet<unsigned>& numbers)
+{
+  ASS(enabled());
+
+  current().walk(refutation, [&](unsigned number, const string&) {
+    numbers.insert(number);
+  });
+}
+
+}
@@ -0,0 +1,95 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file InferenceLog.hpp
+ * Defines class InferenceLog for keeping the derivations of long runs on disk.
+ */
+
+#ifndef __InferenceLog__
+#define __InferenceLog__
+
+#include <fstream>
+#include <ostream>
+#include <string>
+
+#include "Forwards.hpp"
+#include "Lib/DHMap.hpp"
+#include "Lib/DHSet.hpp"
+
+namespace Kernel {
+
+using namespace Lib;
+
+/**
+ * Proof on demand: the derivation records of the clauses of a saturation
+ * run are moved to a file, so that clauses deleted from the search can be
+ * freed even if live clauses descend from them.
+ *
+ * Once a clause has been handled as a new clause, nothing but the proof
+ * output follows its premises. prune() then writes the clause, its
+ * inference and the numbers of its premises to the file and drops the
+ * premises from the inference, which keeps its rule, age and the other
+ * fields. Premises that have not been pruned yet are pruned with it, except
+ * the units of preprocessing and the conclusions of SAT inferences, which
+ * stay in memory with their derivations.
+ *
+ * When a refutation is found, outputProof() rebuilds its derivation from
+ * the file and the units kept in memory. Code that walks the derivation
+ * otherwise has to go through collectAncestors().
+ *
+ * The static functions work on the log of the current environment, which
+ * the API replaces for each prover context (see installInstance()).
+ */
+class InferenceLog
+{
+public:
+  InferenceLog() = default;
+  ~InferenceLog();
+
+  static void open(const std::string& file);
+  static void close();
+
+  /** True if the derivation records are moved to the file */
+  static bool enabled() { return current()._enabled; }
+
+  static void prune(Clause* cl);
+
+  static void outputProof(std::ostream& out, Unit* refutation);
+  static void collectAncestors(Unit* refutation, DHSet<unsigned>& numbers);
+
+  /**
+   * Make the static functions work on @b log (or the process-wide default
+   * log if @b log is nullptr).
+   * @return the previously installed log
+   */
+  static InferenceLog* installInstance(InferenceLog* log);
+
+private:
+  static InferenceLog& current() { return s_installed ? *s_installed : s_default; }
+
+  template<class StepFn>
+  void walk(Unit* refutation, StepFn step);
+
+  bool _enabled = false;
+  std::string _fileName;
+  std::ofstream _out;
+  /** numbers of the clauses whose records are in the file */
+  DHSet<unsigned> _pruned;
+  /** premises of pruned clauses that keep their derivation in memory, by number */
+  DHMap<unsigned, Unit*> _kept;
+
+  static InferenceLog s_default;
+  /** log used instead of the default one, if non-null */
+  static InferenceLog* s_installed;
+};
+
+};
+
+#endif /* __InferenceLog__ */
@@ -83,11 +83,12 @@ void InferenceStore::recordIntroducedSymbol(Unit* u, SymbolType st, unsigned num
 }
 
 /**
- * Record the introduction of a split name
+ * Record the introduction of a split name by the AVATAR definition @b u
  */
-void InferenceStore::recordIntroducedSplitName(Unit* u, std::string name)
+void InferenceStore::recordIntroducedSplitName(Unit* u)
 {
-  ALWAYS(_introducedSplitNames.insert(u->number(),name));
+  ASS(!u->isClause());
+  ALWAYS(_introducedSplitNames.insert(u->number()));
 }
 
 /**
@@ -283,7 +284,7 @@ protected:
             << *extra;
       }
 
-      out << "]" << endl;
+      out << "]" << '\n';
     }
   }
 
@@ -351,9 +352,9 @@ struct InferenceStore::ProofPropertyPrinter
   {
     ProofPrinter::print();
     for(unsigned i=0;i<11;i++){ out << buckets[i] << " ";}
-    out << endl;
-    if(last_one){ out << "yes" << endl; }
-    else{ out << "no" << endl; }
+    out << '\n';
+    if(last_one){ out << "yes" << '\n'; }
+    else{ out << "no" << '\n'; }
   }
 
 protected:
@@ -552,6 +553,14 @@ protected:
     }
     return res;
   }
+  /** The name introduced by the AVATAR definition @b u, i.e. the NamedFormula side of its equivalence */
+  const std::string& getSplitName(Unit* u) {
+    Formula* def = static_cast<FormulaUnit*>(u)->formula();
+    ASS_EQ(def->connective(),IFF);
+    Formula* name = def->left()->connective() == NAME ? def->left() : def->right();
+    ASS_EQ(name->connective(),NAME);
+    return static_cast<NamedFormula*>(name)->name();
+  }
   std::string getNewSymbols(std::string origin, std::string symStr) {
     return "new_symbols(" + origin + ",[" +symStr + "])";
   }
@@ -578,7 +587,7 @@ protected:
     ASS(hasNewSymbols(u));
 
     if(_is->_introducedSplitNames.find(u->number())){
-      return getNewSymbols(origin,_is->_introducedSplitNames.get(u->number()));
+      return getNewSymbols(origin,getSplitName(u));
     }
 
     SymbolStack& syms = _is->_introducedSymbols.get(u->number());
@@ -674,7 +683,7 @@ protected:
       inferenceStr+="])";
     }
 
-    out<<getFofString(tptpUnitId(us), formulaStr, inferenceStr, rule, us->inputType())<<endl;
+    out<<getFofString(tptpUnitId(us), formulaStr, inferenceStr, rule, us->inputType())<<'\n';
   }
 
   void printSATStep(SATClause *cl) override {
@@ -741,7 +750,7 @@ protected:
     }
     inferenceStr+="])";
 
-    out<<getFofString(tptpUnitId(us), getFormulaString(us), inferenceStr, rule)<<endl;
+    out<<getFofString(tptpUnitId(us), getFormulaString(us), inferenceStr, rule)<<'\n';
   }
 
   void printGeneralSplittingComponent(Unit* us)
@@ -757,7 +766,7 @@ protected:
     std::string defId=tptpDefId(us);
 
     out<<getFofString(tptpUnitId(us), getFormulaString(us),
-	    "inference("+tptpRuleName(InferenceRule::CLAUSIFY)+",[],["+defId+"])", InferenceRule::CLAUSIFY)<<endl;
+	    "inference("+tptpRuleName(InferenceRule::CLAUSIFY)+",[],["+defId+"])", InferenceRule::CLAUSIFY)<<'\n';
 
 
     List<unsigned>* nameVars=0;
@@ -808,7 +817,7 @@ protected:
 	      << getNewSymbols("naming",getSingletonIterator(nameSymbol))
 	      << "],[" << tptpRuleName(rule) << "])";
 
-    out<<getFofString(defId, defStr, originStm.str(), rule)<<endl;
+    out<<getFofString(defId, defStr, originStm.str(), rule)<<'\n';
   }
 };
 
@@ -905,7 +914,7 @@ protected:
               .template collect<Stack>();
     auto sortInstance = TermList(AtomicSort::create(sortCons, arity, args.begin()));
     if (env.signature->isTermAlgebraSort(sortInstance)) {
-      out << "=== warning term algebras are not yet implemented for proof checking ==" << std::endl;
+      out << "=== warning term algebras are not yet implemented for proof checking ==" << '\n';
     }
     return sig.isArrayCon(sortCons)
       || sortInstance == AtomicSort::intSort()
@@ -923,7 +932,7 @@ protected:
         outputQuoted(out, sig.typeConName(i));
         out << " "
             << sig.typeConArity(i) << ")" 
-            << std::endl;
+            << '\n';
       }
     }
     for (unsigned i = 0; i < sig.functions(); ++i) {
@@ -944,7 +953,7 @@ protected:
         out << " )";
         outputSort(out, fty->result());
         out << ")" 
-            << std::endl;
+            << '\n';
       }
     }
     for (unsigned i = 0; i < sig.predicates(); ++i) {
@@ -966,29 +975,29 @@ protected:
           outputSort(out, s);
         }
         out << " ) Bool)"
-            << std::endl;
+            << '\n';
       }
     }
 
-    out   << "(define-fun |$floor| ((x Real)) Real " << std::endl
-          << "   (to_real (to_int x)))             " << std::endl
-          <<                                            std::endl;
+    out   << "(define-fun |$floor| ((x Real)) Real " << '\n'
+          << "   (to_real (to_int x)))             " << '\n'
+          <<                                            '\n';
 
     auto defRemainderInTermsOfQuotient = [&](auto kind, auto definition) {
-      out << "(declare-fun |$quotient_"  << kind << "0| (Int) Int)         " << std::endl
-          << "(declare-fun |$remainder_" << kind << "0| (Int) Int)         " << std::endl
-          <<                                                                    std::endl
-          << "(define-fun |$quotient_" << kind << "| ((m Int) (n Int)) Int " << std::endl
-          << "   (ite (= n 0)                                              " << std::endl
-          << "     (|$quotient_" << kind << "0| m)                         " << std::endl
+      out << "(declare-fun |$quotient_"  << kind << "0| (Int) Int)         " << '\n'
+          << "(declare-fun |$remainder_" << kind << "0| (Int) Int)         " << '\n'
+          <<                                                                    '\n'
+          << "(define-fun |$quotient_" << kind << "| ((m Int) (n Int)) Int " << '\n'
+          << "   (ite (= n 0)                                              " << '\n'
+          << "     (|$quotient_" << kind << "0| m)                         " << '\n'
           << definition 
-          << "   )"                                                          << std::endl
-          << ")"                                                             << std::endl
-          <<                                                                    std::endl
-          << "(define-fun |$remainder_" << kind << "| ((m Int) (n Int)) Int" << std::endl
-          << "   (ite (= n 0)                                              " << std::endl
-          << "    (|$remainder_" << kind << "0| m)                         " << std::endl
-          << "    (- m (* n (|$quotient_" << kind << "| m n)))))           " << std::endl;
+          << "   )"                                                          << '\n'
+          << ")"                                                             << '\n'
+          <<                                                                    '\n'
+          << "(define-fun |$remainder_" << kind << "| ((m Int) (n Int)) Int" << '\n'
+          << "   (ite (= n 0)                                              " << '\n'
+          << "    (|$remainder_" << kind << "0| m)                         " << '\n'
+          << "    (- m (* n (|$quotient_" << kind << "| m n)))))           " << '\n';
     };
 
     defRemainderInTermsOfQuotient("f",
@@ -1475,11 +1484,11 @@ protected:
 
     if (unit->isClause()) {
       Clause* cl=static_cast<Clause*>(unit);
-      out << "(or false " << std::endl;
+      out << "(or false " << '\n';
       for(auto lit : iterTraits(cl->iterLits())) {
         out << "  ";
         outputLiteral(out, lit);
-        out << std::endl;
+        out << '\n';
       }
       out << "  )";
     } else {
@@ -1497,27 +1506,27 @@ protected:
     auto prems = iterTraits(concl->getParents());
  
     outputSymbolDeclarations(out);
-    out        << std::endl;
-    out        << std::endl;
+    out        << '\n';
+    out        << '\n';
 
     for (auto prem : prems) {
-      out << ";- unit id: " << prem->number() << std::endl;
+      out << ";- unit id: " << prem->number() << '\n';
       out << "(assert ";
       output(out, prem);
-      out << ")" << std::endl;
-      out        << std::endl;
+      out << ")" << '\n';
+      out        << '\n';
     }
 
-    out << std::endl;
-    out << ";- rule: " << ruleName(concl->inference().rule()) << std::endl;
-    out << std::endl;
-    out << ";- unit id: " << concl->number() << std::endl;
+    out << '\n';
+    out << ";- rule: " << ruleName(concl->inference().rule()) << '\n';
+    out << '\n';
+    out << ";- unit id: " << concl->number() << '\n';
     out << "(assert (not ";
     output(out, concl);
-    out  << "))" << std::endl;
+    out  << "))" << '\n';
 
-    out << "(check-sat)" << std::endl;
-    out << "%#" << std::endl;
+    out << "(check-sat)" << '\n';
+    out << "%#" << '\n';
   }
 
 
@@ -1607,7 +1616,7 @@ InferenceStore::ProofPrinter* InferenceStore::createProofPrinter(std::ostream& o
  */
 void InferenceStore::outputUnsatCore(std::ostream& out, Unit* refutation)
 {
-  out << "(" << endl;
+  out << "(" << '\n';
 
   Stack<Unit*> todo;
   todo.push(refutation);
@@ -1621,16 +1630,16 @@ void InferenceStore::outputUnsatCore(std::ostream& out, Unit* refutation)
       if(!u->isClause()){
         if(u->getFormula()->hasLabel()){
           std::string label =  u->getFormula()->getLabel();
-          out << label << endl;
+          out << label << '\n';
         }
         else{
           ASS(env.options->ignoreMissingInputsInUnsatCore() || u->getFormula()->hasLabel());
           if(!(env.options->ignoreMissingInputsInUnsatCore() || u->getFormula()->hasLabel())){
-            cout << "ERROR: There is a problem with the unsat core. There is an input formula in the proof" <<  endl;
-            cout << "that does not have a label. We expect all  input formulas to have labels as this  is what" << endl;
-            cout << "smtcomp does. If you don't want this then use the ignore_missing_inputs_in_unsat_core option" << endl;
-            cout << "The unlabelled  input formula is " << endl;
-            cout << u->toString() << endl;
+            cout << "ERROR: There is a problem with the unsat core. There is an input formula in the proof" <<  '\n';
+            cout << "that does not have a label. We expect all  input formulas to have labels as this  is what" << '\n';
+            cout << "smtcomp does. If you don't want this then use the ignore_missing_inputs_in_unsat_core option" << '\n';
+            cout << "The unlabelled  input formula is " << '\n';
+            cout << u->toString() << '\n';
           }
         }
       }
@@ -1649,7 +1658,7 @@ void InferenceStore::outputUnsatCore(std::ostream& out, Unit* refutation)
     }
   }
 
-  out << ")" << endl;
+  out << ")" << '\n';
 }
 
 
@@ -1666,8 +1675,12 @@ void InferenceStore::outputProof(std::ostream& out, Unit* refutation)
     return;
   }
   ScopedPtr<ProofPrinter> pp(p);
+  Term::ToStringMemo memo;
   pp->scheduleForPrinting(refutation);
   pp->print();
+  // the steps end with '\n' rather than endl, so that a long proof is
+  // written in large blocks
+  out.flush();
 }
 
 /**
@@ -1681,12 +1694,14 @@ void InferenceStore::outputProof(std::ostream& out, UnitList* units)
     return;
   }
   ScopedPtr<ProofPrinter> pp(p);
+  Term::ToStringMemo memo;
   UnitList::Iterator uit(units);
   while(uit.hasNext()) {
     Unit* u = uit.next();
     pp->scheduleForPrinting(u);
   }
   pp->print();
+  out.flush();
 }
 
 void InferenceStore::reset()
@@ -1700,12 +1715,24 @@ void InferenceStore::reset()
   _introducedSplitNames.reset();
 }
 
+InferenceStore* InferenceStore::s_installed = nullptr;
+
 InferenceStore* InferenceStore::instance()
 {
+  if (s_installed) {
+    return s_installed;
+  }
   static ScopedPtr<InferenceStore> inst(new InferenceStore());
 
   return inst.ptr();
 }
 
+InferenceStore* InferenceStore::installInstance(InferenceStore* store)
+{
+  InferenceStore* prev = s_installed;
+  s_installed = store;
+  return prev;
+}
+
 #undef ALL_NUM
 }
@@ -24,6 +24,7 @@
 #include "Lib/Allocator.hpp"
 #include "Lib/DHMap.hpp"
 #include "Lib/DHMultiset.hpp"
+#include "Lib/DHSet.hpp"
 #include "Lib/Stack.hpp"
 
 #include "Kernel/Clause.hpp"
@@ -37,6 +38,12 @@ class InferenceStore
 {
 public:
   static InferenceStore* instance();
+  /**
+   * Make instance() return @b store (or the process-wide default store if @b store is nullptr).
+   * Returns the store that was installed before. Used by the library to give each prover
+   * context its own store.
+   */
+  static InferenceStore* installInstance(InferenceStore* store);
 
   /** Reset internal state (for library use when running multiple proofs) */
   void reset();
@@ -71,8 +78,10 @@ public:
   };
 
   void recordSplittingNameLiteral(Unit* us, Literal* lit);
+  /** The recorded splitting name literals, needed to print proofs with splits */
+  VirtualIterator<Literal*> splittingNameLiterals() const { return _splittingNameLiterals.range(); }
   void recordIntroducedSymbol(Unit* u, SymbolType st, unsigned number);
-  void recordIntroducedSplitName(Unit* u, std::string name);
+  void recordIntroducedSplitName(Unit* u);
 
   void outputUnsatCore(std::ostream& out, Unit* refutation);
   void outputProof(std::ostream& out, Unit* refutation);
@@ -97,8 +106,14 @@ private:
   typedef std::pair<SymbolType,unsigned> SymbolId;
   typedef Stack<SymbolId> SymbolStack;
   DHMap<unsigned,SymbolStack> _introducedSymbols;
-  DHMap<unsigned,std::string> _introducedSplitNames;
-
+  /**
+   * numbers of the AVATAR definitions "name <=> component"; the name itself is
+   * only read off the definition's NamedFormula when a proof is printed
+   */
+  DHSet<unsigned> _introducedSplitNames;
+
+  /** store returned by instance() instead of the default one, if non-null */
+  static InferenceStore* s_installed;
 };
 
 };
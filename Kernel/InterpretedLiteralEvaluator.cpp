@@ -1009,6 +1009,9 @@ InterpretedLiteralEvaluator::InterpretedLiteralEvaluator(bool doNormalize) : _no
   _funEvaluators.ensure(0);
   _predEvaluators.ensure(0);
 
+  // the evaluation of a subterm depends on nothing else, and the same
+  // ground arithmetic subterms are evaluated clause after clause
+  setMemoizing(true);
 }
 
 InterpretedLiteralEvaluator::~InterpretedLiteralEvaluator()
@@ -1414,6 +1417,9 @@ bool InterpretedLiteralEvaluator::evaluate(Literal* lit, bool& isConstant, Liter
                       : lit;
   DEBUG( "\t0 ==> ", resLit->toString() );
 
+  if (memoSize() > MAX_MEMO_SIZE) {
+    resetMemo();
+  }
   resLit = BottomUpTermTransformer::transformLiteral( resLit);
   DEBUG( "\t1 ==> ", resLit->toString() );
 
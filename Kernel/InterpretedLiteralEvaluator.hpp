@@ -77,6 +77,9 @@ protected:
   bool balanceDivide(Interpretation multiply, Term* AmultiplyB, TermList A, TermList C, TermList& result, bool& swap);
   
 private:
+  /** the number of evaluated subterms remembered before they are all forgotten */
+  static constexpr unsigned MAX_MEMO_SIZE = 1 << 18;
+
   template<class Fn>
   Evaluator* getEvaluator(unsigned func, DArray<Evaluator*>& evaluators, Fn canEval);
   const bool _normalize;
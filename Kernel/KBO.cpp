@@ -727,6 +727,34 @@ Ordering::Result KBO::comparePredicates(Literal* l1, Literal* l2) const
   unsigned p1 = l1->functor();
   unsigned p2 = l2->functor();
 
+  if (p1 != p2 && tryGetGlobalOrdering() == this) {
+    // the argument weights are cached, and as for terms the difference
+    // of the weights together with the variable occurrence counts of the
+    // literals often decides the comparison without a traversal
+    int weightDiff = 0;
+    for (TermList* ts = l1->args(); !ts->isEmpty(); ts = ts->next()) {
+      weightDiff += computeWeight(AppliedTerm(*ts));
+    }
+    for (TermList* ts = l2->args(); !ts->isEmpty(); ts = ts->next()) {
+      weightDiff -= computeWeight(AppliedTerm(*ts));
+    }
+    if (weightDiff > 0) {
+      if (l1->numVarOccs() < l2->numVarOccs()) {
+        return INCOMPARABLE;
+      }
+      if (l2->ground()) {
+        return GREATER;
+      }
+    } else if (weightDiff < 0) {
+      if (l2->numVarOccs() < l1->numVarOccs()) {
+        return INCOMPARABLE;
+      }
+      if (l1->ground()) {
+        return LESS;
+      }
+    }
+  }
+
   Result res;
   ASS(_state);
 
@@ -782,6 +810,31 @@ Ordering::Result KBO::compare(AppliedTerm tl1, AppliedTerm tl2) const
   Term* t1=tl1.term.term();
   Term* t2=tl2.term.term();
 
+  // Shared terms cache their weight and count their variable occurrences,
+  // which often decides the comparison without a traversal: the heavier
+  // term is greater iff the variable condition holds, which fails if it
+  // has fewer variable occurrences, and trivially holds if the lighter
+  // term is ground.
+  if (!tl1.aboveVar && !tl2.aboveVar && t1->shared() && t2->shared() && tryGetGlobalOrdering() == this) {
+    auto w1 = computeWeight(tl1);
+    auto w2 = computeWeight(tl2);
+    if (w1 > w2) {
+      if (t1->numVarOccs() < t2->numVarOccs()) {
+        return INCOMPARABLE;
+      }
+      if (t2->ground()) {
+        return GREATER;
+      }
+    } else if (w1 < w2) {
+      if (t2->numVarOccs() < t1->numVarOccs()) {
+        return INCOMPARABLE;
+      }
+      if (t1->ground()) {
+        return LESS;
+      }
+    }
+  }
+
   ASS(_state);
   State* state = _state.get();
 #if VDEBUG
@@ -78,6 +78,39 @@ Ordering::Result LPO::compareUnidirectional(AppliedTerm lhs, AppliedTerm rhs) co
   return lpo(lhs,rhs);
 }
 
+/**
+ * Return the comparison of @b tl1 and @b tl2 by @b compute, reusing the
+ * result of an earlier comparison when both terms are shared and not
+ * affected by the substitution. Small terms are compared directly, as
+ * this is cheaper than the lookup.
+ */
+template<bool bidir>
+Ordering::Result LPO::memoized(AppliedTerm tl1, AppliedTerm tl2, Result (LPO::*compute)(AppliedTerm, AppliedTerm) const) const
+{
+  static constexpr unsigned MIN_MEMO_WEIGHT = 12;
+  static constexpr unsigned MAX_MEMO_SIZE = 1 << 16;
+
+  auto t1 = tl1.term.term();
+  auto t2 = tl2.term.term();
+  auto fixed = [](AppliedTerm t) {
+    return t.term.term()->shared() && (!t.aboveVar || t.term.term()->ground());
+  };
+  if (!fixed(tl1) || !fixed(tl2) || t1->weight() + t2->weight() < MIN_MEMO_WEIGHT) {
+    return (this->*compute)(tl1, tl2);
+  }
+  auto key = std::make_tuple(t1, t2, bidir);
+  if (auto res = _memo.find(key)) {
+    return *res;
+  }
+  // no reference into the memo is kept, as the recursive comparisons insert into it
+  auto res = (this->*compute)(tl1, tl2);
+  if (_memo.size() >= MAX_MEMO_SIZE) {
+    _memo.reset();
+  }
+  _memo.insert(key, res);
+  return res;
+}
+
 Ordering::Result LPO::clpo(AppliedTerm tl1, AppliedTerm tl2) const
 {
   ASS(tl1.term.isTerm());
@@ -85,6 +118,11 @@ Ordering::Result LPO::clpo(AppliedTerm tl1, AppliedTerm tl2) const
     return tl1.containsVar(tl2.term) ? GREATER : INCOMPARABLE;
   }
   ASS(tl2.term.isTerm());
+  return memoized<true>(tl1, tl2, &LPO::clpoUncached);
+}
+
+Ordering::Result LPO::clpoUncached(AppliedTerm tl1, AppliedTerm tl2) const
+{
   auto t1=tl1.term.term();
   auto t2=tl2.term.term();
 
@@ -182,7 +220,11 @@ Ordering::Result LPO::lpo(AppliedTerm tt1, AppliedTerm tt2) const
   if (tt2.term.isVar()) {
     return tt1.containsVar(tt2.term) ? GREATER : INCOMPARABLE;
   }
+  return memoized<false>(tt1, tt2, &LPO::lpoUncached);
+}
 
+Ordering::Result LPO::lpoUncached(AppliedTerm tt1, AppliedTerm tt2) const
+{
   auto t1=tt1.term.term();
   auto t2=tt2.term.term();
 
@@ -18,8 +18,12 @@
 #ifndef __LPO__
 #define __LPO__
 
+#include <tuple>
+
 #include "Forwards.hpp"
 
+#include "Lib/DHMap.hpp"
+
 #include "SubstHelper.hpp"
 
 #include "Ordering.hpp"
@@ -66,7 +70,21 @@ protected:
   Result lexMAE(AppliedTerm s, AppliedTerm t, const TermList* sl, const TermList* tl, unsigned arity) const;
   Result majo(AppliedTerm s, AppliedTerm t, const TermList* tl, unsigned arity) const;
 
+  template<bool bidir>
+  Result memoized(AppliedTerm tl1, AppliedTerm tl2, Result (LPO::*compute)(AppliedTerm, AppliedTerm) const) const;
+  Result clpoUncached(AppliedTerm tl1, AppliedTerm tl2) const;
+  Result lpoUncached(AppliedTerm tl1, AppliedTerm tl2) const;
+
   friend class TermOrderingDiagramLPO;
+
+private:
+  /**
+   * Results of comparisons of pairs of shared terms that are not affected
+   * by the substitution, with a flag for bidirectional comparisons. The
+   * recursive definition compares the same pairs of subterms repeatedly,
+   * which this cache reduces to one comparison per pair.
+   */
+  mutable DHMap<std::tuple<Term*, Term*, bool>, Result> _memo;
 };
 
 }
@@ -16,6 +16,7 @@
 #include "Lib/Metaiterators.hpp"
 #include "Lib/Stack.hpp"
 
+#include "Indexing/Index.hpp"
 #include "Indexing/LiteralIndex.hpp"
 #include "Indexing/TermIndex.hpp"
 
@@ -169,16 +170,37 @@ VirtualIterator<std::tuple<>> LookaheadLiteralSelector::getGeneraingInferenceIte
  * Return the literal from the @b lits array (of length @b cnt) that
  * is the best to be selected. This selection is done regardless any
  * completeness constraints, the caller has to handle that, if necessary.
+ *
+ * If the estimate lifetime is non-zero, the inference counts of the
+ * literals that exhaust their iterators in the race are kept, and are used
+ * instead of the iterators until the indices have been updated that many
+ * times. Shared literals recur in many clauses, so this spares most of
+ * the retrievals at the price of counts that may be slightly out of date.
  */
 Literal* LookaheadLiteralSelector::pickTheBest(Literal** lits, unsigned cnt)
 {
   ASS_G(cnt,1); //special cases are handled elsewhere
 
   static DArray<VirtualIterator<std::tuple<>> > runifs; //resolution unification iterators
+  //the counts of literals with a valid estimate, -1 for the others
+  static DArray<int> known;
   runifs.ensure(cnt);
+  known.ensure(cnt);
 
+  unsigned now = Index::totalUpdates();
+  if (_estimates.size() > MAX_ESTIMATES) {
+    _estimates.reset();
+  }
   for(unsigned i=0;i<cnt;i++) {
-    runifs[i]=getGeneraingInferenceIterator(lits[i]);
+    known[i] = -1;
+    Estimate* est = _estimateLifetime ? _estimates.findPtr(lits[i]) : nullptr;
+    if (est && now - est->updates < _estimateLifetime) {
+      known[i] = est->count;
+      runifs[i] = VirtualIterator<std::tuple<>>::getEmpty();
+    }
+    else {
+      runifs[i]=getGeneraingInferenceIterator(lits[i]);
+    }
   }
 
   /*
@@ -190,15 +212,25 @@ Literal* LookaheadLiteralSelector::pickTheBest(Literal** lits, unsigned cnt)
    */
   static Stack<Literal*> candidates;
   candidates.reset();
+  int round = 0;
   do {
     for(unsigned i=0;i<cnt;i++) {
-      if(runifs[i].hasNext()) {
+      if(known[i] >= 0) {
+	if(known[i] == round) {
+	  candidates.push(lits[i]);
+	}
+      }
+      else if(runifs[i].hasNext()) {
 	runifs[i].next();
       }
       else {
 	candidates.push(lits[i]);
+	if(_estimateLifetime) {
+	  _estimates.set(lits[i], Estimate{ static_cast<unsigned>(round), now });
+	}
       }
     }
+    round++;
   } while(candidates.isEmpty());
 
   using namespace LiteralComparators;
@@ -17,6 +17,8 @@
 
 #include "Forwards.hpp"
 #include "Shell/Options.hpp"
+#include "Lib/DHMap.hpp"
+
 #include "LiteralSelector.hpp"
 
 namespace Kernel {
@@ -30,6 +32,7 @@ public:
   {
     _delay = options.lookaheadDelay();
     _skipped = 0;
+    _estimateLifetime = options.lookaheadEstimateLifetime();
     _startupSelector = (_delay==0) ? 0 : LiteralSelector::getSelector(ordering, options, completeSelection ? 10 : 1010);
   }
 
@@ -50,10 +53,23 @@ private:
 
   struct GenIteratorIterator;
 
+  /** The count of inferences of a literal and when it was taken */
+  struct Estimate {
+    unsigned count;
+    /** Index::totalUpdates() at the time */
+    unsigned updates;
+  };
+  /** above this number of estimates the cache is emptied */
+  static constexpr unsigned MAX_ESTIMATES = 1 << 16;
+
   bool _completeSelection;
   LiteralSelector* _startupSelector;
   int _delay;
   int _skipped;
+  /** the number of index updates for which an estimate is used, 0 for none */
+  unsigned _estimateLifetime;
+  /** inference counts of the literals that won or tied a race, see pickTheBest */
+  DHMap<Literal*, Estimate> _estimates;
 };
 
 }
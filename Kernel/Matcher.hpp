@@ -194,15 +194,19 @@ bool MatchingUtils::matchArgs(Term* base, Term* instance, Binder& binder)
       if(s->functor()!=t->functor()) {
 	return false;
       }
-      if(bt->term()->shared() && it->term()->shared()) {
-	if(bt->term()->ground() && *bt!=*it) {
-	  return false;
-	}
-	if(s->weight() > t->weight()) {
+      bool descend = s->arity() > 0;
+      if(s->shared() && t->shared()) {
+	if(s->ground()) {
+	  if(*bt!=*it) {
+	    return false;
+	  }
+	  // the terms are identical, so there is nothing to match below them
+	  descend = false;
+	} else if(s->weight() > t->weight()) {
 	  return false;
 	}
       }
-      if(s->arity() > 0) {
+      if(descend) {
 	bt = s->args();
 	it = t->args();
 	continue;
@@ -297,6 +297,35 @@ Ordering::Result PrecedenceOrdering::compare(Literal* l1, Literal* l2) const
   return comparePredicates(l1, l2);
 } // PrecedenceOrdering::compare()
 
+unsigned PrecedenceOrdering::s_lessCacheEpoch = 0;
+
+/**
+ * The ordering is stable under substitutions, so this holds if @b l1 is
+ * less than @b l2 already.
+ *
+ * The results are kept by literal ids, which the garbage collection of the
+ * API reuses, so resetStaticCaches() invalidates them. At most
+ * LESS_CACHE_MAX results are kept, beyond that they are forgotten.
+ */
+bool PrecedenceOrdering::lessUnderAllSubstitutions(Literal* l1, Literal* l2) const
+{
+  if (_lessCacheEpoch != s_lessCacheEpoch || _lessCache.size() >= LESS_CACHE_MAX) {
+    _lessCache.reset();
+    _lessCacheEpoch = s_lessCacheEpoch;
+  }
+  uint64_t key = (uint64_t(l1->getId()) << 32) | l2->getId();
+  bool* less;
+  if (_lessCache.getValuePtr(key, less)) {
+    *less = compare(l1, l2) == LESS;
+  }
+  return *less;
+}
+
+void PrecedenceOrdering::resetStaticCaches()
+{
+  s_lessCacheEpoch++;
+}
+
 /**
  * Return the predicate level. If @b pred is less than or equal to
  * @b _predicates, then the value is taken from the array _predicateLevels,
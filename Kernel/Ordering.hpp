@@ -25,6 +25,7 @@
 
 #include "Lib/Comparison.hpp"
 #include "Lib/DArray.hpp"
+#include "Lib/DHMap.hpp"
 #include "Kernel/Term.hpp"
 
 #include "Kernel/SubstHelper.hpp"
@@ -108,6 +109,13 @@ public:
 
   virtual void show(std::ostream& out) const = 0;
 
+  /**
+   * Return true if @b l1 σ is less than @b l2 σ for every substitution σ,
+   * so that a comparison of the instances can be skipped. False is always
+   * a safe answer.
+   */
+  virtual bool lessUnderAllSubstitutions(Literal* l1, Literal* l2) const { return false; }
+
   static bool isGreaterOrEqual(Result r) { return (r == GREATER || r == EQUAL); }
 
   void removeNonMaximal(LiteralList*& lits) const;
@@ -171,6 +179,9 @@ public:
   PrecedenceOrdering(PrecedenceOrdering&&) = default;
   PrecedenceOrdering& operator=(PrecedenceOrdering&&) = default;
   Result compare(Literal* l1, Literal* l2) const override;
+  bool lessUnderAllSubstitutions(Literal* l1, Literal* l2) const override;
+  /** Forget the results of lessUnderAllSubstitutions() of all orderings */
+  static void resetStaticCaches();
   void show(std::ostream&) const override;
   virtual void showConcrete(std::ostream&) const = 0;
 
@@ -221,6 +232,14 @@ protected:
 
   bool _reverseLCM;
   bool _qkboPrecedence;
+
+  static constexpr unsigned LESS_CACHE_MAX = 1u << 20;
+  /** results of lessUnderAllSubstitutions by the ids of the two literals */
+  mutable DHMap<uint64_t, bool> _lessCache;
+  /** the value of s_lessCacheEpoch when _lessCache was last cleared */
+  mutable unsigned _lessCacheEpoch = 0;
+  /** bumped by resetStaticCaches() */
+  static unsigned s_lessCacheEpoch;
 };
 
 
@@ -342,6 +342,71 @@ NormalizationResult normalizeNumSort(TermList t, NormalizationResult* ts, bool&
   }
 }
 
+/** copies of the alternatives of a NormalizationResult, which is move-only */
+struct CloneNormalizationResult {
+  NormalizationResult operator()(PolyNf const& x) const
+  { return NormalizationResult(x); }
+
+  template<class NumTraits>
+  NormalizationResult operator()(Polynom<NumTraits> const& x) const
+  { return NormalizationResult(Polynom<NumTraits>(x)); }
+
+  template<class NumTraits>
+  NormalizationResult operator()(PreMonom<NumTraits> const& x) const
+  {
+    PreMonom<NumTraits> out(x.numeral);
+    out.factors->loadFromIterator(x.factors->iterFifo());
+    return NormalizationResult(std::move(out));
+  }
+};
+
+/**
+ * Memoization of the normal forms of the non-variable subterms met by
+ * normalizeTerm, so that subterms shared between different terms are
+ * normalized once. Along with a normal form it stores whether normalizing
+ * the subterm simplified anything, and a hit sets @b simplified accordingly.
+ */
+struct SubtermNormalizationMemo
+{
+  Map<TypedTermList, std::pair<NormalizationResult, bool>> _memo;
+  bool* simplified = nullptr;
+
+  Option<NormalizationResult> get(TypedTermList const& t)
+  {
+    if (t.isVar()) {
+      return {};
+    }
+    auto entry = _memo.tryGet(t);
+    if (entry.isNone()) {
+      return {};
+    }
+    *simplified |= entry->second;
+    return some(entry->first.apply(CloneNormalizationResult{}));
+  }
+
+  template<class Init> NormalizationResult getOrInit(TypedTermList const& t, Init init)
+  {
+    if (t.isVar()) {
+      return init();
+    }
+    if (auto hit = get(t)) {
+      return std::move(*hit);
+    }
+    // the children were normalized already, so init only sets the flag for t itself
+    bool outer = *simplified;
+    *simplified = false;
+    auto result = init();
+    bool here = *simplified;
+    for (unsigned i = 0; !here && i < t.term()->numTermArguments(); i++) {
+      auto arg = t.term()->termArg(i);
+      here = arg.isTerm() && _memo.get(TypedTermList(arg, SortHelper::getTermArgSort(t.term(), i))).second;
+    }
+    *simplified = outer || here;
+    _memo.insert(t, std::make_pair(result.apply(CloneNormalizationResult{}), here));
+    return result;
+  }
+};
+
 PolyNf normalizeTerm(TypedTermList t, bool& simplified)
 {
   DBG_INDENT
@@ -350,6 +415,8 @@ PolyNf normalizeTerm(TypedTermList t, bool& simplified)
   auto out = memo.getOrInit(t, [&t]() {
 
       bool simplified = false;
+  static SubtermNormalizationMemo subtermMemo;
+  subtermMemo.simplified = &simplified;
   NormalizationResult r = BottomUpEvaluation<TypedTermList, NormalizationResult>()
     .function(
         [&](TypedTermList t, NormalizationResult* ts) -> NormalizationResult 
@@ -373,6 +440,7 @@ PolyNf normalizeTerm(TypedTermList t, bool& simplified)
             }
           }
         })
+    .memo<SubtermNormalizationMemo&>(subtermMemo)
     .apply(t);
 
   DEBUG(1, "normed: ", r)
@@ -152,8 +152,8 @@ TermSpec const& RobSubstitution::derefBound(TermSpec const& t_) const
   }
 }
 
-template<class T, class H1, class H2>
-void RobSubstitution::bind(DHMap<VarSpec, T, H1, H2>& map, const VarSpec& v, T b)
+template<class T>
+void RobSubstitution::bind(VarSpecMap<T>& map, const VarSpec& v, T b)
 {
   if(bdIsRecording()) {
     ASS(map.find(v).isNone());
@@ -233,6 +233,9 @@ void RobSubstitution::bindVar(const VarSpec& var, const VarSpec& to)
 
 bool RobSubstitution::occurs(VarSpec const& toFind, TermSpec const& ts) 
 {
+   if (ts.definitelyGround()) {
+     return false;
+   }
 
    Recycled<DHSet<TermSpec>> encountered;
    Recycled<Stack<TermSpec>> todo;
@@ -323,8 +326,20 @@ bool RobSubstitution::unify(TermSpec s, TermSpec t)
            && dt1.functor() == dt2.functor()) {
 
       for (auto c : dt1.allArgs().zip(dt2.allArgs())) {
+        // shared ground terms are unifiable iff they are identical, which
+        // is decided here without going through the todo stack
+        if (c.first.definitelyGround() && c.second.definitelyGround()) {
+          if (c.first.term != c.second.term) {
+            mismatch = true;
+            break;
+          }
+          continue;
+        }
         pushTodo(make_pair(std::move(c.first), std::move(c.second)));
       }
+      if (mismatch) {
+        break;
+      }
 
     } else {
       mismatch = true;
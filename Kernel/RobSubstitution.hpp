@@ -29,6 +29,8 @@
 #include "Kernel/Signature.hpp"
 #include "Kernel/TypedTermList.hpp"
 
+#include <vector>
+
 #if VDEBUG
 #include <iostream>
 #endif
@@ -278,6 +280,142 @@ public:
 
 using namespace Lib;
 
+/**
+ * A map from variables to values of type @b T, used for the bindings of a
+ * RobSubstitution.
+ *
+ * The variables of a bank are small dense numbers, so values are kept in
+ * flat arrays indexed by the bank and the variable number instead of a hash
+ * table. Every entry records the generation in which it was set, so that
+ * reset() forgets all entries by starting a new generation. Variables of
+ * unusually large banks or numbers are kept in a hash map instead.
+ */
+template<class T>
+class VarSpecMap
+{
+  struct Entry
+  {
+    T value;
+    /** the entry is set iff this is the current generation of the map */
+    unsigned generation = 0;
+  };
+
+  static constexpr unsigned DENSE_BANKS = 64;
+  static constexpr unsigned DENSE_VARS = 1024;
+
+  /** entries by slot and variable number */
+  std::vector<std::vector<Entry>> _dense;
+  DHMap<VarSpec, T> _sparse;
+  unsigned _generation = 1;
+  unsigned _denseSize = 0;
+
+  /** the slot of @b v in @b _dense, or none if @b v is kept in @b _sparse */
+  static Option<unsigned> slot(VarSpec const& v)
+  {
+    // the smallest bank index that can be bound is GLUE_INDEX
+    unsigned bank = v.index - GLUE_INDEX;
+    if (bank >= DENSE_BANKS || v.var() >= DENSE_VARS) {
+      return {};
+    }
+    return some(2 * bank + v.special());
+  }
+
+  Entry const* denseEntry(unsigned slot, unsigned var) const
+  {
+    if (slot >= _dense.size() || var >= _dense[slot].size()) {
+      return nullptr;
+    }
+    auto& e = _dense[slot][var];
+    return e.generation == _generation ? &e : nullptr;
+  }
+
+public:
+  Option<T const&> find(VarSpec const& v) const
+  {
+    auto s = slot(v);
+    if (s.isNone()) {
+      return _sparse.find(v);
+    }
+    auto e = denseEntry(*s, v.var());
+    return e ? Option<T const&>(e->value) : Option<T const&>();
+  }
+
+  void set(VarSpec const& v, T val)
+  {
+    auto s = slot(v);
+    if (s.isNone()) {
+      _sparse.set(v, std::move(val));
+      return;
+    }
+    if (*s >= _dense.size()) {
+      _dense.resize(*s + 1);
+    }
+    auto& entries = _dense[*s];
+    if (v.var() >= entries.size()) {
+      entries.resize(v.var() + 1);
+    }
+    auto& e = entries[v.var()];
+    if (e.generation != _generation) {
+      e.generation = _generation;
+      _denseSize++;
+    }
+    e.value = std::move(val);
+  }
+
+  void remove(VarSpec const& v)
+  {
+    auto s = slot(v);
+    if (s.isNone()) {
+      _sparse.remove(v);
+      return;
+    }
+    ASS(denseEntry(*s, v.var()))
+    _dense[*s][v.var()].generation = 0;
+    _denseSize--;
+  }
+
+  void reset()
+  {
+    if (_denseSize != 0) {
+      _denseSize = 0;
+      if (++_generation == 0) {
+        // the generations wrapped around, so old entries could look current
+        for (auto& entries : _dense) {
+          for (auto& e : entries) {
+            e.generation = 0;
+          }
+        }
+        _generation = 1;
+      }
+    }
+    _sparse.reset();
+  }
+
+  unsigned size() const { return _denseSize + _sparse.size(); }
+  bool keepRecycled() const { return !_dense.empty() || _sparse.keepRecycled(); }
+
+  friend std::ostream& operator<<(std::ostream& out, VarSpecMap const& self)
+  {
+    out << "{ ";
+    bool first = true;
+    auto write = [&](VarSpec const& v, T const& val) {
+      out << (first ? "" : ", ") << '"' << v << '"' << " : " << '"' << val << '"';
+      first = false;
+    };
+    for (unsigned s = 0; s < self._dense.size(); s++) {
+      for (unsigned var = 0; var < self._dense[s].size(); var++) {
+        if (auto e = self.denseEntry(s, var)) {
+          write(VarSpec(TermList::var(var, s % 2), int(s / 2) + GLUE_INDEX), e->value);
+        }
+      }
+    }
+    for (auto itm : iterTraits(self._sparse.items())) {
+      write(itm.first, itm.second);
+    }
+    return out << " }";
+  }
+};
+
 class AbstractingUnifier;
 class UnificationConstraint;
 
@@ -287,8 +425,8 @@ class RobSubstitution
   friend class AbstractingUnifier;
   friend class UnificationConstraint;
  
-  DHMap<VarSpec, TermSpec> _bindings;
-  mutable DHMap<VarSpec, unsigned> _outputVarBindings;
+  VarSpecMap<TermSpec> _bindings;
+  mutable VarSpecMap<unsigned> _outputVarBindings;
   mutable bool _startedBindingOutputVars;
   mutable unsigned _nextUnboundAvailable;
   mutable unsigned _nextGlueAvailable;
@@ -454,8 +592,8 @@ private:
   RobSubstitution(const RobSubstitution& obj) = delete;
   RobSubstitution& operator=(const RobSubstitution& obj) = delete;
 
-  template<class T, class H1, class H2>
-  void bind(DHMap<VarSpec, T, H1, H2>& map, const VarSpec& v, T b);
+  template<class T>
+  void bind(VarSpecMap<T>& map, const VarSpec& v, T b);
   void bind(const VarSpec& v, TermSpec b);
   void bindVar(const VarSpec& var, const VarSpec& to);
   bool match(TermSpec base, TermSpec instance);
@@ -27,6 +27,8 @@ using namespace Shell;
 
 const unsigned Signature::STRING_DISTINCT_GROUP = 0;
 
+unsigned Signature::Symbol::s_usageEpoch = 0;
+
 /**
  * Standard constructor.
  * @author Andrei Voronkov
@@ -38,6 +40,7 @@ Signature::Symbol::Symbol(const std::string& nm, unsigned arity, bool interprete
     _type(0),
     _distinctGroups(0),
     _usageCount(0),
+    _usageEpoch(s_usageEpoch),
     _unitUsageCount(0),
     _interpreted(interpreted ? 1 : 0),
     _linMul(0),
@@ -418,7 +421,8 @@ const std::string& Signature::functionName(int number)
  */
 bool Signature::functionExists(const std::string& name,unsigned arity) const
 {
-  return _funNames.find(key(name, arity));
+  auto symbolKey = findKey(name, arity);
+  return symbolKey.isSome() && _funNames.find(*symbolKey);
 }
 
 /**
@@ -426,7 +430,8 @@ bool Signature::functionExists(const std::string& name,unsigned arity) const
  */
 bool Signature::predicateExists(const std::string& name,unsigned arity) const
 {
-  return _predNames.find(key(name, arity));
+  auto symbolKey = findKey(name, arity);
+  return symbolKey.isSome() && _predNames.find(*symbolKey);
 }
 
 /**
@@ -434,18 +439,21 @@ bool Signature::predicateExists(const std::string& name,unsigned arity) const
  */
 bool Signature::typeConExists(const std::string& name,unsigned arity) const
 {
-  return _typeConNames.find(key(name, arity));
+  auto symbolKey = findKey(name, arity);
+  return symbolKey.isSome() && _typeConNames.find(*symbolKey);
 }
 
 unsigned Signature::getFunctionNumber(const std::string& name, unsigned arity) const
 {
-  ASS(_funNames.find(key(name, arity)));
-  return _funNames.get(key(name, arity));
+  auto symbolKey = findKey(name, arity);
+  ASS(symbolKey.isSome() && _funNames.find(*symbolKey));
+  return _funNames.get(*symbolKey);
 }
 
 bool Signature::tryGetFunctionNumber(const std::string& name, unsigned arity, unsigned& out) const
 {
-  auto* value = _funNames.getPtr(key(name, arity));
+  auto symbolKey = findKey(name, arity);
+  auto* value = symbolKey.isSome() ? _funNames.getPtr(*symbolKey) : nullptr;
   if (value != NULL) {
     out = *value;
     return true;
@@ -456,7 +464,8 @@ bool Signature::tryGetFunctionNumber(const std::string& name, unsigned arity, un
 
 bool Signature::tryGetPredicateNumber(const std::string& name, unsigned arity, unsigned& out) const
 {
-  auto* value = _predNames.getPtr(key(name, arity));
+  auto symbolKey = findKey(name, arity);
+  auto* value = symbolKey.isSome() ? _predNames.getPtr(*symbolKey) : nullptr;
   if (value != NULL) {
     out = *value;
     return true;
@@ -468,8 +477,9 @@ bool Signature::tryGetPredicateNumber(const std::string& name, unsigned arity, u
 
 unsigned Signature::getPredicateNumber(const std::string& name, unsigned arity) const
 {
-  ASS(_predNames.find(key(name, arity)));
-  return _predNames.get(key(name, arity));
+  auto symbolKey = findKey(name, arity);
+  ASS(symbolKey.isSome() && _predNames.find(*symbolKey));
+  return _predNames.get(*symbolKey);
 }
 
 /**
@@ -494,7 +504,7 @@ unsigned Signature::addFunction (const std::string& name,
   }
   if (env.options->arityCheck()) {
     unsigned prev;
-    if (_arityCheck.find(name,prev)) {
+    if (_arityCheck.find(symbolKey.unwrap<0>().first,prev)) {
       unsigned prevArity = prev/2;
       bool isFun = prev % 2;
       USER_ERROR((std::string)"Symbol " + name +
@@ -502,7 +512,7 @@ unsigned Signature::addFunction (const std::string& name,
 		 " and a " + (isFun ? "function" : "predicate") +
 		 " of arity " + Int::toString(prevArity));
     }
-    _arityCheck.insert(name,2*arity+1);
+    _arityCheck.insert(symbolKey.unwrap<0>().first,2*arity+1);
   }
 
   result = _funs.length();
@@ -764,7 +774,7 @@ unsigned Signature::addPredicate (const std::string& name,
   }
   if (env.options->arityCheck()) {
     unsigned prev;
-    if (_arityCheck.find(name,prev)) {
+    if (_arityCheck.find(symbolKey.unwrap<0>().first,prev)) {
       unsigned prevArity = prev/2;
       bool isFun = prev % 2;
       USER_ERROR((std::string)"Symbol " + name +
@@ -772,7 +782,7 @@ unsigned Signature::addPredicate (const std::string& name,
 		 " and a " + (isFun ? "function" : "predicate") +
 		 " of arity " + Int::toString(prevArity));
     }
-    _arityCheck.insert(name,2*arity);
+    _arityCheck.insert(symbolKey.unwrap<0>().first,2*arity);
   }
 
   result = _preds.length();
@@ -800,6 +810,22 @@ unsigned Signature::addNameFunction(unsigned arity)
   return addFreshFunction(arity,"sP");
 } // addNameFunction
 
+/**
+ * Return the name prefixI or prefixI_suffix, where I is the next fresh symbol number,
+ * built in place rather than by concatenating temporaries, as Skolemization and
+ * naming may introduce a very large number of symbols.
+ */
+std::string Signature::nextFreshSymbolName(const char* prefix, const char* suffix)
+{
+  std::string name(prefix);
+  name += Int::toString(_nextFreshSymbolNumber++);
+  if (suffix) {
+    name += '_';
+    name += suffix;
+  }
+  return name;
+}
+
 /**
  * Add fresh function of a given arity and with a given prefix. If suffix is non-zero,
  * the function name will be prefixI, where I is an integer, otherwise it will be
@@ -808,8 +834,6 @@ unsigned Signature::addNameFunction(unsigned arity)
  */
 unsigned Signature::addFreshFunction(unsigned arity, const char* prefix, const char* suffix)
 {
-  std::string pref(prefix);
-  std::string suf(suffix ? std::string("_")+suffix : "");
   bool added;
   unsigned result;
   //commented out because it could lead to introduction of function with the same name
@@ -818,7 +842,7 @@ unsigned Signature::addFreshFunction(unsigned arity, const char* prefix, const c
 //  unsigned result = addFunction(pref+suf,arity,added);
 //  if (!added) {
     do {
-      result = addFunction(pref+Int::toString(_nextFreshSymbolNumber++)+suf,arity,added);
+      result = addFunction(nextFreshSymbolName(prefix,suffix),arity,added);
     }
     while (!added);
 //  }
@@ -836,13 +860,11 @@ unsigned Signature::addFreshFunction(unsigned arity, const char* prefix, const c
  */
 unsigned Signature::addFreshTypeCon(unsigned arity, const char* prefix, const char* suffix)
 {
-  std::string pref(prefix);
-  std::string suf(suffix ? std::string("_")+suffix : "");
   bool added;
   unsigned result;
 
   do {
-    result = addTypeCon(pref+Int::toString(_nextFreshSymbolNumber++)+suf,arity,added);
+    result = addTypeCon(nextFreshSymbolName(prefix,suffix),arity,added);
   }
   while (!added);
 
@@ -862,8 +884,6 @@ unsigned Signature::addFreshTypeCon(unsigned arity, const char* prefix, const ch
  */
 unsigned Signature::addFreshPredicate(unsigned arity, const char* prefix, const char* suffix)
 {
-  std::string pref(prefix);
-  std::string suf(suffix ? std::string("_")+suffix : "");
   bool added = false;
   unsigned result;
   //commented out because it could lead to introduction of function with the same name
@@ -874,7 +894,7 @@ unsigned Signature::addFreshPredicate(unsigned arity, const char* prefix, const
 //  }
 //  if (!added) {
     do {
-      result = addPredicate(pref+Int::toString(_nextFreshSymbolNumber++)+suf,arity,added);
+      result = addPredicate(nextFreshSymbolName(prefix,suffix),arity,added);
     }
     while (!added);
 //  }
@@ -923,18 +943,59 @@ unsigned Signature::addSkolemPredicate(unsigned arity, const char* suffix)
 } // addSkolemPredicate
 
 /**
- * Return the key "name_arity" used for hashing. This key is obtained by
- * concatenating the name, underscore character and the arity. The key is
- * created in such a way that it does not collide with special keys, such as
- * those for string constants.
+ * Return the key of the symbol @b name of arity @b arity used for hashing,
+ * interning the name. The key pairs the atom of the name with the arity,
+ * so that the maps of symbols hash and compare two integers instead of the
+ * name, and is created in such a way that it does not collide with special
+ * keys, such as those for string constants.
  * @since 27/02/2006 Redmond
  * @author Andrei Voronkov
  */
 Signature::SymbolKey Signature::key(const std::string& name,int arity)
 {
-  return SymbolKey(std::make_pair(name,unsigned(arity)));
+  return SymbolKey(std::make_pair(_atoms.intern(name),unsigned(arity)));
 } // Signature::key
 
+/**
+ * Return the key of the symbol @b name of arity @b arity if its name has
+ * been interned. No symbol of this name exists otherwise.
+ */
+Option<Signature::SymbolKey> Signature::findKey(const std::string& name,int arity) const
+{
+  return _atoms.find(name).map([&](unsigned atom) { return SymbolKey(std::make_pair(atom,unsigned(arity))); });
+} // Signature::findKey
+
+/**
+ * If a function with the name of atom @b atom and arity @b arity exists,
+ * return its number. Otherwise, add a new one and return its number.
+ * Finding an existing function only hashes the atom and the arity.
+ */
+unsigned Signature::addFunctionByAtom(unsigned atom,unsigned arity)
+{
+  ASS_L(atom,_atoms.size());
+  unsigned result;
+  if (_funNames.find(SymbolKey(std::make_pair(atom,arity)),result)) {
+    getFunction(result)->unmarkIntroduced();
+    return result;
+  }
+  return addFunction(std::string(_atoms.name(atom)),arity);
+} // Signature::addFunctionByAtom
+
+/**
+ * If a predicate with the name of atom @b atom and arity @b arity exists,
+ * return its number. Otherwise, add a new one and return its number.
+ */
+unsigned Signature::addPredicateByAtom(unsigned atom,unsigned arity)
+{
+  ASS_L(atom,_atoms.size());
+  unsigned result;
+  if (_predNames.find(SymbolKey(std::make_pair(atom,arity)),result)) {
+    getPredicate(result)->unmarkIntroduced();
+    return result;
+  }
+  return addPredicate(std::string(_atoms.name(atom)),arity);
+} // Signature::addPredicateByAtom
+
 
 /** Add a color to the symbol for interpolation and symbol elimination purposes */
 void Signature::Symbol::addColor(Color color)
@@ -28,6 +28,7 @@
 #include "Lib/List.hpp"
 #include "Lib/DHMap.hpp"
 #include "Lib/SmartPtr.hpp"
+#include "Lib/AtomTable.hpp"
 
 #include "Shell/TermAlgebra.hpp"
 #include "Shell/Options.hpp"
@@ -47,7 +48,7 @@ using namespace Lib;
 class Signature
 {
   using SymbolKey = Coproduct<
-      std::pair<std::string, unsigned> // <- (name, arity)
+      std::pair<unsigned, unsigned> // <- (atom of the name, arity)
     , std::string // <- string-constant
     // (number, arity). 
     // if arity = 0 we mean a numeral constant
@@ -94,6 +95,8 @@ class Signature
     List<unsigned>* _distinctGroups;
     /** number of times it is used in the problem */
     unsigned _usageCount;
+    /** value of s_usageEpoch when _usageCount was last updated; if it differs, the count is 0 */
+    unsigned _usageEpoch;
     /** number of units it is used in in the problem */
     unsigned _unitUsageCount;
 
@@ -217,11 +220,13 @@ class Signature
     inline bool termAlgebraDiscriminator() const { return _termAlgebraDiscriminator; }
 
     /** Increase the usage count of this symbol **/
-    inline void incUsageCnt(){ _usageCount++; }
+    inline void incUsageCnt(){ resetUsageCntIfStale(); _usageCount++; }
     /** Return the usage count of this symbol **/
-    inline unsigned usageCnt() const { return _usageCount; }
+    inline unsigned usageCnt() const { return _usageEpoch == s_usageEpoch ? _usageCount : 0; }
     /** Reset usage count to zero, to start again! **/
-    inline void resetUsageCnt(){ _usageCount=0; }
+    inline void resetUsageCnt(){ _usageCount=0; _usageEpoch=s_usageEpoch; }
+    /** Reset the usage counts of all symbols (of all signatures) to zero in constant time **/
+    static void resetAllUsageCnts(){ s_usageEpoch++; }
 
     inline void incUnitUsageCnt(){ _unitUsageCount++;}
     inline unsigned unitUsageCnt() const { return _unitUsageCount; }
@@ -325,6 +330,12 @@ class Signature
     OperatorType* fnType() const;
     OperatorType* predType() const;
     OperatorType* typeConType() const;
+
+  private:
+    inline void resetUsageCntIfStale(){ if (_usageEpoch != s_usageEpoch) { resetUsageCnt(); } }
+
+    /** incremented by resetAllUsageCnts(), which makes all stored usage counts stale */
+    static unsigned s_usageEpoch;
   }; // class Symbol
 
   class InterpretedSymbol
@@ -489,6 +500,13 @@ class Signature
     bool added;
     return addFunction(name,arity,added);
   }
+  /**
+   * Intern the name of a symbol. The returned atom can be passed to
+   * addFunctionByAtom and addPredicateByAtom instead of the name.
+   */
+  unsigned internName(const std::string& name) { return _atoms.intern(name); }
+  unsigned addFunctionByAtom(unsigned atom,unsigned arity);
+  unsigned addPredicateByAtom(unsigned atom,unsigned arity);
   /**
    * If a unique string constant with this name and arity exists, return its number.
    * Otherwise, add a new one and return its number.
@@ -666,9 +684,8 @@ class Signature
   /** return true iff predicate of given @b name and @b arity exists. */
   bool isPredicateName(std::string name, unsigned arity)
   {
-    auto symbolKey = key(name,arity);
-    unsigned tmp;
-    return _predNames.find(symbolKey,tmp);
+    auto symbolKey = findKey(name,arity);
+    return symbolKey.isSome() && _predNames.find(*symbolKey);
   }
 
   void addChoiceOperator(unsigned fun){
@@ -801,7 +818,8 @@ class Signature
   bool hasTermAlgebras() { return !_termAlgebras.isEmpty(); }
   bool hasDefPreds() const { return !_fnDefPreds.isEmpty() || !_boolDefPreds.isEmpty(); }
       
-  static SymbolKey key(const std::string& name,int arity);
+  SymbolKey key(const std::string& name,int arity);
+  Option<SymbolKey> findKey(const std::string& name,int arity) const;
 
   /** the number of string constants */
   unsigned strings() const {return _strings;}
@@ -1020,10 +1038,13 @@ private:
   SymbolMap _funNames;
   SymbolMap _predNames;
   SymbolMap _typeConNames;
-  /** Map for the arity_check options: maps symbols to their arities */
-  Map<std::string, unsigned> _arityCheck;
+  /** the names of the symbols interned for the keys of the maps above */
+  AtomTable _atoms;
+  /** Map for the arity_check options: maps atoms of symbols to their arities */
+  Map<unsigned, unsigned> _arityCheck;
   /** Last number used for fresh functions and predicates */
   int _nextFreshSymbolNumber;
+  std::string nextFreshSymbolName(const char* prefix, const char* suffix);
 
   /** Map from symbol names to variable numbers*/
   SymbolMap _varNames;
@@ -21,6 +21,7 @@
 
 #include "Indexing/TermSharing.hpp"
 #include "Kernel/HOL/HOL.hpp"
+#include "Lib/DHMap.hpp"
 #include "Lib/Metaiterators.hpp"
 #include "Lib/Output.hpp"
 
@@ -54,7 +55,7 @@ void* Term::operator new(size_t,unsigned arity, size_t preData)
   ASS_EQ(preData%sizeof(size_t), 0);
 
   size_t sz = sizeof(Term)+arity*sizeof(TermList)+preData;
-  void* mem = ALLOC_KNOWN(sz,"Term");
+  void* mem = ALLOC_ACCOUNTED(sz, TERMS);
   mem = reinterpret_cast<void*>(reinterpret_cast<char*>(mem)+preData);
   return (Term*)mem;
 } // Term::operator new
@@ -75,7 +76,7 @@ void Term::destroy ()
   size_t sz = sizeof(Term)+_arity*sizeof(TermList)+getPreDataSize();
   void* mem = this;
   mem = reinterpret_cast<void*>(reinterpret_cast<char*>(mem)-getPreDataSize());
-  DEALLOC_KNOWN(mem,sz,"Term");
+  DEALLOC_ACCOUNTED(mem, sz, TERMS);
 } // Term::destroy
 
 /**
@@ -712,11 +713,46 @@ std::string TermList::toString(bool topLevel) const
 } // TermList::toString
 
 
+namespace {
+
+/** number of live Term::ToStringMemo objects */
+unsigned s_toStringMemoScopes = 0;
+DHMap<std::pair<const Term*, bool>, std::string> s_toStringMemo;
+
+} // namespace
+
+Term::ToStringMemo::ToStringMemo()
+{
+  s_toStringMemoScopes++;
+}
+
+Term::ToStringMemo::~ToStringMemo()
+{
+  if (--s_toStringMemoScopes == 0) {
+    s_toStringMemo.reset();
+  }
+}
+
 /**
  * Return the result of conversion of a term into a std::string.
  * @since 16/05/2007 Manchester
  */
 std::string Term::toString(bool topLevel) const
+{
+  if (s_toStringMemoScopes && shared()) {
+    auto key = std::make_pair(this, topLevel);
+    if (auto res = s_toStringMemo.findPtr(key)) {
+      return *res;
+    }
+    // inserting only after the call, as the subterms are memoized during it
+    std::string res = toStringUncached(topLevel);
+    s_toStringMemo.insert(key, res);
+    return res;
+  }
+  return toStringUncached(topLevel);
+}
+
+std::string Term::toStringUncached(bool topLevel) const
 {
   if (isSuper()) {
     return "$tType";
@@ -1257,8 +1293,9 @@ static Term* s_foolTrue = nullptr;
 static Term* s_foolFalse = nullptr;
 
 // KBO weight cache epoch counter.  Starts at 1 so freshly-created terms
-// (with _kboEpoch=0) are always stale until explicitly warmed.
+// (with _counts.kboEpoch=0) are always stale until explicitly warmed.
 unsigned Term::s_kboEpoch = 1;
+unsigned Term::s_argumentOrderEpoch = 1;
 static AtomicSort* s_superSort = nullptr;
 static AtomicSort* s_defaultSort = nullptr;
 static AtomicSort* s_boolSort = nullptr;
@@ -1343,7 +1380,7 @@ void AtomicSort::resetStaticCaches() {
   // For a constant sort (arity 0), size is sizeof(Term)
   if (s_superSort) {
     size_t sz = sizeof(Term) + s_superSort->arity() * sizeof(TermList);
-    DEALLOC_KNOWN(s_superSort, sz, "Term");
+    DEALLOC_ACCOUNTED(s_superSort, sz, TERMS);
     s_superSort = nullptr;
   }
   // The others are shared and managed by TermSharing
@@ -1716,14 +1753,14 @@ Term::Term(const Term& t) throw()
     _arity(t._arity),
     _color(COLOR_TRANSPARENT),
     _hasInterpretedConstants(0),
+    _hasInterpretedSymbols(0),
     _isTwoVarEquality(0),
     _weight(0),
-    _kboWeight(-1),
-    _kboEpoch(0),
+    _argumentOrderEpoch(0),
 #if VDEBUG
     _kboInstance(nullptr),
 #endif
-    _vars(0)
+    _counts{0, 0}
 {
   ASS(!isSpecial()); //we do not copy special terms
 
@@ -1751,15 +1788,14 @@ Term::Term() throw()
    _arity(0),
    _color(COLOR_TRANSPARENT),
    _hasInterpretedConstants(0),
+   _hasInterpretedSymbols(0),
    _isTwoVarEquality(0),
    _weight(0),
-   _kboWeight(-1),
-   _kboEpoch(0),
+   _argumentOrderEpoch(0),
 #if VDEBUG
    _kboInstance(nullptr),
 #endif
-   _maxRedLen(0),
-   _vars(0)
+   _counts{0, 0}
 {
   _args[0].setContent(0);
   _args[0]._setTag(FUN);
@@ -1780,7 +1816,7 @@ std::string Term::headerToString() const
   std::string s("functor: ");
   s += Int::toString(_functor) + ", arity: " + Int::toString(_arity)
     + ", weight: " + Int::toString(_weight)
-    + ", vars: " + Int::toString(_vars)
+    + ", vars: " + Int::toString(_counts.vars)
     + ", polarity: " + Int::toString(_args[0]._polarity())
     + ", shared: " + Int::toString(_args[0]._shared())
     + ", literal: " + Int::toString(_args[0]._literal())
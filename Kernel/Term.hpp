@@ -524,6 +524,18 @@ public:
   { return toSpecialFunctor(functor()); }
   std::string toString(bool topLevel = true) const;
   friend std::ostream& operator<<(std::ostream& out, Kernel::Term const& tl);
+
+  /**
+   * While an object of this class exists, toString() remembers the strings
+   * of shared terms, so that printing a large proof builds the string of
+   * each shared subterm only once.
+   */
+  class ToStringMemo {
+  public:
+    ToStringMemo();
+    ~ToStringMemo();
+  };
+
   static std::string variableToString(unsigned var);
   static std::string variableToString(TermList var);
 
@@ -683,15 +695,10 @@ public:
     return _weight;
   }
 
-  int maxRedLength() const
-  {
-    ASS(shared());
-    return _maxRedLen;    
-  }
-
   int kboWeight(const void* kboInstance) const
   {
-    if (_kboEpoch != s_kboEpoch) return -1;
+    ASS(!isLiteral());
+    if (_counts.kboEpoch != s_kboEpoch) return -1;
 #if VDEBUG
     ASS(_kboInstance && _kboInstance == kboInstance);
 #endif
@@ -700,12 +707,13 @@ public:
 
   void setKboWeight(int w, const void* kboInstance)
   {
+    ASS(!isLiteral()); // literals use the epoch slot for the argument order
 #if VDEBUG
-    ASS(!_kboInstance || _kboEpoch != s_kboEpoch);
+    ASS(!_kboInstance || _counts.kboEpoch != s_kboEpoch);
     _kboInstance = kboInstance;
 #endif
     _kboWeight = w;
-    _kboEpoch = s_kboEpoch;
+    _counts.kboEpoch = s_kboEpoch;
   }
 
   /** Invalidate all cached KBO weights across all shared terms.
@@ -713,6 +721,11 @@ public:
    * so that stale weights from the previous ordering are not reused. */
   static void invalidateKboWeightCache() { ++s_kboEpoch; }
 
+  /** Invalidate the argument orders cached on all shared equality literals.
+   * Must be called whenever a new global ordering is installed, for the same
+   * reason as invalidateKboWeightCache(). */
+  static void invalidateArgumentOrderCache() { ++s_argumentOrderEpoch; }
+
   /** Mark term as shared */
   void markShared()
   {
@@ -736,11 +749,6 @@ public:
     return _args[0]._id();
   }
   
-  void setMaxRedLen(int rl)
-  {
-    _maxRedLen = rl;
-  } // setWeight
-
   /** Set the number of variable _occurrences_ */
   void setNumVarOccs(unsigned v)
   {
@@ -748,7 +756,7 @@ public:
       ASS_EQ(v,2);
       return;
     }
-    _vars = v;
+    _counts.vars = v;
   } // setVars
 
   void setHasTermVar(bool b)
@@ -764,7 +772,7 @@ public:
     if(_isTwoVarEquality) {
       return _sort.isVar() ? 3 : 2 + _sort.term()->numVarOccs();
     }
-    return _vars;
+    return _counts.vars;
   } // vars()
 
   /**
@@ -906,6 +914,15 @@ public:
   /** Assign value that will be returned by the hasInterpretedConstants() function */
   void setInterpretedConstantsPresence(bool value) { _hasInterpretedConstants=value; }
 
+  /**
+   * Return true if the shared term contains an interpreted symbol, a term
+   * algebra constructor or a linear multiplication. Except in the modes that
+   * abstract arbitrary terms, unification with abstraction treats ground
+   * terms without such symbols syntactically.
+   */
+  bool hasInterpretedSymbols() const { ASS(shared()); return _hasInterpretedSymbols; }
+  void setInterpretedSymbolsPresence(bool value) { _hasInterpretedSymbols=value; }
+
   /** Return true if term is either an if-then-else or a let...in expression */
   bool isSpecial() const { return functor() >= SPECIAL_FUNCTOR_LOWER_BOUND; }
 
@@ -929,6 +946,7 @@ public:
 
 protected:
   std::string headToString() const;
+  std::string toStringUncached(bool topLevel) const;
 
   unsigned computeDistinctVars() const;
 
@@ -942,6 +960,9 @@ protected:
    */
   ArgumentOrderVals getArgumentOrderValue() const
   {
+    if (_argumentOrderEpoch != s_argumentOrderEpoch) {
+      return AO_UNKNOWN;
+    }
     return static_cast<ArgumentOrderVals>(_args[0]._order());
   }
 
@@ -958,37 +979,59 @@ protected:
     ASS_LE(val,AO_INCOMPARABLE);
 
     _args[0]._setOrder(val);
+    _argumentOrderEpoch = s_argumentOrderEpoch;
   }
 
   /** The number of this symbol in a signature */
   unsigned _functor;
   /** Arity of the symbol */
-  unsigned _arity : 28;
+  unsigned _arity : 27;
   /** colour, used in interpolation and symbol elimination */
   unsigned _color : 2;
   /** Equal to 1 if the term/literal contains any interpreted constants */
   unsigned _hasInterpretedConstants : 1;
+  /** Equal to 1 if the shared term contains a symbol that unification with
+   * abstraction may abstract, see hasInterpretedSymbols() */
+  unsigned _hasInterpretedSymbols : 1;
   /** If true, the object is an equality literal between two variables */
   unsigned _isTwoVarEquality : 1;
   /** Weight of the symbol, i.e. sum of symbol and variable occurrences. */
   unsigned _weight;
-  /** Cached weight of the term for KBO, otherwise -1 and invalid. Note that
-   * KBO symbol weights are not necessarily 1, so this can differ from @b _weight. */
-  int _kboWeight;
-  /** Epoch at which _kboWeight was cached. If this differs from s_kboEpoch the
-   * cached weight is stale and must be recomputed. Initialized to 0 so it is
-   * always stale before any KBO ordering is created (s_kboEpoch starts at 1). */
-  unsigned _kboEpoch;
+  union {
+    /** Cached weight of the term for KBO, valid only if @b _counts.kboEpoch equals
+     * s_kboEpoch. Note that KBO symbol weights are not necessarily 1, so this can
+     * differ from @b _weight. */
+    int _kboWeight;
+    /** Literals do not cache a KBO weight, they use the slot for the epoch at
+     * which the argument order value was stored (compared to s_argumentOrderEpoch).
+     * Initialized to 0 so it is always stale (s_argumentOrderEpoch starts at 1). */
+    unsigned _argumentOrderEpoch;
+  };
 #if VDEBUG
   /** KBO instance that uses the cached value @b _kboWeight. */
   const void* _kboInstance;
 #endif
-  /** length of maximum reduction length */
-  int _maxRedLen;
+  /**
+   * The header is kept at 24 bytes (plus the debug-only _kboInstance) by
+   * sharing this word between the per-term counters and the sort of a
+   * two-variable equality, which never needs either of them.
+   *
+   * The caches above are written in place even though a forked portfolio
+   * worker thereby copies the pages of the terms its ordering touches.
+   * A write happens at most once per term and epoch, while keeping the
+   * caches in a side table would put a lookup on every ordering call.
+   */
   union {
-    /** If _isTwoVarEquality is false, this value is valid and contains
-     * number of occurrences of variables */
-    unsigned _vars;
+    struct {
+      /** Epoch at which _kboWeight was cached. If this differs from s_kboEpoch the
+       * cached weight is stale and must be recomputed. Initialized to 0 so it is
+       * always stale before any KBO ordering is created (s_kboEpoch starts at 1).
+       * Unused by literals. */
+      unsigned kboEpoch;
+      /** If _isTwoVarEquality is false, this value is valid and contains
+       * number of occurrences of variables */
+      unsigned vars;
+    } _counts;
     /** If _isTwoVarEquality is true, this value is valid and contains
      * the sort of the top-level variables */
     TermList _sort;
@@ -1005,8 +1048,11 @@ protected:
 
   /** Global KBO epoch counter. Incrementing this invalidates all per-term
    * cached KBO weights, allowing a new ordering to be used without iterating
-   * all shared terms. Starts at 1 so _kboEpoch=0 (new terms) is always stale. */
+   * all shared terms. Starts at 1 so _counts.kboEpoch=0 (new terms) is always stale. */
   static unsigned s_kboEpoch;
+  /** Global epoch of the argument orders cached on equality literals, works
+   * like s_kboEpoch. */
+  static unsigned s_argumentOrderEpoch;
 
 public:
   /**
@@ -1029,6 +1075,9 @@ public:
     const TermList* _next;
   }; // Term::Iterator
 }; // class Term
+#if !VDEBUG
+static_assert(sizeof(Term) == 32, "term header must stay at 24 bytes plus the first argument");
+#endif
 
 
 /**
@@ -47,8 +47,11 @@ TermOrderingDiagram* TermOrderingDiagram::createForSingleComparison(const Orderi
 
 void TermOrderingDiagram::resetStaticCaches()
 {
-  // Note: this leaks the TermOrderingDiagram* values in the cache
-  // but clearing them properly requires iterating and deleting each
+  // the cached diagrams belong to the ordering of the finished proof
+  auto it = s_singleComparisonCache.iter();
+  while (it.hasNext()) {
+    delete it.next().value();
+  }
   s_singleComparisonCache.reset();
 }
 
@@ -110,45 +113,62 @@ void* TermOrderingDiagram::next()
 
     } else {
       ASS_EQ(node->tag, Node::T_POLY);
-
-      const auto& kbo = static_cast<const KBO&>(_ord);
-      auto weight = node->poly->constant;
-      ZIArray<int> varDiffs;
-      for (const auto& [var, coeff] : node->poly->varCoeffPairs) {
-        AppliedTerm tt(TermList::var(var), _appl, true);
-
-        VariableIterator vit(tt.term);
-        while (vit.hasNext()) {
-          auto v = vit.next();
-          varDiffs[v.var()] += coeff;
-          // since the counts are sorted in descending order,
-          // this can only mean we will fail
-          if (varDiffs[v.var()]<0) {
-            goto loop_end;
-          }
-        }
-        int64_t w = kbo.computeWeight(tt);
-        weight += coeff*w;
-        // due to descending order of counts,
-        // this also means failure
-        if (coeff<0 && weight<0) {
-          goto loop_end;
-        }
-      }
-
-      if (weight > 0) {
-        comp = Ordering::GREATER;
-      } else if (weight == 0) {
-        comp = Ordering::EQUAL;
-      }
+      comp = evaluatePoly(node->poly);
     }
-loop_end:
     _prev = _curr;
     _curr = &node->getBranch(comp);
   }
   return nullptr;
 }
 
+Ordering::Result TermOrderingDiagram::evaluatePoly(const Polynomial* poly) const
+{
+  // Poly nodes are evaluated for every retrieval, so the variable
+  // counters are kept between calls and only the touched ones are
+  // cleared again, instead of allocating and zeroing an array each time.
+  static ZIArray<int> varDiffs;
+  static Stack<unsigned> touched;
+
+  const auto& kbo = static_cast<const KBO&>(_ord);
+  int64_t weight = poly->constant;
+  auto res = Ordering::INCOMPARABLE;
+  for (const auto& [var, coeff] : poly->varCoeffPairs) {
+    AppliedTerm tt(TermList::var(var), _appl, true);
+
+    VariableIterator vit(tt.term);
+    while (vit.hasNext()) {
+      auto v = vit.next().var();
+      if (varDiffs[v] == 0) {
+        touched.push(v);
+      }
+      varDiffs[v] += coeff;
+      // since the counts are sorted in descending order,
+      // this can only mean we will fail
+      if (varDiffs[v]<0) {
+        goto end;
+      }
+    }
+    int64_t w = kbo.computeWeight(tt);
+    weight += coeff*w;
+    // due to descending order of counts,
+    // this also means failure
+    if (coeff<0 && weight<0) {
+      goto end;
+    }
+  }
+
+  if (weight > 0) {
+    res = Ordering::GREATER;
+  } else if (weight == 0) {
+    res = Ordering::EQUAL;
+  }
+end:
+  while (touched.isNonEmpty()) {
+    varDiffs[touched.pop()] = 0;
+  }
+  return res;
+}
+
 void TermOrderingDiagram::insert(const Stack<TermOrderingConstraint>& comps, void* data)
 {
   ASS(data);
@@ -97,6 +97,9 @@ protected:
   struct Node;
   struct Polynomial;
 
+  /** Evaluates a poly node under the current substitution. */
+  Ordering::Result evaluatePoly(const Polynomial* poly) const;
+
   /** A branch is essentially a shared pointer for a node,
    *  except the node takes care of its own lifecycle. */
   struct Branch {
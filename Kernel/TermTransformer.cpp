@@ -108,6 +108,8 @@ Term* TermTransformer::transform(Term* term)
 
   Stack<TermList*> toDo(8);
   Stack<Term*> terms(8);
+  // the subterms that were replaced by the elements of terms
+  Stack<Term*> sources(8);
   Stack<bool> modified(8);
   Stack<TermList> args(8);
   ASS(toDo.isEmpty());
@@ -129,6 +131,7 @@ Term* TermTransformer::transform(Term* term)
         break;
       }
       Term* orig = terms.pop();
+      Term* source = sources.pop();
 
       onTermExit(orig);
 
@@ -136,6 +139,7 @@ Term* TermTransformer::transform(Term* term)
       if (!modified.pop()) {
         args.truncate(args.length() - orig->arity());
         args.push(TermList(orig));
+        memorize(source, TermList(orig));
         continue;
       }
 
@@ -154,6 +158,7 @@ Term* TermTransformer::transform(Term* term)
         newTrm=Term::create(orig,argLst);
       }
       args.push(TermList(newTrm));
+      memorize(source, TermList(newTrm));
       modified.setTop(true);
       continue;
     } else {
@@ -178,12 +183,24 @@ Term* TermTransformer::transform(Term* term)
       continue;
     }
 
-    TermList dest = transformSubterm(tl);
+    TermList dest;
+    if (findMemo(tl, dest)) {
+      if (tl != dest) {
+        modified.setTop(true);
+      }
+      args.push(dest);
+      continue;
+    }
+
+    dest = transformSubterm(tl);
     if (tl != dest) {
       modified.setTop(true);
     }
     if (dest.isVar() || !exploreSubterms(tl, dest)) {
       args.push(dest);
+      if (tl.isTerm()) {
+        memorize(tl.term(), dest);
+      }
       continue;
     }
 
@@ -194,11 +211,13 @@ Term* TermTransformer::transform(Term* term)
 
     ASS(!t->isSpecial())
     terms.push(t);
+    sources.push(tl.term());
     modified.push(false);
     toDo.push(t->args());
   }
   ASS(toDo.isEmpty());
   ASS(terms.isEmpty());
+  ASS(sources.isEmpty());
   ASS_EQ(modified.length(), 1);
   ASS_EQ(args.length(), term->arity());
 
@@ -289,14 +308,17 @@ Term* BottomUpTermTransformer::transform(Term* term)
         args.truncate(args.length() - orig->arity());
       }
 
+      TermList res;
       if(orig->isSort()){
         //For most applications we probably dont want to transform sorts
         //however, we don't enforce that here, inheriting classes can decide
         //for themselves
-        args.push(transformSubterm(TermList(AtomicSort::create(static_cast<AtomicSort*>(orig),argLst))));
+        res = transformSubterm(TermList(AtomicSort::create(static_cast<AtomicSort*>(orig),argLst)));
       } else {
-        args.push(transformSubterm(TermList(Term::create(orig,argLst))));
+        res = transformSubterm(TermList(Term::create(orig,argLst)));
       }
+      args.push(res);
+      memorize(orig, res);
       continue;
     } else {
       toDo.push(tt->next());
@@ -316,6 +338,12 @@ Term* BottomUpTermTransformer::transform(Term* term)
       continue;
     }
 
+    TermList memo;
+    if (findMemo(tl, memo)) {
+      args.push(memo);
+      continue;
+    }
+
     ASS(tl.isTerm());
     Term* t=tl.term();
     terms.push(t);
@@ -16,6 +16,7 @@
 #define __TermTransformer__
 
 #include "Forwards.hpp"
+#include "Lib/DHMap.hpp"
 #include "Kernel/Term.hpp"
 
 
@@ -32,6 +33,34 @@ public:
 protected:
   Term* transformSpecial(Term* specialTerm);
   virtual TermList transform(TermList ts) = 0;
+
+  /**
+   * Remember the result for every shared proper subterm that is transformed,
+   * and reuse it when the subterm occurs again, also in later calls. A term
+   * DAG is then transformed in time linear in the DAG rather than in the
+   * tree. Only for transformations whose result for a subterm depends on
+   * nothing but the subterm: the onTermEntry()/onTermExit() hooks are not
+   * called for subterms found in the memo.
+   */
+  void setMemoizing(bool memoizing) { _memoizing = memoizing; _memo.reset(); }
+  /** Forget the remembered results, e.g. when the transformation changes */
+  void resetMemo() { _memo.reset(); }
+  /** The number of remembered results */
+  unsigned memoSize() const { return _memo.size(); }
+
+  /** True if the result for @b t is remembered, which is then assigned to @b res */
+  bool findMemo(TermList t, TermList& res)
+  { return _memoizing && t.isTerm() && t.term()->shared() && _memo.find(t.term(), res); }
+  void memorize(Term* t, TermList res)
+  {
+    if (_memoizing && t->shared()) {
+      _memo.insert(t, res);
+    }
+  }
+
+private:
+  bool _memoizing = false;
+  DHMap<Term*, TermList> _memo;
 };
 
 /**
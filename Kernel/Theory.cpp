@@ -63,7 +63,7 @@ Option<IntegerConstantType> IntegerConstantType::parse(std::string const& str)
 
 #define IMPL_BIN_OP(fun, mpz_fun)                                                         \
   IntegerConstantType IntegerConstantType::fun(const IntegerConstantType& num) const      \
-  { auto out = IntegerConstantType(0); mpz_fun(out._val, this->_val, num._val); return out; } \
+  { IntegerConstantType out; mpz_fun(out._val, this->_val, num._val); return out; }         \
 
   // TODO move semantics
 IMPL_BIN_OP(operator+, mpz_add)
@@ -269,7 +269,7 @@ RationalConstantType RationalConstantType::operator/(const RationalConstantType&
 
 bool RationalConstantType::isInt() const
 {
-  return _den == IntegerConstantType(1);
+  return _den == 1;
 }
 
 bool RationalConstantType::operator==(const RationalConstantType& o) const
@@ -305,14 +305,21 @@ bool RationalConstantType::operator>(const RationalConstantType& o) const
  */
 void RationalConstantType::cannonize()
 {
-  // TODO faster (?)
-  mpq_t q;
-  init_mpq(q, *this);
-  auto den_ref = mpq_denref(q);
-  auto num_ref = mpq_numref(q);
-  mpz_swap(_num._val, num_ref);
-  mpz_swap(_den._val, den_ref);
-  mpq_clear(q);
+  // most rationals arising in practice are integral, so check this first
+  // before going through the gcd
+  if (_den == 1) {
+    return;
+  }
+  if (_den.isNegative()) {
+    mpz_neg(_num._val, _num._val);
+    mpz_neg(_den._val, _den._val);
+  }
+  IntegerConstantType gcd;
+  mpz_gcd(gcd._val, _num._val, _den._val);
+  if (gcd != 1) {
+    mpz_divexact(_num._val, _num._val, gcd._val);
+    mpz_divexact(_den._val, _den._val, gcd._val);
+  }
 }
  
 Comparison RationalConstantType::comparePrecedence(RationalConstantType n1, RationalConstantType n2)
@@ -132,10 +132,10 @@ public:
   static TermList getSort() { return AtomicSort::intSort(); }
 
   IntegerConstantType() { mpz_init(_val); }
-  explicit IntegerConstantType(int v) : IntegerConstantType() { mpz_set_si(_val, v); }
+  explicit IntegerConstantType(int v) { mpz_init_set_si(_val, v); }
 
   IntegerConstantType(IntegerConstantType     && o) : IntegerConstantType() { mpz_swap(_val, o._val); }
-  IntegerConstantType(IntegerConstantType const& o) : IntegerConstantType() {  mpz_set(_val, o._val); }
+  IntegerConstantType(IntegerConstantType const& o) { mpz_init_set(_val, o._val); }
   IntegerConstantType& operator=(IntegerConstantType     && o) { mpz_swap(_val, o._val); return *this; }
   IntegerConstantType& operator=(IntegerConstantType const& o) {  mpz_set(_val, o._val); return *this; }
 
@@ -209,7 +209,38 @@ public:
   friend struct RationalConstantType;
   friend void init_mpq(mpq_t out, RationalConstantType const&);
 private:
-  MK_CAST_OPS(IntegerConstantType, int)
+  // Mixed operations with machine integers use the gmp functions taking a
+  // word-sized operand instead of first converting the int to an mpz.
+#define MK_INT_CMP(OP)                                                                    \
+  friend bool operator OP(IntegerConstantType const& l, int r) { return mpz_cmp_si(l._val, r) OP 0; } \
+  friend bool operator OP(int l, IntegerConstantType const& r) { return 0 OP mpz_cmp_si(r._val, l); } \
+
+  MK_INT_CMP(<)
+  MK_INT_CMP(>)
+  MK_INT_CMP(<=)
+  MK_INT_CMP(>=)
+  MK_INT_CMP(==)
+  MK_INT_CMP(!=)
+#undef MK_INT_CMP
+
+  static void addSi(mpz_t out, mpz_t const l, int r)
+  {
+    if (r >= 0) mpz_add_ui(out, l, (unsigned long) r);
+    else        mpz_sub_ui(out, l, -(unsigned long) r);
+  }
+
+  static void subSi(mpz_t out, mpz_t const l, int r)
+  {
+    if (r >= 0) mpz_sub_ui(out, l, (unsigned long) r);
+    else        mpz_add_ui(out, l, -(unsigned long) r);
+  }
+
+  friend IntegerConstantType operator+(IntegerConstantType const& l, int r) { IntegerConstantType out; addSi(out._val, l._val, r); return out; }
+  friend IntegerConstantType operator+(int l, IntegerConstantType const& r) { return r + l; }
+  friend IntegerConstantType operator-(IntegerConstantType const& l, int r) { IntegerConstantType out; subSi(out._val, l._val, r); return out; }
+  friend IntegerConstantType operator-(int l, IntegerConstantType const& r) { IntegerConstantType out; subSi(out._val, r._val, l); mpz_neg(out._val, out._val); return out; }
+  friend IntegerConstantType operator*(IntegerConstantType const& l, int r) { IntegerConstantType out; mpz_mul_si(out._val, l._val, r); return out; }
+  friend IntegerConstantType operator*(int l, IntegerConstantType const& r) { return r * l; }
 };
 
 /**
@@ -1190,6 +1190,116 @@ AbstractionOracle::AbstractionResult uwa_floor(AbstractingUnifier& au, TermSpec
 }
 
 
+namespace {
+
+/** The outcomes of the oracle that are cached, see cachedAbstract */
+struct CachedAbstraction {
+  enum Outcome : uint8_t {
+    /** no abstraction applies */
+    NONE,
+    NEVER_EQUAL,
+    /** the pair itself is the only constraint, in the given or the swapped order */
+    KEEP,
+    KEEP_SWAPPED,
+  };
+  Outcome outcome;
+  TermList sort;
+};
+
+/** the number of cached decisions at which the cache is emptied */
+constexpr unsigned MAX_CACHED_ABSTRACTIONS = 1 << 16;
+
+DHMap<std::tuple<const Term*, const Term*, unsigned>, CachedAbstraction> s_abstractions;
+
+bool groundShared(TermSpec const& t)
+{ return t.term.isTerm() && t.term.term()->shared() && t.term.term()->ground(); }
+
+/**
+ * The result of @b compute, the oracle of mode @b mode on @b t1 and @b t2.
+ *
+ * On ground shared terms the oracle does not depend on the substitution, so
+ * its decisions on recurring pairs are cached: failures, and pairs kept as
+ * their own constraint, which the fixed point iteration asks about again.
+ * Other results are computed each time.
+ */
+template<class Compute>
+Option<AbstractionOracle::AbstractionResult> cachedAbstract(TermSpec const& t1, TermSpec const& t2, Options::UnificationWithAbstraction mode, Compute compute)
+{
+  using AbstractionResult = AbstractionOracle::AbstractionResult;
+  if (!groundShared(t1) || !groundShared(t2)) {
+    return compute();
+  }
+  auto key = std::make_tuple(t1.term.term(), t2.term.term(), unsigned(mode));
+  CachedAbstraction cached;
+  if (s_abstractions.find(key, cached)) {
+    switch (cached.outcome) {
+      case CachedAbstraction::NONE:
+        return {};
+      case CachedAbstraction::NEVER_EQUAL:
+        return some(AbstractionResult(AbstractionOracle::NeverEqual{}));
+      case CachedAbstraction::KEEP:
+        return some(AbstractionResult(AbstractionOracle::EqualIf()
+              .constr(UnificationConstraint(t1, t2, TermSpec(cached.sort, t1.index)))));
+      case CachedAbstraction::KEEP_SWAPPED:
+        return some(AbstractionResult(AbstractionOracle::EqualIf()
+              .constr(UnificationConstraint(t2, t1, TermSpec(cached.sort, t1.index)))));
+    }
+    ASSERTION_VIOLATION;
+  }
+
+  auto res = compute();
+  Option<CachedAbstraction> toCache;
+  if (!res) {
+    toCache = some(CachedAbstraction{CachedAbstraction::NONE, TermList()});
+  } else if (res->template is<AbstractionOracle::NeverEqual>()) {
+    toCache = some(CachedAbstraction{CachedAbstraction::NEVER_EQUAL, TermList()});
+  } else {
+    auto& cond = res->template unwrap<AbstractionOracle::EqualIf>();
+    if (cond.unify().size() == 0 && cond.constr().size() == 1) {
+      auto& c = cond.constr()[0];
+      auto sort = SortHelper::getResultSort(t1.term.term());
+      if (c.lhs().term == t1.term && c.rhs().term == t2.term) {
+        toCache = some(CachedAbstraction{CachedAbstraction::KEEP, sort});
+      } else if (c.lhs().term == t2.term && c.rhs().term == t1.term) {
+        toCache = some(CachedAbstraction{CachedAbstraction::KEEP_SWAPPED, sort});
+      }
+    }
+  }
+  if (toCache) {
+    if (s_abstractions.size() >= MAX_CACHED_ABSTRACTIONS) {
+      s_abstractions.reset();
+    }
+    s_abstractions.insert(key, *toCache);
+  }
+  return res;
+}
+
+} // namespace
+
+void AbstractionOracle::resetStaticCaches()
+{
+  s_abstractions.reset();
+}
+
+bool AbstractionOracle::neverUnifiable(TermSpec const& t1, TermSpec const& t2) const
+{
+  switch (_mode) {
+    case Shell::Options::UnificationWithAbstraction::ALL:
+    case Shell::Options::UnificationWithAbstraction::GROUND:
+    case Shell::Options::UnificationWithAbstraction::FUNC_EXT:
+      // these abstract uninterpreted terms as well
+      return false;
+    default:
+      break;
+  }
+  auto syntactic = [](TermSpec const& t) {
+    if (!t.term.isTerm()) return false;
+    const Term* trm = t.term.term();
+    return trm->shared() && !trm->isSort() && trm->ground() && !trm->hasInterpretedSymbols();
+  };
+  return t1.term != t2.term && syntactic(t1) && syntactic(t2);
+}
+
 Option<AbstractionOracle::AbstractionResult> AbstractionOracle::tryAbstract(AbstractingUnifier* au, TermSpec const& t1, TermSpec const& t2) const
 {
   ASS(_mode != Shell::Options::UnificationWithAbstraction::OFF)
@@ -1198,13 +1308,13 @@ Option<AbstractionOracle::AbstractionResult> AbstractionOracle::tryAbstract(Abst
     return funcExt(au, t1, t2);
 
   } else if (_mode == Shell::Options::UnificationWithAbstraction::ALASCA_MAIN_FLOOR) {
-    return uwa_floor(*au, t1, t2, _mode);
+    return cachedAbstract(t1, t2, _mode, [&]() { return uwa_floor(*au, t1, t2, _mode); });
 
   } else if (_mode == Shell::Options::UnificationWithAbstraction::ALASCA_MAIN
       || _mode == Shell::Options::UnificationWithAbstraction::ALASCA_CAN_ABSTRACT
       || _mode == Shell::Options::UnificationWithAbstraction::ALASCA_ONE_INTERP
       ) {
-    return alasca(*au, t1, t2, _mode);
+    return cachedAbstract(t1, t2, _mode, [&]() { return alasca(*au, t1, t2, _mode); });
 
   } else {
     auto abs = canAbstract(au, t1, t2);
@@ -1412,6 +1522,9 @@ bool AbstractingUnifier::unify(TermSpec t1, TermSpec t2, bool& progress)
         DEBUG_UNIFY(2, "binding: ", dt2, " -> ", dt1)
         subs().bind(dt2.varSpec(), dt1);
 
+      } else if(_uwa.neverUnifiable(dt1, dt2)) {
+        return false;
+
       } else if(doAbstract(dt1, dt2)) {
 
         ASS(absRes);
@@ -133,9 +133,20 @@ public:
       TermSpec const& t1,
       TermSpec const& t2) const;
 
+  /**
+   * True if @b t1 and @b t2 are distinct ground shared terms without any
+   * symbols that the oracle could abstract (see Term::hasInterpretedSymbols()),
+   * which therefore cannot be unified. Only looks at metadata of the shared
+   * terms, so it is checked before the oracle is asked.
+   */
+  bool neverUnifiable(TermSpec const& t1, TermSpec const& t2) const;
+
   static Shell::Options::UnificationWithAbstraction create();
   static Shell::Options::UnificationWithAbstraction createOnlyHigherOrder();
 
+  /** Forget the cached decisions on ground shared terms, which refer to the term bank */
+  static void resetStaticCaches();
+
 private:
   // for old non-alasca uwa modes
   bool isInterpreted(unsigned f) const;
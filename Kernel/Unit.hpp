@@ -148,6 +148,8 @@ public:
   static void resetPreprocessingEnd() { _firstNonPreprocessingNumber = 0; }
   static void onParsingEnd(){ _lastParsingNumber = _lastNumber;}
   static unsigned getLastParsingNumber(){ return _lastParsingNumber;}
+  /** Number of the most recently created unit */
+  static unsigned getLastNumber() { return _lastNumber; }
 
 protected:
   /** Number of this unit, used for printing and statistics */
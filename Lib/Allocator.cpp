@@ -16,13 +16,126 @@
  * @since 24/07/2023, mostly replaced by a small-object allocator
  */
 
-#include <cstdio>
+#include <algorithm>
 #include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#include <sys/mman.h>
+#endif
 
 #include "Allocator.hpp"
 
 #ifndef INDIVIDUAL_ALLOCATIONS
 Lib::SmallObjectAllocator Lib::GLOBAL_SMALL_OBJECT_ALLOCATOR;
+
+// the size of a transparent huge page on x86-64 and most AArch64 systems
+static const size_t HUGE_PAGE = 2 * 1024 * 1024;
+static bool s_hugePages = false;
+
+void Lib::useHugePages(bool enable) {
+  s_hugePages = enable;
+}
+
+/*
+ * Blocks of huge pages are whole, aligned huge pages, so that the system can back each by a single one.
+ * Small chunks allocated one after another then share translation lookaside buffer entries
+ * much more than with 4 KiB pages, which matters when indices are traversed.
+ */
+void *Lib::allocateBlock(size_t &size) {
+#if defined(MADV_HUGEPAGE)
+  if(s_hugePages) {
+    size = HUGE_PAGE * ((size + HUGE_PAGE - 1) / HUGE_PAGE);
+    void *block = ::operator new(size, std::align_val_t(HUGE_PAGE));
+    // only advice: without transparent huge pages, the block is just an aligned allocation
+    madvise(block, size, MADV_HUGEPAGE);
+    return block;
+  }
+#endif
+  return ::operator new(size);
+}
+
+void Lib::freeBlock(void *block, size_t size) {
+  // blocks of huge pages are the only ones that are multiples of huge pages
+  if(size % HUGE_PAGE == 0)
+    ::operator delete(block, std::align_val_t(HUGE_PAGE));
+  else
+    ::operator delete(block);
+}
+
+/*
+ * Count the free chunks of every block and release the blocks whose chunks are all free,
+ * removing their chunks from the free list (which otherwise keeps its order).
+ */
+template<size_t SIZE>
+size_t Lib::FixedSizeAllocator<SIZE>::trim() {
+  // blocks sorted by address, with their number of free chunks
+  std::vector<std::pair<char *, size_t>> sorted;
+  for(char *block = blocks; block; block = nextBlock(block))
+    sorted.push_back({block, 0});
+  std::sort(sorted.begin(), sorted.end());
+
+  auto blockOf = [&](void *chunk) {
+    auto it = std::upper_bound(sorted.begin(), sorted.end(), std::make_pair(static_cast<char *>(chunk), SIZE_MAX));
+    ASS(it != sorted.begin())
+    --it;
+    ASS_L(static_cast<char *>(chunk), it->first + blockBytes(it->first))
+    return it;
+  };
+
+  for(void **chunk = free_list; chunk; chunk = static_cast<void **>(*chunk))
+    blockOf(chunk)->second++;
+
+  // a block is unused if all chunks it handed out are free again
+  auto unused = [&](const std::pair<char *, size_t> &b) {
+    size_t bytes = blockBytes(b.first);
+    size_t handedOut = (b.first == current.bytes ? bytes - current.remaining : bytes) / SIZE;
+    return b.second == handedOut;
+  };
+
+  void ***tail = &free_list;
+  for(void **chunk = free_list; chunk; chunk = static_cast<void **>(*chunk)) {
+    if(!unused(*blockOf(chunk))) {
+      *tail = chunk;
+      tail = reinterpret_cast<void ***>(chunk);
+    }
+  }
+  *tail = nullptr;
+
+  size_t released = 0;
+  char **link = &blocks;
+  while(*link) {
+    char *block = *link;
+    if(unused(*blockOf(block))) {
+      *link = nextBlock(block);
+      if(block == current.bytes) {
+        current.bytes = nullptr;
+        current.remaining = 0;
+      }
+      size_t size = header(block).size;
+      freeBlock(block - sizeof(BlockHeader), size);
+      released += size;
+    }
+    else
+      link = &nextBlock(block);
+  }
+  return released;
+}
+
+template size_t Lib::FixedSizeAllocator<1 * sizeof(void *)>::trim();
+template size_t Lib::FixedSizeAllocator<2 * sizeof(void *)>::trim();
+template size_t Lib::FixedSizeAllocator<3 * sizeof(void *)>::trim();
+template size_t Lib::FixedSizeAllocator<4 * sizeof(void *)>::trim();
+template size_t Lib::FixedSizeAllocator<6 * sizeof(void *)>::trim();
+template size_t Lib::FixedSizeAllocator<8 * sizeof(void *)>::trim();
+// sizes used by the clause allocator, see Kernel/Clause.cpp
+template size_t Lib::FixedSizeAllocator<14 * sizeof(void *)>::trim();
+template size_t Lib::FixedSizeAllocator<16 * sizeof(void *)>::trim();
+template size_t Lib::FixedSizeAllocator<20 * sizeof(void *)>::trim();
+template size_t Lib::FixedSizeAllocator<24 * sizeof(void *)>::trim();
+template size_t Lib::FixedSizeAllocator<32 * sizeof(void *)>::trim();
 #endif
 
 #if __has_include(<sys/resource.h>)
@@ -66,3 +179,28 @@ long Lib::peakMemoryUsageKB() {
 
   return 0;
 }
+
+Lib::MemoryUsage Lib::MEMORY_USAGE[static_cast<unsigned>(Lib::MemoryCategory::COUNT)];
+
+const char *Lib::memoryCategoryName(MemoryCategory category) {
+  switch(category) {
+  case MemoryCategory::TERMS:
+    return "terms";
+  case MemoryCategory::CLAUSES:
+    return "clauses";
+  case MemoryCategory::INDEXING:
+    return "indexing";
+  case MemoryCategory::PASSIVE:
+    return "passive";
+  case MemoryCategory::SAT:
+    return "SAT";
+  case MemoryCategory::COUNT:
+    break;
+  }
+  ASSERTION_VIOLATION
+}
+
+void Lib::resetMemoryPeaks() {
+  for(MemoryUsage &usage : MEMORY_USAGE)
+    usage.peak = usage.live;
+}
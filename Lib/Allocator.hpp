@@ -24,6 +24,7 @@
 #include <new>
 
 #include "Debug/Assertion.hpp"
+#include "HeapProfiler.hpp"
 
 /*
  * uncomment the following to use Valgrind more profitably
@@ -36,17 +37,79 @@ namespace Lib {
 // attempt to set a memory limit for this process by system call
 void setMemoryLimit(size_t bytes);
 long peakMemoryUsageKB();
+
+/*
+ * Subsystems whose memory use is counted separately.
+ * Only allocations made through ALLOC_ACCOUNTED/DEALLOC_ACCOUNTED or by classes
+ * using USE_ACCOUNTED_ALLOCATOR are counted, so the numbers are lower bounds.
+ */
+enum class MemoryCategory : unsigned {
+  // shared and non-shared terms, literals and sorts
+  TERMS,
+  // clauses, but not their literals
+  CLAUSES,
+  // substitution tree nodes and code tree literal data
+  INDEXING,
+  // clause queues of the passive containers
+  PASSIVE,
+  // clauses of the SAT solvers
+  SAT,
+  COUNT
+};
+
+// bytes in use by one subsystem, and the most that were ever in use at once
+struct MemoryUsage {
+  size_t live = 0;
+  size_t peak = 0;
+
+  void allocated(size_t size) {
+    live += size;
+    if(live > peak)
+      peak = live;
+  }
+  void freed(size_t size) { live -= size; }
+};
+
+extern MemoryUsage MEMORY_USAGE[static_cast<unsigned>(MemoryCategory::COUNT)];
+
+inline MemoryUsage &memoryUsage(MemoryCategory category) {
+  return MEMORY_USAGE[static_cast<unsigned>(category)];
+}
+
+// bytes in use summed over all categories
+inline size_t accountedMemoryInUse() {
+  size_t sum = 0;
+  for(const MemoryUsage &usage : MEMORY_USAGE)
+    sum += usage.live;
+  return sum;
+}
+
+// human-readable name of `category`, e.g. for statistics
+const char *memoryCategoryName(MemoryCategory category);
+
+// start measuring peaks from the current usage, e.g. at the start of a proof
+void resetMemoryPeaks();
 }
 
 #ifdef INDIVIDUAL_ALLOCATIONS
 namespace Lib {
 inline void *alloc(size_t size, size_t align = alignof(std::max_align_t)) {
-  return ::operator new(size, (std::align_val_t)align);
+  void *res = ::operator new(size, (std::align_val_t)align);
+#if VHEAP_PROFILE
+  HeapProfiler::allocated(res, size);
+#endif
+  return res;
 }
 
 inline void free(void *pointer, size_t size, size_t align = alignof(std::max_align_t)) {
+#if VHEAP_PROFILE
+  HeapProfiler::freed(pointer);
+#endif
   ::operator delete(pointer, (std::align_val_t)align);
 }
+
+// nothing is retained by the system allocator
+inline size_t releaseUnusedMemory() { return 0; }
 } // namespace Lib
 #define USE_GLOBAL_SMALL_OBJECT_ALLOCATOR(C)
 
@@ -55,18 +118,33 @@ inline void free(void *pointer, size_t size, size_t align = alignof(std::max_ali
 
 namespace Lib {
 
+/*
+ * Where the blocks of `FixedSizeAllocator`s come from, defined in Allocator.cpp.
+ *
+ * `allocateBlock` may round `size` up, the rounded size must be passed to `freeBlock`.
+ * With huge pages on, blocks are whole 2 MiB regions backed by transparent huge pages
+ * where the system supports them.
+ */
+void *allocateBlock(size_t &size);
+void freeBlock(void *block, size_t size);
+
+// take blocks of transparent huge pages from now on, blocks already handed out are kept
+void useHugePages(bool enable);
+
 /*
  * A simple fixed-size allocator.
- * Allocates largish blocks of memory (`COUNT * SIZE` bytes) from the system,
+ * Allocates largish blocks of memory (at least `COUNT * SIZE` bytes) from the system,
  * chopping it into smaller fixed-size chunks for fast allocation/deallocation.
  * Chunks are `SIZE` bytes long, aligned to the greatest common divisor of `SIZE` and `alignof(std::max_align_t)`.
  *
- * The allocator never releases memory to the system, instead retaining it in a free list for reallocation.
+ * The allocator retains freed memory in a free list for reallocation.
  * This fits Vampire's generally-growing allocation pattern reasonably well in practice.
+ * Blocks none of whose chunks are in use can be handed back to the system with `trim()`,
+ * which is too slow to call often, but is useful e.g. between proof attempts in library mode.
  */
 template<size_t SIZE>
 class FixedSizeAllocator {
-  // number of chunks (of size `SIZE`) to allocate at a time from the system
+  // least number of chunks (of size `SIZE`) to allocate at a time from the system
   static const size_t COUNT = 1024;
 
   // to allow for a sneaky implementation hack, we cannot allocate anything smaller than sizeof(void *)
@@ -96,8 +174,26 @@ class FixedSizeAllocator {
     }
   };
 
-  // the current block - old blocks are leaked
+  // the current block - old blocks are leaked unless released by trim()
   Block current;
+  /*
+   * All blocks allocated from the system, most recent first, each pointing to its first chunk.
+   * Each block starts with a header before its chunks, keeping the alignment of the chunks.
+   */
+  char *blocks = nullptr;
+
+  struct alignas(std::max_align_t) BlockHeader {
+    // the next older block
+    char *next;
+    // the size the block was allocated with, including the header
+    size_t size;
+  };
+
+  static BlockHeader &header(char *block) { return *reinterpret_cast<BlockHeader *>(block - sizeof(BlockHeader)); }
+  static char *&nextBlock(char *block) { return header(block).next; }
+  // the number of bytes of chunks in `block`
+  static size_t blockBytes(char *block) { return (header(block).size - sizeof(BlockHeader)) / SIZE * SIZE; }
+
   /*
    * The free list.
    *
@@ -107,9 +203,8 @@ class FixedSizeAllocator {
    */
   void **free_list = nullptr;
 
-public:
-  // allocate a single chunk
-  void *alloc() {
+  // the chunk handed out by alloc()
+  void *allocChunk() {
     // first look if there's anything in the free list
     if(free_list) {
       void *recycled = free_list;
@@ -122,18 +217,39 @@ public:
       return current.alloc();
 
     // current block full, get a new one
-    current.bytes = static_cast<char *>(::operator new(COUNT * SIZE));
-    current.remaining = COUNT * SIZE;
+    size_t size = sizeof(BlockHeader) + COUNT * SIZE;
+    char *block = static_cast<char *>(allocateBlock(size));
+    current.bytes = block + sizeof(BlockHeader);
+    header(current.bytes) = {blocks, size};
+    current.remaining = blockBytes(current.bytes);
+    blocks = current.bytes;
     return current.alloc();
   }
 
+public:
+  // allocate a single chunk
+  void *alloc() {
+    void *res = allocChunk();
+#if VHEAP_PROFILE
+    HeapProfiler::allocated(res, SIZE);
+#endif
+    return res;
+  }
+
   // move a chunk to the free list for reallocation
   // NB `ptr` must have been allocated from this allocator
   void free(void *ptr) {
+#if VHEAP_PROFILE
+    HeapProfiler::freed(ptr);
+#endif
     void **head = static_cast<void **>(ptr);
     *head = free_list;
     free_list = head;
   }
+
+  // return blocks with no chunk in use to the system, returning the number of bytes released
+  // takes time linear in the length of the free list, defined in Allocator.cpp
+  size_t trim();
 };
 
 /*
@@ -184,7 +300,11 @@ public:
       return FSA8.alloc();
 
     // fall back to the system allocator for larger allocations
-    return ::operator new(size, (std::align_val_t)align);
+    void *res = ::operator new(size, (std::align_val_t)align);
+#if VHEAP_PROFILE
+    HeapProfiler::allocated(res, size);
+#endif
+    return res;
   }
 
   // deallocate a `pointer` to a memory chunk of known `size`
@@ -208,9 +328,17 @@ public:
     if(size <= 8 * sizeof(void *))
       return FSA8.free(pointer);
 
+#if VHEAP_PROFILE
+    HeapProfiler::freed(pointer);
+#endif
     ::operator delete(pointer, (std::align_val_t)align);
   }
 
+  // return unused memory to the system, returning the number of bytes released
+  size_t trim() {
+    return FSA1.trim() + FSA2.trim() + FSA3.trim() + FSA4.trim() + FSA6.trim() + FSA8.trim();
+  }
+
 private:
   // sizes tuned somewhat based on real allocation data, but I don't claim they couldn't be better!
   // when tuning, bear in mind that the larger the gap between sizes, the more memory is wasted
@@ -263,6 +391,12 @@ inline void free(void *pointer, size_t size, size_t align) {
   GLOBAL_SMALL_OBJECT_ALLOCATOR.free(pointer, size, align);
 }
 
+// Return memory of `GLOBAL_SMALL_OBJECT_ALLOCATOR` that is not in use to the system.
+// Returns the number of bytes released.
+inline size_t releaseUnusedMemory() {
+  return GLOBAL_SMALL_OBJECT_ALLOCATOR.trim();
+}
+
 // Deallocate a `pointer` to a memory chunk of known `size` and aligned to `alignof(std::max_align_t)`.
 // Memory is returned to `GLOBAL_SMALL_OBJECT_ALLOCATOR`.
 // Wasteful as `size` has to be rounded up, do not use in new code.
@@ -290,6 +424,23 @@ inline void free(void *pointer, size_t size) {
 #define ALLOC_KNOWN(size, className) Lib::alloc(size)
 #define DEALLOC_KNOWN(ptr, size, className) Lib::free(ptr, size)
 
+// like ALLOC_KNOWN and DEALLOC_KNOWN, but counting the memory towards a `Lib::MemoryCategory`
+#define ALLOC_ACCOUNTED(size, category) \
+  (Lib::memoryUsage(Lib::MemoryCategory::category).allocated(size), Lib::alloc(size))
+#define DEALLOC_ACCOUNTED(ptr, size, category) \
+  (Lib::memoryUsage(Lib::MemoryCategory::category).freed(size), Lib::free(ptr, size))
+
+// like USE_ALLOCATOR, but counting the memory towards a `Lib::MemoryCategory`
+#define USE_ACCOUNTED_ALLOCATOR(C, category) \
+  void *operator new(size_t size) { \
+    Lib::memoryUsage(Lib::MemoryCategory::category).allocated(size); \
+    return Lib::alloc(size, alignof(C)); \
+  } \
+  void operator delete(void *ptr, size_t size) { \
+    Lib::memoryUsage(Lib::MemoryCategory::category).freed(size); \
+    Lib::free(ptr, size, alignof(C)); \
+  }
+
 // TODO dubious: probably a compiler lint these days?
 /**
  * Deletion of incomplete class types causes memory leaks. Using this
@@ -0,0 +1,136 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file AtomTable.hpp
+ * Defines class AtomTable of interned strings.
+ */
+
+#ifndef __AtomTable__
+#define __AtomTable__
+
+#include <cstring>
+#include <string_view>
+
+#include "Forwards.hpp"
+
+#include "Allocator.hpp"
+#include "Exception.hpp"
+#include "Hash.hpp"
+#include "Map.hpp"
+#include "Option.hpp"
+#include "Stack.hpp"
+
+namespace Lib {
+
+/**
+ * Interns strings as atoms, numbered 0, 1, ... in the order of insertion.
+ *
+ * The characters of all atoms are kept in a few large chunks, so a name is
+ * hashed and compared once, when it is interned, and the atom can be used
+ * as a key where the string would be hashed and copied again, like the
+ * symbol tables of Signature.
+ */
+class AtomTable
+{
+  /** the size of a chunk, longer names get a chunk of their own */
+  static constexpr size_t CHUNK = 1 << 16;
+
+  struct ViewHash {
+    static unsigned hash(std::string_view s)
+    { return DefaultHash::hashBytes(reinterpret_cast<const unsigned char*>(s.data()), s.size()); }
+    static bool equals(std::string_view s1, std::string_view s2)
+    { return s1 == s2; }
+  };
+
+public:
+  USE_ALLOCATOR(AtomTable);
+
+  AtomTable() : _free(nullptr), _left(0) {}
+
+  ~AtomTable()
+  {
+    for (auto& chunk : _chunks) {
+      DEALLOC_KNOWN(chunk.first, chunk.second, "AtomTable::chunk");
+    }
+  }
+
+  AtomTable(const AtomTable&) = delete;
+  AtomTable& operator=(const AtomTable&) = delete;
+
+  /** The atom of @b name, which is added if it was not interned yet */
+  unsigned intern(std::string_view name)
+  {
+    auto atom = _atoms.tryGet(name);
+    if (atom.isSome()) {
+      return *atom;
+    }
+    unsigned res = _names.size();
+    std::string_view stored = store(name);
+    _atoms.insert(stored, res);
+    _names.push(stored);
+    return res;
+  }
+
+  /** The atom of @b name if it has been interned */
+  Option<unsigned> find(std::string_view name) const
+  {
+    auto atom = _atoms.tryGet(name);
+    return atom.isSome() ? Option<unsigned>(*atom) : Option<unsigned>();
+  }
+
+  /** The name of @b atom */
+  std::string_view name(unsigned atom) const
+  { return _names[atom]; }
+
+  /** The number of atoms */
+  unsigned size() const
+  { return _names.size(); }
+
+private:
+  /** Copy @b name to the chunks */
+  std::string_view store(std::string_view name)
+  {
+    size_t len = name.size();
+    char* res;
+    if (len >= CHUNK) {
+      res = allocateChunk(len);
+    } else {
+      if (len > _left) {
+        _free = allocateChunk(CHUNK);
+        _left = CHUNK;
+      }
+      res = _free;
+      _free += len;
+      _left -= len;
+    }
+    std::memcpy(res, name.data(), len);
+    return std::string_view(res, len);
+  }
+
+  char* allocateChunk(size_t size)
+  {
+    char* chunk = static_cast<char*>(ALLOC_KNOWN(size, "AtomTable::chunk"));
+    _chunks.push(std::make_pair(chunk, size));
+    return chunk;
+  }
+
+  Map<std::string_view, unsigned, ViewHash> _atoms;
+  /** the names of the atoms, by number */
+  Stack<std::string_view> _names;
+  /** allocated chunks with their sizes */
+  Stack<std::pair<char*, size_t>> _chunks;
+  /** where the next name is stored and how much space there is left */
+  char* _free;
+  size_t _left;
+}; // class AtomTable
+
+} // namespace Lib
+
+#endif // __AtomTable__
@@ -66,7 +66,7 @@ public:
   Kernel::Problem* getMainProblem() { return _problem; }
   void setMainProblem(Kernel::Problem* p) {
     _problem = p;
-    _higherOrder = _problem->isHigherOrder();
+    _higherOrder = _problem && _problem->isHigherOrder();
   }
 
   bool higherOrder() const {
@@ -51,6 +51,18 @@ struct HashUtils
    */
   template<class... Ts> static unsigned combine(unsigned h1, unsigned h2, unsigned h3, Ts... ts) 
   { return combine(h1, combine(h2, h3, ts...)); }
+
+  /**
+   * Mix @b a and @b b into a 64-bit hash in the style of wyhash: the two
+   * halves of their 128-bit product, xored. Every input bit affects every
+   * output bit, so any bits of the result can be used as a table index or
+   * tag, unlike those of combine() or of the identity hash.
+   */
+  static uint64_t mix(uint64_t a, uint64_t b = 0x9e3779b97f4a7c15ull)
+  {
+    __uint128_t r = __uint128_t(a ^ 0xa0761d6478bd642full) * (b ^ 0xe7037ed1a0b428dbull);
+    return uint64_t(r) ^ uint64_t(r >> 64);
+  }
 };
 
 // the identity hash
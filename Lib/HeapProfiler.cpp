@@ -0,0 +1,231 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file HeapProfiler.cpp
+ * Implements the sampling heap profiler of the allocator.
+ */
+
+#include "HeapProfiler.hpp"
+
+#if VHEAP_PROFILE
+
+#include <algorithm>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <unistd.h>
+
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#define HAVE_BACKTRACE
+#endif
+
+namespace Lib {
+namespace HeapProfiler {
+
+bool s_active = false;
+long s_untilSample = 0;
+size_t s_live = 0;
+
+namespace {
+
+// the profiler uses the system allocator only, so it does not see itself
+
+/** deepest recorded call stack */
+const int MAX_DEPTH = 64;
+
+struct Site {
+  std::vector<void*> stack;
+  size_t liveObjects = 0;
+  size_t liveBytes = 0;
+  size_t allocObjects = 0;
+  size_t allocBytes = 0;
+};
+
+/** the estimate a sampled allocation stands for */
+struct Sample {
+  Site* site;
+  size_t objects;
+  size_t bytes;
+};
+
+struct StackHash {
+  size_t operator()(const std::vector<void*>& stack) const
+  {
+    size_t res = stack.size();
+    for (void* p : stack) {
+      res = res * 1000003 ^ reinterpret_cast<size_t>(p);
+    }
+    return res;
+  }
+};
+
+struct Profile {
+  std::string prefix;
+  long interval;
+  unsigned dumps = 0;
+  std::unordered_map<std::vector<void*>, Site, StackHash> sites;
+  std::unordered_map<void*, Sample> samples;
+};
+
+// never destroyed, as pointers may be freed by destructors of static objects
+Profile* s_profile = nullptr;
+volatile std::sig_atomic_t s_dumpRequested = 0;
+
+void dump()
+{
+  Profile& prf = *s_profile;
+  // the workers of a portfolio inherit the profile, and each writes its own
+  std::string file = prf.prefix + "." + std::to_string(getpid()) + "." + std::to_string(prf.dumps++) + ".heap";
+  std::FILE* out = std::fopen(file.c_str(), "w");
+  if (!out) {
+    std::perror("cannot write heap profile");
+    return;
+  }
+
+  Site total;
+  for (auto& entry : prf.sites) {
+    const Site& site = entry.second;
+    total.liveObjects += site.liveObjects;
+    total.liveBytes += site.liveBytes;
+    total.allocObjects += site.allocObjects;
+    total.allocBytes += site.allocBytes;
+  }
+  // the counts are estimates already, so pprof must not scale them
+  std::fprintf(out, "heap profile: %zu: %zu [%zu: %zu] @ heapprofile\n",
+      total.liveObjects, total.liveBytes, total.allocObjects, total.allocBytes);
+  for (auto& entry : prf.sites) {
+    const Site& site = entry.second;
+    std::fprintf(out, "%zu: %zu [%zu: %zu] @",
+        site.liveObjects, site.liveBytes, site.allocObjects, site.allocBytes);
+    for (void* pc : site.stack) {
+      std::fprintf(out, " %p", pc);
+    }
+    std::fputc('\n', out);
+  }
+
+  // pprof maps the addresses to symbols through the mappings of the process
+  std::fputs("\nMAPPED_LIBRARIES:\n", out);
+  if (std::FILE* maps = std::fopen("/proc/self/maps", "r")) {
+    char buf[4096];
+    size_t n;
+    while ((n = std::fread(buf, 1, sizeof(buf), maps))) {
+      std::fwrite(buf, 1, n, out);
+    }
+    std::fclose(maps);
+  }
+  std::fclose(out);
+}
+
+void requestDump(int)
+{ s_dumpRequested = 1; }
+
+void dumpAtExit()
+{
+  s_active = false;
+  dump();
+}
+
+/** Start the profiler if VAMPIRE_HEAP_PROFILE is set */
+struct Starter {
+  Starter()
+  {
+    const char* prefix = std::getenv("VAMPIRE_HEAP_PROFILE");
+    if (!prefix || !*prefix) {
+      return;
+    }
+    const char* interval = std::getenv("VAMPIRE_HEAP_PROFILE_INTERVAL");
+    s_profile = new Profile();
+    s_profile->prefix = prefix;
+    s_profile->interval = interval ? std::atol(interval) : 0;
+    if (s_profile->interval <= 0) {
+      s_profile->interval = 512 * 1024;
+    }
+    s_untilSample = s_profile->interval;
+    std::signal(SIGUSR1, requestDump);
+    std::atexit(dumpAtExit);
+    s_active = true;
+  }
+} s_starter;
+
+} // namespace
+
+/**
+ * Record the allocation of @b size bytes at @b ptr, which exhausted the
+ * bytes until the next sample, as standing for the sampling intervals it
+ * covers.
+ */
+void sample(void* ptr, size_t size)
+{
+  Profile& prf = *s_profile;
+  size_t intervals = 0;
+  while (s_untilSample <= 0) {
+    s_untilSample += prf.interval;
+    intervals++;
+  }
+
+  std::vector<void*> stack(MAX_DEPTH);
+#ifdef HAVE_BACKTRACE
+  int depth = backtrace(stack.data(), MAX_DEPTH);
+  stack.resize(depth);
+  // drop the frames of the profiler itself
+  stack.erase(stack.begin(), stack.begin() + std::min(depth, 2));
+#else
+  stack.clear();
+#endif
+
+  Site& site = prf.sites[stack];
+  if (site.stack.empty()) {
+    site.stack = stack;
+  }
+  size_t bytes = intervals * prf.interval;
+  size_t objects = std::max<size_t>(bytes / size, 1);
+  site.liveObjects += objects;
+  site.liveBytes += bytes;
+  site.allocObjects += objects;
+  site.allocBytes += bytes;
+  // ptr may be a chunk that was sampled, freed outside the hooks and reused
+  auto old = prf.samples.find(ptr);
+  if (old != prf.samples.end()) {
+    old->second.site->liveObjects -= old->second.objects;
+    old->second.site->liveBytes -= old->second.bytes;
+    prf.samples.erase(old);
+  }
+  prf.samples[ptr] = Sample{&site, objects, bytes};
+  s_live = prf.samples.size();
+
+  if (s_dumpRequested) {
+    s_dumpRequested = 0;
+    dump();
+  }
+}
+
+/** Take the sample of @b ptr, if any, off the live bytes of its site */
+void forget(void* ptr)
+{
+  Profile& prf = *s_profile;
+  auto it = prf.samples.find(ptr);
+  if (it == prf.samples.end()) {
+    return;
+  }
+  it->second.site->liveObjects -= it->second.objects;
+  it->second.site->liveBytes -= it->second.bytes;
+  prf.samples.erase(it);
+  s_live = prf.samples.size();
+}
+
+} // namespace HeapProfiler
+} // namespace Lib
+
+#endif // VHEAP_PROFILE
@@ -0,0 +1,66 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file HeapProfiler.hpp
+ * Defines the hooks of the sampling heap profiler of the allocator.
+ */
+
+#ifndef __HeapProfiler__
+#define __HeapProfiler__
+
+#include <cstddef>
+
+/*
+ * A sampling heap profiler for the allocations of Lib/Allocator, built in
+ * with -DHEAP_PROFILER=ON (VHEAP_PROFILE) and started at program start if
+ * the environment variable VAMPIRE_HEAP_PROFILE names a file prefix.
+ *
+ * Every VAMPIRE_HEAP_PROFILE_INTERVAL allocated bytes (512 KiB by default)
+ * the call stack of the allocation is recorded, and the allocation stands
+ * for those bytes of its site until it is freed. At exit, and at the next
+ * sampled allocation after a SIGUSR1, the live and total bytes per site
+ * are written to <prefix>.<pid>.<n>.heap in the legacy heap profile format of
+ * gperftools, which pprof reads together with the binary.
+ *
+ * The hooks are called by the fixed-size pools, so they see through them,
+ * and by the fallback to the system allocator. They are not thread safe.
+ */
+#if VHEAP_PROFILE
+namespace Lib {
+namespace HeapProfiler {
+
+extern bool s_active;
+/** bytes to allocate until the next sample */
+extern long s_untilSample;
+/** the number of sampled allocations that are not freed yet */
+extern size_t s_live;
+
+void sample(void* ptr, size_t size);
+void forget(void* ptr);
+
+inline void allocated(void* ptr, size_t size)
+{
+  if (s_active && (s_untilSample -= static_cast<long>(size)) <= 0) {
+    sample(ptr, size);
+  }
+}
+
+inline void freed(void* ptr)
+{
+  if (s_live) {
+    forget(ptr);
+  }
+}
+
+} // namespace HeapProfiler
+} // namespace Lib
+#endif
+
+#endif // __HeapProfiler__
@@ -27,4 +27,11 @@ static_assert(
 #endif
 #endif
 
+// hint that the memory at `addr` is going to be read soon, e.g. a node put on a backtracking stack
+#if defined(__GNUC__) || defined(__clang__)
+#define VAMPIRE_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define VAMPIRE_PREFETCH(addr) ((void)(addr))
+#endif
+
 #endif /*__Portability__*/
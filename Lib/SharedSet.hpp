@@ -20,6 +20,7 @@
 #include "Debug/Assertion.hpp"
 
 #include "Allocator.hpp"
+#include "DHMap.hpp"
 #include "Metaiterators.hpp"
 #include "Set.hpp"
 #include "Sort.hpp"
@@ -33,6 +34,15 @@ class SharedSet {
 
   typedef Stack<T> ItemStack;
 
+  /**
+   * A set at most this many times smaller than the other set of an
+   * operation is merged with it, a smaller one is looked up in it by binary
+   * search instead.
+   */
+  static constexpr size_t LOOKUP_RATIO = 8;
+  /** the number of unions remembered by getUnion() before it forgets them all */
+  static constexpr unsigned MAX_MEMOIZED_UNIONS = 1 << 16;
+
 public:
   DECL_ELEMENT_TYPE(T);
 
@@ -93,6 +103,12 @@ public:
     return false;
   }
 
+  /**
+   * Return the union of this set with @b s.
+   *
+   * The sets are shared and never destroyed, so the unions are remembered:
+   * the same splits of premises are joined over and over.
+   */
   const SharedSet* getUnion(const SharedSet* s) const
   {
     ASS(s);
@@ -104,6 +120,31 @@ public:
       return s;
     }
 
+    static DHMap<std::pair<const SharedSet*,const SharedSet*>, const SharedSet*> memo;
+    auto key = this < s ? std::make_pair(this, s) : std::make_pair(s, this);
+    const SharedSet* res;
+    if(memo.find(key, res)) {
+      return res;
+    }
+    if(memo.size() >= MAX_MEMOIZED_UNIONS) {
+      memo.reset();
+    }
+    res = computeUnion(s);
+    memo.insert(key, res);
+    return res;
+  }
+
+private:
+  const SharedSet* computeUnion(const SharedSet* s) const
+  {
+    // the splits of a conclusion usually contain those of a small premise
+    if(size()*LOOKUP_RATIO < s->size() && isSubsetOf(s)) {
+      return s;
+    }
+    if(s->size()*LOOKUP_RATIO < size() && s->isSubsetOf(this)) {
+      return this;
+    }
+
     bool p1Superset = true;
     bool p2Superset = true;
 
@@ -157,6 +198,7 @@ public:
     return res;
   }
 
+public:
   const SharedSet* getIntersection(const SharedSet* s) const
   {
     ASS(s);
@@ -242,6 +284,18 @@ public:
   {
     ASS(s);
 
+    if(size()*LOOKUP_RATIO < s->size() || s->size()*LOOKUP_RATIO < size()) {
+      const SharedSet* small = size() < s->size() ? this : s;
+      const SharedSet* large = small == this ? s : this;
+      auto it = small->iter();
+      while(it.hasNext()) {
+        if(large->member(it.next())) {
+          return true;
+        }
+      }
+      return false;
+    }
+
     const T* p1=_items;
     const T* p2=s->_items;
     const T* p1e=p1+size();
@@ -273,6 +327,18 @@ public:
     if(s==this) {
       return true;
     }
+    if(!isEmpty() && ((*this)[0]<(*s)[0] || s->maxval()<maxval())) {
+      return false;
+    }
+    if(size()*LOOKUP_RATIO < s->size()) {
+      auto it = iter();
+      while(it.hasNext()) {
+        if(!s->member(it.next())) {
+          return false;
+        }
+      }
+      return true;
+    }
 
     const T* p1=_items;
     const T* p2=s->_items;
@@ -19,7 +19,9 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <ostream>
+#include <type_traits>
 
 #include "Forwards.hpp"
 #include "Lib/TypeList.hpp"
@@ -86,9 +88,7 @@ public:
     }
     C* mem = static_cast<C*>(ALLOC_KNOWN(capacity*sizeof(C),className()));
     if (_stack) {
-      for (unsigned i = 0; i < size(); i++) {
-        ::new(&mem[i]) C(std::move((*this)[i]));
-      }
+      relocate(_stack, size(), mem);
       DEALLOC_KNOWN(_stack,_capacity*sizeof(C),className());
 
       _cursor = mem + (_cursor - _stack);
@@ -119,7 +119,7 @@ public:
     _cursor = _stack;
     _end = _stack+_capacity;
 
-    loadFromIterator(BottomFirstIterator(const_cast<Stack&>(s)));
+    copyElements(s);
   }
 
   Stack(Stack&& s) noexcept
@@ -156,7 +156,8 @@ public:
       return *this;
     }
     reset();
-    loadFromIterator(BottomFirstIterator(const_cast<Stack&>(s)));
+    reserve(s.size());
+    copyElements(s);
     return *this;
   }
 
@@ -846,10 +847,7 @@ protected:
 
     C* newStack = static_cast<C*>(mem);
     if(_capacity) {
-      for (size_t i = 0; i<_capacity; i++) {
-        ::new(newStack+i) C(std::move(_stack[i]));
-        _stack[i].~C();
-      }
+      relocate(_stack, _capacity, newStack);
       // deallocate the old stack
       DEALLOC_KNOWN(_stack,_capacity*sizeof(C),className());
     }
@@ -860,6 +858,42 @@ protected:
     _capacity = newCapacity;
   } // Stack::expand
 
+  /**
+   * Move @b n elements from @b from to the uninitialized memory at @b to,
+   * ending the lifetime of the originals. Trivially copyable elements
+   * (terms, literal pointers, numbers, ...) are moved with a single memcpy.
+   */
+  static void relocate(C* from, size_t n, C* to)
+  {
+    if constexpr (std::is_trivially_copyable_v<C>) {
+      if (n) {
+        std::memcpy(static_cast<void*>(to), static_cast<const void*>(from), n*sizeof(C));
+      }
+    } else {
+      for (size_t i = 0; i<n; i++) {
+        ::new(to+i) C(std::move(from[i]));
+        from[i].~C();
+      }
+    }
+  }
+
+  /** Append copies of the elements of @b s, for which there must be room */
+  void copyElements(const Stack& s)
+  {
+    size_t n = s.size();
+    ASS_LE(n, static_cast<size_t>(_end - _cursor));
+    if constexpr (std::is_trivially_copyable_v<C>) {
+      if (n) {
+        std::memcpy(static_cast<void*>(_cursor), static_cast<const void*>(s._stack), n*sizeof(C));
+      }
+      _cursor += n;
+    } else {
+      for (size_t i = 0; i<n; i++) {
+        ::new(_cursor++) C(s._stack[i]);
+      }
+    }
+  }
+
 public:
 
 
@@ -0,0 +1,345 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file SwissSet.hpp
+ * Defines class SwissSet<Val>, an open addressing hash set probing groups
+ * of control bytes, with the interface of Set.
+ */
+
+#ifndef __SwissSet__
+#define __SwissSet__
+
+#include <cstdint>
+#include <cstring>
+
+#if __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "Forwards.hpp"
+
+#include "Debug/Assertion.hpp"
+#include "Allocator.hpp"
+#include "Hash.hpp"
+#include "Metaiterators.hpp"
+
+namespace Lib {
+
+/**
+ * A hash set in the style of SwissTable, usable in place of Set.
+ *
+ * Every slot has a control byte: EMPTY, DELETED or, for an occupied slot,
+ * seven bits of the hash of its value. Slots are probed in aligned groups
+ * of 16, and the control bytes of a group are compared with the searched
+ * seven bits at once (with SSE2 when available), so that a lookup calls
+ * Hash::equals almost only on the value it finds. A lookup stops at the
+ * first group with an EMPTY slot.
+ *
+ * The hash codes are spread by HashUtils::mix, so Hash::hash does not
+ * have to distribute its low bits well, and they are not stored: growing
+ * the table hashes the values again. Values are compared using
+ * Hash::equals, as in Set.
+ */
+template <typename Val, typename Hash>
+class SwissSet
+{
+  static constexpr unsigned GROUP = 16;
+  static constexpr uint8_t EMPTY = 0x80;
+  static constexpr uint8_t DELETED = 0xfe;
+
+  /** bit i is set iff the control byte i of the group at @b ctrl is @b tag */
+  static unsigned match(const uint8_t* ctrl, uint8_t tag)
+  {
+#if __SSE2__
+    __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(tag))));
+#else
+    unsigned res = 0;
+    for (unsigned i = 0; i < GROUP; i++) {
+      res |= unsigned(ctrl[i] == tag) << i;
+    }
+    return res;
+#endif
+  }
+
+  /** bit i is set iff the slot i of the group at @b ctrl is EMPTY or DELETED */
+  static unsigned matchFree(const uint8_t* ctrl)
+  {
+#if __SSE2__
+    // exactly the free control bytes have the high bit set
+    return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)));
+#else
+    unsigned res = 0;
+    for (unsigned i = 0; i < GROUP; i++) {
+      res |= unsigned(ctrl[i] >> 7) << i;
+    }
+    return res;
+#endif
+  }
+
+  /**
+   * The probe sequence of a hash code. Visits every group of a table with
+   * a power of two number of groups, in triangular steps.
+   */
+  class Probe
+  {
+  public:
+    Probe(uint64_t hash, unsigned groupMask) : _group(unsigned(hash >> 7) & groupMask), _mask(groupMask), _step(0) {}
+    unsigned group() const { return _group; }
+    void next() { _group = (_group + ++_step) & _mask; }
+  private:
+    unsigned _group;
+    unsigned _mask;
+    unsigned _step;
+  };
+
+public:
+  USE_ALLOCATOR(SwissSet);
+
+  SwissSet() : _capacity(0), _size(0), _used(0), _ctrl(nullptr), _slots(nullptr)
+  { rehash(GROUP); }
+
+  ~SwissSet()
+  { deallocate(_ctrl, _slots, _capacity); }
+
+  SwissSet(const SwissSet&) = delete;
+  SwissSet& operator=(const SwissSet&) = delete;
+
+  /**
+   * If the set contains value equal to @b key, return true,
+   * and assign the value to @b result
+   *
+   * Hash class has to contain methods
+   * Hash::hash(Key)
+   * Hash::equals(Val,Key)
+   */
+  template<typename Key>
+  bool find(Key key, Val& result) const
+  {
+    int i = findSlot(Hash::hash(key), [&](const Val& v) { return Hash::equals(v, key); });
+    if (i < 0) {
+      return false;
+    }
+    result = _slots[i];
+    return true;
+  }
+
+  /** True if the set contains @b val */
+  bool contains(Val val) const
+  { return findSlot(Hash::hash(val), [&](const Val& v) { return Hash::equals(v, val); }) >= 0; }
+
+  /**
+   * Return the value with hash code @b hashCode for which @b isCorrectVal
+   * holds, inserting the value returned by @b create if there is none.
+   * @b inserted is set to whether the value has been inserted.
+   * See Set::rawFindOrInsert.
+   */
+  template<class Create, class IsCorrectVal>
+  Val& rawFindOrInsert(Create create, unsigned hashCode, IsCorrectVal isCorrectVal, bool& inserted)
+  {
+    if (_used >= maxUsed()) {
+      // drop the DELETED slots in place if they make up much of the load
+      rehash(_size >= maxUsed() / 2 ? _capacity * 2 : _capacity);
+    }
+    uint64_t hash = HashUtils::mix(hashCode);
+    uint8_t tag = hash & 0x7f;
+    int free = -1;
+    for (Probe p(hash, groupMask());; p.next()) {
+      unsigned base = p.group() * GROUP;
+      const uint8_t* ctrl = _ctrl + base;
+      for (unsigned m = match(ctrl, tag); m; m &= m - 1) {
+        unsigned i = base + __builtin_ctz(m);
+        if (isCorrectVal(_slots[i])) {
+          inserted = false;
+          return _slots[i];
+        }
+      }
+      unsigned freeSlots = matchFree(ctrl);
+      if (free < 0 && freeSlots) {
+        free = base + __builtin_ctz(freeSlots);
+      }
+      if (match(ctrl, EMPTY)) {
+        break;
+      }
+    }
+    if (_ctrl[free] == EMPTY) {
+      _used++;
+    }
+    _ctrl[free] = tag;
+    _slots[free] = create();
+    _size++;
+    inserted = true;
+    ASS_REP(Hash::hash(_slots[free]) == hashCode, _slots[free])
+    return _slots[free];
+  }
+
+  template<class Create, class IsCorrectVal>
+  Val& rawFindOrInsert(Create create, unsigned hashCode, IsCorrectVal isCorrectVal)
+  { bool b; return rawFindOrInsert(std::move(create), hashCode, std::move(isCorrectVal), b); }
+
+  /**
+   * If a value equal to @b val is not contained in the set, insert @b val
+   * in the set. Return the value equal to @b val from the set.
+   */
+  Val insert(Val val)
+  { return insert(val, Hash::hash(val)); }
+
+  /** Insert a value with a given code in the set */
+  Val insert(Val val, unsigned code)
+  { return rawFindOrInsert([&]() { return std::move(val); }, code, [&](auto& v) { return Hash::equals(v, val); }); }
+
+  /** Return the number of elements */
+  unsigned size() const { return _size; }
+
+  /** Remove a value from the set. Return true if the value is found */
+  bool remove(Val val)
+  {
+    int i = findSlot(Hash::hash(val), [&](const Val& v) { return Hash::equals(v, val); });
+    if (i < 0) {
+      return false;
+    }
+    // a lookup passing this group stops in it if it has an EMPTY slot, so
+    // no lookup needs the slot to look occupied then
+    if (match(_ctrl + (i & ~(GROUP - 1)), EMPTY)) {
+      _ctrl[i] = EMPTY;
+      _used--;
+    } else {
+      _ctrl[i] = DELETED;
+    }
+    _size--;
+    return true;
+  }
+
+  /** Make the set empty */
+  void reset()
+  {
+    std::memset(_ctrl, EMPTY, _capacity);
+    _size = 0;
+    _used = 0;
+  }
+
+  /** Iterates over the values stored in the set */
+  class Iterator {
+  public:
+    DECL_ELEMENT_TYPE(Val);
+
+    explicit Iterator(const SwissSet& set) : _set(&set), _next(0) {}
+
+    bool hasNext()
+    {
+      while (_next != _set->_capacity) {
+        if (!(_set->_ctrl[_next] & EMPTY)) {
+          return true;
+        }
+        _next++;
+      }
+      return false;
+    }
+
+    /** @warning hasNext() must have been called before */
+    Val next()
+    {
+      ASS(!(_set->_ctrl[_next] & EMPTY));
+      return _set->_slots[_next++];
+    }
+
+  private:
+    const SwissSet* _set;
+    unsigned _next;
+  };
+  DECL_ITERATOR_TYPE(Iterator);
+
+  IterTraits<Iterator> iter() const
+  { return iterTraits(Iterator(*this)); }
+
+private:
+  unsigned groupMask() const { return _capacity / GROUP - 1; }
+  /** the number of non-EMPTY slots at which the table is rebuilt */
+  unsigned maxUsed() const { return _capacity - _capacity / 8; }
+
+  /** the slot of the value with hash code @b hashCode for which @b isVal holds, or -1 */
+  template<class IsVal>
+  int findSlot(unsigned hashCode, IsVal isVal) const
+  {
+    uint64_t hash = HashUtils::mix(hashCode);
+    uint8_t tag = hash & 0x7f;
+    for (Probe p(hash, groupMask());; p.next()) {
+      unsigned base = p.group() * GROUP;
+      const uint8_t* ctrl = _ctrl + base;
+      for (unsigned m = match(ctrl, tag); m; m &= m - 1) {
+        unsigned i = base + __builtin_ctz(m);
+        if (isVal(_slots[i])) {
+          return i;
+        }
+      }
+      if (match(ctrl, EMPTY)) {
+        return -1;
+      }
+    }
+  }
+
+  /** Move the values to a new table with @b capacity slots, a power of two */
+  void rehash(unsigned capacity)
+  {
+    ASS_GE(capacity, GROUP);
+    ASS_EQ(capacity & (capacity - 1), 0);
+
+    uint8_t* oldCtrl = _ctrl;
+    Val* oldSlots = _slots;
+    unsigned oldCapacity = _capacity;
+
+    _ctrl = static_cast<uint8_t*>(ALLOC_KNOWN(capacity, "SwissSet::ctrl"));
+    std::memset(_ctrl, EMPTY, capacity);
+    _slots = array_new<Val>(ALLOC_KNOWN(capacity * sizeof(Val), "SwissSet::slots"), capacity);
+    _capacity = capacity;
+    _used = _size;
+
+    // the values are pairwise distinct, so each goes to the first free slot
+    // of its probe sequence without any equality tests
+    for (unsigned j = 0; j < oldCapacity; j++) {
+      if (oldCtrl[j] & EMPTY) {
+        continue;
+      }
+      uint64_t hash = HashUtils::mix(Hash::hash(oldSlots[j]));
+      Probe p(hash, groupMask());
+      unsigned freeSlots;
+      while (!(freeSlots = matchFree(_ctrl + p.group() * GROUP))) {
+        p.next();
+      }
+      unsigned i = p.group() * GROUP + __builtin_ctz(freeSlots);
+      _ctrl[i] = hash & 0x7f;
+      _slots[i] = std::move(oldSlots[j]);
+    }
+    deallocate(oldCtrl, oldSlots, oldCapacity);
+  }
+
+  static void deallocate(uint8_t* ctrl, Val* slots, unsigned capacity)
+  {
+    if (!ctrl) {
+      return;
+    }
+    DEALLOC_KNOWN(ctrl, capacity, "SwissSet::ctrl");
+    array_delete(slots, capacity);
+    DEALLOC_KNOWN(slots, capacity * sizeof(Val), "SwissSet::slots");
+  }
+
+  /** the number of slots, a power of two and a multiple of GROUP */
+  unsigned _capacity;
+  /** the number of values */
+  unsigned _size;
+  /** the number of slots that are not EMPTY */
+  unsigned _used;
+  uint8_t* _ctrl;
+  Val* _slots;
+}; // class SwissSet
+
+} // namespace Lib
+
+#endif // __SwissSet__
@@ -12,6 +12,7 @@
  * Implements class Timer.
  */
 
+#include <ctime>
 #include <iostream>
 #include <mutex>
 #include <thread>
@@ -47,6 +48,27 @@ static long perf_event_open(struct perf_event_attr *hw_event, pid_t pid, int cpu
   int ret = syscall(__NR_perf_event_open, hw_event, pid, cpu,group_fd, flags);
   return ret;
 }
+
+// open a counter of the user instructions of this process, started from zero, or return -1
+static int openInstructionCounter()
+{
+  struct perf_event_attr pe;
+
+  memset(&pe, 0, sizeof(struct perf_event_attr));
+    pe.type = PERF_TYPE_HARDWARE;
+    pe.size = sizeof(struct perf_event_attr);
+    pe.config = PERF_COUNT_HW_INSTRUCTIONS;
+    pe.disabled = 1;
+    pe.exclude_kernel = 1;
+    pe.exclude_hv = 1;
+
+  int fd = perf_event_open(&pe, 0, -1, -1, 0);
+  if (fd != -1) {
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+  }
+  return fd;
+}
 #endif
 
 enum LimitType {
@@ -177,18 +199,7 @@ void reinitialise(bool tryInitInstructionLimiting) {
     * (otherwise tick() could start asking the uninitialized PERF_FD!)
     */
     LAST_INSTRUCTION_COUNT_READ = -1;
-    PERF_FD = -1;
-    struct perf_event_attr pe;
-
-    memset(&pe, 0, sizeof(struct perf_event_attr));
-      pe.type = PERF_TYPE_HARDWARE;
-      pe.size = sizeof(struct perf_event_attr);
-      pe.config = PERF_COUNT_HW_INSTRUCTIONS;
-      pe.disabled = 1;
-      pe.exclude_kernel = 1;
-      pe.exclude_hv = 1;
-
-    PERF_FD = perf_event_open(&pe, 0, -1, -1, 0);
+    PERF_FD = openInstructionCounter();
     if (PERF_FD == -1) {
       // we want this to be guarded by env.options->instructionLimit()
       // not to bother with the error people who don't even know about instruction limiting
@@ -199,9 +210,6 @@ void reinitialise(bool tryInitInstructionLimiting) {
           << "\n(If you are seeing 'Permission denied' ask your admin to run 'sudo sysctl -w kernel.perf_event_paranoid=-1' for you.)"
           << std::endl;
       }
-    } else {
-      ioctl(PERF_FD, PERF_EVENT_IOC_RESET, 0);
-      ioctl(PERF_FD, PERF_EVENT_IOC_ENABLE, 0);
     }
   }
 #endif
@@ -223,6 +231,14 @@ void resetStartTime() {
   START_TIME = std::chrono::steady_clock::now();
 }
 
+long threadCpuMilliseconds() {
+  timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+    return 0;
+  }
+  return long(ts.tv_sec) * 1000 + ts.tv_nsec / 1000000;
+}
+
 // return elapsed time after `START_TIME`
 // must be thread-safe as it is called by the main process and timer_thread
 long elapsedMilliseconds() {
@@ -296,5 +312,33 @@ void updateInstructionCount()
 #endif
 }
 
+InstructionCounter::InstructionCounter()
+#if VAMPIRE_PERF_EXISTS
+  : _fd(openInstructionCounter())
+#else
+  : _fd(-1)
+#endif
+{}
+
+InstructionCounter::~InstructionCounter()
+{
+#if VAMPIRE_PERF_EXISTS
+  if (_fd >= 0) {
+    close(_fd);
+  }
+#endif
+}
+
+long long InstructionCounter::instructions() const
+{
+  long long res = -1;
+#if VAMPIRE_PERF_EXISTS
+  if (_fd >= 0 && read(_fd, &res, sizeof(long long)) != sizeof(long long)) {
+    res = -1;
+  }
+#endif
+  return res;
+}
+
 } //namespace Timer
 } //namespace Lib
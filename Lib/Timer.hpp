@@ -45,6 +45,9 @@ namespace Timer {
   inline long elapsedDeciseconds()
   { return elapsedMilliseconds() / 100; }
 
+  // CPU time consumed by the calling thread
+  long threadCpuMilliseconds();
+
   // output times in various formats (?!)
   void printMSString(std::ostream &, int);
   std::string msToSecondsString(int);
@@ -58,6 +61,24 @@ namespace Timer {
   // make sure that the instruction data is as up-to-date as possible
   // otherwise may be (slightly) stale
   void updateInstructionCount();
+
+  // a counter of the (user) instructions executed from its construction on,
+  // through the same perf event as instruction limiting, e.g. for performance tests;
+  // unavailable if !VAMPIRE_PERF_EXISTS or if the perf event cannot be opened
+  class InstructionCounter {
+  public:
+    InstructionCounter();
+    ~InstructionCounter();
+    InstructionCounter(const InstructionCounter&) = delete;
+    InstructionCounter& operator=(const InstructionCounter&) = delete;
+
+    bool available() const { return _fd >= 0; }
+    // instructions executed since construction, -1 if not available
+    long long instructions() const;
+
+  private:
+    int _fd;
+  };
 };
 }
 
@@ -32,6 +32,8 @@
 #include "Kernel/TermIterators.hpp"
 #include "Kernel/Theory.hpp"
 
+#include "Indexing/TermSharing.hpp"
+
 #include "Shell/AnswerLiteralManager.hpp"
 #include "Shell/Options.hpp"
 #include "Shell/DistinctGroupExpansion.hpp"
@@ -2121,6 +2123,9 @@ void TPTP::include()
   consumeToken(T_RPAR);
   consumeToken(T_DOT);
 
+  // the included file is parsed in place, on the same state stacks: its units
+  // are not independent of the rest, since symbols are registered in the global
+  // signature in order of appearance and that numbering is visible to the prover
   std::filesystem::path path = fs::absolute(resolveInclude(included));
   auto in = new ifstream(path);
   if (!*in) {
@@ -3228,7 +3233,7 @@ Formula* TPTP::createPredicateApplication(std::string name, unsigned arity)
       if(tsSort != AtomicSort::superSort()){
         USER_ERROR("The sort ", tsSort, " of type argument ", ts, " is not $ttype as mandated by TF1");
       }
-    } else {
+    } else if (sort != tsSort) {
       _substScratchpad.reset();
       if(!_substScratchpad.match(sort, 0, tsSort, 1)) {
         USER_ERROR("Failed to create predicate application for ", name, " of type ", type->toString(), "\n",
@@ -3237,12 +3242,32 @@ Formula* TPTP::createPredicateApplication(std::string name, unsigned arity)
       }
     }
   }
-  auto out = new AtomicFormula(Literal::create(pred, arity, /* polarity */ true, args));
+  auto out = new AtomicFormula(type->numTypeArguments() == 0
+    ? createCheckedLiteral(pred, arity, args)
+    : Literal::create(pred, arity, /* polarity */ true, args));
   _termLists.pop(arity);
   return out;
 } // createPredicateApplication
 
 
+/**
+ * Create and share an application of the monomorphic function @b fun
+ * whose argument sorts have been checked against its type already, so
+ * that term sharing does not check them a second time.
+ */
+Term* TPTP::createCheckedTerm(unsigned fun, unsigned arity, TermList* args)
+{
+  TermSharing::WellSortednessCheckingLocalDisabler checked(env.sharing);
+  return Term::create(fun, arity, args);
+}
+
+/** The predicate counterpart of createCheckedTerm() */
+Literal* TPTP::createCheckedLiteral(unsigned pred, unsigned arity, TermList* args)
+{
+  TermSharing::WellSortednessCheckingLocalDisabler checked(env.sharing);
+  return Literal::create(pred, arity, /* polarity */ true, args);
+}
+
 /**
  * Creates a term that is a function application from
  * provided function symbol name and arity. If arity is greater than zero,
@@ -3278,7 +3303,7 @@ TermList TPTP::createFunctionApplication(std::string name, unsigned arity)
         USER_ERROR("The sort " + ssSort.toString() + " of type argument " + ss.toString() + " "
                    "is not $tType as mandated by TF1");
       }
-    } else {
+    } else if (sort != ssSort) {
       _substScratchpad.reset();
       if(!_substScratchpad.match(sort, 0, ssSort, 1)){
         USER_ERROR("Failed to create function application for " + name + " of type " + type->toString() + "\n" +
@@ -3287,7 +3312,9 @@ TermList TPTP::createFunctionApplication(std::string name, unsigned arity)
       }
     }
   }
-  auto t = TermList(Term::create(fun, arity, args));
+  auto t = type->numTypeArguments() == 0
+    ? TermList(createCheckedTerm(fun, arity, args))
+    : TermList(Term::create(fun, arity, args));
   _termLists.pop(arity);
   return t;
 }
@@ -17,6 +17,7 @@
 #ifndef __Parser_TPTP__
 #define __Parser_TPTP__
 
+#include <cstring>
 #include <filesystem>
 #include <unordered_set>
 
@@ -641,10 +642,13 @@ private:
    */
   inline char getChar(int pos)
   {
+    // read through the stream buffer, as istream::get() builds a sentry
+    // for every character, which dominated lexing of large files
+    std::streambuf* buf = currentFile.in->rdbuf();
     while (_cend <= pos) {
-      int c = currentFile.in->get();
+      int c = buf->sbumpc();
       //      if (c == -1) { std::cout << "<EOF>"; } else {std::cout << char(c);}
-      _chars[_cend++] = c == -1 ? 0 : c;
+      _chars[_cend++] = c == std::char_traits<char>::eof() ? 0 : c;
     }
     return _chars[pos];
   } // getChar
@@ -657,9 +661,7 @@ private:
     ASS(n > 0);
     ASS(n <= _cend);
 
-    for (int i = 0;i < _cend-n;i++) {
-      _chars[i] = _chars[n+i];
-    }
+    std::memmove(&_chars[0], &_chars[n], _cend - n);
     _cend -= n;
   } // shiftChars
 
@@ -742,6 +744,8 @@ private:
   Literal* createEquality(bool polarity,TermList& lhs,TermList& rhs);
   Formula* createPredicateApplication(std::string name,unsigned arity);
   TermList createFunctionApplication(std::string name,unsigned arity);
+  static Term* createCheckedTerm(unsigned fun, unsigned arity, TermList* args);
+  static Literal* createCheckedLiteral(unsigned pred, unsigned arity, TermList* args);
   TermList createTypeConApplication(std::string name,unsigned arity);
   void insertImplicitLetTypeArguments(const LetSymbolReference& ref, unsigned& arity);
   void endEquality();
@@ -0,0 +1,60 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file PortfolioSATSolver.cpp
+ * Implements class PortfolioSATSolver.
+ */
+
+#include "Lib/Environment.hpp"
+#include "Shell/Statistics.hpp"
+
+#include "PortfolioSATSolver.hpp"
+
+namespace SAT
+{
+
+Status PortfolioSATSolver::solveUnderAssumptionsLimited(const SATLiteralStack& assumps, unsigned conflictCountLimit)
+{
+  // propagation alone is not worth sharing out
+  if(conflictCountLimit == 0){
+    return _solvers[_answered]->solveUnderAssumptionsLimited(assumps, 0);
+  }
+
+  bool unlimited = conflictCountLimit == UINT_MAX;
+  unsigned first = _answered;
+  unsigned budget = INITIAL_BUDGET;
+  unsigned spent = 0;
+  for(;;){
+    for(unsigned i = 0; i < 2; i++){
+      unsigned idx = first ^ i;
+      unsigned slice = unlimited ? budget : std::min(budget, conflictCountLimit - spent);
+      Status status = _solvers[idx]->solveUnderAssumptionsLimited(assumps, slice);
+      if(status != Status::UNKNOWN){
+        if(idx != first){
+          env.statistics->satPortfolioSwitches++;
+        }
+        _answered = idx;
+        return status;
+      }
+      if(!unlimited){
+        spent += slice;
+        if(spent == conflictCountLimit){
+          return Status::UNKNOWN;
+        }
+      }
+    }
+    // stays well below UINT_MAX, which the solvers read as no limit
+    if(budget < (1u << 30)){
+      budget *= 2;
+    }
+  }
+}
+
+}
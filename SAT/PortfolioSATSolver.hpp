@@ -0,0 +1,101 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file PortfolioSATSolver.hpp
+ * Defines class PortfolioSATSolver.
+ *
+ * Two solvers receive the same clauses and take turns on each solving call,
+ * each for a conflict budget that doubles every round, until one of them
+ * answers. Solvers that are good on different kinds of instances thus
+ * cost at most about twice the better of the two. The answering solver
+ * is asked first on the next call and serves all queries about the result.
+ */
+
+#ifndef __PortfolioSATSolver__
+#define __PortfolioSATSolver__
+
+#include "Forwards.hpp"
+
+#include "Lib/ScopedPtr.hpp"
+
+#include "SATSolver.hpp"
+
+namespace SAT {
+
+using namespace Lib;
+
+class PortfolioSATSolver : public SATSolver {
+public:
+  PortfolioSATSolver(SATSolver* first, SATSolver* second)
+  {
+    _solvers[0] = first;
+    _solvers[1] = second;
+  }
+
+  void randomizeForNextAssignment(unsigned maxVar) override {
+    _solvers[0]->randomizeForNextAssignment(maxVar);
+    _solvers[1]->randomizeForNextAssignment(maxVar);
+  }
+
+  void addClause(SATClause* cl) override {
+    _solvers[0]->addClause(cl);
+    _solvers[1]->addClause(cl);
+  }
+
+  VarAssignment getAssignment(unsigned var) override {
+    ASS_G(var,0); ASS_LE(var,_varCnt);
+    return _solvers[_answered]->getAssignment(var);
+  }
+
+  bool isZeroImplied(unsigned var) override {
+    ASS_G(var,0); ASS_LE(var,_varCnt);
+    return _solvers[_answered]->isZeroImplied(var);
+  }
+
+  void ensureVarCount(unsigned newVarCnt) override {
+    _solvers[0]->ensureVarCount(newVarCnt);
+    _solvers[1]->ensureVarCount(newVarCnt);
+    _varCnt=std::max(_varCnt,newVarCnt);
+  }
+
+  unsigned newVar() override {
+    ALWAYS(_solvers[0]->newVar() == ++_varCnt);
+    ALWAYS(_solvers[1]->newVar() == _varCnt);
+    return _varCnt;
+  }
+
+  void suggestPolarity(unsigned var,unsigned pol) override {
+    _solvers[0]->suggestPolarity(var,pol);
+    _solvers[1]->suggestPolarity(var,pol);
+  }
+
+  Status solveUnderAssumptionsLimited(const SATLiteralStack& assumps, unsigned conflictCountLimit) override;
+
+  SATLiteralStack failedAssumptions() override {
+    return _solvers[_answered]->failedAssumptions();
+  }
+
+  SATClauseList *minimizePremises(SATClauseList *premises) override {
+    return _solvers[_answered]->minimizePremises(premises);
+  }
+private:
+  /** conflicts granted to each solver in the first round of a call */
+  static const unsigned INITIAL_BUDGET = 256;
+
+  ScopedPtr<SATSolver> _solvers[2];
+
+  /** index of the solver that produced the last result */
+  unsigned _answered = 0;
+  unsigned _varCnt = 0;
+};
+
+}
+
+#endif // __PortfolioSATSolver__
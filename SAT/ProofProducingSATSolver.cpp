@@ -15,6 +15,7 @@
 namespace SAT {
 
 SATClause *ProofProducingSATSolver::proof() {
+  ASS(_trackPremises)
 #if VDEBUG
   for(SATClause *cl : iterTraits(_addedClauses->iter()))
     // should not be an empty clause in the input (?)
@@ -24,17 +24,22 @@ namespace SAT {
  * SAT solvers do not in general "remember" what they are given
  * and do not report this in e.g. DRAT proofs, so we have to remember ourselves.
  * This is actually a good thing, as we want to remember how we derived a certain clause ourselves.
+ *
+ * Callers that only need the verdict can switch the tracking off,
+ * after which no premises or proofs can be asked for.
  */
 class ProofProducingSATSolver final : public SATSolver {
 public:
   ProofProducingSATSolver() = default;
-  explicit ProofProducingSATSolver(SATSolver *inner) :
+  explicit ProofProducingSATSolver(SATSolver *inner, bool trackPremises = true) :
     _inner(inner),
+    _trackPremises(trackPremises),
     _addedClauses(nullptr) {}
 
   void addClause(SATClause* cl) override
   {
-    SATClauseList::push(cl,_addedClauses);
+    if(_trackPremises)
+      SATClauseList::push(cl,_addedClauses);
     _inner->addClause(cl);
   }
 
@@ -75,15 +80,17 @@ public:
     return _inner->minimizePremises(premises);
   }
 
+  bool tracksPremises() const { return _trackPremises; }
+
   // all premises ever added
-  SATClauseList *premiseList() const { return _addedClauses; }
+  SATClauseList *premiseList() const { ASS(_trackPremises) return _addedClauses; }
 
   /*
    * Returns only those premises required to get unsat from the last solve() call.
    * This may be a superset of those actually necessary depending on
    * how well the minimisation process goes.
    */
-  SATClauseList *minimizedPremises() { return _inner->minimizePremises(_addedClauses); }
+  SATClauseList *minimizedPremises() { ASS(_trackPremises) return _inner->minimizePremises(_addedClauses); }
 
   /*
    * run CaDiCaL on `premiseList` to get a DRAT proof
@@ -93,6 +100,8 @@ public:
 private:
   ScopedPtr<SATSolver> _inner;
 
+  bool _trackPremises = true;
+
   // to be used for the premises of a refutation
   SATClauseList* _addedClauses = nullptr;
 };
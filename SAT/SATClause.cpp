@@ -51,7 +51,7 @@ void* SATClause::operator new(size_t sz,unsigned lits)
   if (lits > 0)
     size-=sizeof(SATLiteral);
 
-  return ALLOC_KNOWN(size,"SATClause");
+  return ALLOC_ACCOUNTED(size, SAT);
 }
 
 void SATClause::operator delete(void *ptr, size_t sz) {
@@ -60,7 +60,7 @@ void SATClause::operator delete(void *ptr, size_t sz) {
   if(self->_length > 0)
     size -= sizeof(SATLiteral);
 
-  DEALLOC_KNOWN(ptr, size, "SATClause");
+  DEALLOC_ACCOUNTED(ptr, size, SAT);
 }
 
 SATClause::SATClause(unsigned length)
@@ -108,7 +108,7 @@ void SATClause::destroy()
   // call a destructor of the clause object (will destroy _literals[0])
   this->~SATClause();
     
-  DEALLOC_KNOWN(this, size,"SATClause");
+  DEALLOC_ACCOUNTED(this, size, SAT);
 } // SATClause::destroy
 
 
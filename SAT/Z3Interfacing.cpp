@@ -874,6 +874,9 @@ void Z3Interfacing::z3_set_param(const char* k, Value const& v)
   _solver.set(k, v);
 }
 
+void Z3Interfacing::setTimeout(unsigned ms)
+{ z3_set_param("timeout", ms); }
+
 char const* Z3Interfacing::z3_full_version()
 {
   return Z3_get_full_version();
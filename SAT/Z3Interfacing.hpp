@@ -177,6 +177,9 @@ public:
 
   static char const* z3_full_version();
 
+  /** Make each check give up with UNKNOWN after @b ms milliseconds */
+  void setTimeout(unsigned ms);
+
   void addClause(SATClause* cl) override;
 
   /**
@@ -185,6 +185,50 @@ void SATSubsumptionAndResolution::loadProblem(Clause* sidePremise,
   _bindingsManager.clear();
 } // SATSubsumptionAndResolution::loadProblem
 
+/**
+ * @brief Fill the tables of the predicates in _mainPremise used by the pruning,
+ * unless they are filled for it already.
+ *
+ * In forward simplification, the main premise is the same for all the
+ * candidate side premises, so the tables are filled once for all of them
+ * and each check only walks over the side premise.
+ */
+void SATSubsumptionAndResolution::prepareMainPremisePruning()
+{
+  ASS(_mainPremise)
+
+  // the tables grow with the signature, new symbols do not occur in the main premise
+  _pruneMainHeaders.resize(2 * env.signature->predicates(), 0);
+  _pruneSideHeaders.resize(2 * env.signature->predicates(), 0);
+  _pruneMainFunctors.resize(env.signature->predicates(), 0);
+
+  if (_mainPremise->number() == _pruneMainNumber) {
+    return;
+  }
+  _pruneMainNumber = _mainPremise->number();
+
+  // entries of the header table are counts above _pruneMainZero, entries of the
+  // functor table are set when equal to _pruneMainTop
+  if (isAdditionOverflow<prune_t>(_pruneMainTop, _mainPremise->length() + 1)) {
+    std::fill(_pruneMainHeaders.begin(), _pruneMainHeaders.end(), 0);
+    std::fill(_pruneMainFunctors.begin(), _pruneMainFunctors.end(), 0);
+    _pruneMainTop = 0;
+  }
+  _pruneMainZero = _pruneMainTop;
+  _pruneMainTop += _mainPremise->length() + 1;
+
+  // fill in the multiset of signed predicates of M and the set of its predicates
+  // (and sum up the weight of M on the way, see pruneSubsumption)
+  _pruneMainWeight = 0;
+  for (unsigned i = 0; i < _mainPremise->length(); i++) {
+    Literal* const lit = (*_mainPremise)[i];
+    unsigned const hdr = lit->header();
+    _pruneMainHeaders[hdr] = std::max(_pruneMainHeaders[hdr], _pruneMainZero) + 1;
+    _pruneMainFunctors[lit->functor()] = _pruneMainTop;
+    _pruneMainWeight += lit->weight();
+  }
+} // SATSubsumptionAndResolution::prepareMainPremisePruning
+
 /**
  * @brief Heuristically determine whether it is impossible to find a subsumption
  * between _sidePremise and _mainPremise.
@@ -206,44 +250,42 @@ bool SATSubsumptionAndResolution::pruneSubsumption()
     return true;
   }
 
-  auto& headerMultiset = _pruneStorage;
-  prune_t& timestamp = _pruneTimestamp;
-  static_assert(
-    std::is_same<std::remove_reference_t<decltype(timestamp)>,
-    std::remove_reference_t<decltype(headerMultiset)>::value_type>::value,
-    "timestamp and storage should be the same type");
-
-  // multiset of signed predicates in M
-  headerMultiset.resize(2 * env.signature->predicates(), 0);
-  ASS(std::all_of(headerMultiset.begin(), headerMultiset.end(), [&](prune_t x) { return x <= timestamp; }))
-
-  // Our relative zero for counting is the timestamp.
-  // We need to reset the vector only if the counts could overflow.
-  if (isAdditionOverflow<prune_t>(timestamp, _mainPremise->length())) {
-    // when timestamp wraps around, we reset the vector to 0.
-    std::fill(headerMultiset.begin(), headerMultiset.end(), 0);
+  prepareMainPremisePruning();
+
+  // the literals of L seen so far with each header, as counts above a zero
+  // that moves on with every check
+  auto& sideHeaders = _pruneSideHeaders;
+  prune_t& timestamp = _pruneSideTimestamp;
+  if (isAdditionOverflow<prune_t>(timestamp, _sidePremise->length())) {
+    std::fill(sideHeaders.begin(), sideHeaders.end(), 0);
     timestamp = 0;
   }
-
   prune_t const zero = timestamp;
-  timestamp += _mainPremise->length();
-  ASS(std::all_of(headerMultiset.begin(), headerMultiset.end(), [&](prune_t x) { return x <= zero; }))
-
-  // fill in the multiset of functors in M
-  for (unsigned i = 0; i < _mainPremise->length(); i++) {
-    unsigned const hdr = (*_mainPremise)[i]->header();
-    headerMultiset[hdr] = std::max(headerMultiset[hdr], zero) + 1;
-  }
+  timestamp += _sidePremise->length();
+  ASS(std::all_of(sideHeaders.begin(), sideHeaders.end(), [&](prune_t x) { return x <= zero; }))
 
   // check if the multiset of functors in L is a subset of the multiset of functors in M
+  unsigned sideWeight = 0;
   for (unsigned j = 0; j < _sidePremise->length(); j++) {
-    unsigned const hdr = (*_sidePremise)[j]->header();
-    // we need to do the check before decrementing to avoid wraparound and keep the invariant valid
-    if (headerMultiset[hdr] <= zero) {
+    Literal* const lit = (*_sidePremise)[j];
+    unsigned const hdr = lit->header();
+    prune_t const used = std::max(sideHeaders[hdr], zero) - zero;
+    prune_t const available = std::max(_pruneMainHeaders[hdr], _pruneMainZero) - _pruneMainZero;
+    if (used == available) {
       _subsumptionImpossible = true;
       return true;
     }
-    headerMultiset[hdr]--;
+    sideHeaders[hdr] = zero + used + 1;
+    sideWeight += lit->weight();
+  }
+
+  // A substitution never decreases the weight of a literal, so if σ(L) is a
+  // sub-multiset of M, the weight of L cannot exceed the weight of M.
+  // (The weights are summed here rather than taken from Clause::weight(),
+  // which caches its value and must not be called before the splits are set.)
+  if (sideWeight > _pruneMainWeight) {
+    _subsumptionImpossible = true;
+    return true;
   }
 
   // WARNING !!!
@@ -266,9 +308,6 @@ bool SATSubsumptionAndResolution::pruneSubsumption()
  * set of predicates in _mainPremise. If it is not, then it is impossible to find a
  * subsumption resolution.
  *
- * TODO: functorSet is initialized from _mainPremise which is the same for the whole forward loop.
- *       we could re-use it for multiple pruning checks instead of filling it every time.
- *
  * @return true if subsumption resolution is impossible, false if we don't know
  */
 bool SATSubsumptionAndResolution::pruneSubsumptionResolution()
@@ -276,25 +315,10 @@ bool SATSubsumptionAndResolution::pruneSubsumptionResolution()
   ASS(_sidePremise)
   ASS(_mainPremise)
 
-  auto& functorSet = _pruneStorage;
-  auto& timestamp = _pruneTimestamp;
-
-  functorSet.resize(env.signature->predicates(), 0);
-  ASS(std::all_of(functorSet.begin(), functorSet.end(), [&](prune_t x) { return x <= timestamp; }))
-
-  timestamp++;
-  if (timestamp == 0) {
-    // when timestamp wraps around, we reset the vector to 0 and increment again.
-    timestamp++;
-    std::fill(functorSet.begin(), functorSet.end(), 0);
-  }
-  ASS(std::all_of(functorSet.begin(), functorSet.end(), [&](prune_t x) { return x < timestamp; }));
-
-  for (unsigned i = 0; i < _mainPremise->length(); i++)
-    functorSet[(*_mainPremise)[i]->functor()] = timestamp;
+  prepareMainPremisePruning();
 
   for (unsigned j = 0; j < _sidePremise->length(); j++)
-    if (functorSet[(*_sidePremise)[j]->functor()] != timestamp)
+    if (_pruneMainFunctors[(*_sidePremise)[j]->functor()] != _pruneMainTop)
       return true;
 
   return false;
@@ -320,6 +344,66 @@ void SATSubsumptionAndResolution::addBinding(BindingsManager::Binder* binder,
     _bindingsManager.commit_bindings(*binder, satVar);
 } // SATSubsumptionAndResolution::addBinding
 
+/**
+ * @brief Pack the top symbols of the first four arguments of @b lit into 16-bit lanes.
+ *
+ * A lane is 0 for a variable (and for a special term, if @b pattern) and a
+ * hash of the functor otherwise. An argument of a pattern can only match an
+ * argument of an instance if its lane is 0 or equal to the lane of the
+ * instance; see argumentsMayMatch.
+ */
+static uint64_t argumentSignature(Literal* lit, bool pattern)
+{
+  uint64_t sig = 0;
+  unsigned args = std::min(lit->arity(), 4u);
+  for (unsigned k = 0; k < args; k++) {
+    TermList arg = *lit->nthArgument(k);
+    if (arg.isVar() || (pattern && arg.term()->isSpecial())) {
+      continue;
+    }
+    sig |= uint64_t(arg.term()->functor() % 0xFFFF + 1) << (16 * k);
+  }
+  return sig;
+}
+
+/** The signature of an equality with its two arguments swapped */
+static uint64_t reversedSignature(uint64_t sig)
+{
+  return ((sig & 0xFFFF) << 16) | ((sig >> 16) & 0xFFFF);
+}
+
+/**
+ * @brief False if the arguments of a pattern literal with signature @b pattern
+ * cannot match those of an instance literal with signature @b instance.
+ *
+ * Checks all four lanes at once: it fails when some lane is non-zero in the
+ * pattern and differs in the instance.
+ */
+static bool argumentsMayMatch(uint64_t pattern, uint64_t instance)
+{
+  constexpr uint64_t low = 0x7FFF7FFF7FFF7FFFull;
+  constexpr uint64_t high = ~low;
+  // the high bit of each lane of x that is not 0
+  auto nonZeroLanes = [](uint64_t x) { return (((x & low) + low) | x) & high; };
+  return !(nonZeroLanes(pattern) & nonZeroLanes(pattern ^ instance));
+}
+
+/**
+ * @brief Fill the argument signatures of the literals of both premises,
+ * used by checkAndAddMatch to skip the pairs that cannot match.
+ */
+void SATSubsumptionAndResolution::fillArgumentSignatures()
+{
+  _sideSignatures.resize(_m);
+  for (unsigned i = 0; i < _m; ++i) {
+    _sideSignatures[i] = argumentSignature((*_sidePremise)[i], true);
+  }
+  _mainSignatures.resize(_n);
+  for (unsigned j = 0; j < _n; ++j) {
+    _mainSignatures[j] = argumentSignature((*_mainPremise)[j], false);
+  }
+}
+
 bool SATSubsumptionAndResolution::checkAndAddMatch(Literal* l_i,
                                                    Literal* m_j,
                                                    unsigned i,
@@ -334,14 +418,14 @@ bool SATSubsumptionAndResolution::checkAndAddMatch(Literal* l_i,
   ASS_EQ(l_i->polarity() == m_j->polarity(), polarity)
 
   bool match = false;
-  {
+  if (argumentsMayMatch(_sideSignatures[i], _mainSignatures[j])) {
     auto binder = _bindingsManager.start_binder();
     if (MatchingUtils::matchArgs(l_i, m_j, binder)) {
       addBinding(&binder, i, j, polarity, false);
       match = true;
     }
   }
-  if (l_i->isEquality()) {
+  if (l_i->isEquality() && argumentsMayMatch(reversedSignature(_sideSignatures[i]), _mainSignatures[j])) {
     auto binder = _bindingsManager.start_binder();
     if (MatchingUtils::matchReversedArgs(l_i, m_j, binder)) {
       addBinding(&binder, i, j, polarity, false);
@@ -360,6 +444,8 @@ bool SATSubsumptionAndResolution::fillMatchesS()
   ASS_EQ(_matchSet._m, _m)
   ASS_EQ(_matchSet._n, _n)
 
+  fillArgumentSignatures();
+
   Literal* l_i, * m_j;
 
   // number of matches found is equal to the number of variables in the SAT solver
@@ -402,6 +488,8 @@ void SATSubsumptionAndResolution::fillMatchesSR(unsigned litToRemove)
   ASS_EQ(_matchSet._m, _m)
   ASS_EQ(_matchSet._n, _n)
 
+  fillArgumentSignatures();
+
   // stores whether on all the literals in L there is a negative match in M
   bool clauseHasNegativeMatch = false;
 
@@ -508,7 +596,17 @@ bool SATSubsumptionAndResolution::cnfForSubsumption()
   // NOTE: instance constraints cannot be packed densely because we only know their shape at the end.
   // uint32_t const instance_constraint_maxsize = 2 * base_len;
   // ⋀ⱼ AMO({b⁺ᵢⱼ ∣ i ∈ {1,...,m}})
+  // Most mⱼ have at most one positive match, their constraint is a tautology
+  // and is not built at all, which keeps the solver setup proportional to
+  // the pairs that can actually conflict.
   for (unsigned j = 0; j < _n; ++j) {
+    unsigned positiveMatches = 0;
+    for (Match match : _matchSet.getJMatches(j)) {
+      positiveMatches += match.polarity;
+    }
+    if (positiveMatches < 2) {
+      continue;
+    }
     solver.constraint_start();
     for (Match match : _matchSet.getJMatches(j)) {
       if (match.polarity) {
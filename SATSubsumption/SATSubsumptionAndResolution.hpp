@@ -14,6 +14,7 @@
 #ifndef SAT_SUBSUMPTION_RESOLUTION_HPP
 #define SAT_SUBSUMPTION_RESOLUTION_HPP
 
+#include <climits>
 #include <cstdint>
 
 #include "Kernel/Clause.hpp"
@@ -321,11 +322,28 @@ private:
   /// remembers if the fillMatchesSR concluded that subsumption resolution is impossible
   bool _srImpossible;
 
-  /// @brief temporary storage, used by pruneSubsumption and pruneSubsumptionResolution
-  /// invariant: for all x in _tmpStorage, x <= _tmpTimestamp
+  /// @brief tables of the predicates of the main premise, used by pruneSubsumption and
+  /// pruneSubsumptionResolution and filled by prepareMainPremisePruning
   using prune_t = unsigned;
-  std::vector<prune_t> _pruneStorage;
-  prune_t _pruneTimestamp = 0;
+  /// @brief number of the main premise the tables are filled for
+  unsigned _pruneMainNumber = UINT_MAX;
+  /// @brief literals of the main premise by header, as counts above _pruneMainZero
+  /// invariant: for all x in _pruneMainHeaders, x <= _pruneMainTop
+  std::vector<prune_t> _pruneMainHeaders;
+  /// @brief predicates of the main premise, marked by the value _pruneMainTop
+  std::vector<prune_t> _pruneMainFunctors;
+  prune_t _pruneMainZero = 0;
+  prune_t _pruneMainTop = 0;
+  /// @brief weight of the literals of the main premise
+  unsigned _pruneMainWeight = 0;
+  /// @brief top symbols of the arguments of the literals of the side and main premise,
+  /// by literal index, filled by fillArgumentSignatures
+  std::vector<uint64_t> _sideSignatures;
+  std::vector<uint64_t> _mainSignatures;
+  /// @brief literals of the side premise by header, counted by pruneSubsumption
+  /// invariant: for all x in _pruneSideHeaders, x <= _pruneSideTimestamp
+  std::vector<prune_t> _pruneSideHeaders;
+  prune_t _pruneSideTimestamp = 0;
 
   /* Methods */
   /**
@@ -345,6 +363,12 @@ private:
    */
   bool pruneSubsumption();
 
+  /**
+   * Fills the tables of the main premise used by the pruning methods,
+   * unless they are filled for the current main premise already
+   */
+  void prepareMainPremisePruning();
+
   /**
    * Heuristically predicts whether subsumption resolution will fail.
    * This method should be fast
@@ -425,6 +449,12 @@ private:
    */
   bool fillMatchesS();
 
+  /**
+   * Fills the argument signatures of the literals of sidePremise and mainPremise,
+   * which rule out most of the pairs that cannot match before the matching
+   */
+  void fillArgumentSignatures();
+
   /**
    * Fills the match set and the bindings manager with all the possible positive and negative bindings between the literals of sidePremise and mainPremise.
    * If the argument litToRemove is set, it will not consider negative matches for the literals other than the one at index litToRemove.
@@ -307,10 +307,22 @@ struct Watch final {
     : clause_ref{cr}
   { }
 
-  // TODO: optimizations: blocking literal, virtual binary clauses
+#if SUBSAT_BLOCKING
+  constexpr Watch(ConstraintRef cr, Lit blocking) noexcept
+    : clause_ref{cr}
+    , blocking_lit{blocking}
+  { }
+#endif
+
+  // TODO: optimizations: virtual binary clauses
   //       (although kitten doesn't seem to do either of those)
   //       (note that neither of those will change setup costs since we already defer watchlist construction until solving starts)
   ConstraintRef clause_ref;
+#if SUBSAT_BLOCKING
+  /// A literal of the clause; if it is true, the clause is satisfied and the watch can be skipped.
+  /// Invalid in the watches of AtMostOne constraints.
+  Lit blocking_lit = Lit::invalid();
+#endif
 };
 static_assert(std::is_trivially_destructible<Watch>::value, "");
 
@@ -1560,7 +1572,11 @@ private:
       // ... (current code here)
       // }
 
-      // TODO: blocking literal optimization
+#if SUBSAT_BLOCKING
+      if (m_values[watch.blocking_lit] == Value::True) {
+        continue;
+      }
+#endif
 
       ConstraintRef const clause_ref = watch.clause_ref;
       Constraint& clause = m_constraints.deref(clause_ref);
@@ -1581,7 +1597,9 @@ private:
       // Note that other_lit may be different from the blocking literal,
       // so we must check its value here.
       if (other_value == Value::True) {
-        // TODO: update blocking literal to other_lit
+#if SUBSAT_BLOCKING
+        (q - 1)->blocking_lit = other_lit;
+#endif
         continue;
       }
 
@@ -1605,7 +1623,9 @@ private:
       if (replacement_value == Value::True) {
         // The replacement literal is true, so it's enough to update the blocking literal.
         // Since we entered this clause, this means the current blocking literal is not true, so this update is always beneficial.
-        // TODO: update blocking literal to replacement
+#if SUBSAT_BLOCKING
+        (q - 1)->blocking_lit = replacement;
+#endif
         // Since the 'replacement' is true, the clause is only relevant when 'replacement' is unassigned.
         // So if it was assigned in an earlier decision level, that is actually good.
       }
@@ -1617,7 +1637,7 @@ private:
         clause[1] = replacement;
         *replacement_it = not_lit;
         // Watch the replacement literal
-        watch_clause_literal(replacement, /* TODO: other_lit, */ clause_ref);
+        watch_clause_literal(replacement, other_lit, clause_ref);
         ticks++;
       }
       else if (other_value != Value::Unassigned) {
@@ -1671,12 +1691,17 @@ private:
 
 
   /// Watch literal 'lit' in the given clause.
-  void watch_clause_literal(Lit lit, /* TODO: Lit blocking_lit, */ ConstraintRef clause_ref)
+  void watch_clause_literal(Lit lit, Lit blocking_lit, ConstraintRef clause_ref)
   {
-    LOG_DEBUG("Watching " << lit << /* " blocked by " << blocking_lit << */ " in " << SHOWREF(clause_ref));
+    LOG_DEBUG("Watching " << lit << " blocked by " << blocking_lit << " in " << SHOWREF(clause_ref));
     auto& watches = m_watches[lit];
     ASS(std::all_of(watches.cbegin(), watches.cend(), [=](Watch w){ return w.clause_ref != clause_ref; }));
+#if SUBSAT_BLOCKING
+    watches.push_back(Watch{clause_ref, blocking_lit});
+#else
+    (void)blocking_lit;
     watches.push_back(Watch{clause_ref});
+#endif
   }
 
 
@@ -1685,8 +1710,8 @@ private:
   {
     Constraint const& clause = m_constraints.deref(clause_ref);
     ASS(clause.size() >= 2);
-    watch_clause_literal(clause[0], /* TODO: clause[1], */ clause_ref);
-    watch_clause_literal(clause[1], /* TODO: clause[0], */ clause_ref);
+    watch_clause_literal(clause[0], clause[1], clause_ref);
+    watch_clause_literal(clause[1], clause[0], clause_ref);
   }
 
 
@@ -68,11 +68,10 @@ static_assert(VDEBUG == 1, "VDEBUG and NDEBUG are not synchronized");
 
 // Blocking literal optimization
 // Stores the other watched literal in the watch lists, saves some dereferencing during solving at the cost of increased watch size.
+// The watches of a clause whose blocking literal is true are skipped without touching the clause,
+// which are most of them for the many short clauses of subsumption resolution instances.
 #ifndef SUBSAT_BLOCKING
-#define SUBSAT_BLOCKING 0
-#endif
-#if SUBSAT_BLOCKING
-#error "SUBSAT_BLOCKING not yet implemented"
+#define SUBSAT_BLOCKING 1
 #endif
 
 // Binary clauses are 'virtual', meaning they're embedded in the watchlists and not stored at all outside.
@@ -13,6 +13,9 @@
  * @since 30/12/2007 Manchester
  */
 
+#include <cstring>
+#include <iterator>
+
 #include "Debug/RuntimeStatistics.hpp"
 
 #include "Lib/Environment.hpp"
@@ -20,6 +23,7 @@
 #include "Lib/Random.hpp"
 #include "Kernel/Term.hpp"
 #include "Kernel/Clause.hpp"
+#include "Lib/SharedSet.hpp"
 #include "Shell/Statistics.hpp"
 #include "Shell/Options.hpp"
 
@@ -36,19 +40,7 @@ using namespace Lib;
 using namespace Kernel;
 
 /**
- * Weight comparison of clauses.
- * @return the result of comparison (LESS, EQUAL or GREATER)
- * @warning if the option increased_numeral_weight is on, then each comparison
- *          recomputes the numeral weight of clauses, see Clause::getNumeralWeight(), so it
- *          it can be expensive
- */
-static Comparison compareWeight(Clause* cl1, Clause* cl2, const Options& opt)
-{
-  return Int::compare(cl1->weightForClauseSelection(opt), cl2->weightForClauseSelection(opt));
-}
-
-/**
- * Comparison of clauses. The comparison uses four orders in the
+ * Key of a clause in the age queue. The comparison uses four orders in the
  * following order:
  * <ol><li>by age;</li>
  *     <li>by weight;</li>
@@ -57,29 +49,10 @@ static Comparison compareWeight(Clause* cl1, Clause* cl2, const Options& opt)
  * </ol>
  * @since 30/12/2007 Manchester
  */
-bool AgeQueue::lessThan(Clause* c1,Clause* c2)
+ClauseQueue::Key AgeQueue::key(Clause* cl)
 {
-  if (c1->age() < c2->age()) {
-    return true;
-  }
-  if (c2->age() < c1->age()) {
-    return false;
-  }
-
-  Comparison weightCmp=compareWeight(c1, c2, _opt);
-  if (weightCmp!=EQUAL) {
-    return weightCmp==LESS;
-  }
-
-  if (c1->inputType() < c2->inputType()) {
-    return false;
-  }
-  if (c2->inputType() < c1->inputType()) {
-    return true;
-  }
-
-  return c1->number() < c2->number();
-} // AgeQueue::lessThan
+  return makeKey(cl->age(), cl->weightForClauseSelection(_opt), cl);
+} // AgeQueue::key
 
 AgeQueue::OrdVal AgeQueue::getOrdVal(Clause* cl) const
 {
@@ -87,8 +60,8 @@ AgeQueue::OrdVal AgeQueue::getOrdVal(Clause* cl) const
 }
 
 /**
- * Comparison of clauses. The comparison uses four orders in the
- * following order:
+ * Key of a clause in the weight queue. The comparison uses four orders in
+ * the following order:
  * <ol><li>by weight;</li>
  *     <li>by age;</li>
  *     <li>by input type;</li>
@@ -96,27 +69,10 @@ AgeQueue::OrdVal AgeQueue::getOrdVal(Clause* cl) const
  * </ol>
  * @since 30/12/2007 Manchester
  */
-bool WeightQueue::lessThan(Clause* c1,Clause* c2)
+ClauseQueue::Key WeightQueue::key(Clause* cl)
 {
-  Comparison weightCmp=compareWeight(c1, c2, _opt);
-  if (weightCmp!=EQUAL) {
-    return weightCmp==LESS;
-  }
-
-  if (c1->age() < c2->age()) {
-    return true;
-  }
-  if (c2->age() < c1->age()) {
-    return false;
-  }
-  if (c1->inputType() < c2->inputType()) {
-    return false;
-  }
-  if (c2->inputType() < c1->inputType()) {
-    return true;
-  }
-  return c1->number() < c2->number();
-} // WeightQueue::lessThan
+  return makeKey(cl->weightForClauseSelection(_opt), cl->age(), cl);
+} // WeightQueue::key
 
 WeightQueue::OrdVal WeightQueue::getOrdVal(Clause* cl) const
 {
@@ -124,6 +80,52 @@ WeightQueue::OrdVal WeightQueue::getOrdVal(Clause* cl) const
 }
 
 
+ScoreQueue::ScoreQueue(const Options& opt)
+  : _opt(opt), _coefficients(opt.clauseScoreCoefficients())
+{
+}
+
+/**
+ * The linear score of @b cl over the features weight, age, length,
+ * positive literals, splits and derivation from the goal.
+ */
+float ScoreQueue::score(Clause* cl) const
+{
+  const Inference& inf = cl->inference();
+  float features[] = {
+    float(cl->weightForClauseSelection(_opt)),
+    float(inf.age()),
+    float(cl->length()),
+    float(cl->numPositiveLiterals()),
+    float(inf.splits() ? inf.splits()->size() : 0),
+    float(inf.derivedFromGoal()),
+  };
+  float res = 0;
+  for (unsigned i = 0; i < std::size(features); i++) {
+    res += _coefficients[i] * features[i];
+  }
+  return res;
+}
+
+ScoreQueue::OrdVal ScoreQueue::getOrdVal(Clause* cl) const
+{
+  return std::make_pair(score(cl),cl->age());
+}
+
+/**
+ * Key of a clause in the score queue: by score, then by age, by input
+ * type and by number.
+ */
+ClauseQueue::Key ScoreQueue::key(Clause* cl)
+{
+  // order-preserving map of the float to an unsigned
+  float s = score(cl);
+  unsigned bits;
+  std::memcpy(&bits, &s, sizeof(bits));
+  bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+  return makeKey(bits, cl->age(), cl);
+} // ScoreQueue::key
+
 AWPassiveClauseContainer::AWPassiveClauseContainer(bool isOutermost, const Shell::Options& opt, std::string name) :
   PassiveClauseContainer(isOutermost, opt, name),
   _ageQueue(opt),
@@ -17,6 +17,8 @@
 #define __AWPassiveClauseContainers__
 
 #include <climits>
+#include <limits>
+#include <vector>
 #include "Kernel/Clause.hpp"
 #include "Kernel/Term.hpp"
 #include "Kernel/ClauseQueue.hpp"
@@ -37,7 +39,7 @@ public:
   static constexpr OrdVal maxOrdVal = std::make_pair(UINT_MAX,UINT_MAX);
   OrdVal getOrdVal(Clause* cl) const;
 protected:
-  bool lessThan(Clause*,Clause*) override;
+  Key key(Clause*) override;
 private:
   const Shell::Options& _opt;
 };
@@ -52,11 +54,33 @@ public:
   static constexpr OrdVal maxOrdVal = std::make_pair(UINT_MAX,UINT_MAX);
   OrdVal getOrdVal(Clause* cl) const;
 protected:
-  bool lessThan(Clause*,Clause*) override;
+  Key key(Clause*) override;
 private:
   const Shell::Options& _opt;
 };
 
+/**
+ * Queue ordered by a linear score of clause features, smallest first,
+ * with ties broken by age.
+ */
+class ScoreQueue
+  : public ClauseQueue
+{
+public:
+  ScoreQueue(const Options& opt);
+
+  typedef std::pair<float,unsigned> OrdVal;
+  static constexpr OrdVal maxOrdVal = std::make_pair(std::numeric_limits<float>::max(),UINT_MAX);
+  OrdVal getOrdVal(Clause* cl) const;
+  float score(Clause* cl) const;
+protected:
+  Key key(Clause*) override;
+private:
+  const Shell::Options& _opt;
+  /** coefficients of the features, see Options::clauseScoreCoefficients() */
+  std::vector<float> _coefficients;
+};
+
 class AgeBasedPassiveClauseContainer
 : public SingleQueuePassiveClauseContainer<AgeQueue>
 {
@@ -147,6 +171,19 @@ public:
   }
 };
 
+/**
+ * Passive container selecting clauses by the score given by the option
+ * clause_score_coefficients. The score is computed once, when a clause is
+ * inserted, and kept in its queue node.
+ */
+class ScoreBasedPassiveClauseContainer
+: public SingleQueuePassiveClauseContainer<ScoreQueue>
+{
+public:
+  ScoreBasedPassiveClauseContainer(bool isOutermost, const Shell::Options& opt, std::string name)
+    : SingleQueuePassiveClauseContainer<ScoreQueue>(isOutermost,opt,name) {}
+};
+
 /**
  * Defines the class Passive of passive clauses
  * @since 31/12/2007 Manchester
@@ -12,8 +12,6 @@
  * Implementing ClauseContainer and its descendants.
  */
 
-#include "Debug/RuntimeStatistics.hpp"
-
 #include "Lib/Environment.hpp"
 #include "Lib/Stack.hpp"
 #include "Shell/Statistics.hpp"
@@ -57,7 +55,12 @@ Clause* UnprocessedClauseContainer::pop()
   return res;
 }
 
-void PassiveClauseContainer::updateLimits(long long estReachableCnt)
+/**
+ * Set the limits so that only the @b estReachableCnt clauses selected first are
+ * kept. Clauses already in passive that exceed them are removed if @b retroactive
+ * or the lrs_retroactive_deletes option is set.
+ */
+void PassiveClauseContainer::updateLimits(long long estReachableCnt, bool retroactive)
 {
   ASS_GE(estReachableCnt,0);
 
@@ -80,7 +83,7 @@ void PassiveClauseContainer::updateLimits(long long estReachableCnt)
   bool atLeastOneLimitTightened = setLimitsFromSimulation();
   Clause::releaseAux();
 
-  if (atLeastOneLimitTightened && env.options->lrsRetroactiveDeletes()) {
+  if (atLeastOneLimitTightened && (retroactive || env.options->lrsRetroactiveDeletes())) {
     // let's notify ourselves (the PassiveClauseContainer) ...
     onLimitsUpdated();
     // ... and also the getActiveClauseContainer, about the tightening limits
@@ -144,7 +147,7 @@ void ActiveClauseContainer::onLimitsUpdated(PassiveClauseContainer* limits)
     Clause* removed=toRemove.pop();
     ASS(removed->store()==Clause::ACTIVE);
 
-    RSTAT_CTR_INC("clauses discarded from active on limit update");
+    env.statistics->inc(Counter::ACTIVE_LIMIT_DISCARDS);
     env.statistics->discardedNonRedundantClauses++;
 
     remove(removed);
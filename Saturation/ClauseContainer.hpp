@@ -145,7 +145,7 @@ public:
   /*
    * LRS specific methods for computation of Limits
    */
-  void updateLimits(long long estReachableCnt);
+  void updateLimits(long long estReachableCnt, bool retroactive = false);
 
   virtual void simulationInit() = 0;
   virtual bool simulationHasNext() = 0;
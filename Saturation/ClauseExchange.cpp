@@ -0,0 +1,438 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file ClauseExchange.cpp
+ * Implements class ClauseExchange.
+ */
+
+#include <climits>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "Debug/TimeProfiling.hpp"
+
+#include "Lib/DHMap.hpp"
+#include "Lib/DHSet.hpp"
+#include "Lib/Environment.hpp"
+#include "Lib/Stack.hpp"
+
+#include "Kernel/Clause.hpp"
+#include "Kernel/Inference.hpp"
+#include "Kernel/InferenceLog.hpp"
+#include "Kernel/Signature.hpp"
+#include "Kernel/SortHelper.hpp"
+#include "Kernel/Term.hpp"
+
+#include "Inferences/ProofExtra.hpp"
+
+#include "Shell/Options.hpp"
+#include "Shell/Statistics.hpp"
+#include "Shell/UIHelper.hpp"
+
+#include "ClauseExchange.hpp"
+
+namespace Saturation
+{
+
+using namespace std;
+using namespace Shell;
+
+unsigned ClauseExchange::s_maxWeight = 0;
+
+namespace {
+
+/** the file the records are appended to */
+filesystem::path s_file;
+/** symbols with smaller numbers existed when the workers were forked */
+unsigned s_functions = 0;
+unsigned s_predicates = 0;
+unsigned s_typeCons = 0;
+
+/** descriptor for appending, opened on the first publish */
+int s_fd = -1;
+/** set when appending failed, after which nothing more is published */
+bool s_publishFailed = false;
+/** length of the prefix of the file that has been read already */
+streamoff s_readOffset = 0;
+
+/** strategies of the other workers, in the order of their records */
+Stack<string> s_strategies;
+/**
+ * the last strategy recorded by each pid; a pid reused by a later worker
+ * gets the new worker's strategy before any of its clauses
+ */
+DHMap<unsigned, unsigned> s_workerStrategies;
+/** where an imported clause came from */
+struct Origin {
+  /** index into s_strategies, UINT_MAX if the strategy is unknown */
+  unsigned strategy;
+  /** the number of the clause in the exporting worker */
+  unsigned clause;
+};
+/** the origins of the imported clauses, by clause number */
+DHMap<unsigned, Origin> s_origins;
+
+void writeVarint(string& out, unsigned val)
+{
+  while (val >= 0x80) {
+    out.push_back(static_cast<char>((val & 0x7f) | 0x80));
+    val >>= 7;
+  }
+  out.push_back(static_cast<char>(val));
+}
+
+/** Frame @b payload as a record and append it to the file with a single write */
+bool appendRecord(const string& payload)
+{
+  static string record;
+  record.clear();
+  writeVarint(record, payload.size());
+  record += payload;
+  // a single write, so that concurrent appends do not interleave
+  return ::write(s_fd, record.data(), record.size()) == static_cast<ssize_t>(record.size());
+}
+
+bool readVarint(const string& in, size_t& pos, unsigned& val)
+{
+  val = 0;
+  for (unsigned shift = 0; shift < 32; shift += 7) {
+    if (pos == in.size()) {
+      return false;
+    }
+    unsigned char byte = in[pos++];
+    val |= unsigned(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Append @b t to @b out, returning false if it cannot be exchanged.
+ * Variables are written as 2*n, terms as 2*functor+1 followed by their
+ * arguments; @b sort says whether the functors are type constructors.
+ */
+bool encodeTerm(string& out, TermList t, bool sort)
+{
+  if (t.isVar()) {
+    if (!t.isOrdinaryVar() || t.var() > (UINT_MAX >> 1)) {
+      return false;
+    }
+    writeVarint(out, t.var() << 1);
+    return true;
+  }
+  Term* trm = t.term();
+  if (trm->isSpecial() || trm->functor() >= (sort ? s_typeCons : s_functions)
+      || (!sort && trm->numTypeArguments() != 0)) {
+    return false;
+  }
+  writeVarint(out, (trm->functor() << 1) | 1);
+  for (unsigned i = 0; i < trm->arity(); i++) {
+    if (!encodeTerm(out, *trm->nthArgument(i), sort)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Append @b lit to @b out as 2*predicate+polarity followed by its
+ * arguments, preceded by the argument sort for equalities.
+ */
+bool encodeLiteral(string& out, Literal* lit)
+{
+  if (lit->functor() >= s_predicates || lit->numTypeArguments() != 0) {
+    return false;
+  }
+  writeVarint(out, (lit->functor() << 1) | unsigned(lit->polarity()));
+  if (lit->isEquality() && !encodeTerm(out, SortHelper::getEqualityArgumentSort(lit), true)) {
+    return false;
+  }
+  for (unsigned i = 0; i < lit->arity(); i++) {
+    if (!encodeTerm(out, *lit->nthArgument(i), false)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool decodeTerm(const string& in, size_t& pos, bool sort, TermList& res)
+{
+  unsigned code;
+  if (!readVarint(in, pos, code)) {
+    return false;
+  }
+  if (!(code & 1)) {
+    res = TermList::var(code >> 1);
+    return true;
+  }
+  unsigned functor = code >> 1;
+  if (functor >= (sort ? s_typeCons : s_functions)) {
+    return false;
+  }
+  unsigned arity = sort ? env.signature->typeConArity(functor) : env.signature->functionArity(functor);
+  TermStack args(arity);
+  for (unsigned i = 0; i < arity; i++) {
+    TermList arg;
+    if (!decodeTerm(in, pos, sort, arg)) {
+      return false;
+    }
+    args.push(arg);
+  }
+  res = sort ? TermList(AtomicSort::create(functor, arity, args.begin()))
+             : TermList(Term::create(functor, arity, args.begin()));
+  return true;
+}
+
+Literal* decodeLiteral(const string& in, size_t& pos)
+{
+  unsigned code;
+  if (!readVarint(in, pos, code) || (code >> 1) >= s_predicates) {
+    return nullptr;
+  }
+  unsigned predicate = code >> 1;
+  bool polarity = code & 1;
+  if (predicate == 0) {
+    TermList sort, lhs, rhs;
+    if (!decodeTerm(in, pos, true, sort) || !decodeTerm(in, pos, false, lhs) || !decodeTerm(in, pos, false, rhs)) {
+      return nullptr;
+    }
+    return Literal::createEquality(polarity, lhs, rhs, sort);
+  }
+  unsigned arity = env.signature->predicateArity(predicate);
+  TermStack args(arity);
+  for (unsigned i = 0; i < arity; i++) {
+    TermList arg;
+    if (!decodeTerm(in, pos, false, arg)) {
+      return nullptr;
+    }
+    args.push(arg);
+  }
+  return Literal::create(predicate, arity, polarity, args.begin());
+}
+
+} // namespace
+
+/**
+ * Start exchanging the unit clauses of weight at most @b maxWeight
+ * through @b file. To be called by the portfolio parent before forking.
+ */
+void ClauseExchange::setUp(filesystem::path file, unsigned maxWeight)
+{
+  ASS_G(maxWeight, 0);
+
+  error_code ec;
+  filesystem::remove(file, ec);
+
+  s_file = std::move(file);
+  s_maxWeight = maxWeight;
+  s_functions = env.signature->functions();
+  s_predicates = env.signature->predicates();
+  s_typeCons = env.signature->typeCons();
+}
+
+/**
+ * Stop the exchange and delete its file. To be called by the portfolio
+ * parent once the workers are gone.
+ */
+void ClauseExchange::tearDown()
+{
+  if (!enabled()) {
+    return;
+  }
+  s_maxWeight = 0;
+  error_code ec;
+  filesystem::remove(s_file, ec);
+}
+
+/**
+ * Offer @b cl to the other workers if it is a split-free unit that is
+ * light enough and uses only symbols they know.
+ */
+void ClauseExchange::publish(Clause* cl)
+{
+  ASS(enabled());
+
+  if (s_publishFailed || cl->length() != 1 || !cl->noSplits() || cl->weight() > s_maxWeight
+      || cl->inference().rule() == InferenceRule::PORTFOLIO_IMPORT) {
+    return;
+  }
+
+  TIME_TRACE("clause exchange");
+
+  static string payload;
+  payload.clear();
+  writeVarint(payload, static_cast<unsigned>(getpid()));
+  writeVarint(payload, cl->length());
+  writeVarint(payload, cl->number());
+  for (Literal* lit : cl->iterLits()) {
+    if (!encodeLiteral(payload, lit)) {
+      return;
+    }
+  }
+  if (s_fd == -1) {
+    s_fd = ::open(s_file.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0600);
+    if (s_fd != -1) {
+      // a strategy record is a clause record with no literals
+      string strategy;
+      writeVarint(strategy, static_cast<unsigned>(getpid()));
+      writeVarint(strategy, 0);
+      strategy += env.options->generateEncodedOptions();
+      s_publishFailed = !appendRecord(strategy);
+    }
+  }
+  if (s_fd == -1 || s_publishFailed || !appendRecord(payload)) {
+    s_publishFailed = true;
+    return;
+  }
+  env.statistics->exportedClauses++;
+}
+
+/**
+ * Push to @b result the clauses the other workers published since the
+ * previous call.
+ */
+void ClauseExchange::receive(Stack<Clause*>& result)
+{
+  ASS(enabled());
+
+  TIME_TRACE("clause exchange");
+
+  ifstream in(s_file, ios::binary);
+  if (!in || !in.seekg(s_readOffset)) {
+    return;
+  }
+  string data((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+
+  unsigned ownPid = static_cast<unsigned>(getpid());
+  static Stack<Literal*> lits;
+  size_t pos = 0;
+  for (;;) {
+    size_t recordPos = pos;
+    unsigned length;
+    if (!readVarint(data, recordPos, length) || data.size() - recordPos < length) {
+      // a record still being written is read on the next call
+      break;
+    }
+    size_t end = recordPos + length;
+    string record = data.substr(recordPos, length);
+    pos = end;
+
+    size_t rpos = 0;
+    unsigned pid, litCnt, number;
+    if (!readVarint(record, rpos, pid) || pid == ownPid || !readVarint(record, rpos, litCnt)) {
+      continue;
+    }
+    if (litCnt == 0) {
+      s_workerStrategies.set(pid, s_strategies.size());
+      s_strategies.push(record.substr(rpos));
+      continue;
+    }
+    if (!readVarint(record, rpos, number)) {
+      continue;
+    }
+    lits.reset();
+    while (lits.size() < litCnt) {
+      Literal* lit = decodeLiteral(record, rpos);
+      if (!lit) {
+        break;
+      }
+      lits.push(lit);
+    }
+    if (lits.size() != litCnt || rpos != record.size()) {
+      continue;
+    }
+    Clause* cl = Clause::fromStack(lits, NonspecificInference0(UnitInputType::AXIOM, InferenceRule::PORTFOLIO_IMPORT));
+    Origin origin { UINT_MAX, number };
+    s_workerStrategies.find(pid, origin.strategy);
+    s_origins.insert(cl->number(), origin);
+    if (env.options->proofExtra() == Options::ProofExtra::FULL) {
+      env.proofExtra.insert(cl, new Inferences::PortfolioImportExtra(pid, number));
+    }
+    result.push(cl);
+    env.statistics->importedClauses++;
+  }
+  s_readOffset += pos;
+}
+
+/**
+ * Write to @b out which strategies derive the imported clauses that
+ * @b refutation depends on, so that the proof can be completed by running
+ * them alone. Writes nothing if the proof imports no clauses.
+ */
+void ClauseExchange::explainImports(Unit* refutation, ostream& out)
+{
+  // the numbers the imported clauses have in their workers, by strategy
+  DHMap<unsigned, Stack<unsigned>> strategies;
+  unsigned imports = 0;
+  auto addImport = [&](unsigned number) {
+    imports++;
+    Origin origin;
+    if (s_origins.find(number, origin) && origin.strategy != UINT_MAX) {
+      Stack<unsigned>* clauses;
+      strategies.getValuePtr(origin.strategy, clauses);
+      clauses->push(origin.clause);
+    }
+  };
+  if (InferenceLog::enabled()) {
+    // the premises of pruned clauses are only in the log
+    DHSet<unsigned> ancestors;
+    InferenceLog::collectAncestors(refutation, ancestors);
+    DHSet<unsigned>::Iterator ait(ancestors);
+    while (ait.hasNext()) {
+      unsigned number = ait.next();
+      if (s_origins.find(number)) {
+        addImport(number);
+      }
+    }
+  }
+  DHSet<Unit*> visited;
+  Stack<Unit*> todo;
+  if (!InferenceLog::enabled()) {
+    todo.push(refutation);
+  }
+  while (todo.isNonEmpty()) {
+    Unit* u = todo.pop();
+    if (!visited.insert(u)) {
+      continue;
+    }
+    if (u->inference().rule() == InferenceRule::PORTFOLIO_IMPORT) {
+      addImport(u->number());
+      continue;
+    }
+    Inference& inf = u->inference();
+    Inference::Iterator it = inf.iterator();
+    while (inf.hasNext(it)) {
+      todo.push(inf.next(it));
+    }
+  }
+  if (!imports) {
+    return;
+  }
+  addCommentSignForSZS(out) << "The proof uses " << imports << " clause(s) imported from other workers,"
+      << " which are derived by the strategies:" << endl;
+  DHMap<unsigned, Stack<unsigned>>::Iterator sit(strategies);
+  while (sit.hasNext()) {
+    unsigned strategy;
+    Stack<unsigned>& clauses = sit.nextRef(strategy);
+    addCommentSignForSZS(out) << "  " << s_strategies[strategy] << " (its clauses";
+    for (unsigned number : clauses) {
+      out << " " << number;
+    }
+    out << ")" << endl;
+  }
+}
+
+}
@@ -0,0 +1,65 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file ClauseExchange.hpp
+ * Defines class ClauseExchange for sharing clauses between the strategies
+ * of a portfolio run.
+ */
+
+#ifndef __ClauseExchange__
+#define __ClauseExchange__
+
+#include <filesystem>
+
+#include "Forwards.hpp"
+
+namespace Saturation
+{
+
+using namespace Kernel;
+using namespace Lib;
+
+/**
+ * Sharing of unit clauses between the worker processes of a portfolio run.
+ *
+ * The parent process sets the exchange up before forking, so that all
+ * workers share the file and the signature prefix the file refers to.
+ * Each record is appended with a single write and carries the pid of its
+ * writer and the number the clause has there; a worker reads the records appended since its last visit and
+ * skips its own. Only clauses whose symbols were all present at fork time
+ * can be exchanged, as later symbols (skolems, names, ...) differ between
+ * the workers.
+ *
+ * Before its first clause, a worker appends a record with its strategy, so
+ * that a proof using imported clauses can name the strategies that derive
+ * them (see explainImports()). With proof_extra full, the writer and the
+ * number of an imported clause are shown as the extra of its inference.
+ */
+class ClauseExchange
+{
+public:
+  static void setUp(std::filesystem::path file, unsigned maxWeight);
+  static void tearDown();
+
+  /** True if clauses should be published and received in this process */
+  static bool enabled() { return s_maxWeight != 0; }
+
+  static void publish(Clause* cl);
+  static void receive(Stack<Clause*>& result);
+
+  static void explainImports(Unit* refutation, std::ostream& out);
+
+private:
+  static unsigned s_maxWeight;
+};
+
+};
+
+#endif /* __ClauseExchange__ */
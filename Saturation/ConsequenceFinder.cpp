@@ -59,7 +59,7 @@ void ConsequenceFinder::onNewPropositionalClause(Clause* cl)
   }
 
 
-  if(!cl->noSplits() || !_td.simplify(cl)) {
+  if(!cl->noSplits() || !cl->hasLiteralClass(Clause::LABEL_LITERAL) || !_td.simplify(cl)) {
     return;
   }
   Literal* pos=0;
@@ -130,6 +130,9 @@ void ConsequenceFinder::onAllProcessed()
  */
 bool ConsequenceFinder::isRedundant(Clause* cl)
 {
+  if (!cl->hasLiteralClass(Clause::LABEL_LITERAL)) {
+    return false;
+  }
   for (auto l : cl->iterLits()) {
     unsigned fn = l->functor();
     if(!env.signature->getPredicate(fn)->label()) {
@@ -147,6 +150,9 @@ void ConsequenceFinder::onClauseInserted(Clause* cl)
 {
   TIME_TRACE(TimeTrace::CONSEQUENCE_FINDING);
 
+  if (!cl->hasLiteralClass(Clause::LABEL_LITERAL)) {
+    return;
+  }
   bool red=false;
   for (auto l : cl->iterLits()) {
     unsigned fn = l->functor();
@@ -175,6 +181,9 @@ void ConsequenceFinder::onClauseRemoved(Clause* cl)
 {
   TIME_TRACE(TimeTrace::CONSEQUENCE_FINDING);
 
+  if (!cl->hasLiteralClass(Clause::LABEL_LITERAL)) {
+    return;
+  }
   for (auto l : cl->iterLits()) {
     unsigned fn = l->functor();
     if(!env.signature->getPredicate(fn)->label()) {
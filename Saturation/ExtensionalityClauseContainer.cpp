@@ -45,6 +45,10 @@ Literal* ExtensionalityClauseContainer::addIfExtensionality(Clause* c) {
   if (clen < 2 || (_maxLen > 1 && clen > _maxLen))
     return 0;
 
+  // all extensionality clauses have an X=Y
+  if (!c->hasLiteralClass(Clause::VARIABLE_EQUALITY))
+    return 0;
+
   Literal* varEq = 0;
   TermList sort;
 
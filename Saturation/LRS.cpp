@@ -12,6 +12,8 @@
  * Implements class LRS.
  */
 
+#include <climits>
+
 #include "Lib/Environment.hpp"
 #include "Lib/Timer.hpp"
 #include "Debug/TimeProfiling.hpp"
@@ -72,6 +74,42 @@ bool LRS::shouldUpdateLimits()
   return false;
 }
 
+/**
+ * Blend the rate of @b done per @b spent over the last interval into the
+ * moving average @b avg, in which the old average has weight @b smoothing.
+ */
+static void blendRate(double& avg, double smoothing, long long done, long spent)
+{
+  if (spent <= 0) {
+    return;
+  }
+  double rate = double(done) / spent;
+  avg = avg < 0 ? rate : smoothing * avg + (1 - smoothing) * rate;
+}
+
+/**
+ * Update the activation rates from the progress since the previous call,
+ * or since the start of saturation on the first call.
+ *
+ * With lrs_rate_smoothing 0, the rates are the averages since the start.
+ */
+void LRS::updateRates(long long processed, long currTime, long currInstrs)
+{
+  double smoothing = _opt.lrsRateSmoothing();
+  if (smoothing == 0 || _timeRate < 0) {
+    long timeSpent = currTime - _lrsStartTime;
+    long instrsBurned = currInstrs - _lrsStartInstrs;
+    _timeRate = timeSpent > 0 ? double(processed) / timeSpent : -1;
+    _instrRate = instrsBurned > 0 ? double(processed) / instrsBurned : -1;
+  } else {
+    blendRate(_timeRate, smoothing, processed - _prevActivations, currTime - _prevTime);
+    blendRate(_instrRate, smoothing, processed - _prevActivations, currInstrs - _prevInstrs);
+  }
+  _prevActivations = processed;
+  _prevTime = currTime;
+  _prevInstrs = currInstrs;
+}
+
 /**
  * Return an estimate of the number of clauses that the saturation
  * algorithm will be able to activate in the remaining time
@@ -88,8 +126,6 @@ long long LRS::estimatedReachableCount()
 #endif
 
   long currTime = Timer::elapsedMilliseconds();
-  // time spent in saturation (parsing, preprocessing, and the initial loading up of the input into passive are excluded)
-  long timeSpent=currTime-_lrsStartTime; // (in milliseconds)
 
   int opt_timeLimitMs = _opt.timeLimitInMilliseconds();
   float correction_coef = _opt.lrsEstimateCorrectionCoef();
@@ -103,7 +139,6 @@ long long LRS::estimatedReachableCount()
 #endif
 
   long currInstructions = Timer::elapsedMegaInstructions();
-  long instrsBurned = currInstructions - _lrsStartInstrs;
 
   long long result = -1;
 
@@ -114,7 +149,9 @@ long long LRS::estimatedReachableCount()
   }
 
   {
-    long long processed=env.statistics->activations;
+    // rates only count activations in saturation (parsing, preprocessing,
+    // and the initial loading up of the input into passive are excluded)
+    updateRates(env.statistics->activations, currTime, currInstructions);
 
     long long timeLeft; // (in milliseconds)
     if(_opt.simulatedTimeLimitInMilliseconds()) {
@@ -123,22 +160,27 @@ long long LRS::estimatedReachableCount()
       timeLeft=opt_timeLimitMs - currTime;
     }
 
-    long int instrsLeft = opt_instruction_limit - instrsBurned;
+    // like the time limit, the instruction limit counts from the start of the process
+    long int instrsLeft = opt_instruction_limit - currInstructions;
 
     // note that result is -1 here already
 
-    if(timeLeft > 0) {
-      result = correction_coef*(processed*timeLeft)/timeSpent;
+    if(timeLeft > 0 && _timeRate >= 0) {
+      result = correction_coef*_timeRate*timeLeft;
     } // otherwise, it's somehow past the deadline, or no timilimit set
 
-    if (instrsLeft > 0) {
-      long long res_by_instr = correction_coef*(processed*instrsLeft)/instrsBurned;
+    if (instrsLeft > 0 && _instrRate >= 0) {
+      long long res_by_instr = correction_coef*_instrRate*instrsLeft;
       if (result > 0) {
         result = std::min(result,res_by_instr);
       } else {
         result = res_by_instr;
       }
     } // otherwise, it's somehow past the deadline, or on instruction limit set
+
+    if (result >= 0) {
+      env.statistics->lrsReachableEstimate = result < UINT_MAX ? unsigned(result) : UINT_MAX;
+    }
   }
 
   finish:
@@ -36,6 +36,17 @@ protected:
   bool shouldUpdateLimits();
 
   long long estimatedReachableCount();
+
+private:
+  void updateRates(long long processed, long currTime, long currInstrs);
+
+  /** activations, time and instructions at the previous estimate */
+  long long _prevActivations = 0;
+  long _prevTime = 0;
+  long _prevInstrs = 0;
+  /** smoothed activations per millisecond and per mega-instruction, negative until measured */
+  double _timeRate = -1;
+  double _instrRate = -1;
 };
 
 };
@@ -12,8 +12,13 @@
  * Implements class Otter.
  */
 
+#include <algorithm>
+
+#include "Lib/Environment.hpp"
+#include "Debug/TimeProfiling.hpp"
 #include "Kernel/Clause.hpp"
 #include "Shell/Options.hpp"
+#include "Shell/Statistics.hpp"
 
 #include "Otter.hpp"
 
@@ -25,7 +30,8 @@ using namespace Kernel;
 using namespace Shell;
 
 Otter::Otter(Problem& prb, const Options& opt)
-  : SaturationAlgorithm(prb, opt)
+  : SaturationAlgorithm(prb, opt), _adaptiveWindow(opt.adaptivePassiveSimplification()), _passiveIndexed(true),
+    _windowAdded(0), _windowUpdates(0), _windowReductions(0), _unindexedWindows(0), _unindexedLimit(1)
 {
 }
 
@@ -48,14 +54,29 @@ void Otter::onPassiveAdded(Clause* cl)
   SaturationAlgorithm::onPassiveAdded(cl);
 
   if(cl->store()==Clause::PASSIVE) {
-    _simplCont.add(cl);
+    if (_adaptiveWindow) {
+      _passiveClauses.insert(cl);
+    }
+    if (_passiveIndexed) {
+      _simplCont.add(cl);
+      _windowUpdates++;
+    }
+    if (_adaptiveWindow && ++_windowAdded == _adaptiveWindow) {
+      updatePassiveIndexing();
+    }
   }
 }
 
 void Otter::onPassiveRemoved(Clause* cl)
 {
   if(cl->store()==Clause::PASSIVE) {
-    _simplCont.remove(cl);
+    if (_adaptiveWindow) {
+      _passiveClauses.remove(cl);
+    }
+    if (_passiveIndexed) {
+      _simplCont.remove(cl);
+      _windowUpdates++;
+    }
   }
 
   SaturationAlgorithm::onPassiveRemoved(cl);
@@ -84,4 +105,70 @@ void Otter::beforeSelectedRemoved(Clause* cl)
   _simplCont.remove(cl);
 }
 
+bool Otter::handleClauseBeforeActivation(Clause* cl)
+{
+  ASS_EQ(cl->store(), Clause::SELECTED);
+
+  // the selected clause simplifies with the active ones from now on
+  if (_adaptiveWindow && _passiveClauses.remove(cl) && !_passiveIndexed) {
+    _simplCont.add(cl);
+  }
+  return true;
+}
+
+void Otter::onReductionPremises(Clause* cl, const ClauseStack& premises, bool forward)
+{
+  if (!_adaptiveWindow || !_passiveIndexed) {
+    return;
+  }
+  if (forward) {
+    for (Clause* premise : premises) {
+      if (premise && premise->store() == Clause::PASSIVE) {
+        _windowReductions++;
+        return;
+      }
+    }
+  } else if (cl->store() == Clause::PASSIVE) {
+    _windowReductions++;
+  }
+}
+
+void Otter::updatePassiveIndexing()
+{
+  if (_passiveIndexed) {
+    if (_windowReductions * UPDATES_PER_REDUCTION < _windowUpdates) {
+      setPassiveIndexed(false);
+      _unindexedWindows = 0;
+    } else {
+      _unindexedLimit = 1;
+    }
+  } else if (++_unindexedWindows >= _unindexedLimit) {
+    // try again, and wait twice as long if it does not pay off this time either
+    setPassiveIndexed(true);
+    _unindexedLimit = std::min(2 * _unindexedLimit, MAX_UNINDEXED_WINDOWS);
+  }
+  _windowAdded = 0;
+  _windowUpdates = 0;
+  _windowReductions = 0;
+}
+
+void Otter::setPassiveIndexed(bool indexed)
+{
+  ASS_NEQ(indexed, _passiveIndexed);
+
+  TIME_TRACE("passive simplification indexing");
+  env.statistics->inc(Counter::PASSIVE_INDEXING_SWITCHES);
+
+  _passiveIndexed = indexed;
+  DHSet<Clause*>::Iterator it(_passiveClauses);
+  while (it.hasNext()) {
+    Clause* cl = it.next();
+    if (indexed) {
+      _simplCont.add(cl);
+    } else {
+      _simplCont.remove(cl);
+    }
+  }
+}
+
 }
@@ -18,6 +18,8 @@
 
 #include "Forwards.hpp"
 
+#include "Lib/DHSet.hpp"
+
 #include "SaturationAlgorithm.hpp"
 
 namespace Saturation {
@@ -49,6 +51,30 @@ protected:
   /** called before the selected clause is deleted from the searchspace */
   void beforeSelectedRemoved(Clause* cl) override;
 
+  bool handleClauseBeforeActivation(Clause* cl) override;
+
+  void onReductionPremises(Clause* cl, const ClauseStack& premises, bool forward) override;
+
+  /**
+   * With the adaptive_passive_simplification option, passive clauses are
+   * only indexed for simplification while it pays off, as in Otter, and
+   * otherwise simplification only uses active clauses, as in Discount.
+   *
+   * Every window of that many new passive clauses, the reductions that a
+   * passive clause took part in are compared with the updates of the
+   * simplification indexes by passive clauses. Once passive clauses are no
+   * longer indexed, the benefit cannot be seen, so they are indexed again
+   * for one window after a number of windows, which doubles every time
+   * that indexing does not pay off.
+   */
+  void updatePassiveIndexing();
+  void setPassiveIndexed(bool indexed);
+
+  /** index updates by passive clauses one reduction is worth */
+  static constexpr unsigned UPDATES_PER_REDUCTION = 32;
+  /** the most windows for which passive clauses stay unindexed */
+  static constexpr unsigned MAX_UNINDEXED_WINDOWS = 64;
+
   /**
    * Dummy container for simplification indexes to subscribe
    * to its events.
@@ -74,6 +100,19 @@ protected:
   };
 
   FakeContainer _simplCont;
+
+  /** the number of passive clauses in a window, 0 if passive clauses are always indexed */
+  unsigned _adaptiveWindow;
+  bool _passiveIndexed;
+  /** passive clauses (only kept with the adaptive indexing) */
+  DHSet<Clause*> _passiveClauses;
+  /** new passive clauses, index updates and reductions in the current window */
+  unsigned _windowAdded;
+  unsigned _windowUpdates;
+  unsigned _windowReductions;
+  /** the windows passive clauses have been unindexed for and the windows they stay so */
+  unsigned _unindexedWindows;
+  unsigned _unindexedLimit;
 };
 
 };
@@ -72,17 +72,12 @@ PredicateSplitPassiveClauseContainer::~PredicateSplitPassiveClauseContainer() {
 
 unsigned PredicateSplitPassiveClauseContainer::bestQueue(float featureValue) const
 {
-  // compute best queue clause should be placed in
+  // compute best queue clause should be placed in: the first one whose cutoff is not below the value,
+  // the cutoffs are strictly increasing
   ASS(_cutoffs.back() == std::numeric_limits<float>::max());
-  for (unsigned i = 0; i < _cutoffs.size(); i++)
-  {
-    if (featureValue <= _cutoffs[i])
-    {
-      return i;
-    }
-  }
-  // unreachable
-  ASSERTION_VIOLATION;
+  auto it = std::lower_bound(_cutoffs.begin(), _cutoffs.end(), featureValue);
+  ASS(it != _cutoffs.end());
+  return std::distance(_cutoffs.begin(), it);
 }
 
 void PredicateSplitPassiveClauseContainer::add(Clause* cl)
@@ -231,10 +226,12 @@ Clause* PredicateSplitPassiveClauseContainer::popSelected()
   // note: for a non-layered arrangement, the clause only occurred in _queues[currIndex] (from which it was just removed using popSelected(), so we don't need any additional clause-removal
   if (_layeredArrangement)
   {
-    // remove clause from all queues
-    for (unsigned i = 0; i < _queues.size(); i++)
+    // remove clause from the other queues it was added to, those starting from its best queue
+    for (unsigned i = bestQueue(evaluateFeature(cl)); i < _queues.size(); i++)
     {
-      _queues[i]->remove(cl);
+      if (i != currIndex) {
+        _queues[i]->remove(cl);
+      }
     }
   }
 
@@ -428,7 +425,7 @@ PredicateSplitPassiveClauseContainer(isOutermost, opt, name, std::move(queues),
 float TheoryMultiSplitPassiveClauseContainer::evaluateFeature(Clause* cl) const
 {
   // heuristically compute likeliness that clause occurs in proof
-  auto inference = cl->inference();
+  const Inference& inference = cl->inference();
   auto expectedRatioDenominator = _opt.theorySplitQueueExpectedRatioDenom();
   return inference.th_ancestors * expectedRatioDenominator - inference.all_ancestors;
 }
@@ -446,7 +443,7 @@ PredicateSplitPassiveClauseContainer(isOutermost, opt, name, std::move(queues),
 float AvatarMultiSplitPassiveClauseContainer::evaluateFeature(Clause* cl) const
 {
   // heuristically compute likeliness that clause occurs in proof
-  auto inf = cl->inference();
+  const Inference& inf = cl->inference();
   return (inf.splits() == nullptr) ? 0 : inf.splits()->size();
 }
 
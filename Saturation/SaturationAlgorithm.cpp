@@ -12,6 +12,9 @@
  * Implementing SaturationAlgorithm class.
  */
 
+#include <cstdio>
+#include <fstream>
+
 #include "Debug/Assertion.hpp"
 
 #include "Lib/Environment.hpp"
@@ -23,8 +26,11 @@
 
 #include "Kernel/Clause.hpp"
 #include "Kernel/Inference.hpp"
+#include "Kernel/InferenceLog.hpp"
 #include "Kernel/LiteralSelector.hpp"
 #include "Kernel/Problem.hpp"
+#include "Kernel/Signature.hpp"
+#include "Kernel/TermIterators.hpp"
 #include "Kernel/Unit.hpp"
 
 #include "Inferences/InterpretedEvaluation.hpp"
@@ -54,6 +60,7 @@
 #include "Inferences/Condensation.hpp"
 #include "Inferences/FastCondensation.hpp"
 #include "Inferences/DistinctEqualitySimplifier.hpp"
+#include "Inferences/DuplicateClauseDeletion.hpp"
 
 #include "Inferences/InferenceEngine.hpp"
 #include "Inferences/AnswerLiteralProcessors.hpp"
@@ -96,11 +103,14 @@
 #include "Shell/PartialRedundancyHandler.hpp"
 #include "Shell/Options.hpp"
 #include "Shell/Statistics.hpp"
+#include "Shell/TPTPPrinter.hpp"
+#include "Shell/UIHelper.hpp"
 #include "Debug/TimeProfiling.hpp"
 #include "Shell/Shuffling.hpp"
 
 #include "Splitter.hpp"
 
+#include "ClauseExchange.hpp"
 #include "ConsequenceFinder.hpp"
 #include "LabelFinder.hpp"
 #include "Splitter.hpp"
@@ -125,11 +135,26 @@ using namespace Saturation;
 #define REPORT_FW_SIMPL 0
 /** Print information about performed backward simplifications */
 #define REPORT_BW_SIMPL 0
+/** Number of activations between reading the clauses shared by other portfolio workers */
+#define CLAUSE_EXCHANGE_INTERVAL 64
+
+/** Set the name under which the cost of @b engine is reported, see EngineCostTimer */
+template<class Engine>
+static Engine* costNamed(Engine* engine, const char* name)
+{
+  engine->setCostName(name);
+  return engine;
+}
 
 SaturationAlgorithm* SaturationAlgorithm::s_instance = 0;
+SaturationAlgorithm::StepHook SaturationAlgorithm::s_stepHook = 0;
+void* SaturationAlgorithm::s_stepHookData = 0;
 
 std::unique_ptr<PassiveClauseContainer> makeLevel0(bool isOutermost, const Options& opt, std::string name)
 {
+  if (opt.useClauseScore()) {
+    return std::make_unique<ScoreBasedPassiveClauseContainer>(isOutermost, opt, name + "ScoreQ");
+  }
   if (opt.weightRatio() == 0) {
     ASS_G(opt.ageRatio(),0);
     return std::make_unique<AgeBasedPassiveClauseContainer>(isOutermost, opt, name + "AgeQ");
@@ -220,6 +245,34 @@ SaturationAlgorithm::SaturationAlgorithm(Problem& prb, const Options& opt)
   ASS_EQ(s_instance, 0);  //there can be only one saturation algorithm at a time
 
   _activationLimit = opt.activationLimit();
+  _cpuTimeLimit = opt.cpuTimeLimitInMilliseconds();
+  _memorySoftLimit = _memoryShedLevel = size_t(opt.memorySoftLimit()) * 1024 * 1024;
+  _bwSimplificationBudget = opt.backwardSimplificationBudget();
+  PhaseTimer::setEnabled(opt.phaseTiming());
+  EngineCostTimer::setEnabled(opt.engineCosts());
+  _batchDuplicateElimination = opt.unprocessedDuplicateElimination();
+  if (!opt.checkpointFile().empty()) {
+    _checkpointInterval = opt.checkpointInterval();
+  }
+  if (opt.saturationAlgorithm() != Options::SaturationAlgorithm::LRS) {
+    _passiveHotLimit = opt.passiveHotLimit();
+    _passiveSpillTrigger = 2 * _passiveHotLimit;
+  }
+  if (_checkpointInterval || _passiveHotLimit) {
+    _passiveSet = new DHSet<Clause*>();
+  }
+  if (!opt.clauseTrace().empty()) {
+    _trace = std::make_unique<std::ofstream>(opt.clauseTrace());
+    if (!*_trace) {
+      USER_ERROR("Cannot open clause trace file: " + opt.clauseTrace());
+    }
+    UIHelper::outputSymbolDeclarations(*_trace);
+  }
+  if (!opt.inferenceLog().empty()) {
+    InferenceLog::open(opt.inferenceLog());
+  } else if (InferenceLog::enabled()) {
+    InferenceLog::close();
+  }
 
   _ordering = OrderingSP(Ordering::create(prb, opt));
   if (!Ordering::trySetGlobalOrdering(_ordering)) {
@@ -249,6 +302,10 @@ SaturationAlgorithm::SaturationAlgorithm(Problem& prb, const Options& opt)
   _passive->removedEvent.subscribe(this, &SaturationAlgorithm::passiveRemovedHandler);
   _passive->selectedEvent.subscribe(this, &SaturationAlgorithm::onPassiveSelected);
 
+  if (opt.passiveVariantDeduplication()) {
+    _waitingVariants = new HashingClauseVariantIndex();
+  }
+
   if (opt.extensionalityResolution() != Options::ExtensionalityResolution::OFF) {
     _extensionality = new ExtensionalityClauseContainer(opt);
     //_active->addedEvent.subscribe(_extensionality, &ExtensionalityClauseContainer::addIfExtensionality);
@@ -282,6 +339,10 @@ SaturationAlgorithm::~SaturationAlgorithm()
   _active->detach();
   _passive->detach();
 
+  while (!_spilledPassive.isEmpty()) {
+    _spilledPassive.pop().cl->decRefCnt();
+  }
+
   if (_generator) {
     _generator->detach();
   }
@@ -310,6 +371,10 @@ SaturationAlgorithm::~SaturationAlgorithm()
     delete bse;
   }
 
+  while (_bwSimplificationQueue.isNonEmpty()) {
+    _bwSimplificationQueue.pop_front().cl->decRefCnt();
+  }
+
   delete _unprocessed;
   delete _active;
 }
@@ -349,6 +414,17 @@ void SaturationAlgorithm::onActiveAdded(Clause* c)
   if (env.options->showActive()) {
     std::cout << "[SA] active: " << c->toString() << std::endl;
   }
+  if (_trace) {
+    traceEvent("active", c);
+  }
+}
+
+/**
+ * Record an event of clause @b cl in the clause trace
+ */
+void SaturationAlgorithm::traceEvent(const char* event, Clause* cl)
+{
+  *_trace << "% " << event << ' ' << cl->number() << '\n';
 }
 
 /**
@@ -358,6 +434,9 @@ void SaturationAlgorithm::onActiveRemoved(Clause* c)
 {
   ASS(c->store()==Clause::ACTIVE);
   c->setStore(Clause::NONE);
+  if (_trace) {
+    traceEvent("removed", c);
+  }
   // at this point the c object may be deleted
 }
 
@@ -386,6 +465,9 @@ void SaturationAlgorithm::onPassiveAdded(Clause* c)
   if (env.options->showPassive()) {
     std::cout << "[SA] passive: " << c->toString() << std::endl;
   }
+  if (_trace) {
+    traceEvent("passive", c);
+  }
 
   //when a clause is added to the passive container,
   //we know it is not redundant
@@ -401,6 +483,9 @@ void SaturationAlgorithm::onPassiveRemoved(Clause* c)
 {
   ASS(c->store()==Clause::PASSIVE);
   c->setStore(Clause::NONE);
+  if (_trace) {
+    traceEvent("removed", c);
+  }
   // at this point the c object can be deleted
 }
 
@@ -413,6 +498,15 @@ void SaturationAlgorithm::onPassiveRemoved(Clause* c)
  */
 void SaturationAlgorithm::onPassiveSelected(Clause* c)
 {
+  if (_trace) {
+    traceEvent("selected", c);
+  }
+  if (_waitingVariants) {
+    _waitingVariants->remove(c);
+  }
+  if (_passiveSet) {
+    _passiveSet->remove(c);
+  }
 }
 
 /**
@@ -434,6 +528,11 @@ void SaturationAlgorithm::onNewClause(Clause* cl)
   if (env.options->showNew()) {
     std::cout << "[SA] new: " << cl->toString() << std::endl;
   }
+  if (_trace) {
+    std::string language;
+    std::string body = TPTPPrinter::clauseToString(cl, language);
+    *_trace << language << "(u" << cl->number() << ",axiom," << body << ").\n";
+  }
 
   if (cl->isPropositional()) {
     onNewUsefulPropositionalClause(cl);
@@ -498,9 +597,20 @@ void SaturationAlgorithm::onClauseReduction(Clause* cl, Clause **replacements, u
   static ClauseStack premStack;
   premStack.reset();
   premStack.loadFromIterator(std::move(premises));
+  onReductionPremises(cl, premStack, forward);
 
   Clause *replacement = numOfReplacements ? *replacements : 0;
 
+  if (_trace) {
+    *_trace << "% reduced " << cl->number() << " by";
+    for (Clause* premise : iterTraits(premStack.iterFifo())) {
+      if (premise) {
+        *_trace << ' ' << premise->number();
+      }
+    }
+    *_trace << '\n';
+  }
+
   if (env.options->showReductions()) {
     std::cout << "[SA] " << (forward ? "forward" : "backward") << " reduce: " << cl->toString() << endl;
     for(unsigned i = 0; i < numOfReplacements; i++){
@@ -573,6 +683,12 @@ void SaturationAlgorithm::activeRemovedHandler(Clause* cl)
  */
 void SaturationAlgorithm::passiveRemovedHandler(Clause* cl)
 {
+  if (_waitingVariants) {
+    _waitingVariants->remove(cl);
+  }
+  if (_passiveSet) {
+    _passiveSet->remove(cl);
+  }
   onPassiveRemoved(cl);
 }
 
@@ -583,10 +699,30 @@ void SaturationAlgorithm::passiveRemovedHandler(Clause* cl)
  * set-of-support option is enabled and @b cl has input type equal to
  * @b Clause::AXIOM. In this case, @b cl is put into the active container.
  */
-void SaturationAlgorithm::addInputClause(Clause* cl)
+void SaturationAlgorithm::addInputClause(Clause* cl, bool mayHoldBack)
 {
   ASS_LE(toNumber(cl->inputType()),toNumber(UnitInputType::CLAIM)); // larger input types should not appear in proof search
 
+  if (mayHoldBack && _opt.theoryAxiomsLazy() && cl->isPureTheoryDescendant()) {
+    static Stack<unsigned> triggers;
+    triggers.reset();
+    collectTheoryTriggers(cl, triggers);
+    if (holdBackAxiom(cl, triggers, _lazyTheoryAxioms)) {
+      env.statistics->lazyTheoryAxioms++;
+      return;
+    }
+  }
+  if (mayHoldBack && _opt.equalityProxyLazy() && cl->inference().rule() == InferenceRule::EQUALITY_PROXY_AXIOM2) {
+    static Stack<unsigned> triggers;
+    triggers.reset();
+    collectProxyTriggers(cl, triggers);
+    // reflexivity, symmetry and transitivity have no triggers
+    if (holdBackAxiom(cl, triggers, _lazyCongruenceAxioms)) {
+      env.statistics->lazyCongruenceAxioms++;
+      return;
+    }
+  }
+
   if (_symEl) {
     _symEl->onInputClause(cl);
   }
@@ -621,6 +757,95 @@ void SaturationAlgorithm::addInputClause(Clause* cl)
   env.statistics->initialClauses++;
 }
 
+/**
+ * Push to @b triggers the keys of the interpreted symbols of @b cl whose
+ * use should bring in the theory axioms mentioning them: 2*f for functions
+ * and 2*p+1 for predicates. Equality and numerals occur everywhere and
+ * are no triggers.
+ */
+void SaturationAlgorithm::collectTheoryTriggers(Clause* cl, Stack<unsigned>& triggers)
+{
+  for (Literal* lit : cl->iterLits()) {
+    if (!lit->isEquality() && env.signature->getPredicate(lit->functor())->interpreted()) {
+      triggers.push(2 * lit->functor() + 1);
+    }
+    NonVariableNonTypeIterator nvit(lit);
+    while (nvit.hasNext()) {
+      unsigned fn = nvit.next()->functor();
+      Signature::Symbol* sym = env.signature->getFunction(fn);
+      if (sym->interpreted() && !sym->interpretedNumber()) {
+        triggers.push(2 * fn);
+      }
+    }
+  }
+}
+
+/**
+ * Push to @b triggers the keys of the symbols of @b cl other than equality
+ * and the equality proxy predicates, with the keys of collectTheoryTriggers.
+ * The congruence axiom of a symbol has just that symbol as trigger.
+ */
+void SaturationAlgorithm::collectProxyTriggers(Clause* cl, Stack<unsigned>& triggers)
+{
+  for (Literal* lit : cl->iterLits()) {
+    if (!lit->isEquality() && !env.signature->getPredicate(lit->functor())->equalityProxy()) {
+      triggers.push(2 * lit->functor() + 1);
+    }
+    NonVariableNonTypeIterator nvit(lit);
+    while (nvit.hasNext()) {
+      triggers.push(2 * nvit.next()->functor());
+    }
+  }
+}
+
+/** True if @b cl has a literal of an equality proxy predicate */
+static bool hasProxyLiteral(Clause* cl)
+{
+  return cl->iterLits().any([](Literal* lit) {
+    return !lit->isEquality() && env.signature->getPredicate(lit->functor())->equalityProxy();
+  });
+}
+
+/**
+ * Keep the axiom @b cl out of the search in @b lazyAxioms until a clause
+ * activates one of its @b triggers. Return false if it has no triggers, in
+ * which case it has to be added right away.
+ */
+bool SaturationAlgorithm::holdBackAxiom(Clause* cl, const Stack<unsigned>& triggers, DHMap<unsigned, ClauseStack>& lazyAxioms)
+{
+  if (triggers.isEmpty()) {
+    return false;
+  }
+  for (unsigned t : triggers) {
+    ClauseStack* axioms;
+    lazyAxioms.getValuePtr(t, axioms);
+    if (axioms->isEmpty() || axioms->top() != cl) {
+      axioms->push(cl);
+    }
+  }
+  cl->incRefCnt();
+  _heldAxioms.insert(cl);
+  return true;
+}
+
+/** Add the axioms held back in @b lazyAxioms under any of @b triggers */
+void SaturationAlgorithm::releaseAxioms(const Stack<unsigned>& triggers, DHMap<unsigned, ClauseStack>& lazyAxioms)
+{
+  for (unsigned t : triggers) {
+    ClauseStack axioms;
+    if (!lazyAxioms.pop(t, axioms)) {
+      continue;
+    }
+    for (Clause* ax : axioms) {
+      // axioms are listed under each of their triggers
+      if (_heldAxioms.remove(ax)) {
+        addInputClause(ax, /* mayHoldBack */ false);
+        ax->decRefCnt();
+      }
+    }
+  }
+}
+
 /**
  * Return literal selector that is to be used for set-of-support clauses
  */
@@ -819,7 +1044,9 @@ void SaturationAlgorithm::newClausesToUnprocessed()
         onNonRedundantClause(cl);
         break;
       case Clause::NONE:
-        addUnprocessedClause(cl);
+        if (!_batchDuplicateElimination || !isBatchDuplicate(cl)) {
+          addUnprocessedClause(cl);
+        }
         break;
       case Clause::SELECTED:
       case Clause::ACTIVE:
@@ -832,6 +1059,62 @@ void SaturationAlgorithm::newClausesToUnprocessed()
     }
     cl->decRefCnt(); // belongs to _newClauses.popWithoutDec()
   }
+
+  if (_batchClauseList.isNonEmpty()) {
+    _batchClauses.reset();
+    while (_batchClauseList.isNonEmpty()) {
+      _batchClauseList.pop()->decRefCnt();
+    }
+  }
+}
+
+/**
+ * Return true if a clause with the same literals as @b cl and a subset of
+ * its splits already came in the current batch of new clauses, and remember
+ * @b cl otherwise.
+ *
+ * The literals are shared, so this is a comparison of pointers, and it runs
+ * before the immediate simplifications, which would treat both clauses the
+ * same. Symmetric inferences often derive the same conclusion several times
+ * from one given clause.
+ */
+bool SaturationAlgorithm::isBatchDuplicate(Clause* cl)
+{
+  unsigned hash = cl->length();
+  for (Literal* lit : cl->iterLits()) {
+    hash += DefaultHash::hash(lit->getId());
+  }
+
+  ClauseStack* candidates;
+  _batchClauses.getValuePtr(hash, candidates);
+
+  static Stack<Literal*> lits;
+  static Stack<Literal*> otherLits;
+  lits.reset();
+  lits.loadFromIterator(cl->iterLits());
+  std::sort(lits.begin(), lits.end());
+  for (Clause* other : *candidates) {
+    if (other->length() != cl->length()) {
+      continue;
+    }
+    SplitSet* splits = other->splits();
+    if (splits && !splits->isEmpty() && !(cl->splits() && splits->isSubsetOf(cl->splits()))) {
+      continue;
+    }
+    otherLits.reset();
+    otherLits.loadFromIterator(other->iterLits());
+    std::sort(otherLits.begin(), otherLits.end());
+    if (lits == otherLits) {
+      env.statistics->unprocessedDuplicates++;
+      return true;
+    }
+  }
+
+  // kept until the end of the batch, as the immediate simplifications may delete it
+  cl->incRefCnt();
+  candidates->push(cl);
+  _batchClauseList.push(cl);
+  return false;
 }
 
 /**
@@ -862,10 +1145,39 @@ void SaturationAlgorithm::addUnprocessedClause(Clause* cl)
     return;
   }
 
+  if (_waitingVariants) {
+    if (hasWaitingVariant(cl)) {
+      env.statistics->passiveVariantDuplicates++;
+      return;
+    }
+    _waitingVariants->insert(cl);
+  }
+
   cl->setStore(Clause::UNPROCESSED);
   _unprocessed->add(cl);
 }
 
+/**
+ * Return true iff a variant of @b cl is in the unprocessed or passive
+ * container and depends on no splits @b cl does not depend on, so that
+ * @b cl can be dropped without losing anything.
+ */
+bool SaturationAlgorithm::hasWaitingVariant(Clause* cl)
+{
+  TIME_TRACE("passive variant check");
+
+  auto variants = _waitingVariants->retrieveVariants(cl->literals(), cl->length());
+  while (variants.hasNext()) {
+    Clause* variant = variants.next();
+    ASS(variant->store() == Clause::UNPROCESSED || variant->store() == Clause::PASSIVE);
+    SplitSet* splits = variant->splits();
+    if (!splits || splits->isEmpty() || (cl->splits() && splits->isSubsetOf(cl->splits()))) {
+      return true;
+    }
+  }
+  return false;
+}
+
 /**
  * Deal with clause that has an empty non-propositional part.
  *
@@ -906,9 +1218,10 @@ void SaturationAlgorithm::handleEmptyClause(Clause* cl)
 bool SaturationAlgorithm::forwardSimplify(Clause* cl)
 {
   TIME_TRACE("forward simplification");
+  PhaseTimer phaseTimer(SaturationPhase::FORWARD_SIMPLIFICATION);
 
   if (env.options->lrsPreemptiveDeletes() && _passive->exceedsAllLimits(cl)) {
-    RSTAT_CTR_INC("clauses discarded by limit in forward simplification");
+    env.statistics->inc(Counter::FORWARD_LIMIT_DISCARDS);
     env.statistics->discardedNonRedundantClauses++;
     return false;
   }
@@ -921,7 +1234,12 @@ bool SaturationAlgorithm::forwardSimplify(Clause* cl)
     {
       Clause *replacement = 0;
       auto premises = ClauseIterator::getEmpty();
-      if (fse->perform(cl, replacement, premises)) {
+      bool reduced;
+      {
+        EngineCostTimer timer(fse->costName());
+        reduced = fse->perform(cl, replacement, premises);
+      }
+      if (reduced) {
         if (replacement) {
           addNewClause(replacement);
         }
@@ -979,6 +1297,7 @@ bool SaturationAlgorithm::forwardSimplify(Clause* cl)
   cl->incRefCnt();
 
   if (_splitter && !_opt.splitAtActivation()) {
+    PhaseTimer splittingTimer(SaturationPhase::SPLITTING);
     if (_splitter->doSplitting(cl)) {
       return false;
     }
@@ -993,35 +1312,93 @@ bool SaturationAlgorithm::forwardSimplify(Clause* cl)
 void SaturationAlgorithm::backwardSimplify(Clause* cl)
 {
   TIME_TRACE("backward simplification");
+  PhaseTimer phaseTimer(SaturationPhase::BACKWARD_SIMPLIFICATION);
 
-  BwSimplList::Iterator bsit(_bwSimplifiers);
-  while (bsit.hasNext()) {
-    BackwardSimplificationEngine *bse = bsit.next();
-
-    BwSimplificationRecordIterator simplifications;
-    bse->perform(cl, simplifications);
-    while (simplifications.hasNext()) {
-      BwSimplificationRecord srec = simplifications.next();
-      Clause *redundant = srec.toRemove;
-      ASS_NEQ(redundant, cl);
+  if (!_bwSimplificationBudget) {
+    BwSimplList::Iterator bsit(_bwSimplifiers);
+    while (bsit.hasNext()) {
+      backwardSimplify(cl, bsit.next(), nullptr);
+    }
+    return;
+  }
 
-      Clause *replacement = srec.replacement;
+  if (_bwSimplifiers) {
+    cl->incRefCnt();
+    _bwSimplificationQueue.push_back({ cl, _bwSimplifiers });
+    performQueuedBackwardSimplifications();
+  }
+}
 
-      if (replacement) {
-        addNewClause(replacement);
+/**
+ * Perform the backward simplifications of @b bse by @b cl. With a non-null
+ * @b budget, stop when it runs out and return false if some may be left.
+ */
+bool SaturationAlgorithm::backwardSimplify(Clause* cl, BackwardSimplificationEngine* bse, unsigned* budget)
+{
+  BwSimplificationRecordIterator simplifications;
+  bse->perform(cl, simplifications);
+  while (simplifications.hasNext()) {
+    if (budget && *budget == 0) {
+      return false;
+    }
+    BwSimplificationRecord srec = simplifications.next();
+    Clause *redundant = srec.toRemove;
+    Clause *replacement = srec.replacement;
+
+    if (budget) {
+      (*budget)--;
+      // a deferred simplifier may have entered the indices in the meantime
+      if (redundant == cl) {
+        if (replacement) {
+          replacement->destroyIfUnnecessary();
+        }
+        continue;
       }
-      onClauseReduction(redundant, &replacement, 1, cl, false);
+    }
+    ASS_NEQ(redundant, cl);
 
-      // we must remove the redundant clause before adding its replacement,
-      // as otherwise the redundant one might demodulate the replacement into
-      // a tautology
+    if (replacement) {
+      addNewClause(replacement);
+    }
+    onClauseReduction(redundant, &replacement, 1, cl, false);
+
+    // we must remove the redundant clause before adding its replacement,
+    // as otherwise the redundant one might demodulate the replacement into
+    // a tautology
 
-      redundant->incRefCnt(); // we don't want the clause deleted before we record the simplification
+    redundant->incRefCnt(); // we don't want the clause deleted before we record the simplification
 
-      removeActiveOrPassiveClause(redundant);
+    removeActiveOrPassiveClause(redundant);
+
+    redundant->decRefCnt();
+  }
+  return true;
+}
 
-      redundant->decRefCnt();
+/**
+ * Work off the queued backward simplifications in order, as far as the
+ * budget of the current step allows.
+ *
+ * An engine interrupted by the budget is restarted from scratch on the next
+ * occasion; the clauses it already removed are not found again. Backward
+ * simplification only removes redundant clauses, so delaying it does not
+ * affect completeness.
+ */
+void SaturationAlgorithm::performQueuedBackwardSimplifications()
+{
+  while (_bwSimplificationBudgetLeft && _bwSimplificationQueue.isNonEmpty()) {
+    BwSimplificationTask& task = _bwSimplificationQueue.front();
+    // a clause deleted in the meantime might have been made redundant
+    // by one of the clauses it would now remove
+    if (task.cl->store() != Clause::NONE) {
+      while (task.engines && backwardSimplify(task.cl, task.engines->head(), &_bwSimplificationBudgetLeft)) {
+        task.engines = task.engines->tail();
+      }
+      if (task.engines) {
+        return;
+      }
     }
+    _bwSimplificationQueue.pop_front().cl->decRefCnt();
   }
 }
 
@@ -1069,10 +1446,30 @@ void SaturationAlgorithm::addToPassive(Clause* cl)
   cl->setStore(Clause::PASSIVE);
   env.statistics->passiveClauses++;
 
+  if (ClauseExchange::enabled()) {
+    ClauseExchange::publish(cl);
+  }
+
+  if (_passiveSet) {
+    _passiveSet->insert(cl);
+  }
+
   {
     TIME_TRACE(TimeTrace::PASSIVE_CONTAINER_MAINTENANCE);
     _passive->add(cl);
   }
+
+  // the new clause handlers, the last ones to follow the premises, are done
+  if (InferenceLog::enabled()) {
+    InferenceLog::prune(cl);
+  }
+
+  if (_passiveHotLimit && _passive->sizeEstimate() >= _passiveSpillTrigger) {
+    spillPassiveTail();
+    // clauses that cannot be spilled stay, so the next attempt waits until
+    // passive has grown by another passive_hot_limit
+    _passiveSpillTrigger = std::max(2 * _passiveHotLimit, _passive->sizeEstimate() + _passiveHotLimit);
+  }
 }
 
 void SaturationAlgorithm::removeSelected(Clause* cl)
@@ -1097,6 +1494,7 @@ void SaturationAlgorithm::removeSelected(Clause* cl)
 void SaturationAlgorithm::activate(Clause* cl)
 {
       TIME_TRACE("activation")
+  PhaseTimer phaseTimer(SaturationPhase::ACTIVATION);
 
   {
     TIME_TRACE("redundancy check")
@@ -1108,6 +1506,7 @@ void SaturationAlgorithm::activate(Clause* cl)
   {
     TIME_TRACE("splitting")
     if (_splitter && _opt.splitAtActivation()) {
+      PhaseTimer splittingTimer(SaturationPhase::SPLITTING);
       if (_splitter->doSplitting(cl)) {
         return removeSelected(cl);
       }
@@ -1136,6 +1535,22 @@ void SaturationAlgorithm::activate(Clause* cl)
 
   _partialRedundancyHandler->checkEquations(cl);
 
+  if (_lazyTheoryAxioms.size()) {
+    static Stack<unsigned> triggers;
+    triggers.reset();
+    collectTheoryTriggers(cl, triggers);
+    releaseAxioms(triggers, _lazyTheoryAxioms);
+  }
+  // the congruence axioms of the symbols of clauses that interact with
+  // the proxy predicates
+  if (_lazyCongruenceAxioms.size() && hasProxyLiteral(cl)) {
+    static Stack<unsigned> triggers;
+    triggers.reset();
+    collectProxyTriggers(cl, triggers);
+    releaseAxioms(triggers, _lazyCongruenceAxioms);
+  }
+
+  PhaseTimer generationTimer(SaturationPhase::GENERATION);
   auto generated = TIME_TRACE_EXPR(TimeTrace::CLAUSE_GENERATION, _generator->generateSimplify(cl));
   auto toAdd = TIME_TRACE_ITER(TimeTrace::CLAUSE_GENERATION, std::move(generated.clauses));
 
@@ -1154,7 +1569,14 @@ void SaturationAlgorithm::activate(Clause* cl)
         onParenthood(genCl, premCl);
       }
     }
+
+    // the conclusions are produced as they are pulled, so the rest of them
+    // is not generated at all once the proof is found
+    if (isRefutation(genCl)) {
+      break;
+    }
   }
+  generationTimer.stop();
 
   _clauseActivationInProgress = false;
 
@@ -1182,6 +1604,14 @@ void SaturationAlgorithm::activate(Clause* cl)
 
 /**
  * Perform the loop that puts clauses from the unprocessed to the passive container.
+ *
+ * The clauses are simplified strictly one after another. Forward
+ * simplification is not a read-only pass over the active set: it creates
+ * shared terms in the global TermSharing, updates the statistics and
+ * clause reference counts, and in Otter-style loops a clause added to
+ * passive can already simplify the next unprocessed clause. So a batch of
+ * unprocessed clauses cannot be simplified concurrently without changing
+ * the result.
  */
 void SaturationAlgorithm::doUnprocessedLoop()
 {
@@ -1201,6 +1631,9 @@ void SaturationAlgorithm::doUnprocessedLoop()
       }
       else {
         ASS_EQ(c->store(), Clause::UNPROCESSED);
+        if (_waitingVariants) {
+          _waitingVariants->remove(c);
+        }
         c->setStore(Clause::NONE);
       }
 
@@ -1246,13 +1679,51 @@ UnitList *SaturationAlgorithm::collectSaturatedSet()
 }
 
 /**
+ * Simplify the unprocessed clauses, select a clause from passive and activate it.
+ *
+ * The stages cannot overlap: the children generated by one activation are
+ * inserted into the same indices the next forward simplification queries,
+ * and backward simplification by the given clause may delete the very
+ * clauses the next candidate would be simplified with.
  *
  * This function may throw RefutationFoundException and TimeLimitExceededException.
  */
 void SaturationAlgorithm::doOneAlgorithmStep()
 {
+  if (ClauseExchange::enabled() && env.statistics->activations % CLAUSE_EXCHANGE_INTERVAL == 0) {
+    static ClauseStack received;
+    received.reset();
+    ClauseExchange::receive(received);
+    for (Clause* cl : received) {
+      addNewClause(cl);
+    }
+  }
+
+  if (_bwSimplificationBudget) {
+    TIME_TRACE("backward simplification");
+    PhaseTimer phaseTimer(SaturationPhase::BACKWARD_SIMPLIFICATION);
+    _bwSimplificationBudgetLeft = _bwSimplificationBudget;
+    performQueuedBackwardSimplifications();
+  }
+
   doUnprocessedLoop();
 
+  if (_passiveHotLimit && _passive->sizeEstimate() <= _passiveHotLimit / 2) {
+    _passiveSpillTrigger = 2 * _passiveHotLimit;
+  }
+  if (_spilledPassive.size() && (_passive->isEmpty() || _passive->sizeEstimate() <= _passiveHotLimit / 2)) {
+    restoreSpilledPassive();
+  }
+
+  if (_passive->isEmpty() && _bwSimplificationQueue.isNonEmpty()) {
+    // finish the deferred work before declaring the clause set saturated
+    TIME_TRACE("backward simplification");
+    PhaseTimer phaseTimer(SaturationPhase::BACKWARD_SIMPLIFICATION);
+    _bwSimplificationBudgetLeft = UINT_MAX;
+    performQueuedBackwardSimplifications();
+    doUnprocessedLoop();
+  }
+
   if (_passive->isEmpty()) {
     TerminationReason termReason =
         isComplete() ? TerminationReason::SATISFIABLE : TerminationReason::REFUTATION_NOT_FOUND;
@@ -1281,9 +1752,16 @@ void SaturationAlgorithm::doOneAlgorithmStep()
     _lrsStartInstrs = Timer::elapsedMegaInstructions();
   }
 
+  // unprocessed is empty here, so active and passive are the whole state
+  if (_checkpointInterval && env.statistics->activations % _checkpointInterval == 0
+      && env.statistics->activations != 0) {
+    writeCheckpoint();
+  }
+
   Clause* cl = nullptr;
   {
     TIME_TRACE(TimeTrace::PASSIVE_CONTAINER_MAINTENANCE);
+    PhaseTimer phaseTimer(SaturationPhase::SELECTION);
     cl = _passive->popSelected();
   }
   ASS_EQ(cl->store(), Clause::PASSIVE);
@@ -1302,7 +1780,12 @@ void SaturationAlgorithm::doOneAlgorithmStep()
     ForwardSimplificationEngine *fse = fsit.next();
     Clause *replacement = 0;
     auto premises = ClauseIterator::getEmpty();
-    if (fse->perform(cl, replacement, premises)) {
+    bool reduced;
+    {
+      EngineCostTimer timer(fse->costName());
+      reduced = fse->perform(cl, replacement, premises);
+    }
+    if (reduced) {
       if (replacement) {
         addNewClause(replacement);
       }
@@ -1322,16 +1805,33 @@ void SaturationAlgorithm::doOneAlgorithmStep()
 MainLoopResult SaturationAlgorithm::runImpl()
 {
   unsigned startTime = Timer::elapsedMilliseconds();
+  long startCpuTime = _cpuTimeLimit ? Timer::threadCpuMilliseconds() : 0;
+  unsigned phaseReportInterval = _opt.phaseReportInterval();
+  unsigned nextPhaseReport = startTime + phaseReportInterval;
+  unsigned jsonInterval = _opt.statisticsJson().empty() ? 0 : _opt.statisticsJsonInterval();
+  unsigned nextJsonReport = startTime + jsonInterval;
   try {
     env.statistics->activations = 0;
     while (true) {
       doOneAlgorithmStep(); // will bump env.statistics->activations by one
 
+      if (phaseReportInterval && Timer::elapsedMilliseconds() >= nextPhaseReport) {
+        env.statistics->printPhaseUsageJson(std::cerr);
+        nextPhaseReport = Timer::elapsedMilliseconds() + phaseReportInterval;
+      }
+      if (jsonInterval && Timer::elapsedMilliseconds() >= nextJsonReport) {
+        env.statistics->writeJson();
+        nextJsonReport = Timer::elapsedMilliseconds() + jsonInterval;
+      }
+
       if (_activationLimit && env.statistics->activations > _activationLimit) {
         throw ActivationLimitExceededException();
       }
       if(_softTimeLimit && Timer::elapsedMilliseconds() - startTime > _softTimeLimit)
         throw TimeLimitExceededException();
+      if (_cpuTimeLimit && Timer::threadCpuMilliseconds() - startCpuTime > _cpuTimeLimit) {
+        throw TimeLimitExceededException();
+      }
 
       // Check if timer thread has set termination reason (library mode)
       if (env.statistics->terminationReason == Shell::TerminationReason::TIME_LIMIT) {
@@ -1340,6 +1840,12 @@ MainLoopResult SaturationAlgorithm::runImpl()
       if (env.statistics->terminationReason == Shell::TerminationReason::INSTRUCTION_LIMIT) {
         throw ActivationLimitExceededException();
       }
+      if (s_stepHook && !s_stepHook(s_stepHookData)) {
+        throw TimeLimitExceededException();
+      }
+      if (_memorySoftLimit && Lib::accountedMemoryInUse() > _memoryShedLevel) {
+        shedPassiveOnMemoryPressure();
+      }
     }
   }
   catch (ThrowableBase&) {
@@ -1348,6 +1854,150 @@ MainLoopResult SaturationAlgorithm::runImpl()
   }
 }
 
+/**
+ * Write the active and passive clauses with the symbol declarations they
+ * need to the checkpoint file, as a TPTP problem that a new run can be
+ * started from if this one is killed.
+ *
+ * The clauses are consequences of the input that entail the ones deleted
+ * as redundant, so the problem is equisatisfiable with the input as long as
+ * no clause has been discarded otherwise. Once LRS, a weight limit or the
+ * memory soft limit has thrown a clause away this no longer holds, and a
+ * run resumed from the clauses could report satisfiable for an unsatisfiable
+ * input, so no further checkpoint is written and the last one written before
+ * stays. Each clause keeps its input type, so that clauses descending from
+ * the conjecture are negated_conjecture ones of the resumed problem. Ages,
+ * the LRS limits and similar state restart from scratch in the resumed run.
+ * The file is written under a temporary name and renamed, so that a run
+ * killed meanwhile leaves the previous checkpoint intact.
+ */
+void SaturationAlgorithm::writeCheckpoint()
+{
+  if (env.statistics->discardedNonRedundantClauses) {
+    return;
+  }
+
+  TIME_TRACE("checkpoint");
+
+  std::string file = _opt.checkpointFile();
+  std::string tmp = file + ".tmp";
+  {
+    std::ofstream out(tmp);
+    UIHelper::outputSymbolDeclarations(out);
+    auto print = [&out](Clause* cl) {
+      ASS(cl->noSplits());
+      out << TPTPPrinter::toString(cl);
+    };
+    ClauseIterator ait = _active->clauses();
+    while (ait.hasNext()) {
+      print(ait.next());
+    }
+    DHSet<Clause*>::Iterator pit(*_passiveSet);
+    while (pit.hasNext()) {
+      print(pit.next());
+    }
+    for (const SpilledClause& sc : iterTraits(_spilledPassive.iter())) {
+      print(sc.cl);
+    }
+    if (!out.flush()) {
+      return;
+    }
+  }
+  if (std::rename(tmp.c_str(), file.c_str()) == 0) {
+    env.statistics->checkpointsWritten++;
+  }
+}
+
+/**
+ * Discard the half of the passive clauses that would be selected last, using
+ * the LRS limits so that new clauses beyond them are not retained either.
+ *
+ * Terms are not reclaimed when clauses are deleted during a proof (only the
+ * API collects them, between proofs), so the memory in use does not drop
+ * below the limit again. The next discard therefore only
+ * happens once it has grown by another eighth of the limit.
+ */
+void SaturationAlgorithm::shedPassiveOnMemoryPressure()
+{
+  TIME_TRACE("memory pressure passive discard");
+
+  if (!_passive->isEmpty()) {
+    _passive->updateLimits(_passive->sizeEstimate() / 2, /*retroactive=*/true);
+  }
+  _memoryShedLevel = std::max(_memorySoftLimit, Lib::accountedMemoryInUse() + _memorySoftLimit / 8);
+}
+
+/**
+ * Set aside the passive clauses that would be selected after the first
+ * passive_hot_limit ones. They leave the passive container, and with it the
+ * simplification indexes of Otter, so that they only cost their clause
+ * objects until restoreSpilledPassive() brings them back, the lightest first.
+ *
+ * The tail is found by simulating the selection as LRS does, which sets the
+ * limits the passive container discards clauses by; they are reset to the
+ * maximum afterwards. Clauses depending on AVATAR assumptions stay, as the
+ * splitter expects them in the search space.
+ */
+void SaturationAlgorithm::spillPassiveTail()
+{
+  // the limits are in use for discarding clauses on memory pressure
+  if (_passive->limitsActive()) {
+    return;
+  }
+
+  TIME_TRACE("passive spilling");
+
+  Clause::requestAux();
+  _passive->simulationInit();
+  for (unsigned i = 0; i < _passiveHotLimit && _passive->simulationHasNext(); i++) {
+    _passive->simulationPopSelected();
+  }
+  _passive->setLimitsFromSimulation();
+  Clause::releaseAux();
+
+  static ClauseStack tail;
+  tail.reset();
+  DHSet<Clause*>::Iterator it(*_passiveSet);
+  while (it.hasNext()) {
+    Clause* cl = it.next();
+    if (cl->noSplits() && _passive->exceedsAllLimits(cl)) {
+      tail.push(cl);
+    }
+  }
+  _passive->setLimitsToMax();
+
+  TIME_TRACE(TimeTrace::PASSIVE_CONTAINER_MAINTENANCE);
+  for (Clause* cl : tail) {
+    // the reference keeps the clause while it is out of the search space
+    cl->incRefCnt();
+    _spilledPassive.insert(SpilledClause{cl->weightForClauseSelection(_opt), cl->age(), cl});
+    _passive->remove(cl);
+  }
+  env.statistics->inc(Counter::PASSIVE_SPILLED, tail.size());
+}
+
+/**
+ * Move spilled clauses back to the passive container, in the order of
+ * weight and age, until it holds passive_hot_limit clauses or no clause is
+ * left spilled. A clause set is never saturated with clauses spilled.
+ */
+void SaturationAlgorithm::restoreSpilledPassive()
+{
+  TIME_TRACE(TimeTrace::PASSIVE_CONTAINER_MAINTENANCE);
+
+  unsigned restored = 0;
+  while (!_spilledPassive.isEmpty() && (_passive->isEmpty() || _passive->sizeEstimate() < _passiveHotLimit)) {
+    Clause* cl = _spilledPassive.pop().cl;
+    ASS_EQ(cl->store(), Clause::NONE);
+    cl->setStore(Clause::PASSIVE);
+    _passiveSet->insert(cl);
+    _passive->add(cl);
+    cl->decRefCnt();
+    restored++;
+  }
+  env.statistics->inc(Counter::PASSIVE_RESTORED, restored);
+}
+
 /**
  * Assign an generating inference object @b generator to be used
  *
@@ -1452,78 +2102,78 @@ SaturationAlgorithm *SaturationAlgorithm::createFromOptions(Problem& prb, const
   CompositeGIE *gie = new CompositeGIE();
 
   if(opt.functionDefinitionIntroduction()) {
-    gie->addFront(new DefinitionIntroduction);
+    gie->addFront(costNamed(new DefinitionIntroduction, "definition introduction"));
   }
 
   //TODO here induction is last, is that right?
   if(opt.induction()!=Options::Induction::NONE){
-    gie->addFront(new Induction());
+    gie->addFront(costNamed(new Induction(), "induction"));
   }
 
   if (opt.instantiation() != Options::Instantiation::OFF) {
     res->_instantiation = new Instantiation();
     // res->_instantiation->init();
-    gie->addFront(res->_instantiation);
+    gie->addFront(costNamed(res->_instantiation, "instantiation"));
   }
 
   bool mayHaveEquality = couldEqualityArise(prb,opt);
 
   if (mayHaveEquality) {
     if (!alascaTakesOver) { // in alasca we have a special equality factoring rule
-      gie->addFront(new EqualityFactoring());
+      gie->addFront(costNamed(new EqualityFactoring(), "equality factoring"));
     }
-    gie->addFront(new EqualityResolution());
+    gie->addFront(costNamed(new EqualityResolution(), "equality resolution"));
     if(env.options->superposition() && !alascaTakesOver){ // in alasca we have a special superposition rule
-      gie->addFront(new Superposition());
+      gie->addFront(costNamed(new Superposition(), "superposition"));
     }
   }
   else if (opt.unificationWithAbstraction() != Options::UnificationWithAbstraction::OFF) {
-    gie->addFront(new EqualityResolution());
+    gie->addFront(costNamed(new EqualityResolution(), "equality resolution"));
   }
 
   if (env.options->choiceReasoning()) {
-    gie->addFront(new Choice());
+    gie->addFront(costNamed(new Choice(), "choice"));
   }
 
-  gie->addFront(new Factoring());
+  gie->addFront(costNamed(new Factoring(), "factoring"));
   if (opt.binaryResolution() && !alascaTakesOver) { // in alasca we have a special resolution rule
-    gie->addFront(new BinaryResolution());
+    gie->addFront(costNamed(new BinaryResolution(), "binary resolution"));
   }
   if (opt.unitResultingResolution() != Options::URResolution::OFF) {
     if (env.options->questionAnswering() == Options::QuestionAnsweringMode::SYNTHESIS) {
-      gie->addFront(new URResolution</*synthesis=*/true>(opt.unitResultingResolution() == Options::URResolution::FULL));
+      gie->addFront(costNamed(new URResolution</*synthesis=*/true>(opt.unitResultingResolution() == Options::URResolution::FULL), "unit resulting resolution"));
     } else {
-      gie->addFront(new URResolution</*synthesis=*/false>(opt.unitResultingResolution() == Options::URResolution::FULL));
+      gie->addFront(costNamed(new URResolution</*synthesis=*/false>(opt.unitResultingResolution() == Options::URResolution::FULL), "unit resulting resolution"));
     }
   }
   if (opt.extensionalityResolution() != Options::ExtensionalityResolution::OFF) {
-    gie->addFront(new ExtensionalityResolution());
+    gie->addFront(costNamed(new ExtensionalityResolution(), "extensionality resolution"));
   }
   if (opt.FOOLParamodulation()) {
-    gie->addFront(new FOOLParamodulation());
+    gie->addFront(costNamed(new FOOLParamodulation(), "FOOL paramodulation"));
   }
   if (opt.cases() && prb.hasFOOL() && !opt.casesSimp()) {
-    gie->addFront(new Cases());
+    gie->addFront(costNamed(new Cases(), "cases"));
   }
 
 
   if (opt.injectivityReasoning()) {
-    gie->addFront(new Injectivity());
+    gie->addFront(costNamed(new Injectivity(), "injectivity"));
   }
   if (mayHaveEquality && env.signature->hasTermAlgebras()) {
     if (opt.termAlgebraCyclicityCheck() == Options::TACyclicityCheck::RULE) {
-      gie->addFront(new AcyclicityGIE());
+      gie->addFront(costNamed(new AcyclicityGIE(), "acyclicity"));
     }
     else if (opt.termAlgebraCyclicityCheck() == Options::TACyclicityCheck::RULELIGHT) {
-      gie->addFront(new AcyclicityGIE1());
+      gie->addFront(costNamed(new AcyclicityGIE1(), "acyclicity"));
     }
     if (opt.termAlgebraInferences()) {
-      gie->addFront(new InjectivityGIE());
+      gie->addFront(costNamed(new InjectivityGIE(), "term algebra injectivity"));
     }
   }
   if (env.options->functionDefinitionRewriting()) {
-    gie->addFront(new FunctionDefinitionRewriting());
-    res->addForwardSimplifierToFront(new FunctionDefinitionDemodulation());
+    gie->addFront(costNamed(new FunctionDefinitionRewriting(), "function definition rewriting"));
+    res->addForwardSimplifierToFront(costNamed(new FunctionDefinitionDemodulation(), "function definition demodulation"));
   }
 
   CompositeSGI *sgi = new CompositeSGI();
@@ -1604,7 +2254,7 @@ SaturationAlgorithm *SaturationAlgorithm::createFromOptions(Problem& prb, const
 
 #if VZ3
   if (opt.theoryInstAndSimp() != Shell::Options::TheoryInstSimp::OFF) {
-    sgi->push(new TheoryInstAndSimp());
+    sgi->push(costNamed(new TheoryInstAndSimp(), "theory instantiation"));
   }
 #endif
 
@@ -1617,13 +2267,13 @@ SaturationAlgorithm *SaturationAlgorithm::createFromOptions(Problem& prb, const
 
   // create forward simplification engine
   if (mayHaveEquality && opt.innerRewriting()) {
-    res->addForwardSimplifierToFront(new InnerRewriting());
+    res->addForwardSimplifierToFront(costNamed(new InnerRewriting(), "inner rewriting"));
   }
   if (opt.globalSubsumption()) {
-    res->addForwardSimplifierToFront(new GlobalSubsumption(opt));
+    res->addForwardSimplifierToFront(costNamed(new GlobalSubsumption(opt), "global subsumption"));
   }
   if (opt.forwardLiteralRewriting()) {
-    res->addForwardSimplifierToFront(new ForwardLiteralRewriting());
+    res->addForwardSimplifierToFront(costNamed(new ForwardLiteralRewriting(), "forward literal rewriting"));
   }
   bool subDemodOrdOpt = /* enables ordering optimizations of subsumption demodulation rules */
             opt.termOrdering() == Shell::Options::TermOrdering::KBO
@@ -1633,17 +2283,17 @@ SaturationAlgorithm *SaturationAlgorithm::createFromOptions(Problem& prb, const
     // fsd should be performed after forward subsumption,
     // because every successful forward subsumption will lead to a (useless) match in fsd.
     if (opt.forwardSubsumptionDemodulation()) {
-      res->addForwardSimplifierToFront(new ForwardSubsumptionDemodulation(false, subDemodOrdOpt));
+      res->addForwardSimplifierToFront(costNamed(new ForwardSubsumptionDemodulation(false, subDemodOrdOpt), "forward subsumption demodulation"));
     }
   }
   if (mayHaveEquality) {
     if (opt.forwardGroundJoinability()) {
-      res->addExpensiveForwardSimplifierToFront(new ForwardGroundJoinability());
+      res->addExpensiveForwardSimplifierToFront(costNamed(new ForwardGroundJoinability(), "forward ground joinability"));
     }
     switch (opt.forwardDemodulation()) {
       case Options::Demodulation::ALL:
       case Options::Demodulation::PREORDERED:
-        res->addForwardSimplifierToFront(new ForwardDemodulation());
+        res->addForwardSimplifierToFront(costNamed(new ForwardDemodulation(), "forward demodulation"));
         break;
       case Options::Demodulation::OFF:
         break;
@@ -1656,14 +2306,18 @@ SaturationAlgorithm *SaturationAlgorithm::createFromOptions(Problem& prb, const
 
   if (opt.forwardSubsumption()) {
     if (opt.codeTreeSubsumption()) {
-      res->addForwardSimplifierToFront(new CodeTreeForwardSubsumptionAndResolution(opt.forwardSubsumptionResolution()));
+      res->addForwardSimplifierToFront(costNamed(new CodeTreeForwardSubsumptionAndResolution(opt.forwardSubsumptionResolution()), "forward subsumption"));
     } else {
-      res->addForwardSimplifierToFront(new ForwardSubsumptionAndResolution(opt.forwardSubsumptionResolution()));
+      res->addForwardSimplifierToFront(costNamed(new ForwardSubsumptionAndResolution(opt.forwardSubsumptionResolution()), "forward subsumption"));
     }
   }
   else if (opt.forwardSubsumptionResolution()) {
     USER_ERROR("Forward subsumption resolution requires forward subsumption to be enabled.");
   }
+  // before forward subsumption, which would delete the duplicates as well
+  if (opt.duplicateClauseDeletion()) {
+    res->addForwardSimplifierToFront(costNamed(new DuplicateClauseDeletion(), "duplicate clause deletion"));
+  }
 
   // create backward simplification engine
   if (mayHaveEquality) {
@@ -1797,6 +2451,22 @@ std::pair<CompositeISE*, CompositeISEMany> SaturationAlgorithm::createISE(Proble
       res->addFront(new PushUnaryMinus());
     }
   }
+#if VSPECIALIZED_SATURATION
+  // the engines every strategy starts with, fused into one
+  if (mayHaveEquality) {
+    if (env.options->newTautologyDel()) {
+      res->addFront(new FusedISE<DuplicateLiteralRemovalISE, TautologyDeletionISE2, TautologyDeletionISE, TrivialInequalitiesRemovalISE>());
+    } else {
+      res->addFront(new FusedISE<DuplicateLiteralRemovalISE, TautologyDeletionISE, TrivialInequalitiesRemovalISE>());
+    }
+  } else {
+    if (env.options->newTautologyDel()) {
+      res->addFront(new FusedISE<DuplicateLiteralRemovalISE, TautologyDeletionISE2, TautologyDeletionISE>());
+    } else {
+      res->addFront(new FusedISE<DuplicateLiteralRemovalISE, TautologyDeletionISE>());
+    }
+  }
+#else
   if (mayHaveEquality) {
     res->addFront(new TrivialInequalitiesRemovalISE());
   }
@@ -1805,6 +2475,7 @@ std::pair<CompositeISE*, CompositeISEMany> SaturationAlgorithm::createISE(Proble
     res->addFront(new TautologyDeletionISE2());
   }
   res->addFront(new DuplicateLiteralRemovalISE());
+#endif
 
   if (env.options->questionAnswering() == Options::QuestionAnsweringMode::PLAIN) {
     res->addFront(new AnswerLiteralResolver());
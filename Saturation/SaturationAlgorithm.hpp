@@ -16,8 +16,15 @@
 #ifndef __SaturationAlgorithm__
 #define __SaturationAlgorithm__
 
+#include <fstream>
+#include <memory>
+
 #include "Forwards.hpp"
 
+#include "Lib/BinaryHeap.hpp"
+#include "Lib/DHMap.hpp"
+#include "Lib/DHSet.hpp"
+#include "Lib/Deque.hpp"
 #include "Lib/Event.hpp"
 #include "Lib/List.hpp"
 #include "Lib/ScopedPtr.hpp"
@@ -26,6 +33,7 @@
 #include "Kernel/MainLoop.hpp"
 #include "Kernel/RCClauseStack.hpp"
 
+#include "Indexing/ClauseVariantIndex.hpp"
 #include "Indexing/IndexManager.hpp"
 
 #include "Inferences/InferenceEngine.hpp"
@@ -145,6 +153,19 @@ public:
   // used by FMB's FunctionRelationshipInference
   void setSoftTimeLimit(unsigned milliseconds) { _softTimeLimit = milliseconds; }
 
+  /**
+   * Hook called by the main loop after every activation. If it returns
+   * false, the run stops as if the time limit had been reached.
+   */
+  typedef bool (*StepHook)(void* data);
+
+  /**
+   * Install (or, with @b hook zero, remove) the hook called after every
+   * activation of any subsequent saturation run. Used by the library
+   * API for progress reporting and cancellation.
+   */
+  static void setStepHook(StepHook hook, void* data) { s_stepHook = hook; s_stepHookData = data; }
+
 protected:
   void init() override;
   MainLoopResult runImpl() override;
@@ -154,6 +175,8 @@ protected:
 
   void newClausesToUnprocessed();
   void addUnprocessedClause(Clause* cl);
+  bool hasWaitingVariant(Clause* cl);
+  bool isBatchDuplicate(Clause* cl);
   bool forwardSimplify(Clause* c);
   void backwardSimplify(Clause* c);
   void addToPassive(Clause* c);
@@ -169,14 +192,26 @@ protected:
   virtual void onClauseRetained(Clause* cl);
   /** called before the selected clause is deleted from the searchspace */
   virtual void beforeSelectedRemoved(Clause* cl) {};
+  /** called with the premises of each reduction of @b cl, before @b cl is removed */
+  virtual void onReductionPremises(Clause* cl, const ClauseStack& premises, bool forward) {}
   void onAllProcessed();
   virtual bool isComplete();
   virtual void poppedFromUnprocessed(Clause* cl) {}; // mainly for LRS to inherit and update its estimates there
 
 private:
   void passiveRemovedHandler(Clause* cl);
+  void shedPassiveOnMemoryPressure();
+  void spillPassiveTail();
+  void restoreSpilledPassive();
+  void writeCheckpoint();
+  bool backwardSimplify(Clause* cl, BackwardSimplificationEngine* bse, unsigned* budget);
+  void performQueuedBackwardSimplifications();
   void activeRemovedHandler(Clause* cl);
-  void addInputClause(Clause* cl);
+  void addInputClause(Clause* cl, bool mayHoldBack = true);
+  static void collectTheoryTriggers(Clause* cl, Stack<unsigned>& triggers);
+  static void collectProxyTriggers(Clause* cl, Stack<unsigned>& triggers);
+  bool holdBackAxiom(Clause* cl, const Stack<unsigned>& triggers, DHMap<unsigned, ClauseStack>& lazyAxioms);
+  void releaseAxioms(const Stack<unsigned>& triggers, DHMap<unsigned, ClauseStack>& lazyAxioms);
 
   LiteralSelector& getSosLiteralSelector();
 
@@ -189,6 +224,8 @@ private:
   class PartialSimplificationPerformer;
 
   static SaturationAlgorithm* s_instance;
+  static StepHook s_stepHook;
+  static void* s_stepHookData;
 protected:
   bool _completeOptionSettings;
   bool _clauseActivationInProgress;
@@ -232,6 +269,43 @@ protected:
   Instantiation* _instantiation;
   FunctionDefinitionHandler& _fnDefHandler;
   std::unique_ptr<PartialRedundancyHandler> _partialRedundancyHandler;
+  /**
+   * Variants of the clauses in the unprocessed and passive containers,
+   * used to drop duplicates of waiting clauses as they arrive
+   * (only present with the passive_variant_deduplication option)
+   */
+  ScopedPtr<HashingClauseVariantIndex> _waitingVariants;
+  /**
+   * The clauses in the passive container, which cannot be enumerated
+   * otherwise (only present when writing checkpoints or with the
+   * passive_hot_limit option)
+   */
+  ScopedPtr<DHSet<Clause*>> _passiveSet;
+  /** Where clause events are recorded (only present with the clause_trace option) */
+  std::unique_ptr<std::ofstream> _trace;
+  void traceEvent(const char* event, Clause* cl);
+  /**
+   * The clauses of the current batch of new clauses by an order-independent
+   * hash of their literals (only used with unprocessed_duplicate_elimination)
+   */
+  DHMap<unsigned, ClauseStack> _batchClauses;
+  ClauseStack _batchClauseList;
+  bool _batchDuplicateElimination = false;
+
+  /**
+   * Theory axioms held back from the search, by the interpreted symbols
+   * whose first use in an activated clause adds them (only used with
+   * theory_axioms_lazy); see collectTheoryTriggers for the keys
+   */
+  DHMap<unsigned, ClauseStack> _lazyTheoryAxioms;
+  /**
+   * Congruence axioms of the equality proxy held back from the search, by
+   * their symbols (only used with equality_proxy_lazy); see
+   * collectProxyTriggers
+   */
+  DHMap<unsigned, ClauseStack> _lazyCongruenceAxioms;
+  /** The axioms in _lazyTheoryAxioms and _lazyCongruenceAxioms that were not added yet */
+  DHSet<Clause*> _heldAxioms;
 
   SubscriptionData _passiveContRemovalSData;
   SubscriptionData _activeContRemovalSData;
@@ -258,6 +332,43 @@ private:
 
   // a "soft" time limit in milliseconds, checked manually: 0 is no limit
   unsigned _softTimeLimit = 0;
+  // limit on the CPU time of the saturating thread in milliseconds: 0 is no limit
+  unsigned _cpuTimeLimit = 0;
+  // accounted memory in bytes above which passive clauses are discarded: 0 is no limit
+  size_t _memorySoftLimit = 0;
+  // the level that triggers the next discard, raised after each discard
+  size_t _memoryShedLevel = 0;
+  // activations between two checkpoints: 0 is no checkpointing
+  unsigned _checkpointInterval = 0;
+  // passive clauses kept in the passive container, the tail is spilled: 0 is no limit
+  unsigned _passiveHotLimit = 0;
+  // passive size at which spillPassiveTail() runs next
+  unsigned _passiveSpillTrigger = 0;
+
+  /** A passive clause set aside by spillPassiveTail(), ordered by weight and age */
+  struct SpilledClause {
+    unsigned weight;
+    unsigned age;
+    Clause* cl;
+
+    static Comparison compare(const SpilledClause& c1, const SpilledClause& c2)
+    {
+      Comparison res = Int::compare(c1.weight, c2.weight);
+      return res == EQUAL ? Int::compare(c1.age, c2.age) : res;
+    }
+  };
+  BinaryHeap<SpilledClause, SpilledClause> _spilledPassive;
+
+  /** A clause whose backward simplifications are still to be done, by @b engines */
+  struct BwSimplificationTask {
+    Clause* cl;
+    BwSimplList* engines;
+  };
+  // backward simplifications performed per step: 0 is no limit and no queueing
+  unsigned _bwSimplificationBudget = 0;
+  // what is left of the budget of the current step
+  unsigned _bwSimplificationBudgetLeft = 0;
+  Deque<BwSimplificationTask> _bwSimplificationQueue;
 };
 
 
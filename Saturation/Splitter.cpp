@@ -42,6 +42,7 @@
 #include "SAT/SATInference.hpp"
 #include "SAT/MinimizingSolver.hpp"
 #include "SAT/FallbackSolverWrapper.hpp"
+#include "SAT/PortfolioSATSolver.hpp"
 #include "SAT/CadicalInterfacing.hpp"
 #include "SAT/MinisatInterfacing.hpp"
 #include "SAT/Z3Interfacing.hpp"
@@ -73,6 +74,8 @@ void SplitDefinitionExtra::output(std::ostream &out) const {
 void SplittingBranchSelector::init()
 {
   _literalPolarityAdvice = _parent.getOptions().splittingLiteralPolarityAdvice();
+  _stickyModel = _parent.getOptions().splittingStickyModel();
+  _minimizeModel = _parent.getOptions().splittingMinimizeModel();
 
   SATSolver *inner;
   switch(_parent.getOptions().satSolver()){
@@ -82,6 +85,9 @@ void SplittingBranchSelector::init()
     case Options::SatSolver::CADICAL:
       inner = new CadicalInterfacing;
       break;
+    case Options::SatSolver::PORTFOLIO:
+      inner = new PortfolioSATSolver(new MinisatInterfacing, new CadicalInterfacing);
+      break;
 #if VZ3
     case Options::SatSolver::Z3:
       {
@@ -107,7 +113,13 @@ void SplittingBranchSelector::init()
       new DP::SimpleCongruenceClosure(&_parent.getOrdering()), _parent.satNaming(), *inner);
   }
 
-  ::new(&_solver) ProofProducingSATSolver(inner);
+  bool trackPremises = _parent.getOptions().splittingTrackPremises()
+    || _parent.getOptions().proof() != Options::Proof::OFF
+    || env.colorUsed;
+#if VZ3
+  trackPremises = trackPremises || _parent.getOptions().satSolver() == Options::SatSolver::Z3;
+#endif
+  ::new(&_solver) ProofProducingSATSolver(inner, trackPremises);
 }
 
 void SplittingBranchSelector::updateVarCnt()
@@ -172,6 +184,13 @@ static Color colorFromPossiblyDeepFOConversion(SATClause* scl,Unit*& u)
 
 void SplittingBranchSelector::handleSatRefutation()
 {
+  if(!_solver.tracksPremises()) {
+    // nobody will look at the proof; claim the weaker "Theorem" rather than "ContradictoryAxioms"
+    ASS(!env.colorUsed)
+    throw MainLoop::RefutationFoundException(Clause::empty(
+      NonspecificInference0(UnitInputType::NEGATED_CONJECTURE, InferenceRule::AVATAR_REFUTATION)));
+  }
+
   SATClause *proof = nullptr;
   SATClauseList *satPremises = nullptr;
 #if VZ3
@@ -349,8 +368,23 @@ SAT::Status SplittingBranchSelector::processDPConflicts()
       s2f.collectAssignment(_solver, gndAssignment);
       // ... moreover, _dp->addLiterals will filter the set anyway
 
-      _dp->reset();
-      _dp->addLiterals(pvi( LiteralStack::ConstIterator(gndAssignment) ), false);
+      // the assignment is ordered by SAT variables, so consecutive models
+      // tend to share long prefixes, which stay in the congruence closure
+      unsigned common = 0;
+      while(common<_dpAssignment.size() && common<gndAssignment.size()
+          && _dpAssignment[common]==gndAssignment[common]) {
+        common++;
+      }
+      while(_dpAssignment.size()>common) {
+        _dpAssignment.pop();
+        _dp->pop();
+      }
+      for(unsigned i=common; i<gndAssignment.size(); i++) {
+        Literal* lit = gndAssignment[i];
+        _dp->push();
+        _dp->addLiterals(pvi( getSingletonIterator(lit) ), false);
+        _dpAssignment.push(lit);
+      }
       DecisionProcedure::Status dpStatus = _dp->getStatus(true);
 
       if(dpStatus!=DecisionProcedure::UNSATISFIABLE) {
@@ -452,9 +486,23 @@ void SplittingBranchSelector::addSatClauseToSolver(SATClause* cl)
   }
 
   RSTAT_CTR_INC("ssat_sat_clauses");
+  if (_lastModelValid && !satisfiedByLastModel(cl)) {
+    _lastModelValid = false;
+  }
   _solver.addClause(cl);
 }
 
+bool SplittingBranchSelector::satisfiedByLastModel(SATClause* cl) const
+{
+  for (SATLiteral lit : cl->iter()) {
+    if (lit.var() < _lastModel.size()
+        && _lastModel[lit.var()] == (lit.positive() ? VarAssignment::TRUE : VarAssignment::FALSE)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void SplittingBranchSelector::recomputeModel(SplitLevelStack& addedComps, SplitLevelStack& removedComps)
 {
   ASS(addedComps.isEmpty());
@@ -462,6 +510,18 @@ void SplittingBranchSelector::recomputeModel(SplitLevelStack& addedComps, SplitL
 
   unsigned maxSatVar = _parent.maxSatVar();
 
+  // If the last model satisfies all clauses added since, it is still a
+  // model and the solver need not be called. Variables introduced since
+  // are left unassigned, which only fits a minimized model.
+  if (_lastModelValid && (_minimizeModel || maxSatVar < _lastModel.size())) {
+    RSTAT_CTR_INC("ssat_reused_models");
+    for(unsigned i=1; i<=maxSatVar; i++) {
+      updateSelection(i, i < _lastModel.size() ? _lastModel[i] : VarAssignment::DONT_CARE, addedComps, removedComps);
+    }
+    env.statistics->splitComponentFlips += addedComps.size() + removedComps.size();
+    return;
+  }
+
   SAT::Status stat;
   {
     TIME_TRACE(TimeTrace::AVATAR_SAT_SOLVER);
@@ -479,6 +539,8 @@ void SplittingBranchSelector::recomputeModel(SplitLevelStack& addedComps, SplitL
   }
   ASS_EQ(stat,Status::SATISFIABLE);
 
+  _lastModel.reset();
+  _lastModel.push(VarAssignment::DONT_CARE); // variables start from 1
   for(unsigned i=1; i<=maxSatVar; i++) {
     VarAssignment asgn = _solver.getAssignment(i);
 
@@ -492,8 +554,17 @@ void SplittingBranchSelector::recomputeModel(SplitLevelStack& addedComps, SplitL
       throw MainLoop::MainLoopFinishedException(TerminationReason::REFUTATION_NOT_FOUND);
     }
 
+    _lastModel.push(asgn);
     updateSelection(i, asgn, addedComps, removedComps);
+
+    // let the solver start from this model next time, so that
+    // few components have to be added or removed
+    if (_stickyModel && asgn != VarAssignment::DONT_CARE) {
+      _solver.suggestPolarity(i, asgn == VarAssignment::TRUE);
+    }
   }
+  env.statistics->splitComponentFlips += addedComps.size() + removedComps.size();
+  _lastModelValid = true;
 }
 
 //////////////
@@ -1115,7 +1186,7 @@ Clause* Splitter::buildAndInsertComponentClause(SplitLevel name, unsigned size,
     Clause* temp = Clause::fromIterator(arrayIter(possibly_flipped_lits, size),
         NonspecificInference0(inpType,InferenceRule::AVATAR_DEFINITION));
     Formula* def_f = new BinaryFormula(IFF,
-                 new NamedFormula(formula_name),
+                 new NamedFormula(std::move(formula_name)),
                  Formula::fromClause(temp));
 
     Inference def_u_i = NonspecificInference0(inpType,InferenceRule::AVATAR_DEFINITION);
@@ -1123,7 +1194,7 @@ Clause* Splitter::buildAndInsertComponentClause(SplitLevel name, unsigned size,
     // e.g. when a PureTheoryDescendant ~$less(X1,$sum(X1,1)) | ~$less(X0,X0) splits, the component ~$less(X1,$sum(X1,1)) is not longer a theory lemma
     def_u_i.setInductionDepth(orig->inference().inductionDepth());
     def_u = new FormulaUnit(def_f,def_u_i);
-    InferenceStore::instance()->recordIntroducedSplitName(def_u,formula_name);
+    InferenceStore::instance()->recordIntroducedSplitName(def_u);
     // cout << "Add def " << def_u->toString() << " for " << name << endl;
     ALWAYS(_defs.insert(posName,def_u));
   }
@@ -1564,6 +1635,7 @@ void Splitter::addComponents(const SplitLevelStack& toAdd)
         Clause* cl = chit.next();
         cl->incNumActiveSplits();
         if (cl->getNumActiveSplits() == (int)cl->splits()->size()) {
+          env.statistics->splitClausesReactivated++;
           _sa->addNewClause(cl);
           //check that restored clause does not depend on inactive splits
           ASS(allSplitLevelsActive(cl->splits()));
@@ -1598,9 +1670,9 @@ void Splitter::removeComponents(const SplitLevelStack& toRemove)
       Clause* ccl=chit.next();
       ASS(ccl->splits()->member(bl));
       if(ccl->store()!=Clause::NONE) {
+        env.statistics->splitClausesDeactivated++;
         _sa->removeActiveOrPassiveClause(ccl);
         ASS_EQ(ccl->store(), Clause::NONE);
-      } else {
       }
       ccl->invalidateMyReductionRecords();
       ccl->decNumActiveSplits();
@@ -91,19 +91,32 @@ private:
   void handleSatRefutation();
   void updateSelection(unsigned satVar, VarAssignment asgn,
       SplitLevelStack& addedComps, SplitLevelStack& removedComps);
+  bool satisfiedByLastModel(SATClause* cl) const;
 
   //options
   Options::SplittingLiteralPolarityAdvice _literalPolarityAdvice;
+  bool _stickyModel;
+  bool _minimizeModel;
 
   Splitter& _parent;
 
   ProofProducingSATSolver _solver;
   ScopedPtr<ShortConflictMetaDP> _dp;
+  /**
+   * The ground assignment last given to _dp, one backtracking level per
+   * literal, so that the part shared with the next assignment is kept
+   */
+  LiteralStack _dpAssignment;
 
   /**
    * Contains selected component names (splitlevels)
    */
   ArraySet _selected;
+
+  /** The assignment of the last model, indexed by variable */
+  Stack<VarAssignment> _lastModel;
+  /** True if the clauses added since the last model are satisfied by it */
+  bool _lastModelValid = false;
 };
 
 
@@ -30,6 +30,8 @@
 #include "Kernel/SubstHelper.hpp"
 #include "Kernel/TermIterators.hpp"
 #include "Kernel/OperatorType.hpp"
+#include "Kernel/Matcher.hpp"
+#include "Kernel/Renaming.hpp"
 #include "Kernel/InterpretedLiteralEvaluator.hpp"
 #include "Kernel/TermIterators.hpp"
 
@@ -51,7 +53,10 @@ namespace Inferences
 Clause* AnswerLiteralResolver::simplify(Clause* cl)
 {
   if (isProperAnswerClause(cl)) {
-    return AnswerLiteralManager::getInstance()->getRefutation(cl);
+    return AnswerLiteralManager::getInstance()->handleAnswer(cl);
+  }
+  if (AnswerLiteralManager::getInstance()->isBlocked(cl)) {
+    return nullptr;
   }
   return cl;
 }
@@ -83,6 +88,9 @@ AnswerLiteralManager* AnswerLiteralManager::getInstance()
 
 void AnswerLiteralManager::addAnswerLiterals(Problem& prb)
 {
+  // a new proof starts, whose answers have not been reported yet
+  _reportedAnswers.reset();
+
   if(addAnswerLiterals(prb.units())) {
     prb.invalidateProperty();
   }
@@ -209,7 +217,11 @@ void AnswerLiteralManager::tryOutputAnswer(Clause* refutation, std::ostream& out
   if (!tryGetAnswer(refutation, answer)) {
     return;
   }
+  outputAnswer(answer, out);
+}
 
+void AnswerLiteralManager::outputAnswer(Stack<Clause*>& answer, std::ostream& out)
+{
   DHSet<unsigned> seenSkolems;
 
   out << "% SZS answers Tuple [";
@@ -396,6 +408,106 @@ Clause* AnswerLiteralManager::getResolverClause(unsigned pred)
   return res;
 }
 
+AnswerLiteralManager::AnswerCallback AnswerLiteralManager::s_answerCallback;
+
+AnswerLiteralManager::AnswerCallback AnswerLiteralManager::swapAnswerCallback(AnswerCallback callback)
+{
+  std::swap(s_answerCallback, callback);
+  return callback;
+}
+
+namespace {
+
+/** Binds the variables of a reported answer to the terms of an instance, undoably */
+struct AnswerBinder {
+  DHMap<unsigned, TermList> bindings;
+  Stack<unsigned> bound;
+
+  bool bind(unsigned var, TermList t)
+  {
+    TermList* b;
+    if (bindings.getValuePtr(var, b, t)) {
+      bound.push(var);
+      return true;
+    }
+    return *b == t;
+  }
+  void specVar(unsigned var, TermList t) { ASSERTION_VIOLATION; }
+  void undo(unsigned mark)
+  {
+    while (bound.size() > mark) {
+      bindings.remove(bound.pop());
+    }
+  }
+};
+
+/**
+ * True if the literals of @b base from the @b i-th on have an instance among
+ * the literals of @b cl under one substitution extending that of @b binder
+ */
+bool answerSubsumes(const Stack<Literal*>& base, unsigned i, Clause* cl, AnswerBinder& binder)
+{
+  if (i == base.size()) {
+    return true;
+  }
+  Literal* b = base[i];
+  for (Literal* l : cl->iterLits()) {
+    unsigned mark = binder.bound.size();
+    if (Literal::headersMatch(b, l, false) && (b->arity() == 0 || MatchingUtils::matchArgs(b, l, binder))
+        && answerSubsumes(base, i + 1, cl, binder)) {
+      return true;
+    }
+    binder.undo(mark);
+  }
+  return false;
+}
+
+} // namespace
+
+bool AnswerLiteralManager::subsumedByReported(Clause* cl)
+{
+  for (const Stack<Literal*>& reported : _reportedAnswers) {
+    AnswerBinder binder;
+    if (answerSubsumes(reported, 0, cl, binder)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool AnswerLiteralManager::isBlocked(Clause* cl)
+{
+  return _reportedAnswers.isNonEmpty() && subsumedByReported(cl);
+}
+
+Clause* AnswerLiteralManager::handleAnswer(Clause* cl)
+{
+  unsigned wanted = env.options->questionAnsweringAnswers();
+  // answers under AVATAR assumptions only ever end the search
+  if (wanted == 1 || !cl->noSplits()) {
+    return getRefutation(cl);
+  }
+
+  // a repeated answer, or one with a reported answer among its disjuncts,
+  // only says less; the order of the literals does not matter
+  if (subsumedByReported(cl)) {
+    return nullptr;
+  }
+  _reportedAnswers.push(Stack<Literal*>::fromIterator(cl->iterLits()));
+  // without a callback, the last answer is printed with the refutation
+  bool last = wanted && _reportedAnswers.size() >= wanted;
+  Stack<Clause*> answer;
+  answer.push(cl);
+  if (s_answerCallback) {
+    std::stringstream ss;
+    outputAnswer(answer, ss);
+    s_answerCallback(ss.str());
+  } else if (!last) {
+    outputAnswer(answer, std::cout);
+  }
+  return last ? getRefutation(cl) : nullptr;
+}
+
 Clause* AnswerLiteralManager::getRefutation(Clause* answer)
 {
   unsigned clen = answer->length();
@@ -15,12 +15,14 @@
 #ifndef __AnswerLiteralManager__
 #define __AnswerLiteralManager__
 
+#include <functional>
 #include <vector>
 
 #include "Forwards.hpp"
 
 #include "Lib/DArray.hpp"
 #include "Lib/DHMap.hpp"
+#include "Lib/DHSet.hpp"
 #include "Lib/Environment.hpp"
 #include "Lib/List.hpp"
 
@@ -66,6 +68,35 @@ public:
 
   void tryOutputAnswer(Clause* refutation, std::ostream& out);
 
+  /**
+   * Receives the answers found while the search goes on, as printed by
+   * tryOutputAnswer(); they are printed to std::cout if there is none.
+   */
+  typedef std::function<void(const std::string&)> AnswerCallback;
+  static void setAnswerCallback(AnswerCallback callback) { s_answerCallback = std::move(callback); }
+  /** Install @b callback and return the one installed before, for switching prover contexts */
+  static AnswerCallback swapAnswerCallback(AnswerCallback callback);
+
+  /**
+   * Handle the clause @b cl, which only has answer literals: return the
+   * refutation it gives, or, while more answers are asked for by the
+   * question_answering_answers option, report the answer and return
+   * nullptr, so that the clause is deleted and the search goes on.
+   * Answers subsumed by one reported before, such as repetitions in
+   * another literal order or disjunctions with a reported answer among
+   * their disjuncts, are deleted without being reported again.
+   * With a callback, the answer ending the search is passed to it too.
+   */
+  Clause* handleAnswer(Clause* cl);
+
+  /**
+   * True if the answer literals of @b cl are subsumed by an answer reported
+   * in this proof. Answer literals are never resolved away during the
+   * search, so every answer derived from @b cl would be deleted by
+   * handleAnswer(), and the reported answers block @b cl right away.
+   */
+  bool isBlocked(Clause* cl);
+
   virtual ~AnswerLiteralManager() {}
 
   virtual bool tryGetAnswer(Clause* refutation, Stack<Clause*>& answer);
@@ -102,7 +133,16 @@ protected:
   Clause* getRefutation(Clause* answer);
   Literal* getAnswerLiteral(VList* vars,SList* srts,Formula* f);
 
+  void outputAnswer(Stack<Clause*>& answer, std::ostream& out);
+
 private:
+  static AnswerCallback s_answerCallback;
+
+  bool subsumedByReported(Clause* cl);
+
+  /** the literals of the answers reported by handleAnswer() in the current proof */
+  Stack<Stack<Literal*>> _reportedAnswers;
+
   Unit* tryAddingAnswerLiteral(Unit* unit);
 
   Clause* getResolverClause(unsigned pred);
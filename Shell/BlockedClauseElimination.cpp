@@ -88,6 +88,9 @@ void BlockedClauseElimination::apply(Problem& prb)
     for (unsigned pred = 1; pred < one.size(); pred++) { // skipping 0, the empty slot for equality
       Stack<Candidate*>& predsCandidates = one[pred];
       unsigned predsRemaining = other[pred].size();
+      if (!withinLimit(predsRemaining)) {
+        continue;
+      }
       for (unsigned i = 0; i < predsCandidates.size(); i++) {
         Candidate* cand = predsCandidates[i];
         cand->weight = predsRemaining;
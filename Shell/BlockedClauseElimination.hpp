@@ -38,13 +38,20 @@ public:
    * Equational version of the tautologyhood check is weaker, but has to be used in the presence of positive equalities.
    *
    * The option forceEquationally forces this even if autodetect would safely not use the equational version.
+   *
+   * A literal with more than partnerLimit resolution partners is not tried as a blocking literal (0 means no limit),
+   * which bounds the work spent on literals of very common predicates, as SAT preprocessors do.
   */
-  BlockedClauseElimination(bool forceEquationally = false) : _forceEquationally(forceEquationally) {}
+  BlockedClauseElimination(bool forceEquationally = false, unsigned partnerLimit = 0)
+    : _forceEquationally(forceEquationally), _partnerLimit(partnerLimit) {}
 
   void apply(Kernel::Problem& prb);
 
 private:
   bool _forceEquationally;
+  unsigned _partnerLimit;
+
+  bool withinLimit(unsigned partners) const { return !_partnerLimit || partners <= _partnerLimit; }
 
   struct ClWrapper;
 
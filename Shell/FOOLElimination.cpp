@@ -412,6 +412,21 @@ Formula* FOOLElimination::processAsFormula(TermList terms) {
  * subterms and we don't have to further process it.
  */
 void FOOLElimination::process(Term* term, Context context, TermList& termResult, Formula*& formulaResult) {
+  if (term->shared()) {
+    /**
+     * Special terms are never shared, so neither are terms containing them,
+     * and a shared term comes out unchanged. Returning it right away avoids
+     * walking it as a tree, which for a term sharing many subterms can take
+     * exponentially longer than its size.
+     */
+    if (context == FORMULA_CONTEXT) {
+      formulaResult = toEquality(TermList(term));
+    } else {
+      termResult = TermList(term);
+    }
+    return;
+  }
+
   // collect free variables of the term and their sorts
   // WARNING, this list is leaked in all cases. Sometimes,
   // it becomes the quantified variables of a formula,
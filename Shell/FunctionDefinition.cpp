@@ -531,6 +531,25 @@ typedef pair<unsigned,unsigned> BindingSpec;
 typedef DHMap<BindingSpec, TermList> BindingMap;
 typedef DHMap<BindingSpec, bool> UnfoldedSet;
 
+/**
+ * True if @b lit contains a function whose definition is to be unfolded.
+ *
+ * Unfolding a literal sets up its own maps and stacks and rebuilds the
+ * literal, while most literals of a large problem contain no defined
+ * function at all, so these are filtered out by this cheap scan first.
+ */
+bool FunctionDefinition::hasUnfoldableDefinition(Literal* lit)
+{
+  NonVariableNonTypeIterator nvit(lit);
+  while (nvit.hasNext()) {
+    Def* d;
+    if (_defs.find(nvit.next()->functor(), d) && d->mark != Def::BLOCKED) {
+      return true;
+    }
+  }
+  return false;
+}
+
 Term* FunctionDefinition::applyDefinitions(Literal* lit, Stack<Def*>* usedDefs)
 {
   //cout << "applying definitions to " + lit->toString() << endl;
@@ -693,6 +712,10 @@ Clause* FunctionDefinition::applyDefinitions(Clause* cl)
   bool modified=false;
   for(unsigned i=0;i<clen;i++) {
     Literal* lit=(*cl)[i];
+    if(!hasUnfoldableDefinition(lit)) {
+      resLits->push(lit);
+      continue;
+    }
     Literal* rlit=static_cast<Literal*>(applyDefinitions(lit, &usedDefs));
     resLits->push(rlit);
     modified|= rlit!=lit;
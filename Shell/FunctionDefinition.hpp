@@ -79,6 +79,7 @@ private:
 
   bool isDefined(Term* t);
 
+  bool hasUnfoldableDefinition(Literal* lit);
   Term* applyDefinitions(Literal* t, Stack<Def*>* usedDefs);
   Clause* applyDefinitions(Clause* cl);
 
@@ -81,7 +81,8 @@ void LispParser::parse(EList** expr0)
       case TT_INTEGER:
       case TT_REAL:
       {
-        Expression* subexpr = new Expression(ATOM, t.text, t.line, t.col);
+        // the lexer assigns the text of every token anew, so it can be moved out
+        Expression* subexpr = new Expression(ATOM, std::move(t.text), t.line, t.col);
         EList* sub = new EList(subexpr);
         *expr = sub;
         expr = sub->tailPtr();
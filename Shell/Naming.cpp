@@ -24,6 +24,7 @@
 #include "Kernel/FormulaUnit.hpp"
 #include "Kernel/Inference.hpp"
 #include "Kernel/InferenceStore.hpp"
+#include "Kernel/Renaming.hpp"
 #include "Kernel/Signature.hpp"
 #include "Kernel/SortHelper.hpp"
 #include "Kernel/SubformulaIterator.hpp"
@@ -46,10 +47,13 @@ using namespace Shell;
  *   it will be named.
  * @param preserveEpr If true, names will not be introduced if it would
  *   lead to introduction of non-constant Skolem functions.
+ * @param reuse If true, a subformula that is a variant of an already
+ *   named one is replaced by an instance of the existing name.
  */
-Naming::Naming(int threshold, bool preserveEpr, bool appify) :
+Naming::Naming(int threshold, bool preserveEpr, bool appify, bool reuse) :
     _threshold(threshold + 1), _preserveEpr(preserveEpr), 
-    _appify(appify), _varsInScope(false) {
+    _appify(appify), _varsInScope(false),
+    _reuse(reuse && !appify && !env.colorUsed) {
   ASS(threshold < 32768);
 } // Naming::Naming
 
@@ -81,6 +85,7 @@ FormulaUnit* Naming::apply(FormulaUnit* unit, UnitList*& defs) {
   }
 
   _defs = UnitList::empty();
+  _reusedDefs = UnitList::empty();
 
   // The original recursive call was here:
 
@@ -92,14 +97,14 @@ FormulaUnit* Naming::apply(FormulaUnit* unit, UnitList*& defs) {
 
   if (f == g) { // not changed
     ASS(UnitList::isEmpty(_defs));
+    ASS(UnitList::isEmpty(_reusedDefs));
     defs = UnitList::empty();
     return unit;
   }
-  ASS(UnitList::isNonEmpty(_defs));
-  UnitList::Iterator defit(_defs);
+  ASS(UnitList::isNonEmpty(_defs) || UnitList::isNonEmpty(_reusedDefs));
 
   defs = _defs;
-  UnitList* premises = UnitList::copy(_defs);
+  UnitList* premises = UnitList::concat(UnitList::copy(_defs), _reusedDefs);
   UnitList::push(unit, premises);
   return new FormulaUnit(g,
       FormulaClauseTransformationMany(InferenceRule::DEFINITION_FOLDING, premises));
@@ -1156,6 +1161,23 @@ Formula* Naming::introduceDefinition(Formula* f, bool iff) {
   ASS_NEQ(f->connective(), LITERAL);
   ASS_NEQ(f->connective(), NOT);
 
+  static DefinitionKey key;
+  static Renaming renaming;
+  bool reusable = _reuse && definitionKey(f, renaming, key);
+  if (reusable) {
+    ReusableDefinition* existing = _definitions.findPtr(key);
+    // a one-directional definition only justifies positive occurrences
+    if (existing && (existing->iff || !iff)) {
+      Renaming inverse;
+      inverse.makeInverse(renaming);
+      if (!UnitList::member(existing->definition, _defs) && !UnitList::member(existing->definition, _reusedDefs)) {
+        UnitList::push(existing->definition, _reusedDefs);
+      }
+      env.statistics->reusedFormulaNames++;
+      return new AtomicFormula(inverse.apply(existing->atom));
+    }
+  }
+
   RSTAT_CTR_INC("naming_introduced_defs");
 
   VList* vs = freeVariables(f);
@@ -1185,6 +1207,16 @@ Formula* Naming::introduceDefinition(Formula* f, bool iff) {
   env.statistics->formulaNames++;
   UnitList::push(definition, _defs);
 
+  if (reusable) {
+    // the name may only mention variables of f, or instances of it could
+    // not be recovered through the inverse renaming
+    unsigned boundVars = renaming.nextVar();
+    renaming.normalizeVariables(atom);
+    if (renaming.nextVar() == boundVars) {
+      _definitions.set(key, ReusableDefinition{ renaming.apply(atom), iff, definition });
+    }
+  }
+
   if (env.options->showPreprocessing()) {
     std::cout << "[PP] naming defs: " << definition->toString() << std::endl;
   }
@@ -1192,6 +1224,84 @@ Formula* Naming::introduceDefinition(Formula* f, bool iff) {
   return name;
 } // Naming::introduceDefinition
 
+/**
+ * Write to @b key an encoding of @b f in which every variable is replaced
+ * by its position in the order of first occurrence, recording that
+ * replacement in @b renaming. Formulas that are variants of each other
+ * thus receive the same key. Return false if @b f contains constructs
+ * that are not encoded, in which case its definition is not reused.
+ */
+bool Naming::definitionKey(Formula* f, Renaming& renaming, DefinitionKey& key)
+{
+  renaming.reset();
+  key.reset();
+
+  static Stack<Formula*> todo;
+  todo.reset();
+  todo.push(f);
+  while (todo.isNonEmpty()) {
+    Formula* g = todo.pop();
+    key.push(g->connective());
+    switch (g->connective()) {
+    case LITERAL: {
+      Literal* l = g->literal();
+      if (!l->shared()) {
+        return false;
+      }
+      renaming.normalizeVariables(l);
+      key.push(reinterpret_cast<uintptr_t>(renaming.apply(l)));
+      break;
+    }
+    case AND:
+    case OR: {
+      FormulaList* args = g->args();
+      key.push(FormulaList::length(args));
+      // push in reverse so that the arguments are encoded in order
+      unsigned start = todo.size();
+      FormulaList::Iterator it(args);
+      while (it.hasNext()) {
+        todo.push(it.next());
+      }
+      std::reverse(todo.begin() + start, todo.end());
+      break;
+    }
+    case IMP:
+    case IFF:
+    case XOR:
+      todo.push(g->right());
+      todo.push(g->left());
+      break;
+    case NOT:
+      todo.push(g->uarg());
+      break;
+    case FORALL:
+    case EXISTS: {
+      key.push(VList::length(g->vars()));
+      VList::Iterator vit(g->vars());
+      SList::Iterator sit(g->sorts());
+      while (vit.hasNext()) {
+        key.push(renaming.getOrBind(vit.next()));
+        if (sit.hasNext()) {
+          TermList sort = sit.next();
+          renaming.normalizeVariables(sort);
+          key.push(renaming.apply(sort).content());
+        } else {
+          key.push(0);
+        }
+      }
+      todo.push(g->qarg());
+      break;
+    }
+    case TRUE:
+    case FALSE:
+      break;
+    default:
+      return false;
+    }
+  }
+  return true;
+}
+
 /**
  * Apply naming to a list of subformulas.
  *
@@ -17,6 +17,9 @@
 #ifndef __Naming__
 #define __Naming__
 
+#include "Lib/DHMap.hpp"
+#include "Lib/Stack.hpp"
+
 #include "Kernel/Formula.hpp"
 
 using namespace Kernel;
@@ -30,7 +33,7 @@ namespace Shell {
 class Naming
 {
 public:
-  Naming (int threshold, bool preserveEpr, bool appify);
+  Naming (int threshold, bool preserveEpr, bool appify, bool reuse = false);
   FormulaUnit* apply(FormulaUnit* unit,UnitList*& defs);
 private:
   /** Encodes information about the position of the sub formula */
@@ -137,6 +140,28 @@ private:
 
   /** The list of definitions produced by naming for this unit*/
   UnitList* _defs;
+  /** Definitions of earlier units whose names were reused for this unit */
+  UnitList* _reusedDefs;
+
+  /** Canonical encoding of a formula up to variable renaming */
+  typedef Stack<uintptr_t> DefinitionKey;
+
+  /** A definition introduced earlier, with the variables of its name canonical */
+  struct ReusableDefinition {
+    Literal* atom;
+    bool iff;
+    Unit* definition;
+  };
+
+  /**
+   * If true, names are shared between subformulas that are variants of
+   * each other, also across units.
+   */
+  bool _reuse;
+  /** Definitions introduced so far, by the key of the named formula */
+  DHMap<DefinitionKey, ReusableDefinition> _definitions;
+
+  bool definitionKey(Formula* f, Renaming& renaming, DefinitionKey& key);
 
   /** Replaces the two functions below with a non-recursive implementation. */
   Formula* apply_iter(Formula* top_f);
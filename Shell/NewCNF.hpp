@@ -22,6 +22,7 @@
 #include "Lib/Deque.hpp"
 #include "Lib/SmartPtr.hpp"
 #include "Lib/DHMap.hpp"
+#include "Lib/Option.hpp"
 #include "Kernel/Substitution.hpp"
 #include "Kernel/Formula.hpp" //TODO AYB remove, it is not required in master
 
@@ -390,6 +391,12 @@ private:
       }
     }
 
+    /**
+     * Iterates over the occurrences in valid generalised clauses, unlinking
+     * the invalid ones on the way. The current occurrence is kept by value,
+     * as this runs for every occurrence of every subformula and a heap
+     * allocation per step dominated the cost for large formulas.
+     */
     class Iterator {
     public:
       Iterator(Occurrences &occurrences): _iterator(List<Occurrence>::DelIterator(occurrences._occurrences)) {}
@@ -401,7 +408,7 @@ private:
             _iterator.del();
             continue;
           }
-          _current = SmartPtr<Occurrence>(new Occurrence(occ.gc, occ.position));
+          _current = Option<Occurrence>(std::move(occ));
           return true;
         }
         return false;
@@ -411,7 +418,7 @@ private:
       }
     private:
       List<Occurrence>::DelIterator _iterator;
-      SmartPtr<Occurrence> _current;
+      Option<Occurrence> _current;
     };
   };
 
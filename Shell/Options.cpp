@@ -95,6 +95,11 @@ void Options::init()
     _memoryLimit.description="Attempt to limit memory use (in MB). Limits less than 20MB are ignored to allow Vampire to start. Known not to work on MacOS for mysterious reasons: https://forums.developer.apple.com/forums/thread/702803";
     _lookup.insert(&_memoryLimit);
 
+    _hugePages = BoolOptionValue("huge_pages","hp",false);
+    _hugePages.description="Allocate the memory for small objects, such as terms, clauses and index nodes, in 2 MB blocks backed by transparent huge pages where the system supports them. This saves address translation misses on large runs, at the price of a larger minimum memory footprint.";
+    _lookup.insert(&_hugePages);
+    _hugePages.setExperimental();
+
 #if VAMPIRE_PERF_EXISTS
   _instructionLimit = UnsignedOptionValue("instruction_limit","i",0);
   _instructionLimit.description="Limit the number (in millions) of executed instructions (excluding the kernel ones).";
@@ -207,6 +212,12 @@ void Options::init()
     _multicore.reliesOn(UsingPortfolioTechnology());
     _multicore.tag(OptionTag::PORTFOLIO);
 
+    _portfolioClauseExchange = UnsignedOptionValue("portfolio_clause_exchange","pce",0);
+    _portfolioClauseExchange.description = "When running in portfolio modes with more than one core, let the strategies share the split-free unit clauses up to this weight that they keep in passive. Each shared clause is imported as an axiom by the other strategies that know all its symbols. Set to 0 to share nothing.";
+    _lookup.insert(&_portfolioClauseExchange);
+    _portfolioClauseExchange.reliesOn(UsingPortfolioTechnology());
+    _portfolioClauseExchange.tag(OptionTag::PORTFOLIO);
+
     _slowness = FloatOptionValue("slowness","",1.0);
     _slowness.description = "The factor by which is multiplied the time limit of each configuration in casc/casc_sat/smtcomp/portfolio mode";
     _lookup.insert(&_slowness);
@@ -365,6 +376,27 @@ void Options::init()
     _lookup.insert(&_statistics);
     _statistics.tag(OptionTag::OUTPUT);
 
+    _phaseTiming = BoolOptionValue("phase_timing","pht",false);
+    _phaseTiming.description="Measure the time spent in the phases of the saturation loop (selection, activation, generation,"
+      " forward and backward simplification, splitting) and report it with the statistics. Unlike time profiling,"
+      " this does not need a special build.";
+    _lookup.insert(&_phaseTiming);
+    _phaseTiming.tag(OptionTag::OUTPUT);
+
+    _phaseReportInterval = UnsignedOptionValue("phase_report_interval","phri",0);
+    _phaseReportInterval.description="Print the phase times measured so far as a line of JSON to stderr every this many milliseconds"
+      " of saturation. 0 means never.";
+    _lookup.insert(&_phaseReportInterval);
+    _phaseReportInterval.tag(OptionTag::OUTPUT);
+    _phaseReportInterval.reliesOn(_phaseTiming.is(equal(true)));
+
+    _engineCosts = BoolOptionValue("engine_costs","ecost",false);
+    _engineCosts.description="Charge the time spent in each generating and forward simplification engine, and the clauses,"
+      " index queries and memory created meanwhile, to that engine and report them, most expensive first, with the"
+      " statistics. Use statistics_json_interval to follow them during the run.";
+    _lookup.insert(&_engineCosts);
+    _engineCosts.tag(OptionTag::OUTPUT);
+
     _testId = StringOptionValue("test_id","","unspecified_test"); // Used by spider mode
     _testId.description="";
     _lookup.insert(&_testId);
@@ -397,6 +429,11 @@ void Options::init()
     _timeLimitInMilliseconds.description="Time limit in wall clock seconds, you can use d,s,m,h,D suffixes also i.e. 60s, 5m. Setting it to 0 effectively gives no time limit.";
     _lookup.insert(&_timeLimitInMilliseconds);
 
+    _cpuTimeLimit = TimeLimitOptionValue("cpu_time_limit","ctl",0);
+    _cpuTimeLimit.description="Limit on the CPU time the saturation spends on the thread running it, suffixes as for time_limit; 0 is no limit. "
+      "Checked by the saturation loop itself, so that proofs run on different threads of a library user can have separate budgets.";
+    _lookup.insert(&_cpuTimeLimit);
+
 #if VTIME_PROFILING
     _timeStatistics = BoolOptionValue("time_statistics","tstat",false);
     _timeStatistics.description="Show how much running time was spent in each part of Vampire";
@@ -408,8 +445,25 @@ void Options::init()
     _lookup.insert(&_timeStatisticsFocus);
     _timeStatisticsFocus.tag(OptionTag::OUTPUT);
     _timeStatisticsFocus.onlyUsefulWith(_timeStatistics.is(equal(true)));
+
+    _timeStatisticsSamples = UnsignedOptionValue("time_statistics_samples","tstat_samples",0);
+    _timeStatisticsSamples.description="In addition to the time statistics, sample which part of Vampire is running this many times per second of CPU time (0 means never) and show the counts in the folded format of flame graph tools";
+    _lookup.insert(&_timeStatisticsSamples);
+    _timeStatisticsSamples.tag(OptionTag::OUTPUT);
+    _timeStatisticsSamples.onlyUsefulWith(_timeStatistics.is(equal(true)));
 #endif // VTIME_PROFILING
 
+    _statisticsJson = StringOptionValue("statistics_json","stat_json","");
+    _statisticsJson.description="Also write all the statistics as a line of JSON to this file at the end of the run";
+    _lookup.insert(&_statisticsJson);
+    _statisticsJson.tag(OptionTag::OUTPUT);
+
+    _statisticsJsonInterval = UnsignedOptionValue("statistics_json_interval","stat_json_int",0);
+    _statisticsJsonInterval.description="During saturation, add a line with the statistics so far to the file of statistics_json every this many milliseconds (0 means never)";
+    _lookup.insert(&_statisticsJsonInterval);
+    _statisticsJsonInterval.tag(OptionTag::OUTPUT);
+    _statisticsJsonInterval.onlyUsefulWith(_statisticsJson.is(notEqual(std::string(""))));
+
 //*********************** Input  ***********************
 
     _include = StringOptionValue("include","","");
@@ -483,6 +537,13 @@ void Options::init()
     _useMonoEqualityProxy.onlyUsefulWith(_equalityProxy.is(notEqual(EqualityProxy::OFF)));
     _useMonoEqualityProxy.tag(OptionTag::PREPROCESSING);
 
+    _equalityProxyLazy = BoolOptionValue("equality_proxy_lazy","epl",false);
+    _equalityProxyLazy.description="Hold back the congruence axioms of a symbol from proof search until a clause containing"
+      " the symbol and an equality proxy predicate is activated.";
+    _lookup.insert(&_equalityProxyLazy);
+    _equalityProxyLazy.tag(OptionTag::SATURATION);
+    _equalityProxyLazy.onlyUsefulWith(_equalityProxy.is(equal(EqualityProxy::RSTC)));
+
     _equalityResolutionWithDeletion = BoolOptionValue("equality_resolution_with_deletion","erd",true);
     _equalityResolutionWithDeletion.description="Perform equality resolution with deletion.";
     _lookup.insert(&_equalityResolutionWithDeletion);
@@ -552,6 +613,13 @@ void Options::init()
     _blockedClauseElimination.tag(OptionTag::PREPROCESSING);
     _blockedClauseElimination.addProblemConstraint(notWithCat(Property::UEQ));
 
+    _blockedClauseEliminationLimit = UnsignedOptionValue("blocked_clause_elimination_limit","bcel",0);
+    _blockedClauseEliminationLimit.description="Only try literals with at most this many resolution partners as blocking literals"
+         " in blocked clause elimination. (0 means `no limit`)";
+    _lookup.insert(&_blockedClauseEliminationLimit);
+    _blockedClauseEliminationLimit.tag(OptionTag::PREPROCESSING);
+    _blockedClauseEliminationLimit.onlyUsefulWith(_blockedClauseElimination.is(equal(true)));
+
     _distinctGroupExpansionLimit = UnsignedOptionValue("distinct_group_expansion_limit","dgel",140);
     _distinctGroupExpansionLimit.description = "If a distinct group (defined, e.g., via TPTP's $distinct)"
          " is not larger than this limit, it will be expanded during preprocessing into quadratically many disequalities."
@@ -564,6 +632,13 @@ void Options::init()
     _lookup.insert(&_theoryAxioms);
     _theoryAxioms.tag(OptionTag::PREPROCESSING);
 
+    _theoryAxiomsLazy = BoolOptionValue("theory_axioms_lazy","thal",false);
+    _theoryAxiomsLazy.description="Hold back theory axioms from proof search until a clause containing one of their"
+      " interpreted symbols (other than equality and numerals) is activated.";
+    _lookup.insert(&_theoryAxiomsLazy);
+    _theoryAxiomsLazy.tag(OptionTag::SATURATION);
+    _theoryAxiomsLazy.onlyUsefulWith(_theoryAxioms.is(notEqual(TheoryAxiomLevel::OFF)));
+
     _theoryFlattening = BoolOptionValue("theory_flattening","thf",false);
     _theoryFlattening.description = "Flatten clauses to separate theory and non-theory parts in the input. This is often quickly undone in proof search.";
     _lookup.insert(&_theoryFlattening);
@@ -618,6 +693,12 @@ void Options::init()
     _naming.addHardConstraint(greaterThan(-1));
     _naming.addHardConstraint(notEqual(1));
 
+    _namingReuse = BoolOptionValue("naming_reuse","nmr",false);
+    _namingReuse.description="When naming a subformula that is a variant of an already named one (possibly in another unit), reuse the existing name and definition instead of introducing new ones.";
+    _lookup.insert(&_namingReuse);
+    _namingReuse.onlyUsefulWith(_naming.is(notEqual(0)));
+    _namingReuse.tag(OptionTag::PREPROCESSING);
+
     _newCNF = BoolOptionValue("newcnf","newcnf",false);
     _newCNF.description="Use NewCNF algorithm to do naming, preprocessing and clausification.";
     _lookup.insert(&_newCNF);
@@ -973,6 +1054,14 @@ void Options::init()
     _lookup.insert(&_lookaheadDelay);
     _lookaheadDelay.onlyUsefulWith(_selection.isLookAheadSelection());
 
+    _lookaheadEstimateLifetime = UnsignedOptionValue("lookahead_estimate_lifetime","lel",0);
+    _lookaheadEstimateLifetime.description = "Reuse the inference count that lookahead selection computed for a literal"
+                                             " until the indices have been updated this many times (0 means never reuse)."
+                                             " The counts are approximate then, but far fewer retrievals are needed";
+    _lookaheadEstimateLifetime.tag(OptionTag::SATURATION);
+    _lookup.insert(&_lookaheadEstimateLifetime);
+    _lookaheadEstimateLifetime.onlyUsefulWith(_selection.isLookAheadSelection());
+
     _ageWeightRatio = RatioOptionValue("age_weight_ratio","awr",1,1,':');
     _ageWeightRatio.description=
     "Ratio in which clauses are being selected for activation i.e. A:W means that for every A clauses selected based on age "
@@ -981,6 +1070,14 @@ void Options::init()
     _ageWeightRatio.tag(OptionTag::SATURATION);
     _ageWeightRatio.onlyUsefulWith2(ProperSaturationAlgorithm());
 
+    _clauseScoreCoefficients = StringOptionValue("clause_score_coefficients","csc","");
+    _clauseScoreCoefficients.description=
+    "Comma separated coefficients of a linear model for clause selection, in the order weight,age,length,positive literals,splits,derived from goal "
+    "(missing trailing coefficients are zero). When set, the clauses with the smallest score are selected first, replacing the age and weight queues.";
+    _lookup.insert(&_clauseScoreCoefficients);
+    _clauseScoreCoefficients.tag(OptionTag::SATURATION);
+    _clauseScoreCoefficients.onlyUsefulWith2(ProperSaturationAlgorithm());
+
     _useTheorySplitQueues = BoolOptionValue("theory_split_queue","thsq",false);
     _useTheorySplitQueues.description = "Turn on clause selection using multiple queues containing different clauses (split by amount of theory reasoning)";
     _useTheorySplitQueues.onlyUsefulWith(ProperSaturationAlgorithm());
@@ -1139,6 +1236,28 @@ void Options::init()
       _sineToPredLevels.is(notEqual(PredicateSineLevels::OFF)),
       _useSineLevelSplitQueues.is(equal(true))));
 
+    _adaptivePassiveSimplification = UnsignedOptionValue("adaptive_passive_simplification","aps",0);
+    _adaptivePassiveSimplification.description=
+    "If non-zero, otter and lrs measure every that many new passive clauses whether simplifying with passive clauses pays off"
+    " for the updates of the simplification indexes it needs, and stop or start indexing passive clauses for simplification"
+    " accordingly. Without passive clauses indexed, the saturation loop simplifies like discount.";
+    _lookup.insert(&_adaptivePassiveSimplification);
+    _adaptivePassiveSimplification.tag(OptionTag::SATURATION);
+    _adaptivePassiveSimplification.onlyUsefulWith(Or(_saturationAlgorithm.is(equal(SaturationAlgorithm::LRS)),
+                                                     _saturationAlgorithm.is(equal(SaturationAlgorithm::OTTER))));
+    _adaptivePassiveSimplification.setExperimental();
+
+    _passiveHotLimit = UnsignedOptionValue("passive_hot_limit","phl",0);
+    _passiveHotLimit.description=
+    "If non-zero, otter and discount keep at most twice that many clauses in the passive container. When there are more,"
+    " the clauses that would be selected after that many are set aside, outside of the indexes, and brought back,"
+    " the lightest and oldest first, when fewer than half of them remain. Unlike the lrs limits, this loses no clauses.";
+    _lookup.insert(&_passiveHotLimit);
+    _passiveHotLimit.tag(OptionTag::SATURATION);
+    _passiveHotLimit.onlyUsefulWith(Or(_saturationAlgorithm.is(equal(SaturationAlgorithm::OTTER)),
+                                       _saturationAlgorithm.is(equal(SaturationAlgorithm::DISCOUNT))));
+    _passiveHotLimit.setExperimental();
+
     _lrsFirstTimeCheck = IntOptionValue("lrs_first_time_check","lftc",5);
     _lrsFirstTimeCheck.description=
     "Percentage of time limit at which the LRS algorithm will for the first time estimate the number of reachable clauses.";
@@ -1184,6 +1303,15 @@ void Options::init()
     _lrsEstimateCorrectionCoef.addConstraint(greaterThan(0.0f));
     _lrsEstimateCorrectionCoef.onlyUsefulWith(_saturationAlgorithm.is(equal(SaturationAlgorithm::LRS)));
 
+    _lrsRateSmoothing = FloatOptionValue("lrs_rate_smoothing","lrsrs",0.0);
+    _lrsRateSmoothing.description = "Estimate the activation rate of lrs as an exponential moving average in which the rate seen so far has this weight "
+      "and the rate since the previous estimate the rest. With 0, the average rate since the start of saturation is used.";
+    _lookup.insert(&_lrsRateSmoothing);
+    _lrsRateSmoothing.tag(OptionTag::LRS);
+    _lrsRateSmoothing.addConstraint(greaterThanEq(0.0f));
+    _lrsRateSmoothing.addConstraint(smallerThan(1.0f));
+    _lrsRateSmoothing.onlyUsefulWith(_saturationAlgorithm.is(equal(SaturationAlgorithm::LRS)));
+
   //*********************** Inferences  ***********************
 
 #if VZ3
@@ -1238,6 +1366,14 @@ void Options::init()
     _lookup.insert(&_thiTautologyDeletion);
     _thiTautologyDeletion.setExperimental();
     _thiTautologyDeletion.onlyUsefulWith(_theoryInstAndSimp.is(notEqual(TheoryInstSimp::OFF)));
+
+    _thiTimeout = UnsignedOptionValue("theory_instantiation_timeout", "thito", 0);
+    _thiTimeout.description = "Time limit in milliseconds for each call to z3 made by theory instantiation (0 means no limit)."
+      " A call that runs out of time produces no instance, and saturation goes on with the next clause.";
+    _thiTimeout.tag(OptionTag::THEORIES);
+    _lookup.insert(&_thiTimeout);
+    _thiTimeout.setExperimental();
+    _thiTimeout.onlyUsefulWith(_theoryInstAndSimp.is(notEqual(TheoryInstSimp::OFF)));
 #endif
 
     _unificationWithAbstraction = ChoiceOptionValue<UnificationWithAbstraction>("unification_with_abstraction","uwa",
@@ -1341,6 +1477,13 @@ void Options::init()
     _viras.setExperimental();
     _viras.onlyUsefulWith(_alasca.is(equal(true)));
 
+    _virasMaxLiterals  = UnsignedOptionValue("viras_max_literals","viras_ml",0);
+    _virasMaxLiterals.description= "VIRAS quantifier elimination is not applied to clauses with more than this many arithmetic literals, as the number of clauses it derives grows quickly with them. Set to 0 for no limit.";
+    _lookup.insert(&_virasMaxLiterals);
+    _virasMaxLiterals.tag(OptionTag::INFERENCES);
+    _virasMaxLiterals.setExperimental();
+    _virasMaxLiterals.onlyUsefulWith(_viras.is(equal(true)));
+
     _alascaDemodulation  = BoolOptionValue("alasca_demodulation","alasca_demod",false);
     _alascaDemodulation.description= "Enables the linear arithmetic demodulation rule\n";
     _lookup.insert(&_alascaDemodulation);
@@ -1643,6 +1786,14 @@ void Options::init()
     _backwardSubsumption.addHardConstraint(
         If(notEqual(Subsumption::OFF)).then(_forwardSubsumption.is(notEqual(false))));
 
+    _backwardSimplificationBudget = UnsignedOptionValue("backward_simplification_budget","bsb",0);
+    _backwardSimplificationBudget.description=
+       "Queue the backward simplifications by newly kept clauses and perform at most this many of them per activation,"
+       " so that a very general simplifier does not stall the main loop. 0 means that all are performed immediately.";
+    _lookup.insert(&_backwardSimplificationBudget);
+    _backwardSimplificationBudget.tag(OptionTag::INFERENCES);
+    _backwardSimplificationBudget.onlyUsefulWith(ProperSaturationAlgorithm());
+
     _backwardSubsumptionResolution = ChoiceOptionValue<Subsumption>("backward_subsumption_resolution","bsr",
                     Subsumption::OFF,{"off","on","unit_only"});
     _backwardSubsumptionResolution.description=
@@ -1690,6 +1841,13 @@ void Options::init()
     _condensation.tag(OptionTag::INFERENCES);
     _condensation.onlyUsefulWith(ProperSaturationAlgorithm());
 
+    _duplicateClauseDeletion = BoolOptionValue("duplicate_clause_deletion","dcd",false);
+    _duplicateClauseDeletion.description=
+       "Delete a new clause if a clause with the same literals is kept, by a hash lookup before forward subsumption.";
+    _lookup.insert(&_duplicateClauseDeletion);
+    _duplicateClauseDeletion.tag(OptionTag::INFERENCES);
+    _duplicateClauseDeletion.onlyUsefulWith(ProperSaturationAlgorithm());
+
     _demodulationRedundancyCheck = ChoiceOptionValue<DemodulationRedundancyCheck>("demodulation_redundancy_check","drc",
        DemodulationRedundancyCheck::ENCOMPASS,{"off","ordering","encompass"});
     _demodulationRedundancyCheck.description=
@@ -1708,6 +1866,24 @@ void Options::init()
     _demodulationRedundancyCheck.onlyUsefulWith(Or(_forwardDemodulation.is(notEqual(Demodulation::OFF)),_backwardDemodulation.is(notEqual(Demodulation::OFF))));
     _demodulationRedundancyCheck.addProblemConstraint(hasEquality());
 
+    _forwardDemodulationIrreducibleCache = BoolOptionValue("forward_demodulation_irreducible_cache","fdic",false);
+    _forwardDemodulationIrreducibleCache.description=
+      "Remember the subterms that no demodulator can rewrite, until a new demodulator arrives, and do not look them up again.";
+    _lookup.insert(&_forwardDemodulationIrreducibleCache);
+    _forwardDemodulationIrreducibleCache.tag(OptionTag::INFERENCES);
+    _forwardDemodulationIrreducibleCache.onlyUsefulWith(ProperSaturationAlgorithm());
+    _forwardDemodulationIrreducibleCache.onlyUsefulWith(_forwardDemodulation.is(notEqual(Demodulation::OFF)));
+    _forwardDemodulationIrreducibleCache.addProblemConstraint(hasEquality());
+
+    _forwardDemodulationOrderingCache = BoolOptionValue("forward_demodulation_ordering_cache","fdoc",true);
+    _forwardDemodulationOrderingCache.description=
+      "Remember for a demodulator that is not oriented and a term it matches whether the instance rewrites the term to a smaller one, so that rewriting the term again skips the ordering check.";
+    _lookup.insert(&_forwardDemodulationOrderingCache);
+    _forwardDemodulationOrderingCache.tag(OptionTag::INFERENCES);
+    _forwardDemodulationOrderingCache.onlyUsefulWith(ProperSaturationAlgorithm());
+    _forwardDemodulationOrderingCache.onlyUsefulWith(_forwardDemodulation.is(equal(Demodulation::ALL)));
+    _forwardDemodulationOrderingCache.addProblemConstraint(hasEquality());
+
     _forwardDemodulationTermOrderingDiagrams = BoolOptionValue("forward_demodulation_term_ordering_diagrams","fdtod",true);
     _forwardDemodulationTermOrderingDiagrams.description=
        "Use term ordering diagrams (TODs) to runtime specialize post-ordering checks in forward demodulation.";
@@ -1836,6 +2012,17 @@ void Options::init()
     _lookup.insert(&_forwardSubsumption);
     _forwardSubsumption.tag(OptionTag::INFERENCES);
 
+    _passiveVariantDeduplication = BoolOptionValue("passive_variant_deduplication","pvd",false);
+    _passiveVariantDeduplication.description="Drop a new clause when a variant of it (with a subset of its splits) is already waiting in the unprocessed or passive container. The variants are looked up in a hash index keyed by a variable-renaming invariant hash of the clause.";
+    _lookup.insert(&_passiveVariantDeduplication);
+    _passiveVariantDeduplication.tag(OptionTag::SATURATION);
+
+    _unprocessedDuplicateElimination = BoolOptionValue("unprocessed_duplicate_elimination","ude",false);
+    _unprocessedDuplicateElimination.description="Drop a new clause when a clause with exactly the same literals (and a subset of its splits) was derived in the same step,"
+    " before the immediate simplifications are run on it.";
+    _lookup.insert(&_unprocessedDuplicateElimination);
+    _unprocessedDuplicateElimination.tag(OptionTag::SATURATION);
+
     _forwardSubsumptionResolution = BoolOptionValue("forward_subsumption_resolution","fsr",true);
     _forwardSubsumptionResolution.description="Perform forward subsumption resolution.";
     _lookup.insert(&_forwardSubsumptionResolution);
@@ -1917,6 +2104,22 @@ void Options::init()
     _unitResultingResolution.onlyUsefulWith(ProperSaturationAlgorithm());
     _unitResultingResolution.addProblemConstraint(notJustEquality());
     _unitResultingResolution.addConstraint(If(equal(URResolution::FULL)).then(_splitting.is(equal(true))));
+
+    _unitResultingResolutionBudget = UnsignedOptionValue("unit_resulting_resolution_budget","urrb",0);
+    _unitResultingResolutionBudget.description=
+    "Give up a unit resulting resolution search on a clause once it has created this many partial resolutions,"
+    " without deriving anything from it, so that wide clauses do not stall the main loop. 0 means no limit.";
+    _lookup.insert(&_unitResultingResolutionBudget);
+    _unitResultingResolutionBudget.tag(OptionTag::INFERENCES);
+    _unitResultingResolutionBudget.onlyUsefulWith(_unitResultingResolution.is(notEqual(URResolution::OFF)));
+
+    _unitResultingResolutionFailFirst = BoolOptionValue("unit_resulting_resolution_fail_first","urrff",false);
+    _unitResultingResolutionFailFirst.description=
+    "In a unit resulting resolution search, resolve the literals with the fewest unit clauses to resolve with"
+    " first, so that combinations that cannot be completed fail early.";
+    _lookup.insert(&_unitResultingResolutionFailFirst);
+    _unitResultingResolutionFailFirst.tag(OptionTag::INFERENCES);
+    _unitResultingResolutionFailFirst.onlyUsefulWith(_unitResultingResolution.is(notEqual(URResolution::OFF)));
     // If br has already been set off then this will be forced on, if br has not yet been set
     // then setting this to off will force br on
 
@@ -1927,6 +2130,17 @@ void Options::init()
     _superpositionFromVariables.addProblemConstraint(hasEquality());
     _superpositionFromVariables.onlyUsefulWith(ProperSaturationAlgorithm());
 
+    _superpositionRepeatFilter = BoolOptionValue("superposition_repeat_filter","srf",false);
+    _superpositionRepeatFilter.description=
+      "Remember the superpositions performed so far (by premises, positions and direction) and skip "
+      "those performed already, such as between clauses put back by AVATAR backtracking whose earlier "
+      "conclusions are still around. The set is cleared when it holds 2^22 superpositions.";
+    _lookup.insert(&_superpositionRepeatFilter);
+    _superpositionRepeatFilter.tag(OptionTag::INFERENCES);
+    _superpositionRepeatFilter.addProblemConstraint(hasEquality());
+    _superpositionRepeatFilter.onlyUsefulWith(ProperSaturationAlgorithm());
+    _superpositionRepeatFilter.onlyUsefulWith(_superposition.is(equal(true)));
+
 //*********************** Higher-order  ***********************
 
     _holPrinting = ChoiceOptionValue("pretty_hol_printing",
@@ -2080,6 +2294,22 @@ void Options::init()
     _splittingMinimizeModel.tag(OptionTag::AVATAR);
     _splittingMinimizeModel.onlyUsefulWith(_splitting.is(equal(true)));
 
+    _splittingStickyModel = BoolOptionValue("avatar_sticky_model","asm",false);
+    _splittingStickyModel.description="After each model, suggest its values as the polarities of the SAT variables,"
+                                      " so that the next model flips as few components as possible.";
+    _lookup.insert(&_splittingStickyModel);
+    _splittingStickyModel.tag(OptionTag::AVATAR);
+    _splittingStickyModel.onlyUsefulWith(_splitting.is(equal(true)));
+
+    _splittingTrackPremises = BoolOptionValue("avatar_track_premises","atp",true);
+    _splittingTrackPremises.description="Remember the clauses given to the SAT solver, so that a SAT refutation can be turned into a proof."
+                                        " Off saves the bookkeeping and the proof reconstruction when only the verdict is needed;"
+                                        " this takes effect only with proof off, no colors and no SMT solver."
+                                        " The refutation then has no premises.";
+    _lookup.insert(&_splittingTrackPremises);
+    _splittingTrackPremises.tag(OptionTag::AVATAR);
+    _splittingTrackPremises.onlyUsefulWith(_splitting.is(equal(true)));
+
     _splittingDeleteDeactivated = ChoiceOptionValue<SplittingDeleteDeactivated>("avatar_delete_deactivated","add",
                                                                         SplittingDeleteDeactivated::LARGE_ONLY,{"on","large","off"});
 
@@ -2121,14 +2351,16 @@ void Options::init()
 //*********************** SAT solver (used in various places)  ***********************
     _satSolver = ChoiceOptionValue<SatSolver>("sat_solver","sas",SatSolver::MINISAT, {
       "minisat",
-      "cadical"
+      "cadical",
+      "portfolio"
 #if VZ3
       ,"z3"
 #endif
     });
     _satSolver.description= "Select the SAT solver to be used throughout Vampire."
       " This will be used in AVATAR (for splitting) when the saturation algorithm is discount, lrs or otter."
-      " And for finite model finding when the saturation algorithm is fmb.";
+      " And for finite model finding when the saturation algorithm is fmb."
+      " The portfolio alternates between minisat and cadical with growing conflict budgets until one of them answers.";
     _lookup.insert(&_satSolver);
 #if VZ3
     _satSolver.addHardConstraint(If(equal(SatSolver::Z3)).then(_saturationAlgorithm.is(notEqual(SaturationAlgorithm::FINITE_MODEL_BUILDING))));
@@ -2223,6 +2455,13 @@ void Options::init()
     _questionAnsweringAvoidThese.onlyUsefulWith(_questionAnswering.is(equal(QuestionAnsweringMode::PLAIN)));
     _questionAnsweringAvoidThese.tag(OptionTag::OTHER);
 
+    _questionAnsweringAnswers = UnsignedOptionValue("question_answering_answers","qaa",1);
+    _questionAnsweringAnswers.description="In qa plain mode: the number of distinct answers to find before the search stops (0 means no limit)."
+      " Every answer but the last is printed as soon as it is found, and is then blocked so that the search goes on looking for a different one.";
+    _lookup.insert(&_questionAnsweringAnswers);
+    _questionAnsweringAnswers.onlyUsefulWith(_questionAnswering.is(equal(QuestionAnsweringMode::PLAIN)));
+    _questionAnsweringAnswers.tag(OptionTag::OTHER);
+
     _randomSeed = UnsignedOptionValue("random_seed","",1 /* this should be the value of Random::_seed from Random.cpp */);
     _randomSeed.description="Some parts of vampire use random numbers. This seed allows for reproducibility of results. By default the seed is not changed."
       " Use the non-default value 0 to have vampire query a random_device for always different behaviour.";
@@ -2234,6 +2473,48 @@ void Options::init()
     _lookup.insert(&_activationLimit);
     _activationLimit.tag(OptionTag::SATURATION);
 
+    _memorySoftLimit = UnsignedOptionValue("memory_soft_limit","msl",0);
+    _memorySoftLimit.description="When the memory used by terms, clauses, indices and passive queues exceeds this many MB,"
+    " discard the passive clauses that would be selected last instead of running out of memory. 0 means no limit.";
+    _lookup.insert(&_memorySoftLimit);
+    _memorySoftLimit.tag(OptionTag::SATURATION);
+
+    _checkpointFile = StringOptionValue("checkpoint_file","cpf","");
+    _checkpointFile.description="Periodically write the active and passive clauses to this file as a TPTP problem,"
+    " from which a new run can continue if this one is killed. Requires avatar to be off,"
+    " as clauses depending on splitting assumptions cannot be written. No checkpoint is written once a clause"
+    " has been discarded by LRS, a weight limit or the memory soft limit, as the clauses then need not be"
+    " equisatisfiable with the input.";
+    _lookup.insert(&_checkpointFile);
+    _checkpointFile.tag(OptionTag::SATURATION);
+    _checkpointFile.reliesOn(_splitting.is(equal(false)));
+
+    _checkpointInterval = UnsignedOptionValue("checkpoint_interval","cpi",10000);
+    _checkpointInterval.description="Number of activations between two writes of the checkpoint file.";
+    _lookup.insert(&_checkpointInterval);
+    _checkpointInterval.tag(OptionTag::SATURATION);
+    _checkpointInterval.addConstraint(greaterThan(0u));
+    _checkpointInterval.onlyUsefulWith(_checkpointFile.is(notEqual(std::string(""))));
+
+    _clauseTrace = StringOptionValue("clause_trace","ctr","");
+    _clauseTrace.description="Record the clause events of the saturation in this file, for profiling a"
+    " simplification or index on the exact clause stream of a run. The file is a TPTP problem: every new"
+    " clause appears as cnf(u<number>,...), or as tff(u<number>,...) if it has variables of a sort other than"
+    " $i, and the events are comment lines '% <event> <number>' with the events passive, selected, active,"
+    " removed and 'reduced <number> by <premise numbers>'.";
+    _lookup.insert(&_clauseTrace);
+    _clauseTrace.tag(OptionTag::SATURATION);
+
+    _inferenceLog = StringOptionValue("inference_log","ilog","");
+    _inferenceLog.description="Move the derivation records of the clauses to this file, followed by '.' and the"
+    " process id, once they are passive,"
+    " so that deleted clauses can be freed even if live clauses descend from them, which caps the memory of"
+    " long runs. The proof is rebuilt from the file when a refutation is found and printed in the default"
+    " format; question answering and the proof output options that need the derivations in memory do not"
+    " work with it.";
+    _lookup.insert(&_inferenceLog);
+    _inferenceLog.tag(OptionTag::SATURATION);
+
     // Even if AUTO_KBO resolves to "qkbo" or "lakbo", we still allow KBO suboptions (and possibly ignore them)
     // this is better than the default (to=auto_kbo) warning whenever we touch "kws" or "kmz" ...
     auto KboLike = [this] {
@@ -2405,15 +2686,15 @@ void Options::init()
 
 void Options::copyValuesFrom(const Options& that)
 {
-  //copy across the actual values in that
-  VirtualIterator<AbstractOptionValue*> options = _lookup.values();
-
-  while(options.hasNext()){
-    AbstractOptionValue* opt = options.next();
+  //copy across the actual values in that, both objects number their options the same
+  ASS_EQ(_lookup.size(),that._lookup.size());
+  for(unsigned i = 0; i < _lookup.size(); i++){
+    AbstractOptionValue* opt = _lookup[i];
     if(opt->shouldCopy()){
-      AbstractOptionValue* other = that.getOptionValueByName(opt->longName);
+      AbstractOptionValue* other = that._lookup[i];
       ASS(opt!=other);
-      ALWAYS(opt->set(other->getStringOfActual()));
+      ASS_EQ(opt->longName,other->longName);
+      opt->copyValueFrom(*other);
       // copyValuesFrom preserves whether the option has been user-set
       opt->is_set=other->is_set;
     }
@@ -3375,9 +3656,11 @@ std::string Options::generateEncodedOptions() const
     forbidden.insert(&_scheduleFile);
 
     forbidden.insert(&_memoryLimit);
+    forbidden.insert(&_hugePages);
     forbidden.insert(&_proof);
     forbidden.insert(&_inputSyntax);
     forbidden.insert(&_multicore);
+    forbidden.insert(&_portfolioClauseExchange);
     forbidden.insert(&_statistics);
     forbidden.insert(&_forcedOptions);
 #if VAMPIRE_PERF_EXISTS
@@ -3497,6 +3780,8 @@ bool Options::complete(const Problem& prb) const
 
   // preprocessing for resolution-based algorithms
   if (_sos.actualValue != Sos::OFF) return false;
+  if (_theoryAxiomsLazy.actualValue) return false;
+  if (_equalityProxyLazy.actualValue) return false;
   // run-time rule causing incompleteness
   if (_forwardLiteralRewriting.actualValue) return false;
 
@@ -3526,6 +3811,7 @@ bool Options::complete(const Problem& prb) const
     // binary resolution is off
     if (_unitResultingResolution.actualValue!=URResolution::FULL &&
        (_unitResultingResolution.actualValue!=URResolution::ON || _splitting.actualValue) ) return false;
+    if (_unitResultingResolutionBudget.actualValue) return false;
     return prop.category() == Property::HNE; // enough URR is complete for Horn problems
   }
 
@@ -3646,6 +3932,16 @@ std::vector<A> parseCommaSeparatedList(std::string const& str)
   return parsed;
 }
 
+std::vector<float> Options::clauseScoreCoefficients() const
+{
+  auto coefficients = parseCommaSeparatedList<float>(_clauseScoreCoefficients.actualValue);
+  if (coefficients.size() > 6) {
+    USER_ERROR("Wrong usage of option '-csc'. At most 6 coefficients (weight,age,length,positive literals,splits,goal) can be given");
+  }
+  coefficients.resize(6, 0.0f);
+  return coefficients;
+}
+
 std::vector<int> Options::theorySplitQueueRatios() const
 {
   auto inputRatios = parseCommaSeparatedList<int>(_theorySplitQueueRatios.actualValue);
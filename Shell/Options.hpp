@@ -459,9 +459,10 @@ public:
   /** Possible values for sat_solver */
   enum class SatSolver : unsigned int {
      MINISAT = 0,
-     CADICAL = 1
+     CADICAL = 1,
+     PORTFOLIO = 2
 #if VZ3
-     ,Z3 = 2
+     ,Z3 = 3
 #endif
   };
 
@@ -841,7 +842,8 @@ private:
         // Meta-data
         std::string longName;
         std::string shortName;
-        std::string description;
+        /** always a string literal, so constructing an option does not copy it */
+        const char* description = "";
         bool experimental;
         bool is_set;
 
@@ -861,6 +863,8 @@ private:
 
         // This allows us to get the actual value in string form
         virtual std::string getStringOfActual() const = 0;
+        // Take the actual value of @b that, the same option of another Options object
+        virtual void copyValueFrom(const AbstractOptionValue& that) = 0;
         // Check if default value
         virtual bool isDefault() const = 0;
 
@@ -875,12 +879,12 @@ private:
             }
 
 
-            if(!description.empty()){
+            if(*description){
                 // Break a the description into lines where there have been at least 70 characters
                 // on the line at the next space
                 out << "\t";
                 int count=0;
-                for(const char* p = description.c_str();*p;p++){
+                for(const char* p = description;*p;p++){
                     out << *p;
                     count++;
                     if(linewrap && count>70 && *p==' '){
@@ -953,6 +957,8 @@ private:
         // Getting the string versions of values, useful for output
         virtual std::string getStringOfValue(T value) const{ ASSERTION_VIOLATION;}
         std::string getStringOfActual() const override { return getStringOfValue(actualValue); }
+        void copyValueFrom(const AbstractOptionValue& that) override
+        { actualValue = static_cast<const OptionValue<T>&>(that).actualValue; }
         
         // Adding and checking constraints
         // By default constraints are soft and reaction to them is controlled by the bad_option option
@@ -1180,6 +1186,11 @@ bool setValue(const std::string& value) override {
     return readRatio(value.c_str(),sep);
 }
 
+void copyValueFrom(const AbstractOptionValue& that) override {
+    OptionValue::copyValueFrom(that);
+    otherValue = static_cast<const RatioOptionValue&>(that).otherValue;
+}
+
 char sep;
 int defaultOtherValue;
 int otherValue;
@@ -1211,6 +1222,12 @@ OptionValue(l,s,10.0), numerator(10), denominator(1) {};
 
 bool setValue(const std::string& value) override;
 
+void copyValueFrom(const AbstractOptionValue& that) override {
+    OptionValue::copyValueFrom(that);
+    numerator = static_cast<const NonGoalWeightOptionValue&>(that).numerator;
+    denominator = static_cast<const NonGoalWeightOptionValue&>(that).denominator;
+}
+
 // output does not output numerator and denominator as they
 // are produced from defaultValue
 int numerator;
@@ -1944,6 +1961,11 @@ public:
   std::string testId() const { return _testId.actualValue; }
   std::string protectedPrefix() const { return _protectedPrefix.actualValue; }
   Statistics statistics() const { return _statistics.actualValue; }
+  std::string const& statisticsJson() const { return _statisticsJson.actualValue; }
+  unsigned statisticsJsonInterval() const { return _statisticsJsonInterval.actualValue; }
+  bool phaseTiming() const { return _phaseTiming.actualValue; }
+  bool engineCosts() const { return _engineCosts.actualValue; }
+  unsigned phaseReportInterval() const { return _phaseReportInterval.actualValue; }
   void setStatistics(Statistics newVal) { _statistics.actualValue=newVal; }
   Proof proof() const { return _proof.actualValue; }
   bool minimizeSatProofs() const { return _minimizeSatProofs.actualValue; }
@@ -1952,6 +1974,7 @@ public:
   void setTraceback(bool traceback) { _traceback.actualValue = traceback; }
   std::string printProofToFile() const { return _printProofToFile.actualValue; }
   int naming() const { return _naming.actualValue; }
+  bool namingReuse() const { return _namingReuse.actualValue; }
 
   bool fmbNonGroundDefs() const { return _fmbNonGroundDefs.actualValue; }
   unsigned fmbStartSize() const { return _fmbStartSize.actualValue;}
@@ -1977,6 +2000,7 @@ public:
   unsigned multicore() const { return _multicore.actualValue; }
   void setMulticore(unsigned newVal) { _multicore.actualValue = newVal; }
   float slowness() const {return _slowness.actualValue; }
+  unsigned portfolioClauseExchange() const { return _portfolioClauseExchange.actualValue; }
   InputSyntax inputSyntax() const { return _inputSyntax.actualValue; }
   void setInputSyntax(InputSyntax newVal) { _inputSyntax.actualValue = newVal; }
   bool normalize() const { return _normalize.actualValue; }
@@ -1990,6 +2014,11 @@ public:
   std::string inputFile() const { return _inputFile.actualValue; }
   void resetInputFile() { _inputFile.actualValue = ""; }
   int activationLimit() const { return _activationLimit.actualValue; }
+  unsigned memorySoftLimit() const { return _memorySoftLimit.actualValue; }
+  std::string checkpointFile() const { return _checkpointFile.actualValue; }
+  std::string clauseTrace() const { return _clauseTrace.actualValue; }
+  std::string inferenceLog() const { return _inferenceLog.actualValue; }
+  unsigned checkpointInterval() const { return _checkpointInterval.actualValue; }
   unsigned randomSeed() const { return _randomSeed.actualValue; }
   void setRandomSeed(unsigned seed) { _randomSeed.actualValue = seed; }
   const std::string& strategySamplerFilename() const { return _sampleStrategy.actualValue; }
@@ -2049,6 +2078,7 @@ public:
   TheoryInstSimp theoryInstAndSimp() const { return _theoryInstAndSimp.actualValue; }
   bool thiGeneralise() const { return _thiGeneralise.actualValue; }
   bool thiTautologyDeletion() const { return _thiTautologyDeletion.actualValue; }
+  unsigned thiTimeout() const { return _thiTimeout.actualValue; }
 #endif
   UnificationWithAbstraction unificationWithAbstraction() const { return _unificationWithAbstraction.actualValue; }
   bool unificationWithAbstractionFixedPointIteration() const { return _unificationWithAbstractionFixedPointIteration.actualValue; }
@@ -2058,6 +2088,7 @@ public:
 
   bool unusedPredicateDefinitionRemoval() const { return _unusedPredicateDefinitionRemoval.actualValue; }
   bool blockedClauseElimination() const { return _blockedClauseElimination.actualValue; }
+  unsigned blockedClauseEliminationLimit() const { return _blockedClauseEliminationLimit.actualValue; }
   unsigned distinctGroupExpansionLimit() const { return _distinctGroupExpansionLimit.actualValue; }
   void setUnusedPredicateDefinitionRemoval(bool newVal) { _unusedPredicateDefinitionRemoval.actualValue = newVal; }
   SatSolver satSolver() const { return _satSolver.actualValue; }
@@ -2076,6 +2107,8 @@ public:
   bool binaryResolution() const { return _binaryResolution.actualValue; }
   bool superposition() const {return _superposition.actualValue; }
   URResolution unitResultingResolution() const { return _unitResultingResolution.actualValue; }
+  unsigned unitResultingResolutionBudget() const { return _unitResultingResolutionBudget.actualValue; }
+  bool unitResultingResolutionFailFirst() const { return _unitResultingResolutionFailFirst.actualValue; }
   bool simulatenousSuperposition() const { return _simultaneousSuperposition.actualValue; }
   bool innerRewriting() const { return _innerRewriting.actualValue; }
   bool equationalTautologyRemoval() const { return _equationalTautologyRemoval.actualValue; }
@@ -2087,25 +2120,34 @@ public:
   //void setArityCheck(bool newVal) { _arityCheck=newVal; }
   Demodulation backwardDemodulation() const { return _backwardDemodulation.actualValue; }
   DemodulationRedundancyCheck demodulationRedundancyCheck() const { return _demodulationRedundancyCheck.actualValue; }
+  bool forwardDemodulationIrreducibleCache() const { return _forwardDemodulationIrreducibleCache.actualValue; }
+  bool forwardDemodulationOrderingCache() const { return _forwardDemodulationOrderingCache.actualValue; }
   bool forwardDemodulationTermOrderingDiagrams() const { return _forwardDemodulationTermOrderingDiagrams.actualValue; }
   bool demodulationOnlyEquational() const { return _demodulationOnlyEquational.actualValue; }
 
   //void setBackwardDemodulation(Demodulation newVal) { _backwardDemodulation = newVal; }
   Subsumption backwardSubsumption() const { return _backwardSubsumption.actualValue; }
+  unsigned backwardSimplificationBudget() const { return _backwardSimplificationBudget.actualValue; }
   //void setBackwardSubsumption(Subsumption newVal) { _backwardSubsumption = newVal; }
   Subsumption backwardSubsumptionResolution() const { return _backwardSubsumptionResolution.actualValue; }
   bool backwardSubsumptionDemodulation() const { return _backwardSubsumptionDemodulation.actualValue; }
   unsigned backwardSubsumptionDemodulationMaxMatches() const { return _backwardSubsumptionDemodulationMaxMatches.actualValue; }
   bool forwardSubsumption() const { return _forwardSubsumption.actualValue; }
+  bool passiveVariantDeduplication() const { return _passiveVariantDeduplication.actualValue; }
+  bool unprocessedDuplicateElimination() const { return _unprocessedDuplicateElimination.actualValue; }
   bool forwardLiteralRewriting() const { return _forwardLiteralRewriting.actualValue; }
   int lrsFirstTimeCheck() const { return _lrsFirstTimeCheck.actualValue; }
   int lrsWeightLimitOnly() const { return _lrsWeightLimitOnly.actualValue; }
+  unsigned adaptivePassiveSimplification() const { return _adaptivePassiveSimplification.actualValue; }
+  unsigned passiveHotLimit() const { return _passiveHotLimit.actualValue; }
   int lrsRetroactiveDeletes() const { return _lrsRetroactiveDeletes.actualValue; }
   int lrsPreemptiveDeletes() const { return _lrsPreemptiveDeletes.actualValue; }
   int lookaheadDelay() const { return _lookaheadDelay.actualValue; }
+  unsigned lookaheadEstimateLifetime() const { return _lookaheadEstimateLifetime.actualValue; }
   // setSimulatedTimeLimit takes deciseconds (compatibility) and stores as ms
   void setSimulatedTimeLimit(int newVal) { _simulatedTimeLimit.actualValue = 100 * newVal; }
   float lrsEstimateCorrectionCoef() const { return _lrsEstimateCorrectionCoef.actualValue; }
+  float lrsRateSmoothing() const { return _lrsRateSmoothing.actualValue; }
   TermOrdering termOrdering() const { return _termOrdering.actualValue; }
   SymbolPrecedence symbolPrecedence() const { return _symbolPrecedence.actualValue; }
   SymbolPrecedenceBoost symbolPrecedenceBoost() const { return _symbolPrecedenceBoost.actualValue; }
@@ -2122,12 +2164,14 @@ public:
   int timeLimitInMilliseconds() const { return _timeLimitInMilliseconds.actualValue; }
   // Compatibility wrapper returning deciseconds (= ms / 100)
   int timeLimitInDeciseconds() const { return _timeLimitInMilliseconds.actualValue / 100; }
+  unsigned cpuTimeLimitInMilliseconds() const { return _cpuTimeLimit.actualValue; }
   // Return simulated time limit in milliseconds (for LRS reachability estimation)
   int simulatedTimeLimitInMilliseconds() const { return _simulatedTimeLimit.actualValue; }
   // Compatibility wrapper returning deciseconds
   int simulatedTimeLimit() const { return _simulatedTimeLimit.actualValue / 100; }
   size_t memoryLimit() const { return _memoryLimit.actualValue; }
   void setMemoryLimitOptionValue(size_t newVal) { _memoryLimit.actualValue = newVal; }
+  bool hugePages() const { return _hugePages.actualValue; }
 #if VAMPIRE_PERF_EXISTS
   unsigned instructionLimit() const { return _instructionLimit.actualValue; }
   void setInstructionLimit(unsigned newVal) { _instructionLimit.actualValue = newVal; }
@@ -2141,6 +2185,8 @@ public:
   int ageRatio() const { return _ageWeightRatio.actualValue; }
   void setAgeRatio(int v){ _ageWeightRatio.actualValue = v; }
   int weightRatio() const { return _ageWeightRatio.otherValue; }
+  bool useClauseScore() const { return !_clauseScoreCoefficients.actualValue.empty(); }
+  std::vector<float> clauseScoreCoefficients() const;
   bool useTheorySplitQueues() const { return _useTheorySplitQueues.actualValue; }
   std::vector<int> theorySplitQueueRatios() const;
   std::vector<float> theorySplitQueueCutoffs() const;
@@ -2161,8 +2207,10 @@ public:
   void setWeightRatio(int v){ _ageWeightRatio.otherValue = v; }
   bool literalMaximalityAftercheck() const { return _literalMaximalityAftercheck.actualValue; }
   bool superpositionFromVariables() const { return _superpositionFromVariables.actualValue; }
+  bool superpositionRepeatFilter() const { return _superpositionRepeatFilter.actualValue; }
   EqualityProxy equalityProxy() const { return _equalityProxy.actualValue; }
   bool useMonoEqualityProxy() const { return _useMonoEqualityProxy.actualValue; }
+  bool equalityProxyLazy() const { return _equalityProxyLazy.actualValue; }
   bool equalityResolutionWithDeletion() const { return _equalityResolutionWithDeletion.actualValue; }
   ExtensionalityResolution extensionalityResolution() const { return _extensionalityResolution.actualValue; }
   bool FOOLParamodulation() const { return _FOOLParamodulation.actualValue; }
@@ -2198,6 +2246,7 @@ public:
   QuestionAnsweringMode questionAnswering() const { return _questionAnswering.actualValue; }
   bool questionAnsweringGroundOnly() const { return _questionAnsweringGroundOnly.actualValue; }
   std::string questionAnsweringAvoidThese() const { return _questionAnsweringAvoidThese.actualValue; }
+  unsigned questionAnsweringAnswers() const { return _questionAnsweringAnswers.actualValue; }
   Output outputMode() const { return _outputMode.actualValue; }
   void setOutputMode(Output newVal) { _outputMode.actualValue = newVal; }
   bool ignoreMissingInputsInUnsatCore() {  return _ignoreMissingInputsInUnsatCore.actualValue; }
@@ -2211,12 +2260,15 @@ public:
   void setIgnoreMissing(IgnoreMissing newVal) { _ignoreMissing.actualValue = newVal; }
   bool increasedNumeralWeight() const { return _increasedNumeralWeight.actualValue; }
   TheoryAxiomLevel theoryAxioms() const { return _theoryAxioms.actualValue; }
+  bool theoryAxiomsLazy() const { return _theoryAxiomsLazy.actualValue; }
   //void setTheoryAxioms(bool newValue) { _theoryAxioms = newValue; }
   Condensation condensation() const { return _condensation.actualValue; }
+  bool duplicateClauseDeletion() const { return _duplicateClauseDeletion.actualValue; }
   bool generalSplitting() const { return _generalSplitting.actualValue; }
 #if VTIME_PROFILING
   bool timeStatistics() const { return _timeStatistics.actualValue; }
   std::string const& timeStatisticsFocus() const { return _timeStatisticsFocus.actualValue; }
+  unsigned timeStatisticsSamples() const { return _timeStatisticsSamples.actualValue; }
 #endif // VTIME_PROFILING
   bool splitting() const { return _splitting.actualValue; }
   void setSplitting(bool value){ _splitting.actualValue=value; }
@@ -2266,6 +2318,8 @@ public:
   SplittingNonsplittableComponents splittingNonsplittableComponents() const { return _splittingNonsplittableComponents.actualValue; }
   SplittingAddComplementary splittingAddComplementary() const { return _splittingAddComplementary.actualValue; }
   bool splittingMinimizeModel() const { return _splittingMinimizeModel.actualValue; }
+  bool splittingStickyModel() const { return _splittingStickyModel.actualValue; }
+  bool splittingTrackPremises() const { return _splittingTrackPremises.actualValue; }
   SplittingLiteralPolarityAdvice splittingLiteralPolarityAdvice() const { return _splittingLiteralPolarityAdvice.actualValue; }
   SplittingDeleteDeactivated splittingDeleteDeactivated() const { return _splittingDeleteDeactivated.actualValue;}
   float splittingAvatimer() const { return _splittingAvatimer.actualValue; }
@@ -2281,6 +2335,7 @@ public:
   ArithmeticSimplificationMode gaussianVariableElimination() const { return _gaussianVariableElimination.actualValue; }
   bool alasca() const { return _alasca.actualValue; }
   bool viras() const { return _viras.actualValue; }
+  unsigned virasMaxLiterals() const { return _virasMaxLiterals.actualValue; }
   bool alascaDemodulation() const { return _alascaDemodulation.actualValue; }
   bool alascaStrongNormalization() const { return _alascaStrongNormalization.actualValue; }
   bool alascaIntegerConversion() const { return _alascaIntegerConversion.actualValue; }
@@ -2307,7 +2362,12 @@ public:
 private:
 
     /**
-     * A LookupWrapper is used to wrap up two maps for long and short names and query them
+     * A LookupWrapper is used to wrap up two maps for long and short names and query them.
+     *
+     * Options are numbered in the order init() inserts them, which is the
+     * same for every Options object. The maps from names to numbers are
+     * built by the first object and shared by all of them, so that each
+     * further object only records where its options are.
      */
     struct LookupWrapper {
 
@@ -2319,30 +2379,57 @@ private:
 
         void insert(AbstractOptionValue* option_value){
             ASS(!option_value->longName.empty());
-            bool new_long =  _longMap.insert(option_value->longName,option_value);
+            Registry& reg = registry();
+            unsigned number = _values.size();
+            _values.push(option_value);
+            if(number < reg.longNames.size()){
+                ASS_EQ(reg.longNames[number],option_value->longName);
+                return;
+            }
+            reg.longNames.push(option_value->longName);
+            bool new_long =  reg.longMap.insert(option_value->longName,number);
             bool new_short = true;
             if(!option_value->shortName.empty()){
-                new_short = _shortMap.insert(option_value->shortName,option_value);
+                new_short = reg.shortMap.insert(option_value->shortName,number);
             }
             if(!new_long || !new_short){ std::cout << "Bad " << option_value->longName << std::endl; }
             ASS(new_long && new_short);
         }
         AbstractOptionValue* findLong(std::string longName) const{
-            if(!_longMap.find(longName)){ throw ValueNotFoundException(); }
-            return _longMap.get(longName);
+            unsigned number;
+            if(!registry().longMap.find(longName,number)){ throw ValueNotFoundException(); }
+            return _values[number];
         }
         AbstractOptionValue* findShort(std::string shortName) const{
-            if(!_shortMap.find(shortName)){ throw ValueNotFoundException(); }
-            return _shortMap.get(shortName);
+            unsigned number;
+            if(!registry().shortMap.find(shortName,number)){ throw ValueNotFoundException(); }
+            return _values[number];
         }
 
+        /** The options ordered as by their long names in a DHMap */
         VirtualIterator<AbstractOptionValue*> values() const {
-            return _longMap.range();
+            return pvi(iterTraits(registry().longMap.range())
+              .map([this](unsigned number) { return _values[number]; }));
         }
 
+        /** The number of options */
+        unsigned size() const { return _values.size(); }
+        /** The option numbered @b number */
+        AbstractOptionValue* operator[](unsigned number) const { return _values[number]; }
+
     private:
-        DHMap<std::string,AbstractOptionValue*> _longMap;
-        DHMap<std::string,AbstractOptionValue*> _shortMap;
+        struct Registry {
+            DHMap<std::string,unsigned> longMap;
+            DHMap<std::string,unsigned> shortMap;
+            Stack<std::string> longNames;
+        };
+        static Registry& registry(){
+            static Registry reg;
+            return reg;
+        }
+
+        /** the options of this object by number */
+        Stack<AbstractOptionValue*> _values;
     };
 
     LookupWrapper _lookup;
@@ -2393,6 +2480,7 @@ private:
   BoolOptionValue _encode;
 
   RatioOptionValue _ageWeightRatio;
+  StringOptionValue _clauseScoreCoefficients;
 
   BoolOptionValue _useTheorySplitQueues;
   StringOptionValue _theorySplitQueueRatios;
@@ -2420,6 +2508,7 @@ private:
   ChoiceOptionValue<BadOption> _badOption;
   ChoiceOptionValue<Demodulation> _backwardDemodulation;
   ChoiceOptionValue<Subsumption> _backwardSubsumption;
+  UnsignedOptionValue _backwardSimplificationBudget;
   ChoiceOptionValue<Subsumption> _backwardSubsumptionResolution;
   BoolOptionValue _backwardSubsumptionDemodulation;
   UnsignedOptionValue _backwardSubsumptionDemodulationMaxMatches;
@@ -2427,13 +2516,17 @@ private:
 
   BoolOptionValue _colorUnblocking;
   ChoiceOptionValue<Condensation> _condensation;
+  BoolOptionValue _duplicateClauseDeletion;
 
   ChoiceOptionValue<DemodulationRedundancyCheck> _demodulationRedundancyCheck;
+  BoolOptionValue _forwardDemodulationIrreducibleCache;
+  BoolOptionValue _forwardDemodulationOrderingCache;
   BoolOptionValue _forwardDemodulationTermOrderingDiagrams;
   BoolOptionValue _demodulationOnlyEquational;
 
   ChoiceOptionValue<EqualityProxy> _equalityProxy;
   BoolOptionValue _useMonoEqualityProxy;
+  BoolOptionValue _equalityProxyLazy;
   BoolOptionValue _equalityResolutionWithDeletion;
   BoolOptionValue _equivalentVariableRemoval;
   ChoiceOptionValue<ExtensionalityResolution> _extensionalityResolution;
@@ -2485,6 +2578,8 @@ private:
   BoolOptionValue _innerRewriting;
   BoolOptionValue _equationalTautologyRemoval;
   BoolOptionValue _partialRedundancyCheck;
+  BoolOptionValue _passiveVariantDeduplication;
+  BoolOptionValue _unprocessedDuplicateElimination;
   BoolOptionValue _partialRedundancyOrderingConstraints;
   BoolOptionValue _partialRedundancyAvatarConstraints;
   BoolOptionValue _partialRedundancyLiteralConstraints;
@@ -2529,8 +2624,11 @@ private:
 
   ChoiceOptionValue<LiteralComparisonMode> _literalComparisonMode;
   IntOptionValue _lookaheadDelay;
+  UnsignedOptionValue _lookaheadEstimateLifetime;
   IntOptionValue _lrsFirstTimeCheck;
   BoolOptionValue _lrsWeightLimitOnly;
+  UnsignedOptionValue _adaptivePassiveSimplification;
+  UnsignedOptionValue _passiveHotLimit;
   BoolOptionValue _lrsRetroactiveDeletes;
   BoolOptionValue _lrsPreemptiveDeletes;
 
@@ -2541,6 +2639,7 @@ private:
 #endif
 
   UnsignedOptionValue _memoryLimit; // should be size_t, making an assumption
+  BoolOptionValue _hugePages;
 
   BoolOptionValue _interactive;
 
@@ -2550,10 +2649,12 @@ private:
   StringOptionValue _scheduleFile;
   UnsignedOptionValue _multicore;
   FloatOptionValue _slowness;
+  UnsignedOptionValue _portfolioClauseExchange;
   BoolOptionValue _randomizeSeedForPortfolioWorkers;
   BoolOptionValue _shuffleOnScheduleRepeats;
 
   IntOptionValue _naming;
+  BoolOptionValue _namingReuse;
   BoolOptionValue _nonliteralsInClauseWeight;
   BoolOptionValue _normalize;
   BoolOptionValue _shuffleInput;
@@ -2575,6 +2676,7 @@ private:
   ChoiceOptionValue<QuestionAnsweringMode> _questionAnswering;
   BoolOptionValue _questionAnsweringGroundOnly;
   StringOptionValue _questionAnsweringAvoidThese;
+  UnsignedOptionValue _questionAnsweringAnswers;
 
   UnsignedOptionValue _randomSeed;
   UnsignedOptionValue _randomStrategySeed;
@@ -2582,6 +2684,11 @@ private:
   StringOptionValue _sampleStrategy;
 
   IntOptionValue _activationLimit;
+  UnsignedOptionValue _memorySoftLimit;
+  StringOptionValue _checkpointFile;
+  StringOptionValue _clauseTrace;
+  StringOptionValue _inferenceLog;
+  UnsignedOptionValue _checkpointInterval;
 
   ChoiceOptionValue<SatSolver> _satSolver;
   ChoiceOptionValue<SaturationAlgorithm> _saturationAlgorithm;
@@ -2628,12 +2735,14 @@ private:
   ChoiceOptionValue<TheoryInstSimp> _theoryInstAndSimp;
   BoolOptionValue _thiGeneralise;
   BoolOptionValue _thiTautologyDeletion;
+  UnsignedOptionValue _thiTimeout;
 #endif
   ChoiceOptionValue<UnificationWithAbstraction> _unificationWithAbstraction;
   BoolOptionValue _unificationWithAbstractionFixedPointIteration;
   BoolOptionValue _useACeval;
   TimeLimitOptionValue _simulatedTimeLimit;
   FloatOptionValue _lrsEstimateCorrectionCoef;
+  FloatOptionValue _lrsRateSmoothing;
   UnsignedOptionValue _sineDepth;
   UnsignedOptionValue _sineGeneralityThreshold;
   UnsignedOptionValue _sineToAgeGeneralityThreshold;
@@ -2650,11 +2759,19 @@ private:
   FloatOptionValue _splittingAvatimer;
   ChoiceOptionValue<SplittingNonsplittableComponents> _splittingNonsplittableComponents;
   BoolOptionValue _splittingMinimizeModel;
+  BoolOptionValue _splittingStickyModel;
+  BoolOptionValue _splittingTrackPremises;
   ChoiceOptionValue<SplittingLiteralPolarityAdvice> _splittingLiteralPolarityAdvice;
   ChoiceOptionValue<SplittingDeleteDeactivated> _splittingDeleteDeactivated;
 
   ChoiceOptionValue<Statistics> _statistics;
+  StringOptionValue _statisticsJson;
+  UnsignedOptionValue _statisticsJsonInterval;
+  BoolOptionValue _phaseTiming;
+  BoolOptionValue _engineCosts;
+  UnsignedOptionValue _phaseReportInterval;
   BoolOptionValue _superpositionFromVariables;
+  BoolOptionValue _superpositionRepeatFilter;
   ChoiceOptionValue<TermOrdering> _termOrdering;
   ChoiceOptionValue<SymbolPrecedence> _symbolPrecedence;
   ChoiceOptionValue<SymbolPrecedenceBoost> _symbolPrecedenceBoost;
@@ -2674,19 +2791,25 @@ private:
   BoolOptionValue _ignoreMissingInputsInUnsatCore;
   StringOptionValue _thanks;
   ChoiceOptionValue<TheoryAxiomLevel> _theoryAxioms;
+  BoolOptionValue _theoryAxiomsLazy;
   BoolOptionValue _theoryFlattening;
   BoolOptionValue _ignoreUnrecognizedLogic;
 
   /** Time limit in milliseconds */
   TimeLimitOptionValue _timeLimitInMilliseconds;
+  TimeLimitOptionValue _cpuTimeLimit;
 #if VTIME_PROFILING
   BoolOptionValue _timeStatistics;
   StringOptionValue _timeStatisticsFocus;
+  UnsignedOptionValue _timeStatisticsSamples;
 #endif // VTIME_PROFILING
 
   ChoiceOptionValue<URResolution> _unitResultingResolution;
+  UnsignedOptionValue _unitResultingResolutionBudget;
+  BoolOptionValue _unitResultingResolutionFailFirst;
   BoolOptionValue _unusedPredicateDefinitionRemoval;
   BoolOptionValue _blockedClauseElimination;
+  UnsignedOptionValue _blockedClauseEliminationLimit;
   UnsignedOptionValue _distinctGroupExpansionLimit;
 
   OptionChoiceValues _tagNames;
@@ -2708,6 +2831,7 @@ private:
   ChoiceOptionValue<ArithmeticSimplificationMode> _gaussianVariableElimination;
   BoolOptionValue _alasca;
   BoolOptionValue _viras;
+  UnsignedOptionValue _virasMaxLiterals;
   BoolOptionValue _alascaDemodulation;
   BoolOptionValue _alascaStrongNormalization;
   BoolOptionValue _alascaIntegerConversion;
@@ -100,6 +100,8 @@ void Preprocess::preprocess(Problem& prb)
       !FunctionDefinitionHandler::isHandlerEnabled(_options)) {
       // if the handler is not requested by any of the relevant options, we preprocess away the special definition parsing immediately
     prb.getFunctionDefinitionHandler().initAndPreprocessEarly(prb);
+    // the definition predicates were replaced in place
+    prb.invalidateProperty();
   }
 
   /* CAREFUL, keep this at the beginning of the preprocessing pipeline,
@@ -126,7 +128,8 @@ void Preprocess::preprocess(Problem& prb)
   }
 
   if(_options.guessTheGoal() != Options::GoalGuess::OFF){
-    prb.invalidateProperty();
+    // normalisation and shuffling only reorder, which the property does
+    // not depend on, so it is only recomputed if something else changed
     prb.getProperty();
     GoalGuessing().apply(prb);
   }
@@ -277,6 +280,10 @@ void Preprocess::preprocess(Problem& prb)
       naming(prb);
     }
 
+    // preprocess3 and clausify stay separate passes: the intermediate units are premises
+    // of the clauses and so cannot be freed early anyway, and fusing the passes would
+    // interleave the unit numbers of skolemised formulas and clauses; units hash by their
+    // numbers, so this would change iteration orders and break reproducibility of strategies
     if (prb.mayHaveFormulas()) {
       if (env.options->showPreprocessing())
         std::cout << "preprocess3 (nnf, flatten, skolemize)" << std::endl;
@@ -428,7 +435,8 @@ void Preprocess::preprocess(Problem& prb)
      if(env.options->showPreprocessing())
        std::cout << "blocked clause elimination" << std::endl;
 
-     BlockedClauseElimination bce(/*force_equationally*/_options.saturationAlgorithm() == Options::SaturationAlgorithm::FINITE_MODEL_BUILDING);
+     BlockedClauseElimination bce(/*force_equationally*/_options.saturationAlgorithm() == Options::SaturationAlgorithm::FINITE_MODEL_BUILDING,
+         _options.blockedClauseEliminationLimit());
      bce.apply(prb);
    }
 
@@ -469,6 +477,36 @@ void Preprocess::preprocess(Problem& prb)
 } // Preprocess::preprocess ()
 
 
+/**
+ * Turn the formulas of @b prb into clauses, skipping every step that
+ * depends on the problem as a whole (theory axioms, SInE, removal of
+ * pure or unused predicates, equality proxy, ...).
+ *
+ * The clauses stay equisatisfiable with the formulas when further units
+ * are added to the problem later, so the library uses this to clausify a
+ * fixed axiom set once and then run the full preprocess() for every query
+ * over it. Problems with FOOL or higher-order features are left untouched.
+ */
+void Preprocess::clausifyOnly(Problem& prb)
+{
+  if (!prb.mayHaveFormulas() || prb.hasFOOL() || prb.isHigherOrder()) {
+    return;
+  }
+
+  preprocess1(prb);
+  preprocess2(prb);
+
+  if (_options.newCNF()) {
+    newCnf(prb);
+  } else {
+    if (_options.naming()) {
+      naming(prb);
+    }
+    preprocess3(prb);
+    clausify(prb);
+  }
+}
+
 /**
  * Preprocess the unit using options from opt. Preprocessing may
  * involve inferences and replacement of this unit by a newly inferred one.
@@ -486,6 +524,7 @@ void Preprocess::preprocess(Problem& prb)
 void Preprocess::preprocess1 (Problem& prb)
 {
   ScopedLet<ExecutionPhase> epLet(env.statistics->phase, ExecutionPhase::PREPROCESS_1);
+  TIME_TRACE("preprocess1");
 
   bool formulasSimplified = false;
 
@@ -537,6 +576,7 @@ void Preprocess::preprocess1 (Problem& prb)
 void Preprocess::preprocess2(Problem& prb)
 {
   env.statistics->phase=ExecutionPhase::PREPROCESS_2;
+  TIME_TRACE("preprocess2");
 
   UnitList::DelIterator us(prb.units());
   while (us.hasNext()) {
@@ -568,7 +608,8 @@ void Preprocess::naming(Problem& prb)
   env.statistics->phase=ExecutionPhase::NAMING;
   UnitList::DelIterator us(prb.units());
   //TODO fix the below
-  Naming naming(_options.naming(),false, prb.isHigherOrder()); // For now just force eprPreservingNaming to be false, should update Naming
+  Naming naming(_options.naming(),false, prb.isHigherOrder(), _options.namingReuse()); // For now just force eprPreservingNaming to be false, should update Naming
+  bool modified = false;
   while (us.hasNext()) {
     Unit* u = us.next();
     if (u->isClause()) {
@@ -581,9 +622,12 @@ void Preprocess::naming(Problem& prb)
       ASS(defs);
       us.insert(defs);
       us.replace(v);
+      modified = true;
     }
   }
-  prb.invalidateProperty();
+  if (modified) {
+    prb.invalidateProperty();
+  }
 }
 
 /**
@@ -592,6 +636,7 @@ void Preprocess::naming(Problem& prb)
 void Preprocess::newCnf(Problem& prb)
 {
   env.statistics->phase=ExecutionPhase::NEW_CNF;
+  TIME_TRACE("new cnf");
 
   // TODO: this is an ugly copy-paste of "Preprocess::clausify"
 
@@ -687,6 +732,7 @@ void Preprocess::preprocess3 (Problem& prb)
   bool modified = false;
 
   env.statistics->phase=ExecutionPhase::PREPROCESS_3;
+  TIME_TRACE("preprocess3");
   UnitList::DelIterator us(prb.units());
   while (us.hasNext()) {
     Unit* u = us.next();
@@ -705,6 +751,7 @@ void Preprocess::preprocess3 (Problem& prb)
 void Preprocess::clausify(Problem& prb)
 {
   env.statistics->phase=ExecutionPhase::CLAUSIFICATION;
+  TIME_TRACE("clausification");
 
   //we check if we haven't discovered an empty clause during preprocessing
   Unit* emptyClause = 0;
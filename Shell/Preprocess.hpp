@@ -42,6 +42,7 @@ public:
   {}
   void preprocess(Problem& prb);
   void preprocess1(Problem& prb);
+  void clausifyOnly(Problem& prb);
   /** turn off clausification, can be used when only preprocessing without clausification is needed */
   void turnClausifierOff() {_clausify = false;}
   void keepSimplifyStep() {_stillSimplify = true; }
@@ -530,8 +530,11 @@ void SineTheorySelector::handlePossibleSignatureChange()
 
 /**
  * Connect unit @b u with symbols it defines
+ *
+ * If @b extended is non-null, the symbols whose D-relation list got a new
+ * head are pushed to it, in the order they were extended.
  */
-void SineTheorySelector::updateDefRelation(Unit* u)
+void SineTheorySelector::updateDefRelation(Unit* u, Stack<SymId>* extended)
 {
   SymIdIterator sit0=_symExtr.extractSymIds(u);
 
@@ -576,6 +579,12 @@ void SineTheorySelector::updateDefRelation(Unit* u)
       //only if the symbol is over _genThreshold; otherwise it is already added
       DEntryList::push(DEntry(minTolerance,u),_def[sym]);
     }
+    else {
+      continue;
+    }
+    if (extended) {
+      extended->push(sym);
+    }
   }
 
 }
@@ -613,6 +622,11 @@ void SineTheorySelector::perform(UnitList*& units)
 
   handlePossibleSignatureChange();
 
+  // what the problem adds to the selection structure, to be taken back at the end
+  Stack<SymId> genIncreased;
+  Stack<SymId> defExtended;
+  unsigned theoryUnitsWithoutSymbols=_unitsWithoutSymbols.size();
+
   UnitList::Iterator uit(units);
   while (uit.hasNext()) {
     Unit* u=uit.next();
@@ -620,6 +634,7 @@ void SineTheorySelector::perform(UnitList*& units)
     while (sit.hasNext()) {
       SymId sid=sit.next();
       _gen[sid]++;
+      genIncreased.push(sid);
     }
   }
 
@@ -638,7 +653,7 @@ void SineTheorySelector::perform(UnitList*& units)
                    || (env.options->guessTheGoal() != Options::GoalGuess::OFF && u->inputType()==UnitInputType::ASSUMPTION));
 
     if (performSelection) {
-      updateDefRelation(u);
+      updateDefRelation(u, &defExtended);
     }
     else {
       selected.insert(u);
@@ -702,6 +717,16 @@ void SineTheorySelector::perform(UnitList*& units)
   env.statistics->sineIterations=depth;
   env.statistics->selectedBySine=_unitsWithoutSymbols.size() + selected.size();
 
+  // restore the selection structure of the theory; the problem's entries
+  // are the most recent heads of their lists
+  while (defExtended.isNonEmpty()) {
+    DEntryList::pop(_def[defExtended.pop()]);
+  }
+  for (SymId sid : genIncreased) {
+    _gen[sid]--;
+  }
+  _unitsWithoutSymbols.truncate(theoryUnitsWithoutSymbols);
+
 #if SINE_PRINT_SELECTED
   UnitList::Iterator selIt(units);
   while (selIt.hasNext()) {
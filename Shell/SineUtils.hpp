@@ -108,7 +108,9 @@ private:
  * sharing the same set of theory axioms
  *
  * First init the selection structure by @b initSelectionStructure() and
- * then select axioms for a particular problem by @b addSelectedAxioms()
+ * then select axioms for a particular problem by @b perform(). The selection
+ * structure is left as it was by @b perform(), so it can be used for any
+ * number of problems.
  */
 class SineTheorySelector
 : public SineBase
@@ -130,7 +132,7 @@ private:
 
   void handlePossibleSignatureChange();
 
-  void updateDefRelation(Unit* u);
+  void updateDefRelation(Unit* u, Stack<SymId>* extended = nullptr);
 
   unsigned _genThreshold;
 
@@ -14,6 +14,8 @@
  * @since 02/01/2008 Manchester
  */
 
+#include <algorithm>
+#include <fstream>
 #include <iostream>
 
 #include "Debug/RuntimeStatistics.hpp"
@@ -25,6 +27,8 @@
 
 #include "Shell/UIHelper.hpp"
 
+#include "Indexing/Index.hpp"
+
 #include "Saturation/SaturationAlgorithm.hpp"
 
 #include "Options.hpp"
@@ -63,6 +67,197 @@ void Statistics::explainRefutationNotFound(std::ostream& out)
   }
 }
 
+struct Statistics::Entry {
+  Entry(string name, string total, string inproof = string())
+    : name(name), total(total), inproof(inproof) {}
+  string name;
+  string total;
+  string inproof;
+};
+
+struct Statistics::Group {
+  Group(string name, bool infGroup = false) : name(name), infGroup(infGroup) {}
+  void addEntry(string name, unsigned total, unsigned inproof = 0) {
+    ASS(infGroup || inproof == 0);
+    ASS(total);
+    ASS_GE(total, inproof);
+    entries.emplace(name, Int::toString(total), Int::toString(inproof));
+  }
+
+  string name;
+  Stack<Entry> entries;
+  bool infGroup;
+};
+
+/** Collect the counters shown by the full statistics, in the groups they are shown in */
+void Statistics::collectGroups(Stack<Group>& groups)
+{
+#define GROUP(name) groups.emplace(name);
+#define ENTRY(name, num) if (num) { groups.top().addEntry(name, num); }
+
+#define IPGROUP(name) groups.emplace(name, /*inproof=*/true);
+#define IPENTRY(name, statpair) ASS_GE(statpair[TOTAL_CNT], statpair[INPROOF_CNT]); \
+  if (statpair[TOTAL_CNT]) { groups.top().addEntry(name, statpair[TOTAL_CNT], statpair[INPROOF_CNT]); }
+
+  IPGROUP("INPUT");
+  for (unsigned i : range(toNumber(UnitInputType::AXIOM),toNumber(UnitInputType::MODEL_DEFINITION))) {
+    IPENTRY(capitalize(inputTypeName(static_cast<UnitInputType>(i))), inputTypeCnts[i]);
+  }
+
+  auto outputInfGroup = [&](string name, InferenceRule first, InferenceRule last) {
+    ASS_L(toNumber(first),toNumber(last));
+    IPGROUP(name);
+    for (unsigned i : range(toNumber(first),toNumber(last))) {
+      IPENTRY(capitalize(ruleName(static_cast<InferenceRule>(i))), inferenceCnts[i]);
+    }
+  };
+
+  outputInfGroup("FORMULA TRANSFORMATIONS", InferenceRule::GENERIC_FORMULA_CLAUSE_TRANSFORMATION, InferenceRule::GENERIC_FORMULA_CLAUSE_TRANSFORMATION_LAST);
+  outputInfGroup("SIMPLIFYING INFERENCES", InferenceRule::GENERIC_SIMPLIFYING_INFERENCE, InferenceRule::GENERIC_SIMPLIFYING_INFERENCE_LAST);
+  outputInfGroup("GENERATING INFERENCES", InferenceRule::GENERIC_GENERATING_INFERENCE, InferenceRule::GENERIC_GENERATING_INFERENCE_LAST);
+  outputInfGroup("THEORY AXIOMS", InferenceRule::GENERIC_THEORY_AXIOM, InferenceRule::GENERIC_THEORY_AXIOM_LAST);
+  outputInfGroup("AVATAR", InferenceRule::GENERIC_AVATAR_INFERENCE, InferenceRule::GENERIC_AVATAR_INFERENCE_LAST);
+  outputInfGroup("MISCELLANEOUS INFERENCES", InferenceRule::GENERIC_GENERATING_INFERENCE_LAST, InferenceRule::GENERIC_AVATAR_INFERENCE);
+
+  IPGROUP("CLAUSES/FORMULAS");
+  IPENTRY("Input clauses", inputClauses);
+  IPENTRY("Input formulas", inputFormulas);
+  IPENTRY("Clauses", clauses);
+  IPENTRY("Formulas", formulas);
+
+  GROUP("PREPROCESSING");
+  ENTRY("Introduced names", formulaNames);
+  ENTRY("Reused names", reusedFormulaNames);
+  ENTRY("Introduced skolems", skolemFunctions);
+  ENTRY("Pure predicates", purePredicates);
+  ENTRY("Unused predicate definitions", unusedPredicateDefinitions);
+  ENTRY("Function definitions", eliminatedFunctionDefinitions);
+  ENTRY("Selected by SInE selection", selectedBySine);
+  ENTRY("SInE iterations", sineIterations);
+  ENTRY("Blocked clauses", blockedClauses);
+  ENTRY("Split inequalities", splitInequalities);
+
+  GROUP("SATURATION");
+  ENTRY("Initial clauses", initialClauses);
+  ENTRY("Lazily added theory axioms", lazyTheoryAxioms);
+  ENTRY("Lazily added congruence axioms", lazyCongruenceAxioms);
+  ENTRY("Activations started", activations);
+  ENTRY("Active clauses", activeClauses);
+  ENTRY("Passive clauses", passiveClauses);
+  ENTRY("Extensionality clauses", extensionalityClauses);
+  ENTRY("Final active clauses", finalActiveClauses);
+  ENTRY("Final passive clauses", finalPassiveClauses);
+  ENTRY("Final extensionality clauses", finalExtensionalityClauses);
+  ENTRY("Discarded non-redundant clauses", discardedNonRedundantClauses);
+  ENTRY("LRS reachable estimate", lrsReachableEstimate);
+  ENTRY("Exported clauses", exportedClauses);
+  ENTRY("Imported clauses", importedClauses);
+  ENTRY("Checkpoints written", checkpointsWritten);
+
+  GROUP("SIMPLIFYING INFERENCES");
+  ENTRY("Duplicate literals", duplicateLiterals);
+  ENTRY("Trivial inequalities", trivialInequalities);
+
+  GROUP("DELETION INFERENCES");
+  ENTRY("Simple tautologies", simpleTautologies);
+  ENTRY("Equational tautologies", equationalTautologies);
+  ENTRY("Deep equational tautologies", deepEquationalTautologies);
+  ENTRY("Forward subsumptions", forwardSubsumed);
+  ENTRY("Backward subsumptions", backwardSubsumed);
+  ENTRY("Passive variant duplicates", passiveVariantDuplicates);
+  ENTRY("Unprocessed duplicates", unprocessedDuplicates);
+  ENTRY("Forward ground joinable", forwardGroundJoinable);
+  ENTRY("Ground joinability diagram checks", groundJoinabilityDiagramChecks);
+  ENTRY("Ground joinability preordered rewrites", groundJoinabilityPreorderedRewrites);
+  ENTRY("Fw demodulations to eq. taut.", forwardDemodulationsToEqTaut);
+  ENTRY("Bw demodulations to eq. taut.", backwardDemodulationsToEqTaut);
+  ENTRY("Fw subsumption demodulations to eq. taut.", forwardSubsumptionDemodulationsToEqTaut);
+  ENTRY("Bw subsumption demodulations to eq. taut.", backwardSubsumptionDemodulationsToEqTaut);
+  ENTRY("Inner rewrites to eq. taut.", innerRewritesToEqTaut);
+
+  GROUP("INDUCTION");
+  ENTRY("MaxInductionDepth",maxInductionDepth);
+  ENTRY("InductionApplications",inductionApplication);
+  ENTRY("InductionFormulasReused",inductionFormulasReused);
+
+  GROUP("REDUNDANT INFERENCES");
+  ENTRY("Skipped superposition", skippedSuperposition);
+  ENTRY("Skipped repeated superposition", skippedRepeatedSuperposition);
+  ENTRY("Skipped resolution", skippedResolution);
+  ENTRY("Due to ordering constraints", inferencesSkippedDueToOrderingConstraints);
+  ENTRY("Due to AVATAR constraints", inferencesSkippedDueToAvatarConstraints);
+  ENTRY("Due to literal constraints", inferencesSkippedDueToLiteralConstraints);
+  ENTRY("Due to colors", inferencesSkippedDueToColors);
+  ENTRY("Due to ordering aftercheck", inferencesBlockedDueToOrderingAftercheck);
+
+  GROUP("AVATAR");
+  ENTRY("Split clauses", splitClauses);
+  ENTRY("Split components", splitComponents);
+  ENTRY("Split component flips", splitComponentFlips);
+  ENTRY("Split clauses deactivated", splitClausesDeactivated);
+  ENTRY("Split clauses reactivated", splitClausesReactivated);
+  ENTRY("Sat splitting refutations", satSplitRefutations);
+  ENTRY("SMT fallbacks",smtFallbacks);
+  ENTRY("SAT portfolio switches",satPortfolioSwitches);
+
+  //TODO record statistics for FMB
+
+  //TODO record statistics for MiniSAT
+  GROUP("SAT SOLVER");
+  ENTRY("SAT solver clauses", satClauses);
+  ENTRY("SAT solver unit clauses", unitSatClauses);
+  ENTRY("SAT solver binary clauses", binarySatClauses);
+  ENTRY("Theory instantiation cache hits", theoryInstCacheHits);
+
+  GROUP("INDICES");
+  for (const auto& [name, usage] : indexUsage) {
+    ENTRY(name + " insertions", usage.insertions);
+    ENTRY(name + " queries", usage.queries);
+  }
+
+  GROUP("PHASES");
+  for (unsigned i = 0; i < phaseUsage.size(); i++) {
+    string name = capitalize(saturationPhaseName(static_cast<SaturationPhase>(i)));
+    ENTRY(name + " ms", unsigned(phaseUsage[i].nanoseconds / 1000000));
+    ENTRY(name + " calls", phaseUsage[i].calls);
+  }
+
+  GROUP("ENGINE COSTS");
+  Stack<std::pair<const char*, const EngineCost*>> engines;
+  for (const auto& [name, cost] : engineCosts) {
+    engines.push(make_pair(name, &cost));
+  }
+  sort(engines.begin(), engines.end(), [](auto& a, auto& b) { return a.second->nanoseconds > b.second->nanoseconds; });
+  for (const auto& [name, cost] : engines) {
+    string prefix = capitalize(name);
+    ENTRY(prefix + " ms", unsigned(cost->nanoseconds / 1000000));
+    ENTRY(prefix + " calls", cost->calls);
+    ENTRY(prefix + " units", cost->units);
+    ENTRY(prefix + " index queries", cost->queries);
+    ENTRY(prefix + " memory KB", unsigned(max<int64_t>(cost->bytes, 0) / 1024));
+  }
+
+  GROUP("COUNTERS");
+  for (unsigned i = 0; i < counters.size(); i++) {
+    ENTRY(counterName(static_cast<Counter>(i)), counters[i]);
+  }
+
+  GROUP("MEMORY");
+  ENTRY("Collected terms", collectedTerms);
+  ENTRY("Collected literals", collectedLiterals);
+  ENTRY("Collected term KB", collectedTermKB);
+  for (unsigned i = 0; i < static_cast<unsigned>(MemoryCategory::COUNT); i++) {
+    const MemoryUsage& usage = MEMORY_USAGE[i];
+    string name = memoryCategoryName(static_cast<MemoryCategory>(i));
+    ENTRY("Live " + name + " KB", unsigned(usage.live / 1024));
+    ENTRY("Peak " + name + " KB", unsigned(usage.peak / 1024));
+  }
+#undef GROUP
+#undef ENTRY
+#undef IPGROUP
+#undef IPENTRY
+}
+
 void Statistics::print(std::ostream& out)
 {
   if (env.options->statistics() != Options::Statistics::NONE) {
@@ -125,126 +320,8 @@ void Statistics::print(std::ostream& out)
 
   if (env.options->statistics()==Options::Statistics::FULL) {
 
-    struct Entry {
-      Entry(string name, string total, string inproof = string())
-        : name(name), total(total), inproof(inproof) {}
-      string name;
-      string total;
-      string inproof;
-    };
-    struct Group {
-      Group(string name, bool infGroup = false) : name(name), infGroup(infGroup) {}
-      void addEntry(string name, unsigned total, unsigned inproof = 0) {
-        ASS(infGroup || inproof == 0);
-        ASS(total);
-        ASS_GE(total, inproof);
-        entries.emplace(name, Int::toString(total), Int::toString(inproof));
-      }
-
-      string name;
-      Stack<Entry> entries;
-      bool infGroup;
-    };
     Stack<Group> groups;
-
-#define GROUP(name) groups.emplace(name);
-#define ENTRY(name, num) if (num) { groups.top().addEntry(name, num); }
-
-#define IPGROUP(name) groups.emplace(name, /*inproof=*/true);
-#define IPENTRY(name, statpair) ASS_GE(statpair[TOTAL_CNT], statpair[INPROOF_CNT]); \
-  if (statpair[TOTAL_CNT]) { groups.top().addEntry(name, statpair[TOTAL_CNT], statpair[INPROOF_CNT]); }
-
-    IPGROUP("INPUT");
-    for (unsigned i : range(toNumber(UnitInputType::AXIOM),toNumber(UnitInputType::MODEL_DEFINITION))) {
-      IPENTRY(capitalize(inputTypeName(static_cast<UnitInputType>(i))), inputTypeCnts[i]);
-    }
-
-    auto outputInfGroup = [&](string name, InferenceRule first, InferenceRule last) {
-      ASS_L(toNumber(first),toNumber(last));
-      IPGROUP(name);
-      for (unsigned i : range(toNumber(first),toNumber(last))) {
-        IPENTRY(capitalize(ruleName(static_cast<InferenceRule>(i))), inferenceCnts[i]);
-      }
-    };
-
-    outputInfGroup("FORMULA TRANSFORMATIONS", InferenceRule::GENERIC_FORMULA_CLAUSE_TRANSFORMATION, InferenceRule::GENERIC_FORMULA_CLAUSE_TRANSFORMATION_LAST);
-    outputInfGroup("SIMPLIFYING INFERENCES", InferenceRule::GENERIC_SIMPLIFYING_INFERENCE, InferenceRule::GENERIC_SIMPLIFYING_INFERENCE_LAST);
-    outputInfGroup("GENERATING INFERENCES", InferenceRule::GENERIC_GENERATING_INFERENCE, InferenceRule::GENERIC_GENERATING_INFERENCE_LAST);
-    outputInfGroup("THEORY AXIOMS", InferenceRule::GENERIC_THEORY_AXIOM, InferenceRule::GENERIC_THEORY_AXIOM_LAST);
-    outputInfGroup("AVATAR", InferenceRule::GENERIC_AVATAR_INFERENCE, InferenceRule::GENERIC_AVATAR_INFERENCE_LAST);
-    outputInfGroup("MISCELLANEOUS INFERENCES", InferenceRule::GENERIC_GENERATING_INFERENCE_LAST, InferenceRule::GENERIC_AVATAR_INFERENCE);
-
-    IPGROUP("CLAUSES/FORMULAS");
-    IPENTRY("Input clauses", inputClauses);
-    IPENTRY("Input formulas", inputFormulas);
-    IPENTRY("Clauses", clauses);
-    IPENTRY("Formulas", formulas);
-
-    GROUP("PREPROCESSING");
-    ENTRY("Introduced names", formulaNames);
-    ENTRY("Introduced skolems", skolemFunctions);
-    ENTRY("Pure predicates", purePredicates);
-    ENTRY("Unused predicate definitions", unusedPredicateDefinitions);
-    ENTRY("Function definitions", eliminatedFunctionDefinitions);
-    ENTRY("Selected by SInE selection", selectedBySine);
-    ENTRY("SInE iterations", sineIterations);
-    ENTRY("Blocked clauses", blockedClauses);
-    ENTRY("Split inequalities", splitInequalities);
-
-    GROUP("SATURATION");
-    ENTRY("Initial clauses", initialClauses);
-    ENTRY("Activations started", activations);
-    ENTRY("Active clauses", activeClauses);
-    ENTRY("Passive clauses", passiveClauses);
-    ENTRY("Extensionality clauses", extensionalityClauses);
-    ENTRY("Final active clauses", finalActiveClauses);
-    ENTRY("Final passive clauses", finalPassiveClauses);
-    ENTRY("Final extensionality clauses", finalExtensionalityClauses);
-    ENTRY("Discarded non-redundant clauses", discardedNonRedundantClauses);
-
-    GROUP("SIMPLIFYING INFERENCES");
-    ENTRY("Duplicate literals", duplicateLiterals);
-    ENTRY("Trivial inequalities", trivialInequalities);
-
-    GROUP("DELETION INFERENCES");
-    ENTRY("Simple tautologies", simpleTautologies);
-    ENTRY("Equational tautologies", equationalTautologies);
-    ENTRY("Deep equational tautologies", deepEquationalTautologies);
-    ENTRY("Forward subsumptions", forwardSubsumed);
-    ENTRY("Backward subsumptions", backwardSubsumed);
-    ENTRY("Forward ground joinable", forwardGroundJoinable);
-    ENTRY("Fw demodulations to eq. taut.", forwardDemodulationsToEqTaut);
-    ENTRY("Bw demodulations to eq. taut.", backwardDemodulationsToEqTaut);
-    ENTRY("Fw subsumption demodulations to eq. taut.", forwardSubsumptionDemodulationsToEqTaut);
-    ENTRY("Bw subsumption demodulations to eq. taut.", backwardSubsumptionDemodulationsToEqTaut);
-    ENTRY("Inner rewrites to eq. taut.", innerRewritesToEqTaut);
-
-    GROUP("INDUCTION");
-    ENTRY("MaxInductionDepth",maxInductionDepth);
-    ENTRY("InductionApplications",inductionApplication);
-
-    GROUP("REDUNDANT INFERENCES");
-    ENTRY("Skipped superposition", skippedSuperposition);
-    ENTRY("Skipped resolution", skippedResolution);
-    ENTRY("Due to ordering constraints", inferencesSkippedDueToOrderingConstraints);
-    ENTRY("Due to AVATAR constraints", inferencesSkippedDueToAvatarConstraints);
-    ENTRY("Due to literal constraints", inferencesSkippedDueToLiteralConstraints);
-    ENTRY("Due to colors", inferencesSkippedDueToColors);
-    ENTRY("Due to ordering aftercheck", inferencesBlockedDueToOrderingAftercheck);
-
-    GROUP("AVATAR");
-    ENTRY("Split clauses", splitClauses);
-    ENTRY("Split components", splitComponents);
-    ENTRY("Sat splitting refutations", satSplitRefutations);
-    ENTRY("SMT fallbacks",smtFallbacks);
-
-    //TODO record statistics for FMB
-
-    //TODO record statistics for MiniSAT
-    GROUP("SAT SOLVER");
-    ENTRY("SAT solver clauses", satClauses);
-    ENTRY("SAT solver unit clauses", unitSatClauses);
-    ENTRY("SAT solver binary clauses", binarySatClauses);
+    collectGroups(groups);
 
     const string TOTALSTR = "TOTAL";
     const string PROOFSTR = "PROOF";
@@ -297,10 +374,6 @@ void Statistics::print(std::ostream& out)
       SEP_LINE;
     }
 #undef SEP_LINE
-#undef GROUP
-#undef ENTRY
-#undef IPGROUP
-#undef IPENTRY
   }
 
   addCommentSignForSZS(out);
@@ -337,6 +410,83 @@ void Statistics::print(std::ostream& out)
     TimeTrace::instance().printPretty(out);
   }
 #endif // VTIME_PROFILING
+
+  if (env.options && !env.options->statisticsJson().empty()) {
+    SaturationAlgorithm::tryUpdateFinalClauseCount();
+    writeJson();
+  }
+}
+
+/** @b s as a JSON string literal */
+static string jsonString(const string& s)
+{
+  string res = "\"";
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      res += '\\';
+      res += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      res += ' ';
+    } else {
+      res += c;
+    }
+  }
+  return res + '"';
+}
+
+/**
+ * Print all the counters of the full statistics, with rates derived from
+ * them, as a single line of JSON. Unlike the text output, the format does
+ * not change between versions other than by the counters that exist.
+ */
+void Statistics::printJson(std::ostream& out)
+{
+  unsigned elapsed = Timer::elapsedMilliseconds();
+  double seconds = max(elapsed, 1u) / 1000.0;
+  Timer::updateInstructionCount();
+
+  out << "{\"version\":" << jsonString(VERSION_STRING)
+      << ",\"termination_reason\":\"" << terminationReason << '"'
+      << ",\"elapsed_ms\":" << elapsed
+      << ",\"peak_memory_kb\":" << Lib::peakMemoryUsageKB()
+      << ",\"mega_instructions\":" << Timer::elapsedMegaInstructions()
+      << ",\"rates\":{\"activations_per_s\":" << activations / seconds
+      << ",\"passive_clauses_per_s\":" << passiveClauses / seconds
+      << ",\"forward_subsumed_per_passive\":" << (passiveClauses ? double(forwardSubsumed) / passiveClauses : 0.0)
+      << "},\"groups\":[";
+
+  Stack<Group> groups;
+  collectGroups(groups);
+  bool firstGroup = true;
+  for (const auto& [gname, entries, infGroup] : groups) {
+    if (entries.isEmpty()) { continue; }
+    // group names are not unique (AVATAR, SIMPLIFYING INFERENCES), hence a list
+    out << (firstGroup ? "" : ",") << "{\"name\":" << jsonString(gname) << ",\"entries\":{";
+    firstGroup = false;
+    bool firstEntry = true;
+    for (const auto& [ename, total, inproof] : entries) {
+      out << (firstEntry ? "" : ",") << jsonString(ename) << ':';
+      firstEntry = false;
+      if (infGroup) {
+        out << "{\"total\":" << total << ",\"in_proof\":" << inproof << '}';
+      } else {
+        out << total;
+      }
+    }
+    out << "}}";
+  }
+  out << "]}" << endl;
+}
+
+/**
+ * Add a line of printJson() to the file of --statistics_json. The first
+ * line written by the process replaces the previous content of the file.
+ */
+void Statistics::writeJson()
+{
+  ofstream out(env.options->statisticsJson(), _jsonWritten ? ios::app : ios::trunc);
+  _jsonWritten = true;
+  printJson(out);
 }
 
 
@@ -359,6 +509,88 @@ void Statistics::print(std::ostream& out)
     inferenceCnts[toNumber(u->inference().rule())][idx]++;
   }
 
+const char* Shell::saturationPhaseName(SaturationPhase phase)
+{
+  switch (phase) {
+  case SaturationPhase::SELECTION:
+    return "selection";
+  case SaturationPhase::ACTIVATION:
+    return "activation";
+  case SaturationPhase::GENERATION:
+    return "generation";
+  case SaturationPhase::FORWARD_SIMPLIFICATION:
+    return "forward simplification";
+  case SaturationPhase::BACKWARD_SIMPLIFICATION:
+    return "backward simplification";
+  case SaturationPhase::SPLITTING:
+    return "splitting";
+  case SaturationPhase::COUNT:
+    break;
+  }
+  ASSERTION_VIOLATION
+}
+
+const char* Shell::counterName(Counter c)
+{
+  switch (c) {
+#define X(id, name) case Counter::id: return name;
+  VAMPIRE_COUNTERS(X)
+#undef X
+  case Counter::COUNT:
+    break;
+  }
+  ASSERTION_VIOLATION
+}
+
+/**
+ * Print the usage of the saturation phases as a single line of JSON,
+ * e.g. for watching a running proof search.
+ */
+void Statistics::printPhaseUsageJson(std::ostream& out)
+{
+  out << "{\"elapsed_ms\":" << Timer::elapsedMilliseconds()
+      << ",\"activations\":" << activations
+      << ",\"phases\":{";
+  for (unsigned i = 0; i < phaseUsage.size(); i++) {
+    string name = saturationPhaseName(static_cast<SaturationPhase>(i));
+    replace(name.begin(), name.end(), ' ', '_');
+    out << (i ? "," : "") << '"' << name << "\":{\"ms\":" << phaseUsage[i].nanoseconds / 1000000
+        << ",\"calls\":" << phaseUsage[i].calls << '}';
+  }
+  out << "}}" << endl;
+}
+
+bool PhaseTimer::s_enabled = false;
+
+bool EngineCostTimer::s_enabled = false;
+
+void EngineCostTimer::start()
+{
+  _units = Unit::getLastNumber();
+  _queries = Indexing::Index::totalQueries();
+  _bytes = accountedMemoryInUse();
+  _start = std::chrono::steady_clock::now();
+}
+
+void EngineCostTimer::record()
+{
+  auto elapsed = std::chrono::steady_clock::now() - _start;
+  Statistics::EngineCost& cost = env.statistics->engineCosts[_name];
+  cost.nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+  cost.calls += _call;
+  cost.units += Unit::getLastNumber() - _units;
+  cost.queries += Indexing::Index::totalQueries() - _queries;
+  cost.bytes += int64_t(accountedMemoryInUse()) - int64_t(_bytes);
+}
+
+void PhaseTimer::record()
+{
+  auto elapsed = std::chrono::steady_clock::now() - _start;
+  Statistics::PhaseUsage& usage = env.statistics->phaseUsage[static_cast<unsigned>(_phase)];
+  usage.nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+  usage.calls++;
+}
+
 const char* Statistics::phaseToString(ExecutionPhase p)
 {
   switch(p) {
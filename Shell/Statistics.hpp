@@ -18,6 +18,10 @@
 #define __Statistics__
 
 #include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <map>
 #include <ostream>
 
 #include "Forwards.hpp"
@@ -90,6 +94,53 @@ enum class ExecutionPhase {
   FMB_SOLVING
 };
 
+/** Phases of the given-clause loop whose time can be measured by PhaseTimer */
+enum class SaturationPhase : unsigned {
+  SELECTION,
+  ACTIVATION,
+  GENERATION,
+  FORWARD_SIMPLIFICATION,
+  BACKWARD_SIMPLIFICATION,
+  SPLITTING,
+  COUNT
+};
+
+const char* saturationPhaseName(SaturationPhase phase);
+
+/**
+ * Table of the counters that are only shown by the full statistics and
+ * need no field of their own: X(identifier, name shown). Unlike the string
+ * keyed RSTAT_* counters of Debug/RuntimeStatistics.hpp, which are compiled
+ * out of release builds, incrementing one of these is a single addition to
+ * Statistics::counters, so they are always on.
+ */
+#define VAMPIRE_COUNTERS(X)                                                                             \
+  X(SUP_WEIGHT_LIMIT_EARLY, "Superpositions over weight limit before building")                         \
+  X(SUP_WEIGHT_LIMIT_REWRITER, "Superpositions over weight limit by rewriter weight")                   \
+  X(SUP_WEIGHT_LIMIT_REWRITER_OCCURRENCES, "Superpositions over weight limit by rewriter occurrences")  \
+  X(SUP_WEIGHT_LIMIT_REWRITTEN, "Superpositions over weight limit by rewritten literal weight")         \
+  X(SUP_AGE_LIMIT_EARLY, "Superpositions over age limit before building")                               \
+  X(SUP_WEIGHT_LIMIT_BUILDING, "Superpositions over weight limit while building")                       \
+  X(SUP_WEIGHT_LIMIT_BUILT, "Superpositions over weight limit after building")                          \
+  X(BR_AGE_LIMIT_EARLY, "Resolutions over age limit before building")                                   \
+  X(BR_WEIGHT_LIMIT_EARLY, "Resolutions over weight limit before building")                             \
+  X(BR_WEIGHT_LIMIT_BUILDING, "Resolutions over weight limit while building")                           \
+  X(ACTIVE_LIMIT_DISCARDS, "Active clauses discarded on limit update")                                  \
+  X(FORWARD_LIMIT_DISCARDS, "Clauses discarded by limits in forward simplification")                    \
+  X(PASSIVE_INDEXING_SWITCHES, "Switches of passive clauses indexing for simplification")               \
+  X(PASSIVE_SPILLED, "Passive clauses spilled from the passive container")                              \
+  X(PASSIVE_RESTORED, "Spilled passive clauses restored")                                              \
+  X(URR_BUDGET_CUTS, "Unit resulting resolution searches cut by budget")
+
+enum class Counter : unsigned {
+#define X(id, name) id,
+  VAMPIRE_COUNTERS(X)
+#undef X
+  COUNT
+};
+
+const char* counterName(Counter c);
+
 /**
  * Class Statistics
  * @since 02/01/2008 Manchester
@@ -99,16 +150,24 @@ public:
   enum UnitCountCategory { TOTAL_CNT = 0, INPROOF_CNT = 1 };
 
   void print(std::ostream& out);
+  void printJson(std::ostream& out);
+  void writeJson();
   void explainRefutationNotFound(std::ostream& out);
   void reportUnit(Unit* u, UnitCountCategory idx);
 
   // Preprocessing
   /** number of formula names introduced during preprocessing */
   unsigned formulaNames = 0;
+  /** number of subformulas replaced by the name of an existing definition of a variant */
+  unsigned reusedFormulaNames = 0;
   /** number of skolem functions (also predicates in FOOL) introduced during skolemization */
   unsigned skolemFunctions = 0;
   /** number of initial clauses */
   unsigned initialClauses = 0;
+  /** number of theory axioms held back until their symbols were used */
+  unsigned lazyTheoryAxioms = 0;
+  /** number of equality proxy congruence axioms held back until their symbols were used */
+  unsigned lazyCongruenceAxioms = 0;
   /** number of inequality splittings performed */
   unsigned splitInequalities = 0;
   /** number of pure predicates */
@@ -127,9 +186,13 @@ public:
   // Induction
   unsigned maxInductionDepth = 0;
   unsigned inductionApplication = 0;
+  /** induction contexts whose clausified induction formulas were found in the index */
+  unsigned inductionFormulasReused = 0;
 
   // Redundant inferences
   unsigned skippedSuperposition = 0;
+  /** superpositions skipped by the filter of superposition_repeat_filter */
+  unsigned skippedRepeatedSuperposition = 0;
   unsigned skippedResolution = 0;
   unsigned inferencesSkippedDueToOrderingConstraints = 0;
   unsigned inferencesSkippedDueToAvatarConstraints = 0;
@@ -160,8 +223,16 @@ public:
   unsigned forwardSubsumed = 0;
   /** number of backward subsumed clauses */
   unsigned backwardSubsumed = 0;
+  /** number of new clauses dropped as variants of unprocessed or passive clauses */
+  unsigned passiveVariantDuplicates = 0;
+  /** number of new clauses dropped as duplicates of clauses derived in the same step */
+  unsigned unprocessedDuplicates = 0;
   /** number of forward ground joinable clauses */
   unsigned forwardGroundJoinable = 0;
+  /** demodulator diagrams traversed by ground joinability */
+  unsigned groundJoinabilityDiagramChecks = 0;
+  /** rewrites by ground joinability with preordered demodulators, which need no diagram */
+  unsigned groundJoinabilityPreorderedRewrites = 0;
   /** number of term algebra distinctness tautology deletions */
   unsigned taDistinctnessTautologyDeletions = 0;
   /** number of inner rewrites into equational tautologies */
@@ -180,6 +251,14 @@ public:
   unsigned extensionalityClauses = 0;
 
   unsigned discardedNonRedundantClauses = 0;
+  /** the last estimate of LRS of the number of clauses still reachable */
+  unsigned lrsReachableEstimate = 0;
+  /** clauses shared with the other portfolio strategies */
+  unsigned exportedClauses = 0;
+  /** clauses received from the other portfolio strategies */
+  unsigned importedClauses = 0;
+  /** snapshots of the saturation state written to the checkpoint file */
+  unsigned checkpointsWritten = 0;
 
   bool smtReturnedUnknown = false;
   bool smtDidNotEvaluate = false;
@@ -192,6 +271,12 @@ public:
   unsigned finalExtensionalityClauses = 0;
   unsigned splitClauses = 0;
   unsigned splitComponents = 0;
+  /** Number of components selected or deselected by new AVATAR models */
+  unsigned splitComponentFlips = 0;
+  /** Number of kept clauses put back when their components were reactivated */
+  unsigned splitClausesReactivated = 0;
+  /** Number of clauses taken out of the saturation when their components were deactivated */
+  unsigned splitClausesDeactivated = 0;
 
   /** Number of clauses generated for the SAT solver */
   unsigned satClauses = 0;
@@ -203,6 +288,63 @@ public:
   unsigned satSplitRefutations = 0;
 
   unsigned smtFallbacks = 0;
+  /** SAT portfolio calls answered by the solver not asked first */
+  unsigned satPortfolioSwitches = 0;
+  /** z3 checks of theory instantiation answered from its cache */
+  unsigned theoryInstCacheHits = 0;
+
+  // Memory
+  /** shared terms destroyed by TermSharing::collectGarbage() */
+  unsigned collectedTerms = 0;
+  /** shared literals destroyed by TermSharing::collectGarbage() */
+  unsigned collectedLiterals = 0;
+  /** kilobytes reclaimed by TermSharing::collectGarbage() */
+  unsigned collectedTermKB = 0;
+
+  // Indices
+  struct IndexUsage {
+    /** clauses inserted into the index */
+    unsigned insertions = 0;
+    /** queries the index answered */
+    unsigned queries = 0;
+  };
+  /** usage of the named indices, reported when they are destroyed */
+  std::map<std::string, IndexUsage> indexUsage;
+
+  // Phases
+  struct PhaseUsage {
+    /** time spent in the phase, including the phases nested in it */
+    uint64_t nanoseconds = 0;
+    /** times the phase was entered */
+    unsigned calls = 0;
+  };
+  /** usage of the saturation phases, only measured with PhaseTimer enabled */
+  std::array<PhaseUsage, static_cast<unsigned>(SaturationPhase::COUNT)> phaseUsage = {};
+
+  void printPhaseUsageJson(std::ostream& out);
+
+  // Engines
+  struct EngineCost {
+    /** time spent in the engine, including the engines it calls */
+    uint64_t nanoseconds = 0;
+    /** times the engine was applied to a clause */
+    unsigned calls = 0;
+    /** units created while the engine ran */
+    unsigned units = 0;
+    /** index queries made while the engine ran */
+    unsigned queries = 0;
+    /** growth of the accounted memory (see Lib::MemoryCategory) while the engine ran */
+    int64_t bytes = 0;
+  };
+  struct NameLess {
+    bool operator()(const char* a, const char* b) const { return std::strcmp(a, b) < 0; }
+  };
+  /** cost of the named inference engines, only measured with EngineCostTimer enabled */
+  std::map<const char*, EngineCost, NameLess> engineCosts;
+
+  /** values of the counters of VAMPIRE_COUNTERS, indexed by Counter */
+  std::array<unsigned, static_cast<unsigned>(Counter::COUNT)> counters = {};
+  void inc(Counter c, unsigned num = 1) { counters[static_cast<unsigned>(c)] += num; }
 
   friend std::ostream& operator<<(std::ostream& out, TerminationReason const& self)
   {
@@ -241,6 +383,13 @@ public:
   ExecutionPhase phase = ExecutionPhase::INITIALIZATION;
 
 private:
+  struct Entry;
+  struct Group;
+  void collectGroups(Lib::Stack<Group>& groups);
+
+  /** whether writeJson() has been called */
+  bool _jsonWritten = false;
+
   static const char* phaseToString(ExecutionPhase p);
 
   /** A pair counting the total and in-proof value of a statistic. */
@@ -260,6 +409,90 @@ private:
   std::array<StatPair, toNumber(UnitInputType::MODEL_DEFINITION)> inputTypeCnts = {};
 }; // class Statistics
 
+/**
+ * Adds the runtime of the current block to the usage of a saturation phase.
+ *
+ * Unlike TIME_TRACE, this is always compiled in: when disabled, it costs a
+ * test of a flag, when enabled two reads of the monotonic clock.
+ */
+class PhaseTimer
+{
+public:
+  explicit PhaseTimer(SaturationPhase phase) : _phase(phase), _running(s_enabled)
+  {
+    if (_running) {
+      _start = std::chrono::steady_clock::now();
+    }
+  }
+  ~PhaseTimer() { stop(); }
+  PhaseTimer(const PhaseTimer&) = delete;
+  PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+  /** End the measurement before the end of the block */
+  void stop()
+  {
+    if (_running) {
+      _running = false;
+      record();
+    }
+  }
+
+  static void setEnabled(bool enabled) { s_enabled = enabled; }
+  static bool enabled() { return s_enabled; }
+
+private:
+  void record();
+
+  static bool s_enabled;
+
+  SaturationPhase _phase;
+  bool _running;
+  std::chrono::steady_clock::time_point _start;
+};
+
+/**
+ * Charges the runtime of the current block, and the units, index queries
+ * and accounted memory created during it, to the inference engine named
+ * @b name in Statistics::engineCosts. Does nothing unless enabled, or if
+ * @b name is nullptr. With @b call false the block is charged without
+ * counting as another application of the engine, e.g. when the clauses
+ * of one application are produced lazily.
+ */
+class EngineCostTimer
+{
+public:
+  EngineCostTimer(const char* name, bool call = true) : _name(s_enabled ? name : nullptr), _call(call)
+  {
+    if (_name) {
+      start();
+    }
+  }
+  ~EngineCostTimer()
+  {
+    if (_name) {
+      record();
+    }
+  }
+  EngineCostTimer(const EngineCostTimer&) = delete;
+  EngineCostTimer& operator=(const EngineCostTimer&) = delete;
+
+  static void setEnabled(bool enabled) { s_enabled = enabled; }
+  static bool enabled() { return s_enabled; }
+
+private:
+  void start();
+  void record();
+
+  static bool s_enabled;
+
+  const char* _name;
+  bool _call;
+  std::chrono::steady_clock::time_point _start;
+  unsigned _units;
+  unsigned _queries;
+  size_t _bytes;
+};
+
 } // namespace Shell
 
 #endif
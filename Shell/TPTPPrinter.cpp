@@ -470,7 +470,8 @@ std::string TPTPPrinter::toString(const Formula* formula)
  * If the unit is a formula of type @b CONJECTURE, output the
  * negation of Vampire's internal representation with the
  * TPTP role conjecture. If it is a clause, just output it as
- * is, with the role negated_conjecture.
+ * is, with the role negated_conjecture. Clauses with variables of
+ * a sort other than $i are output as tff formulas quantifying them.
  */
 std::string TPTPPrinter::toString (const Unit* unit)
 {
@@ -511,8 +512,7 @@ std::string TPTPPrinter::toString (const Unit* unit)
   }
 
   if (unit->isClause()) {
-    prefix = "cnf";
-    main = static_cast<const Clause*>(unit)->toTPTPString();
+    main = clauseToString(static_cast<const Clause*>(unit), prefix);
   }
   else {
     prefix = "tff";
@@ -554,6 +554,26 @@ std::string TPTPPrinter::toString (const Unit* unit)
 }
 
 
+/**
+ * Return the body of a TPTP unit for @b cl and set @b language to the
+ * language of the unit: cnf, unless some variable has a sort other than
+ * $i, which only a quantified tff formula can express.
+ */
+std::string TPTPPrinter::clauseToString(const Clause* cl, std::string& language)
+{
+  DHMap<unsigned,TermList> sorts;
+  SortHelper::collectVariableSorts(const_cast<Clause*>(cl), sorts);
+  DHMap<unsigned,TermList>::Iterator sit(sorts);
+  while (sit.hasNext()) {
+    if (sit.next() != AtomicSort::defaultSort()) {
+      language = "tff";
+      return getBodyStr(const_cast<Clause*>(cl), /*includeSplitLevels=*/false);
+    }
+  }
+  language = "cnf";
+  return cl->toTPTPString();
+}
+
 std::string TPTPPrinter::toString(const Term* t){
   NOT_IMPLEMENTED;
 }
@@ -42,10 +42,11 @@ public:
   static std::string toString(const Formula*);
   static std::string toString(const Term*);
   static std::string toString(const Literal*);
+  static std::string clauseToString(const Clause* cl, std::string& language);
 
 private:
 
-  std::string getBodyStr(Unit* u, bool includeSplitLevels);
+  static std::string getBodyStr(Unit* u, bool includeSplitLevels);
 
   void ensureHeadersPrinted(Unit* u);
   void outputSymbolTypeDefinitions(unsigned symNumber, SymbolType symType);
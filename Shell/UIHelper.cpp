@@ -28,6 +28,7 @@
 #include "Lib/ScopedLet.hpp"
 #include "Lib/Timer.hpp"
 
+#include "Kernel/InferenceLog.hpp"
 #include "Kernel/InferenceStore.hpp"
 #include "Kernel/Problem.hpp"
 #include "Kernel/FormulaUnit.hpp"
@@ -426,7 +427,9 @@ void UIHelper::outputResult(std::ostream& out)
      *
      * Also induction statistics deserve to be correct even if we don't print a proof.
      */
-    bool seenInputInference = refutation->minimizeAncestorsAndUpdateSelectedStats();
+    // the input types are kept when premises are dropped, but the walk
+    // would only see the ancestors still in memory
+    bool seenInputInference = InferenceLog::enabled() || refutation->minimizeAncestorsAndUpdateSelectedStats();
     // minimization might have cause inductionDepth to change (in fact, decrease)
     env.statistics->maxInductionDepth = refutation->inference().inductionDepth();
 
@@ -439,7 +442,11 @@ void UIHelper::outputResult(std::ostream& out)
       if (szsOutputMode()) {
         out << "% SZS output start Proof for " << env.options->problemName() << endl;
       }
-      InferenceStore::instance()->outputProof(out, refutation);
+      if (InferenceLog::enabled()) {
+        InferenceLog::outputProof(out, refutation);
+      } else {
+        InferenceStore::instance()->outputProof(out, refutation);
+      }
       if (szsOutputMode()) {
         out << "% SZS output end Proof for " << env.options->problemName() << endl << flush;
       }
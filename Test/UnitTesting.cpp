@@ -17,6 +17,8 @@
 #include "Lib/Sys/Multiprocessing.hpp"
 #include "Lib/Stack.hpp"
 #include "Lib/Exception.hpp"
+#include "Lib/Int.hpp"
+#include "Lib/Timer.hpp"
 
 #include "UnitTesting.hpp"
 
@@ -68,8 +70,13 @@ bool TestUnit::runTest(std::string const& name)
 {
   auto test = findTest(name);
   if (test != nullptr) {
+    try {
       test->proc();
-      return true;
+    } catch (Lib::Exception& e) {
+      e.cry(std::cerr);
+      return false;
+    }
+    return true;
   } else {
     std::cerr << "test \"" << name << "\" not found in " << id() << std::endl;
     return false;
@@ -83,7 +90,7 @@ bool UnitTesting::run(Stack<std::string> const& args)
   } else if (args.size() == 1) {
     return runUnit(args[0]);
   } else {
-    std::cerr << "usage: vtest <unit-name> [ <test-name-substring> ]";
+    std::cerr << "usage: vtest <unit-name> [ <test-name-substring> ] [ --singlethreaded ] [ --perf[=<margin>] ]";
     exit(-1);
   }
 }
@@ -225,6 +232,34 @@ bool UnitTesting::add(std::string const& testUnit, TestUnit::Test test)
 std::ostream& operator<<(std::ostream& out, TestUnit::Test const& t) 
 { return out << t.name; }
 
+void checkInstructionBudget(const char* name, long long budget, std::function<void()> const& kernel)
+{
+  int margin = UnitTesting::instance().getPerfMargin();
+  if (margin < 0) {
+    kernel();
+    return;
+  }
+
+  Timer::InstructionCounter counter;
+  if (!counter.available()) {
+    std::cout << "[ SKIP ] " << name << ": perf event counters not accessible" << std::endl;
+    kernel();
+    return;
+  }
+  long long start = counter.instructions();
+  kernel();
+  long long used = counter.instructions() - start;
+  long long limit = budget + budget / 100 * margin;
+  if (used > limit) {
+    std::cout << "[ FAIL ] " << name << ": " << used << " instructions, budget " << budget
+              << " (+" << margin << "%)" << std::endl;
+    // fails the test like an exception of the test itself, also when it
+    // does not run in a process of its own
+    throw Lib::Exception("instruction budget of \"", name, "\" exceeded");
+  }
+  std::cout << "[  ok  ] " << name << ": " << used << " instructions, budget " << budget << std::endl;
+}
+
 } // namespace Test
 
 int main(int argc, const char** argv) 
@@ -242,9 +277,23 @@ int main(int argc, const char** argv)
   for (int i = 2; i < argc; i++) {
     args.push(std::string(argv[i]));
   }
-  if (args.top() == "--singlethreaded") {
-    Test::UnitTesting::instance().setSingleThreaded(true);
-    args.pop();
+  while (args.isNonEmpty() && args.top().rfind("--", 0) == 0) {
+    auto flag = args.pop();
+    if (flag == "--singlethreaded") {
+      Test::UnitTesting::instance().setSingleThreaded(true);
+    } else if (flag == "--perf") {
+      Test::UnitTesting::instance().setPerfMargin(20);
+    } else if (flag.rfind("--perf=", 0) == 0) {
+      int margin;
+      if (!Int::stringToInt(flag.substr(7), margin) || margin < 0) {
+        std::cerr << "invalid margin: " << flag << std::endl;
+        return -1;
+      }
+      Test::UnitTesting::instance().setPerfMargin(margin);
+    } else {
+      std::cerr << "unknown flag: " << flag << std::endl;
+      return -1;
+    }
   }
 
   if (cmd == "ls") {
@@ -15,9 +15,9 @@
 #ifndef __UnitTesting__
 #define __UnitTesting__
 
+#include <functional>
 #include <ostream>
 
-
 #include "Forwards.hpp"
 #include "Lib/Stack.hpp"
 
@@ -80,8 +80,10 @@ class UnitTesting
 {
   static UnitTesting* _instance;
   Stack<TestUnit> _units;
-  UnitTesting() : _units(), _singleThreaded(false) {}
+  UnitTesting() : _units(), _singleThreaded(false), _perfMargin(-1) {}
   bool _singleThreaded;
+  /** percentage by which instruction budgets may be exceeded, -1 outside performance mode */
+  int _perfMargin;
 public:
   static UnitTesting& instance();
 
@@ -93,8 +95,21 @@ public:
   bool runTest(std::string const& unit, std::string const& testCase);
   void setSingleThreaded(bool b) { _singleThreaded = b; }
   bool getSingleThreaded() { return _singleThreaded; }
+  void setPerfMargin(int percent) { _perfMargin = percent; }
+  int getPerfMargin() { return _perfMargin; }
 };
 
+/**
+ * Run @b kernel and check that it executes at most @b budget (user) instructions.
+ *
+ * Budgets are only enforced in performance mode (vtest run ... --perf[=<margin>]),
+ * where the measured count is printed and the test fails if it exceeds the budget
+ * by more than margin percent (20 by default). Otherwise, and if the perf event
+ * counters are not accessible, the kernel is only run. Budgets are counted in the
+ * debug build vtest is built in.
+ */
+void checkInstructionBudget(const char* name, long long budget, std::function<void()> const& kernel);
+
 std::ostream& operator<<(std::ostream& out, TestUnit::Test const& t);
 
 class TestAdder
@@ -130,4 +130,20 @@ HOL_TEST_FUN(beta_reduction_4) {
          "vAPP(srt,srt,vLAM(srt,srt,db0(srt)),vAPP(srt > srt,srt,vLAM(srt > srt,srt,vAPP(srt,srt,db0(srt > srt),a)),vLAM(srt,srt,db0(srt))))")
   ASS_EQ(betaNF(t4, &reds), D.a)
   ASS_EQ(reds, 3)
-}
\ No newline at end of file
+}
+HOL_TEST_FUN(beta_reduction_cached) {
+  // (λ x0:(α -> α). x0 a) (λ x0:α. x0)
+  auto term = toNameless(app(D.f, app(lam(x(0, D.fSrt), app(x(0, D.fSrt), D.a)), id())));
+
+  unsigned reds;
+  ASS_EQ(betaNF(term, &reds), app(D.f, D.a))
+  ASS_EQ(reds, 2)
+  // the normal form is now cached, along with its number of reductions
+  ASS_EQ(betaNF(term, &reds), app(D.f, D.a))
+  ASS_EQ(reds, 2)
+
+  // a term without a redex is its own normal form
+  auto nf = toNameless(app(D.f, D.a));
+  ASS_EQ(betaNF(nf, &reds), nf)
+  ASS_EQ(reds, 0)
+}
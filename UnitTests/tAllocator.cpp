@@ -0,0 +1,73 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Lib/Allocator.hpp"
+#include "Lib/Stack.hpp"
+
+#include "Test/UnitTesting.hpp"
+
+using namespace std;
+using namespace Lib;
+
+#ifndef INDIVIDUAL_ALLOCATIONS
+
+TEST_FUN(fixedSizeTrimReleasesFreeBlocks)
+{
+  FixedSizeAllocator<16> fsa;
+  Stack<void*> chunks;
+  for(unsigned i = 0; i < 5000; i++) {
+    chunks.push(fsa.alloc());
+  }
+  while(chunks.isNonEmpty()) {
+    fsa.free(chunks.pop());
+  }
+  ASS_G(fsa.trim(), 0);
+  // nothing left to release
+  ASS_EQ(fsa.trim(), 0);
+
+  // the allocator is still usable afterwards
+  void* p = fsa.alloc();
+  fsa.free(p);
+}
+
+TEST_FUN(fixedSizeTrimKeepsLiveChunks)
+{
+  FixedSizeAllocator<16> fsa;
+  Stack<unsigned*> live;
+  Stack<void*> dead;
+  for(unsigned i = 0; i < 5000; i++) {
+    // the first chunks all end up in one block, which stays in use
+    if(i < 10) {
+      unsigned* p = static_cast<unsigned*>(fsa.alloc());
+      *p = i;
+      live.push(p);
+    }
+    else {
+      dead.push(fsa.alloc());
+    }
+  }
+  while(dead.isNonEmpty()) {
+    fsa.free(dead.pop());
+  }
+  ASS_G(fsa.trim(), 0);
+
+  for(unsigned i = 0; i < live.size(); i++) {
+    ASS_EQ(*live[i], i);
+  }
+  // the free chunks of the block still in use can be reused
+  for(unsigned i = 0; i < 100; i++) {
+    dead.push(fsa.alloc());
+  }
+  for(unsigned i = 0; i < live.size(); i++) {
+    ASS_EQ(*live[i], i);
+  }
+}
+
+#endif // INDIVIDUAL_ALLOCATIONS
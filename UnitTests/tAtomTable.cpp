@@ -0,0 +1,45 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+#include <string>
+
+#include "Debug/Assertion.hpp"
+#include "Lib/AtomTable.hpp"
+#include "Test/UnitTesting.hpp"
+
+using namespace Lib;
+
+TEST_FUN(intern_find)
+{
+  AtomTable atoms;
+  ASS_EQ(atoms.intern("f"), 0);
+  ASS_EQ(atoms.intern("g"), 1);
+  ASS_EQ(atoms.intern("f"), 0);
+  ASS_EQ(atoms.size(), 2);
+  ASS_EQ(atoms.find("g").unwrap(), 1);
+  ASS(atoms.find("h").isNone());
+  ASS(atoms.name(1) == "g");
+}
+
+TEST_FUN(names_stay_valid)
+{
+  AtomTable atoms;
+  // fill several chunks, one of them with a name longer than a chunk
+  std::string longName(100000, 'x');
+  for (unsigned i = 0; i < 20000; i++) {
+    ALWAYS(atoms.intern("sym" + std::to_string(i)) == i);
+  }
+  unsigned longAtom = atoms.intern(longName);
+  ALWAYS(atoms.intern("sym_last") == longAtom + 1);
+  for (unsigned i = 0; i < 20000; i++) {
+    ASS(atoms.name(i) == "sym" + std::to_string(i));
+  }
+  ASS(atoms.name(longAtom) == longName);
+  ASS_EQ(atoms.find(longName).unwrap(), longAtom);
+}
@@ -0,0 +1,99 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+#include "Indexing/ClauseBodyIndex.hpp"
+
+#include "Test/SyntaxSugar.hpp"
+#include "Test/UnitTesting.hpp"
+
+using namespace Indexing;
+
+#define SAME_BODY(c1, c2)                                                     \
+  ALWAYS(ClauseBodyIndex::bodyHash(c1) == ClauseBodyIndex::bodyHash(c2))      \
+  ALWAYS(ClauseBodyIndex::sameBody(c1, c2))                                   \
+  ALWAYS(ClauseBodyIndex::sameBody(c2, c1))
+
+#define DIFFERENT_BODIES(c1, c2)                                              \
+  NEVER(ClauseBodyIndex::sameBody(c1, c2))                                    \
+  NEVER(ClauseBodyIndex::sameBody(c2, c1))
+
+TEST_FUN(permuted_bodies)
+{
+  DECL_DEFAULT_VARS
+  DECL_SORT(srt)
+  DECL_CONST(a, srt)
+  DECL_CONST(b, srt)
+  DECL_PRED(p, {srt})
+  DECL_PRED(q, {srt})
+
+  Clause* c1 = clause({ p(a), q(b), ~p(x) });
+  SAME_BODY(c1, clause({ ~p(x), p(a), q(b) }));
+  SAME_BODY(c1, clause({ q(b), ~p(x), p(a) }));
+  DIFFERENT_BODIES(c1, clause({ p(a), q(b) }));
+  DIFFERENT_BODIES(c1, clause({ p(a), q(b), p(x) }));
+  DIFFERENT_BODIES(c1, clause({ p(a), q(b), ~p(y) }));
+}
+
+TEST_FUN(repeated_literals)
+{
+  DECL_DEFAULT_VARS
+  DECL_SORT(srt)
+  DECL_CONST(a, srt)
+  DECL_CONST(b, srt)
+  DECL_PRED(p, {srt})
+  DECL_PRED(q, {srt})
+
+  Clause* c1 = clause({ p(a), p(a), q(b) });
+  SAME_BODY(c1, clause({ p(a), q(b), p(a) }));
+  // the same literals, with other multiplicities
+  DIFFERENT_BODIES(c1, clause({ p(a), q(b), q(b) }));
+  DIFFERENT_BODIES(c1, clause({ p(a), q(b) }));
+  DIFFERENT_BODIES(c1, clause({ p(a), p(a), p(a), q(b) }));
+}
+
+TEST_FUN(hash_collisions)
+{
+  DECL_SORT(srt)
+  DECL_CONST(a, srt)
+  DECL_FUNC(f, {srt}, srt)
+  DECL_PRED(p, {srt})
+
+  Stack<Literal*> lits;
+  TermSugar t = a;
+  for (unsigned i = 0; i < 1000; i++) {
+    lits.push(p(t));
+    t = f(t);
+  }
+
+  auto body = [&](unsigned i, unsigned j) {
+    Literal* ls[] = { lits[i], lits[j] };
+    return Clause::fromArray(ls, 2, NonspecificInference0(UnitInputType::AXIOM, InferenceRule::INPUT));
+  };
+
+  // among the 500000 two-literal bodies some share a hash code, which is
+  // when sameBody has to tell them apart
+  DHMap<unsigned, std::pair<unsigned, unsigned>> byHash;
+  unsigned collisions = 0;
+  for (unsigned i = 0; i < lits.size(); i++) {
+    for (unsigned j = i + 1; j < lits.size(); j++) {
+      Clause* cl = body(i, j);
+      std::pair<unsigned, unsigned>* first;
+      if (!byHash.getValuePtr(ClauseBodyIndex::bodyHash(cl), first)) {
+        Clause* other = body(first->first, first->second);
+        collisions++;
+        DIFFERENT_BODIES(cl, other);
+        other->destroy();
+      } else {
+        *first = { i, j };
+      }
+      cl->destroy();
+    }
+  }
+  ASS_G(collisions, 0);
+}
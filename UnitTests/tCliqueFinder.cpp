@@ -0,0 +1,105 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+#include <cstdlib>
+
+#include "Debug/Assertion.hpp"
+#include "FMB/CliqueFinder.hpp"
+#include "Test/UnitTesting.hpp"
+
+using namespace Lib;
+using namespace FMB;
+
+typedef DHMap<unsigned,DHSet<unsigned>*> Graph;
+
+static void addEdge(Graph& g, unsigned a, unsigned b)
+{
+  DHSet<unsigned>** nbs;
+  if(g.getValuePtr(a,nbs)){
+    *nbs = new DHSet<unsigned>();
+  }
+  (*nbs)->insert(b);
+  if(g.getValuePtr(b,nbs)){
+    *nbs = new DHSet<unsigned>();
+  }
+  (*nbs)->insert(a);
+}
+
+static void deleteGraph(Graph& g)
+{
+  Graph::Iterator it(g);
+  while(it.hasNext()){
+    delete it.next();
+  }
+}
+
+/** The size of a maximum clique of the vertices 0..n-1, by trying all subsets */
+static unsigned bruteForce(const Stack<unsigned>& adj, unsigned n)
+{
+  unsigned best = 1;
+  for(unsigned set=1;set<(1u<<n);set++){
+    unsigned size = __builtin_popcount(set);
+    if(size<=best){
+      continue;
+    }
+    bool clique = true;
+    for(unsigned v=0;v<n && clique;v++){
+      if(set & (1u<<v)){
+        clique = (set & ~(1u<<v) & ~adj[v])==0;
+      }
+    }
+    if(clique){
+      best = size;
+    }
+  }
+  return best;
+}
+
+TEST_FUN(random_graphs_brute_force)
+{
+  srand(1);
+  for(unsigned round=0;round<300;round++){
+    unsigned n = 1+rand()%12;
+    unsigned density = rand()%100;
+    Graph g;
+    Stack<unsigned> adj;
+    for(unsigned v=0;v<n;v++){
+      adj.push(0);
+      // every vertex is known, also those without neighbours
+      g.insert(v,new DHSet<unsigned>());
+    }
+    for(unsigned a=0;a<n;a++){
+      for(unsigned b=a+1;b<n;b++){
+        if(unsigned(rand()%100)<density){
+          addEdge(g,a,b);
+          adj[a] |= 1u<<b;
+          adj[b] |= 1u<<a;
+        }
+      }
+    }
+    ASS_EQ(CliqueFinder::findMaxCliqueSize(&g),bruteForce(adj,n));
+    deleteGraph(g);
+  }
+}
+
+TEST_FUN(large_graph_fallback)
+{
+  // too many vertices for the bitsets, the clique has no outside neighbours
+  Graph g;
+  for(unsigned v=0;v<5000;v++){
+    g.insert(v,new DHSet<unsigned>());
+  }
+  for(unsigned a=0;a<5;a++){
+    for(unsigned b=a+1;b<5;b++){
+      addEdge(g,100+a,100+b);
+    }
+  }
+  ASS_EQ(CliqueFinder::findMaxCliqueSize(&g),5u);
+  deleteGraph(g);
+}
@@ -215,3 +215,12 @@ TEST_GENERATION(test_redundancy_06,
       ))
       .premiseRedundant(false)
     )
+
+TEST_GENERATION(test_chained_equalities,
+    Generation::AsymmetricTest()
+      .input(     clause({  x != 4, y != x + 1, p(y), q(x)  }))
+      .expected( exactly(
+            clause({  p(4 + 1), q(4)  })
+      ))
+      .premiseRedundant(false)
+    )
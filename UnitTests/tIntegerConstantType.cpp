@@ -7,6 +7,7 @@
  * https://vprover.github.io/license.html
  * and in the source directory
  */
+#include <climits>
 #include <iostream>
 #include "Kernel/Theory.hpp"
 #include "Lib/List.hpp"
@@ -153,3 +154,29 @@ TEST_FUN(parse_real)
   ASS_EQ(RealConstantType::parse("0.123e-8"), 
          RealConstantType::parse("0.00000000123"));
 }
+
+TEST_FUN(machine_int_operands)
+{
+  auto big = IntegerConstantType::parse("100000000000000000000").unwrap();
+  for (int i : { 0, 1, -1, 7, -7, INT_MAX, INT_MIN }) {
+    auto I = IntegerConstantType(i);
+    ASS_EQ(big + i, big + I)
+    ASS_EQ(i + big, I + big)
+    ASS_EQ(big - i, big - I)
+    ASS_EQ(i - big, I - big)
+    ASS_EQ(big * i, big * I)
+    ASS_EQ(I == i, true)
+    ASS_EQ(big > i, true)
+    ASS_EQ(i < big, true)
+    ASS_EQ(-big <= i, true)
+  }
+}
+
+TEST_FUN(rational_cannonize)
+{
+  ASS_EQ(RationalConstantType(4, -6), RationalConstantType(-2, 3))
+  ASS_EQ(RationalConstantType(0, -6), RationalConstantType(0))
+  ASS_EQ(RationalConstantType(6, 3), RationalConstantType(2))
+  ASS(RationalConstantType(6, 3).isInt())
+  ASS_EQ(RationalConstantType(1, 2) + RationalConstantType(1, 2), RationalConstantType(1))
+}
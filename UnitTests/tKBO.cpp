@@ -588,3 +588,21 @@ TEST_FUN(kbo_isGreater_test17) {
     f(g(y,f(g(x,g(y,z)))))));
 }
 
+
+TEST_FUN(kbo_perf_budget_compare) {
+  DECL_DEFAULT_VARS
+  DECL_SORT(srt)
+  DECL_FUNC(f, {srt}, srt)
+  DECL_FUNC(g, {srt, srt}, srt)
+
+  auto ord = kbo(1, 1, weights(), weights());
+  TermList l = f(g(f(g(x,g(y,z))),y));
+  TermList r = f(g(y,f(g(x,g(y,z)))));
+
+  // a generous budget, to catch algorithmic regressions rather than noise
+  Test::checkInstructionBudget("1000 kbo comparisons", 50'000'000, [&]() {
+    for (unsigned i = 0; i < 1000; i++) {
+      ASS_EQ(ord.compare(l, r), Ordering::Result::GREATER)
+    }
+  });
+}
@@ -28,3 +28,20 @@ TEST_FUN(test_match1) {
   check(f(f(a, y), f(x, b)), f(f(a,b),f(a,b)));
 
 }
+
+TEST_FUN(test_reset_and_large_vars) {
+  DECL_DEFAULT_VARS
+  DECL_VAR(big, 5000)
+  DECL_SORT(s);
+  DECL_FUNC(f, {s, s}, s);
+  DECL_CONST(a, s)
+  DECL_CONST(b, s)
+  RobSubstitution subs;
+  ASS(subs.unify(f(x, big), 0, f(a, b), 70))
+  ASS_EQ(subs.apply(TermList(f(x, big)), 0), TermList(f(a, b)))
+  subs.reset();
+  ASS(subs.isEmpty())
+  ASS(subs.apply(TermList(x), 0).isVar())
+  ASS(subs.unify(f(x, big), 0, f(b, a), 1))
+  ASS_EQ(subs.apply(TermList(f(x, big)), 0), TermList(f(b, a)))
+}
@@ -213,6 +213,10 @@ TEST_FUN(NegativeSubsumption)
   L.push_back(clause({ p(f(x1)), p(f(x2)) }));
   M.push_back(clause({ p(f(y1)), p(g(y2)) }));
 
+  // Test 8 (same predicates, but L is heavier than M)
+  L.push_back(clause({ p(f(f(x1))), q(x2) }));
+  M.push_back(clause({ p(y1), q(f(y2)) }));
+
   bool success = true;
   for (unsigned i = 0; i < L.size(); i++) {
     if (subsumption.checkSubsumption(L[i], M[i])) {
@@ -389,6 +393,55 @@ TEST_FUN(NegativeSubsumptionResolution)
   ASS(success)
 }
 
+/**
+ * Check the pruning when one main premise is checked against several side
+ * premises in a row, as in forward simplification
+ */
+TEST_FUN(SameMainPremise)
+{
+  __ALLOW_UNUSED(SYNTAX_SUGAR_SUBSUMPTION_RESOLUTION)
+  SATSubsumptionAndResolution subsumption;
+
+  Kernel::Clause* M = clause({ p(c), p(d), ~q(e), r(y1) });
+
+  // too many p literals
+  ASS(!subsumption.checkSubsumption(clause({ p(x1), p(x2), p(x3) }), M));
+  ASS(subsumption.checkSubsumption(clause({ p(x1), p(x2) }), M));
+  // a predicate not in M
+  ASS(!subsumption.checkSubsumption(clause({ p(x1), q2(x1, x2) }), M));
+  ASS(!subsumption.checkSubsumption(clause({ q(x1) }), M));
+  ASS(subsumption.checkSubsumption(clause({ ~q(x1), r(x2) }), M));
+
+  Kernel::Clause* conclusion = subsumption.checkSubsumptionResolution(clause({ q(e), p(x1) }), M, false, false);
+  ASS(conclusion);
+  ASS(checkClauseEquality(conclusion, clause({ p(c), p(d), r(y1) })));
+  ASS(!subsumption.checkSubsumptionResolution(clause({ q2(x1, x2), p(x1) }), M, false, false));
+
+  // and again after another main premise
+  ASS(!subsumption.checkSubsumption(clause({ p(x1) }), clause({ q(c) })));
+  ASS(subsumption.checkSubsumption(clause({ p(x1), r(x2) }), M));
+}
+
+TEST_FUN(ArgumentTops)
+{
+  __ALLOW_UNUSED(SYNTAX_SUGAR_SUBSUMPTION_RESOLUTION)
+  SATSubsumptionAndResolution subsumption;
+
+  Kernel::Clause* M = clause({ p2(f(c), y1), g(y2) == c });
+
+  ASS(!subsumption.checkSubsumption(clause({ p2(g(x1), x2) }), M));
+  ASS(!subsumption.checkSubsumption(clause({ p2(x1, f(x2)) }), M));
+  ASS(subsumption.checkSubsumption(clause({ p2(f(x1), x2) }), M));
+  // only matched the other way round
+  ASS(subsumption.checkSubsumption(clause({ c == g(x1) }), M));
+  ASS(!subsumption.checkSubsumption(clause({ c == f(x1) }), M));
+
+  Kernel::Clause* conclusion = subsumption.checkSubsumptionResolution(clause({ ~p2(f(x1), x2) }), M, false, false);
+  ASS(conclusion);
+  ASS(checkClauseEquality(conclusion, clause({ g(y2) == c })));
+  ASS(!subsumption.checkSubsumptionResolution(clause({ ~p2(g(x1), x2) }), M, false, false));
+}
+
 TEST_FUN(UsePreviousSettings)
 {
   __ALLOW_UNUSED(SYNTAX_SUGAR_SUBSUMPTION_RESOLUTION);
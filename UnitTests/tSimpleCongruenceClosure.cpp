@@ -0,0 +1,85 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+#include "DP/SimpleCongruenceClosure.hpp"
+
+using namespace Kernel;
+using namespace DP;
+using namespace Test;
+
+#define SAT DecisionProcedure::SATISFIABLE
+#define UNSAT DecisionProcedure::UNSATISFIABLE
+
+TEST_FUN(push_pop) {
+  DECL_SORT(s)
+  DECL_CONST(a, s)
+  DECL_CONST(b, s)
+  DECL_CONST(c, s)
+  DECL_FUNC(f, {s}, s)
+
+  SimpleCongruenceClosure cc(nullptr);
+  cc.addLiteral(f(a) != f(b));
+  ASS_EQ(cc.getStatus(false), SAT);
+
+  cc.push();
+  cc.addLiteral(a == c);
+  ASS_EQ(cc.getStatus(false), SAT);
+  cc.push();
+  cc.addLiteral(c == b);
+  ASS_EQ(cc.getStatus(false), UNSAT);
+
+  LiteralStack core;
+  cc.getUnsatCore(core, 0);
+  ASS_EQ(core.size(), 3);
+
+  cc.pop();
+  ASS_EQ(cc.getStatus(false), SAT);
+  ASS_NEQ(cc.getClassID(a), cc.getClassID(b));
+  ASS_EQ(cc.getClassID(a), cc.getClassID(c));
+  cc.pop();
+  ASS_EQ(cc.getStatus(false), SAT);
+  ASS_NEQ(cc.getClassID(a), cc.getClassID(c));
+
+  cc.addLiteral(a == b);
+  ASS_EQ(cc.getStatus(false), UNSAT);
+}
+
+TEST_FUN(pairs_created_after_merge) {
+  DECL_SORT(s)
+  DECL_CONST(a, s)
+  DECL_CONST(b, s)
+  DECL_CONST(c, s)
+  DECL_FUNC(g, {s, s}, s)
+
+  SimpleCongruenceClosure cc(nullptr);
+  cc.push();
+  cc.addLiteral(a == b);
+  ASS_EQ(cc.getStatus(false), SAT);
+
+  // g(a,c) and g(b,c) are converted while a and b are merged
+  cc.push();
+  cc.addLiteral(g(a, c) != g(b, c));
+  ASS_EQ(cc.getStatus(false), UNSAT);
+  cc.pop();
+  ASS_EQ(cc.getStatus(false), SAT);
+  ASS_EQ(cc.getClassID(g(a, c)), cc.getClassID(g(b, c)));
+
+  cc.addLiteral(g(a, c) != g(b, c));
+  ASS_EQ(cc.getStatus(false), UNSAT);
+  cc.pop();
+  ASS_EQ(cc.getStatus(false), SAT);
+  ASS_NEQ(cc.getClassID(g(a, c)), cc.getClassID(g(b, c)));
+
+  cc.addLiteral(a == b);
+  ASS_EQ(cc.getStatus(false), SAT);
+  ASS_EQ(cc.getClassID(g(a, c)), cc.getClassID(g(b, c)));
+}
@@ -8,6 +8,7 @@
  * and in the source directory
  */
 
+#include "Lib/Int.hpp"
 #include "Lib/Stack.hpp"
 
 #include "Test/UnitTesting.hpp"
@@ -65,3 +66,30 @@ TEST_FUN(stackDelIterator)
     }
   }
 }
+
+TEST_FUN(stackCopyAndReserve)
+{
+  Stack<string> st1;
+  for(int i=0;i<50;i++) {
+    st1.push(Int::toString(i));
+  }
+  Stack<string> st2(st1);
+  ASS_EQ(st2.size(),50u);
+  ASS_EQ(st2[37],"37");
+
+  Stack<string> st3;
+  st3.push("x");
+  st3 = st1;
+  st3.reserve(1000);
+  ASS_EQ(st3.size(),50u);
+  ASS_EQ(st3.top(),"49");
+
+  Stack<unsigned> st4;
+  for(unsigned i=0;i<100;i++) {
+    st4.push(i);
+  }
+  Stack<unsigned> st5(st4);
+  st5.reserve(1000);
+  ASS_EQ(st5.size(),100u);
+  ASS_EQ(st5[63],63u);
+}
@@ -0,0 +1,84 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+#include "Debug/Assertion.hpp"
+#include "Lib/SwissSet.hpp"
+#include "Test/DummyHash.hpp"
+#include "Test/UnitTesting.hpp"
+
+TEST_FUN(find_remove_contains)
+{
+  SwissSet<int> set;
+  int found = 0;
+  set.insert(42);
+  ALWAYS(set.find(42, found));
+  ASS_EQ(found, 42);
+  ALWAYS(set.remove(42));
+  found = 0;
+  NEVER(set.find(42, found));
+  ASS_EQ(found, 0);
+  NEVER(set.contains(42));
+  NEVER(set.remove(42));
+  set.insert(42);
+  ALWAYS(set.contains(42));
+  ASS_EQ(set.size(), 1);
+}
+
+TEST_FUN(reset)
+{
+  SwissSet<int> set;
+  set.insert(42);
+  ASS_EQ(set.size(), 1);
+  set.reset();
+  ASS_EQ(set.size(), 0);
+  NEVER(set.contains(42));
+}
+
+TEST_FUN(growth_and_deleted_slots)
+{
+  SwissSet<int> set;
+  for (int i = 0; i < 10000; i++) {
+    set.insert(i);
+  }
+  for (int i = 0; i < 10000; i += 2) {
+    ALWAYS(set.remove(i));
+  }
+  ASS_EQ(set.size(), 5000);
+  // inserting after the removals reuses or purges the deleted slots
+  for (int i = 10000; i < 20000; i++) {
+    set.insert(i);
+  }
+  ASS_EQ(set.size(), 15000);
+  for (int i = 0; i < 20000; i++) {
+    ASS_EQ(set.contains(i), i >= 10000 || i % 2 == 1);
+  }
+  unsigned iterated = 0;
+  for (int i : set.iter()) {
+    ALWAYS(i >= 10000 || i % 2 == 1);
+    iterated++;
+  }
+  ASS_EQ(iterated, 15000);
+}
+
+TEST_FUN(dummy_hash)
+{
+  // all values share a hash code, so they share even the tag of the control byte
+  SwissSet<int, DummyHash> set;
+  for (int i = 0; i < 100; i++) {
+    set.insert(i);
+  }
+  ASS_EQ(set.size(), 100);
+  int found = 0;
+  ALWAYS(set.find(42, found));
+  ASS_EQ(found, 42);
+  ALWAYS(set.remove(42));
+  NEVER(set.contains(42));
+  ALWAYS(set.contains(99));
+  ASS_EQ(set.size(), 99);
+}
@@ -15,6 +15,7 @@
 #include "Test/SyntaxSugar.hpp"
 #include "Indexing/TermSubstitutionTree.hpp"
 #include "Indexing/LiteralSubstitutionTree.hpp"
+#include "Indexing/GroundHashIndexingStructure.hpp"
 
 
 using namespace Test;
@@ -301,3 +302,177 @@ TEST_FUN(zero_arity_predicate) {
 
 }
 
+
+TEST_FUN(batch_01) {
+
+  DECL_DEFAULT_VARS
+  DECL_SORT(srt)
+  DECL_CONST(a, srt)
+  DECL_CONST(b, srt)
+  DECL_FUNC(f, {srt}, srt)
+  DECL_FUNC(g, {srt, srt}, srt)
+
+  using Data = MyData<TypedTermList>;
+  TermSubstitutionTree<Data> tree;
+  auto dat = [](TypedTermList t, std::string s) { return Data(t, std::move(s)); };
+  Stack<Data> batch = { dat(g(a, x), "g(a,x)"), dat(f(a), "f(a)"), dat(g(a, b), "g(a,b)"), dat(f(x), "f(x)") };
+  tree.handleBatch(batch, /* insert */ true);
+
+  check_unify(tree, f(a), { dat(f(a), "f(a)"), dat(f(x), "f(x)") });
+  check_unify(tree, g(y, b), { dat(g(a, x), "g(a,x)"), dat(g(a, b), "g(a,b)") });
+
+  batch = { dat(g(a, b), "g(a,b)"), dat(f(a), "f(a)") };
+  tree.handleBatch(batch, /* insert */ false);
+
+  check_unify(tree, f(a), { dat(f(x), "f(x)") });
+  check_unify(tree, g(y, b), { dat(g(a, x), "g(a,x)") });
+}
+
+TEST_FUN(batch_literal_01) {
+
+  DECL_DEFAULT_VARS
+  DECL_SORT(srt)
+  DECL_CONST(a, srt)
+  DECL_CONST(b, srt)
+  DECL_PRED(p, {srt})
+  DECL_PRED(q, {srt})
+
+  using Data = MyData<Literal*>;
+  LiteralSubstitutionTree<Data> tree;
+  auto dat = [](Literal* k, std::string s) { return Data(k, std::move(s)); };
+  Stack<Data> batch = { dat(q(a), "q(a)"), dat(~p(a), "~p(a)"), dat(p(x), "p(x)"), dat(q(b), "q(b)") };
+  tree.handleBatch(batch, /* insert */ true);
+
+  check_unify(tree,  p(a), { dat(p(x), "p(x)") });
+  check_unify(tree, ~p(a), { dat(~p(a), "~p(a)") });
+  check_unify(tree,  q(x), { dat(q(a), "q(a)"), dat(q(b), "q(b)") });
+
+  batch = { dat(q(a), "q(a)"), dat(~p(a), "~p(a)") };
+  tree.handleBatch(batch, /* insert */ false);
+
+  check_unify(tree, ~p(a), Stack<Data>{});
+  check_unify(tree,  q(x), { dat(q(b), "q(b)") });
+}
+
+// the indexing structures of GroundHashIndexingStructure.hpp have no multiline output
+template<class Idx, class Data, class Key, class Iter>
+void check_hashed(const char* operation, Idx& idx, Key key, Stack<Data> expected, Iter results)
+{
+  auto is = iterTraits(std::move(results))
+    .map([](auto u) { return *u.data; })
+    .template collect<Stack>();
+  std::sort(is.begin(), is.end());
+  std::sort(expected.begin(), expected.end());
+  if (is == expected) {
+    std::cout << "[  ok  ] " << operation << " " << pretty(key) << std::endl;
+  } else {
+    std::cout << std::endl;
+    std::cout << "[ FAIL ] " << operation << " " << pretty(key) << std::endl;
+    std::cout << "[  idx ] " << idx << std::endl;
+    std::cout << "[   is ]" << is << std::endl;
+    std::cout << "[  exp ]" << expected << std::endl;
+    ASSERTION_VIOLATION
+  }
+}
+
+TEST_FUN(ground_hash_terms_01) {
+
+  DECL_DEFAULT_VARS
+  DECL_SORT(srt)
+  DECL_CONST(a, srt)
+  DECL_CONST(b, srt)
+  DECL_FUNC(f, {srt}, srt)
+
+  using Data = MyData<TypedTermList>;
+  auto dat = [](TypedTermList t, std::string s) { return Data(t, std::move(s)); };
+  GroundHashTIS<Data> idx(new TermSubstitutionTree<Data>());
+  auto gen = [&](TypedTermList t, Stack<Data> expected)
+  { check_hashed("getGen", idx, t, expected, idx.getGeneralizations(t, /* retrieveSubstitutions */ true)); };
+
+  idx.insert(dat(f(a), "1"));
+  idx.insert(dat(f(a), "2"));
+  idx.insert(dat(f(x), "3"));
+  idx.insert(dat(f(b), "4"));
+
+  gen(f(a), { dat(f(a), "1"), dat(f(a), "2"), dat(f(x), "3") });
+  gen(f(b), { dat(f(x), "3"), dat(f(b), "4") });
+  gen(f(f(a)), { dat(f(x), "3") });
+  ASS(idx.generalizationExists(f(b)))
+
+  idx.remove(dat(f(a), "1"));
+  gen(f(a), { dat(f(a), "2"), dat(f(x), "3") });
+  idx.remove(dat(f(a), "2"));
+  idx.remove(dat(f(x), "3"));
+  gen(f(a), Stack<Data>{});
+  ASS(!idx.generalizationExists(f(a)))
+
+  // the first unification query moves the ground entries to the tree
+  check_hashed("unify", idx, TypedTermList(f(y)), Stack<Data>{ dat(f(b), "4") }, idx.getUnifications(f(y), /* retrieveSubstitutions */ true));
+  idx.insert(dat(f(a), "5"));
+  gen(f(a), { dat(f(a), "5") });
+  gen(f(b), { dat(f(b), "4") });
+  idx.remove(dat(f(b), "4"));
+  gen(f(b), Stack<Data>{});
+}
+
+TEST_FUN(ground_hash_literals_01) {
+
+  DECL_DEFAULT_VARS
+  DECL_SORT(srt)
+  DECL_CONST(a, srt)
+  DECL_CONST(b, srt)
+  DECL_FUNC(f, {srt}, srt)
+  DECL_PRED(p, {srt})
+
+  using Data = MyData<Literal*>;
+  auto dat = [](Literal* l, std::string s) { return Data(l, std::move(s)); };
+  GroundHashLIS<Data> idx(new LiteralSubstitutionTree<Data>());
+  auto gen = [&](Literal* l, bool complementary, Stack<Data> expected)
+  { check_hashed(complementary ? "getGen complementary" : "getGen", idx, l, expected,
+      idx.getGeneralizations(l, complementary, /* retrieveSubstitutions */ true)); };
+
+  idx.insert(dat( p(a), "1"));
+  idx.insert(dat(~p(a), "2"));
+  idx.insert(dat( p(x), "3"));
+  idx.insert(dat(f(a) == b, "4"));
+
+  gen( p(a), false, { dat(p(a), "1"), dat(p(x), "3") });
+  gen(~p(a), true,  { dat(p(a), "1"), dat(p(x), "3") });
+  gen( p(a), true,  { dat(~p(a), "2") });
+  gen( p(b), false, { dat(p(x), "3") });
+  // both orientations of a ground equality are the same shared literal
+  gen(b == f(a), false, { dat(f(a) == b, "4") });
+
+  idx.remove(dat(p(a), "1"));
+  gen(p(a), false, { dat(p(x), "3") });
+
+  // retrieving all entries moves the ground ones to the tree
+  ASS_EQ(iterTraits(idx.getAll()).count(), 3)
+  gen(p(a), true, { dat(~p(a), "2") });
+  idx.remove(dat(~p(a), "2"));
+  gen(p(a), true, Stack<Data>{});
+}
+
+TEST_FUN(perf_budget_unify) {
+  DECL_DEFAULT_VARS
+  DECL_SORT(srt)
+  DECL_CONST(a, srt)
+  DECL_CONST(b, srt)
+  DECL_FUNC(f, {srt}, srt)
+  DECL_FUNC(g, {srt, srt}, srt)
+  DECL_PRED(p, {srt})
+
+  TermSubstitutionTree<TermWithValue<Literal*>> tree;
+  TermSugar t = a;
+  for (unsigned i = 0; i < 200; i++) {
+    t = g(t, i % 2 ? a : b);
+    tree.insert(TermWithValue<Literal*>(f(t), p(a)));
+  }
+
+  // a generous budget, to catch algorithmic regressions rather than noise
+  Test::checkInstructionBudget("100 retrievals of 200 unifiers", 200'000'000, [&]() {
+    for (unsigned i = 0; i < 100; i++) {
+      ASS_EQ(iterTraits(tree.getUnifications(f(x), /* retrieveSubstitutions */ true)).count(), 200)
+    }
+  });
+}
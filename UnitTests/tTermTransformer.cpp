@@ -0,0 +1,81 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+#include "Kernel/TermTransformer.hpp"
+
+using namespace Kernel;
+using namespace Test;
+
+/** replaces @b what by @b by, counting the subterms it is asked about */
+class CountingReplacement : public TermTransformer {
+public:
+  CountingReplacement(TermList what, TermList by, bool memoizing) : _what(what), _by(by)
+  { setMemoizing(memoizing); }
+  TermList transformSubterm(TermList t) override { calls++; return t == _what ? _by : t; }
+  unsigned calls = 0;
+private:
+  TermList _what;
+  TermList _by;
+};
+
+class CountingBottomUpReplacement : public BottomUpTermTransformer {
+public:
+  CountingBottomUpReplacement(TermList what, TermList by, bool memoizing) : _what(what), _by(by)
+  { setMemoizing(memoizing); }
+  TermList transformSubterm(TermList t) override { calls++; return t == _what ? _by : t; }
+  unsigned calls = 0;
+private:
+  TermList _what;
+  TermList _by;
+};
+
+TEST_FUN(top_down_memo) {
+  DECL_SORT(s)
+  DECL_CONST(a, s)
+  DECL_CONST(b, s)
+  DECL_FUNC(f, {s}, s)
+  DECL_FUNC(g, {s,s}, s)
+
+  TermList input = g(f(a), f(a));
+  TermList expected = g(f(b), f(b));
+
+  CountingReplacement plain(a, b, false);
+  ASS_EQ(TermList(plain.transform(input.term())), expected);
+  ASS_EQ(plain.calls, 4);
+
+  // the second f(a) is taken from the memo
+  CountingReplacement memoizing(a, b, true);
+  ASS_EQ(TermList(memoizing.transform(input.term())), expected);
+  ASS_EQ(memoizing.calls, 2);
+  // and so is everything in a later call
+  ASS_EQ(TermList(memoizing.transform(TermList(g(f(a), a)).term())), TermList(g(f(b), b)));
+  ASS_EQ(memoizing.calls, 2);
+}
+
+TEST_FUN(bottom_up_memo) {
+  DECL_SORT(s)
+  DECL_CONST(a, s)
+  DECL_CONST(b, s)
+  DECL_FUNC(f, {s}, s)
+  DECL_FUNC(g, {s,s}, s)
+
+  TermList input = g(f(a), f(a));
+  TermList expected = g(f(b), f(b));
+
+  CountingBottomUpReplacement plain(a, b, false);
+  ASS_EQ(TermList(plain.transform(input.term())), expected);
+  ASS_EQ(plain.calls, 4);
+
+  CountingBottomUpReplacement memoizing(a, b, true);
+  ASS_EQ(TermList(memoizing.transform(input.term())), expected);
+  ASS_EQ(memoizing.calls, 2);
+}
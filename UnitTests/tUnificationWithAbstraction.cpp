@@ -1190,6 +1190,25 @@ ROB_UNIFY_TEST_FAIL(rob_unif_test_04,
     /* withFixedPointIteration */ false,
     f(a), g(1 + a))
 
+// distinct ground subterms without interpreted symbols are rejected without asking the oracle
+ROB_UNIFY_TEST_FAIL(rob_unif_test_04_ground,
+    SUGAR(Rat),
+    Options::UnificationWithAbstraction::ONE_INTERP,
+    /* withFixedPointIteration */ false,
+    f2(x, f(a)), f2(b, f(b)))
+
+ROB_UNIFY_TEST(rob_unif_test_04_ground_interp,
+    SUGAR(Rat),
+    Options::UnificationWithAbstraction::ONE_INTERP,
+    /* withFixedPointIteration */ false,
+    f2(x, f(a)),
+    f2(b, f(1 + a)),
+    TermUnificationResultSpec { 
+      .querySigma = f2(b, f(a)),
+      .resultSigma = f2(b, f(1 + a)),
+      .constraints = { a != 1 + a },
+    })
+
 
 ROB_UNIFY_TEST(rob_unif_test_05,
     SUGAR(Rat),
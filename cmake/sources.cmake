@@ -41,11 +41,15 @@ set(UNIT_TESTS
     UnitTests/tALASCA_TermFactoring.cpp
     UnitTests/tALASCA_VIRAS.cpp
     UnitTests/tALASCA_VariableElimination.cpp
+    UnitTests/tAllocator.cpp
     UnitTests/tAnswerLiteralProcessors_Synthesis.cpp
     UnitTests/tArithCompare.cpp
     UnitTests/tArithmeticSubtermGeneralization.cpp
+    UnitTests/tAtomTable.cpp
     UnitTests/tBinaryHeap.cpp
     UnitTests/tBottomUpEvaluation.cpp
+    UnitTests/tClauseBodyIndex.cpp
+    UnitTests/tCliqueFinder.cpp
     UnitTests/tCoproduct.cpp
     UnitTests/tDHMap.cpp
     UnitTests/tDHMultiset.cpp
@@ -76,11 +80,14 @@ set(UNIT_TESTS
     UnitTests/tSATSolver.cpp
     UnitTests/tSATSubsumptionResolution.cpp
     UnitTests/tSet.cpp
+    UnitTests/tSimpleCongruenceClosure.cpp
     UnitTests/tSkipList.cpp
     UnitTests/tStack.cpp
+    UnitTests/tSwissSet.cpp
     UnitTests/tSyntaxSugar.cpp
     UnitTests/tTermAlgebra.cpp
     UnitTests/tTermIndex.cpp
+    UnitTests/tTermTransformer.cpp
     UnitTests/tTimeTrace.cpp
     UnitTests/tUnificationWithAbstraction.cpp
     UnitTests/HOL/tHOL_Printing.cpp
@@ -136,6 +143,8 @@ set(SOURCES
     FMB/SortInference.hpp
     Indexing/AcyclicityIndex.cpp
     Indexing/AcyclicityIndex.hpp
+    Indexing/ClauseBodyIndex.cpp
+    Indexing/ClauseBodyIndex.hpp
     Indexing/ClauseCodeTree.cpp
     Indexing/ClauseCodeTree.hpp
     Indexing/ClauseVariantIndex.cpp
@@ -144,6 +153,7 @@ set(SOURCES
     Indexing/CodeTree.hpp
     Indexing/CodeTreeInterfaces.cpp
     Indexing/CodeTreeInterfaces.hpp
+    Indexing/GroundHashIndexingStructure.hpp
     Indexing/Index.cpp
     Indexing/Index.hpp
     Indexing/IndexManager.cpp
@@ -249,6 +259,8 @@ set(SOURCES
     Inferences/DemodulationHelper.hpp
     Inferences/DistinctEqualitySimplifier.cpp
     Inferences/DistinctEqualitySimplifier.hpp
+    Inferences/DuplicateClauseDeletion.cpp
+    Inferences/DuplicateClauseDeletion.hpp
     Inferences/EqualityFactoring.cpp
     Inferences/EqualityFactoring.hpp
     Inferences/EqualityResolution.cpp
@@ -354,6 +366,8 @@ set(SOURCES
     Kernel/InductionTemplate.hpp
     Kernel/Inference.cpp
     Kernel/Inference.hpp
+    Kernel/InferenceLog.cpp
+    Kernel/InferenceLog.hpp
     Kernel/InferenceStore.cpp
     Kernel/InferenceStore.hpp
     Kernel/InterpretedLiteralEvaluator.cpp
@@ -466,6 +480,7 @@ set(SOURCES
     Lib/Allocator.hpp
     Lib/Array.hpp
     Lib/ArrayMap.hpp
+    Lib/AtomTable.hpp
     Lib/Backtrackable.hpp
     Lib/BacktrackableCollections.hpp
     Lib/BiMap.hpp
@@ -486,6 +501,8 @@ set(SOURCES
     Lib/Exception.cpp
     Lib/Exception.hpp
     Lib/Hash.hpp
+    Lib/HeapProfiler.cpp
+    Lib/HeapProfiler.hpp
     Lib/Int.cpp
     Lib/Int.hpp
     Lib/IntUnionFind.cpp
@@ -522,6 +539,7 @@ set(SOURCES
     Lib/Stack.hpp
     Lib/StringUtils.cpp
     Lib/StringUtils.hpp
+    Lib/SwissSet.hpp
     Lib/Sys/Multiprocessing.cpp
     Lib/Sys/Multiprocessing.hpp
     Lib/System.cpp
@@ -562,6 +580,8 @@ set(SOURCES
     SAT/CadicalInterfacing.hpp
     SAT/FallbackSolverWrapper.cpp
     SAT/FallbackSolverWrapper.hpp
+    SAT/PortfolioSATSolver.cpp
+    SAT/PortfolioSATSolver.hpp
     SAT/MinimizingSolver.cpp
     SAT/MinimizingSolver.hpp
     SAT/MinisatInterfacing.cpp
@@ -602,6 +622,8 @@ set(SOURCES
     Saturation/AbstractPassiveClauseContainers.hpp
     Saturation/ClauseContainer.cpp
     Saturation/ClauseContainer.hpp
+    Saturation/ClauseExchange.cpp
+    Saturation/ClauseExchange.hpp
     Saturation/ConsequenceFinder.cpp
     Saturation/ConsequenceFinder.hpp
     Saturation/Discount.cpp
@@ -0,0 +1,192 @@
+/*
+ * Benchmark: Proof throughput and latency of the library with several threads
+ *
+ * Usage: bench_api_concurrency [-t max_threads] [-l time_limit] [-r rounds] corpus...
+ *
+ * Each corpus argument is a TPTP problem file or a directory whose .p
+ * files are used (e.g. checks/Problems/PUZ). For 1, 2, 4, ... threads up
+ * to max_threads (default: the number of cores), every thread gets its own
+ * VampireContext and proves its share of rounds passes over the corpus.
+ * Reported are the throughput, the p50 and p99 latency of a single proof,
+ * and the peak memory, which makes this the reference for how well
+ * contexts scale. Every thread count runs in a process of its own, so its
+ * peak memory is not the one of the runs before.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "Api/VampireAPI.hpp"
+
+using namespace Api;
+
+using Clock = std::chrono::steady_clock;
+
+struct RunResult {
+    double seconds;
+    std::vector<double> latenciesMs;
+    int proved;
+};
+
+// Prove the problems of `jobs` in a context of its own, recording the time of each proof
+void proveShare(const std::vector<std::string>& corpus, const std::vector<size_t>& jobs,
+                int timeLimit, std::vector<double>& latenciesMs, int& proved) {
+    VampireContext* ctx = createContext();
+    {
+        ContextScope scope(*ctx);
+        options().setTimeLimitInSeconds(timeLimit);
+    }
+    for (size_t job : jobs) {
+        Problem* prb;
+        {
+            ContextScope scope(*ctx);
+            prb = problemFromTPTP(corpus[job]);
+        }
+        if (!prb) {
+            continue;
+        }
+        auto start = Clock::now();
+        ProofResult result = prove(*ctx, prb);
+        latenciesMs.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        if (result == ProofResult::PROOF) {
+            proved++;
+        }
+        ContextScope scope(*ctx);
+        delete prb;
+    }
+    destroyContext(ctx);
+}
+
+RunResult run(const std::vector<std::string>& corpus, unsigned threads, int rounds, int timeLimit) {
+    // problem i of the whole run goes to thread i % threads
+    std::vector<std::vector<size_t>> jobs(threads);
+    size_t total = corpus.size() * rounds;
+    for (size_t i = 0; i < total; i++) {
+        jobs[i % threads].push_back(i % corpus.size());
+    }
+
+    std::vector<std::vector<double>> latencies(threads);
+    std::vector<int> proved(threads, 0);
+    auto start = Clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; t++) {
+        workers.emplace_back(proveShare, std::cref(corpus), std::cref(jobs[t]), timeLimit,
+                             std::ref(latencies[t]), std::ref(proved[t]));
+    }
+    for (std::thread& w : workers) {
+        w.join();
+    }
+
+    RunResult res;
+    res.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    res.proved = 0;
+    for (unsigned t = 0; t < threads; t++) {
+        res.latenciesMs.insert(res.latenciesMs.end(), latencies[t].begin(), latencies[t].end());
+        res.proved += proved[t];
+    }
+    std::sort(res.latenciesMs.begin(), res.latenciesMs.end());
+    return res;
+}
+
+double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    size_t i = std::min(sorted.size() - 1, size_t(p * sorted.size()));
+    return sorted[i];
+}
+
+bool readCorpus(const std::string& path, std::vector<std::string>& corpus) {
+    std::vector<std::filesystem::path> files;
+    if (std::filesystem::is_directory(path)) {
+        for (const auto& entry : std::filesystem::directory_iterator(path)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".p") {
+                files.push_back(entry.path());
+            }
+        }
+        std::sort(files.begin(), files.end());
+    } else {
+        files.push_back(path);
+    }
+    for (const auto& file : files) {
+        std::ifstream in(file);
+        if (!in) {
+            std::cerr << "Cannot read " << file << std::endl;
+            return false;
+        }
+        std::stringstream text;
+        text << in.rdbuf();
+        corpus.push_back(text.str());
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    int timeLimit = 10;
+    int rounds = 1;
+    std::vector<std::string> corpus;
+
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "-t") && i + 1 < argc) {
+            maxThreads = std::max(1, std::atoi(argv[++i]));
+        } else if (!std::strcmp(argv[i], "-l") && i + 1 < argc) {
+            timeLimit = std::atoi(argv[++i]);
+        } else if (!std::strcmp(argv[i], "-r") && i + 1 < argc) {
+            rounds = std::max(1, std::atoi(argv[++i]));
+        } else if (!readCorpus(argv[i], corpus)) {
+            return 1;
+        }
+    }
+    if (corpus.empty()) {
+        std::cerr << "Usage: " << argv[0] << " [-t max_threads] [-l time_limit] [-r rounds] corpus..." << std::endl;
+        return 1;
+    }
+
+    std::cout << "Proving " << corpus.size() << " problems " << rounds << " time(s) with up to "
+              << maxThreads << " threads" << std::endl << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(10) << "proved" << std::setw(12) << "seconds"
+              << std::setw(12) << "proofs/s" << std::setw(12) << "p50 ms" << std::setw(12) << "p99 ms"
+              << std::setw(14) << "peak MB" << std::endl;
+
+    for (unsigned threads = 1;; threads = std::min(threads * 2, maxThreads)) {
+        // the peak memory of a process cannot be reset, so every run gets a fresh one
+        std::cout.flush();
+        pid_t child = fork();
+        if (child < 0) {
+            std::cerr << "Cannot fork" << std::endl;
+            return 1;
+        }
+        if (child == 0) {
+            RunResult res = run(corpus, threads, rounds, timeLimit);
+            std::cout << std::setw(8) << threads
+                      << std::setw(10) << res.proved
+                      << std::setw(12) << std::fixed << std::setprecision(2) << res.seconds
+                      << std::setw(12) << res.latenciesMs.size() / res.seconds
+                      << std::setw(12) << percentile(res.latenciesMs, 0.5)
+                      << std::setw(12) << percentile(res.latenciesMs, 0.99)
+                      << std::setw(14) << memoryReport().peakTotalKB / 1024 << std::endl;
+            std::_Exit(0);
+        }
+        int status;
+        if (waitpid(child, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            std::cerr << "The run with " << threads << " threads failed" << std::endl;
+            return 1;
+        }
+        if (threads == maxThreads) {
+            break;
+        }
+    }
+    return 0;
+}
@@ -1,10 +1,17 @@
 /*
- * Benchmark: Measure proof throughput
+ * Benchmark: Measure proof throughput and the speed of some kernel operations
  */
 
 #include <iostream>
 #include <chrono>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
 #include "Api/VampireAPI.hpp"
+#include "Kernel/Ordering.hpp"
+#include "Kernel/RobSubstitution.hpp"
 
 using namespace Api;
 using namespace Kernel;
@@ -31,6 +38,165 @@ bool runTrivialProof() {
     return result == ProofResult::PROOF;
 }
 
+// Same problem, built without proving it (symbols are shared between problems)
+Problem* buildTrivialProblem() {
+    unsigned a = addFunction("a", 0);
+    unsigned P = addPredicate("P", 1);
+    unsigned Q = addPredicate("Q", 1);
+
+    TermList aConst = constant(a);
+    TermList x = var(0);
+
+    Clause* c1 = axiom({lit(P, true, {aConst})});
+    Clause* c2 = axiom({lit(P, false, {x}), lit(Q, true, {x})});
+    Clause* c3 = conjecture({lit(Q, false, {aConst})});
+
+    return problem({c1, c2, c3});
+}
+
+// Prove all problems with a single proveBatch() call
+int runBatch(int numProofs) {
+    std::cout << "Running " << numProofs << " trivial proofs as one batch..." << std::endl;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::vector<Problem*> problems;
+    for (int i = 0; i < numProofs; i++) {
+        problems.push_back(buildTrivialProblem());
+    }
+    std::vector<ProofResult> results = proveBatch(problems);
+
+    int succeeded = 0;
+    for (ProofResult r : results) {
+        if (r == ProofResult::PROOF) {
+            succeeded++;
+        }
+    }
+    for (Problem* prb : problems) {
+        delete prb;
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = end - start;
+
+    std::cout << "\nResults:" << std::endl;
+    std::cout << "  Proofs completed: " << succeeded << "/" << numProofs << std::endl;
+    std::cout << "  Total time: " << elapsed.count() << " seconds" << std::endl;
+    std::cout << "  Throughput: " << (numProofs / elapsed.count()) << " proofs/second" << std::endl;
+    std::cout << "  Average time per proof: " << (elapsed.count() / numProofs * 1000) << " ms" << std::endl;
+
+    return succeeded == numProofs ? 0 : 1;
+}
+
+// Hash-cons numTerms distinct terms f(t, g(c_i)) and then look all of them up again
+int runTermSharing(int numTerms) {
+    std::cout << "Building " << numTerms << " shared terms..." << std::endl;
+
+    unsigned f = addFunction("f", 2);
+    unsigned g = addFunction("g", 1);
+    unsigned c = addFunction("c", 0);
+
+    auto build = [&]() {
+        TermList t = constant(c);
+        for (int i = 0; i < numTerms; i++) {
+            t = term(f, {t, term(g, {var(i % 16)})});
+        }
+        return t;
+    };
+
+    auto start = std::chrono::high_resolution_clock::now();
+    TermList built = build();
+    auto mid = std::chrono::high_resolution_clock::now();
+    TermList found = build();
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double> insertTime = mid - start;
+    std::chrono::duration<double> lookupTime = end - mid;
+
+    std::cout << "\nResults:" << std::endl;
+    std::cout << "  Insertions: " << (numTerms / insertTime.count()) << " terms/second" << std::endl;
+    std::cout << "  Lookups: " << (numTerms / lookupTime.count()) << " terms/second" << std::endl;
+
+    return built == found ? 0 : 1;
+}
+
+// numTerms random terms over f/2, g/1, a, b and 8 variables, the same in every run
+std::vector<TermList> randomTerms(int numTerms) {
+    unsigned f = addFunction("f", 2);
+    unsigned g = addFunction("g", 1);
+    unsigned a = addFunction("a", 0);
+    unsigned b = addFunction("b", 0);
+
+    std::mt19937 rng(0);
+    std::function<TermList(unsigned)> build = [&](unsigned depth) {
+        unsigned pick = rng() % (depth ? 5 : 3);
+        switch (pick) {
+            case 0: return var(rng() % 8);
+            case 1: return constant(a);
+            case 2: return constant(b);
+            case 3: return term(g, {build(depth - 1)});
+            default: return term(f, {build(depth - 1), build(depth - 1)});
+        }
+    };
+    std::vector<TermList> terms;
+    for (int i = 0; i < numTerms; i++) {
+        terms.push_back(build(6));
+    }
+    return terms;
+}
+
+// Unify each of numTerms random terms with the next one
+int runUnify(int numTerms) {
+    std::cout << "Unifying " << numTerms << " pairs of random terms..." << std::endl;
+
+    std::vector<TermList> terms = randomTerms(numTerms + 1);
+    RobSubstitution subst;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    int unified = 0;
+    for (int i = 0; i < numTerms; i++) {
+        subst.reset();
+        if (subst.unify(terms[i], 0, terms[i + 1], 1)) {
+            unified++;
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = end - start;
+
+    std::cout << "\nResults:" << std::endl;
+    std::cout << "  Unifiable pairs: " << unified << "/" << numTerms << std::endl;
+    std::cout << "  Unifications: " << (numTerms / elapsed.count()) << " pairs/second" << std::endl;
+    return 0;
+}
+
+// Compare each of numTerms random terms with the next one in the default ordering
+int runOrdering(int numTerms) {
+    std::cout << "Comparing " << numTerms << " pairs of random terms..." << std::endl;
+
+    std::vector<TermList> terms = randomTerms(numTerms + 1);
+    unsigned P = addPredicate("P", 1);
+    Problem* prb = problem({axiom({lit(P, true, {terms[0]})})});
+    std::unique_ptr<Ordering> ordering(Ordering::create(*prb, options()));
+
+    auto start = std::chrono::high_resolution_clock::now();
+    int comparable = 0;
+    for (int i = 0; i < numTerms; i++) {
+        if (ordering->compare(terms[i], terms[i + 1]) != Ordering::INCOMPARABLE) {
+            comparable++;
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = end - start;
+
+    std::cout << "\nResults:" << std::endl;
+    std::cout << "  Comparable pairs: " << comparable << "/" << numTerms << std::endl;
+    std::cout << "  Comparisons: " << (numTerms / elapsed.count()) << " pairs/second" << std::endl;
+
+    ordering.reset();
+    delete prb;
+    return 0;
+}
+
 int main(int argc, char** argv) {
     int numProofs = 100;
 
@@ -40,6 +206,23 @@ int main(int argc, char** argv) {
 
     options().setTimeLimitInSeconds(10);
 
+    // "benchmark N batch" measures proveBatch() instead of prove()+reset()
+    if (argc > 2 && std::string(argv[2]) == "batch") {
+        return runBatch(numProofs);
+    }
+    // "benchmark N terms" measures hash-consing of N terms in TermSharing
+    if (argc > 2 && std::string(argv[2]) == "terms") {
+        return runTermSharing(numProofs);
+    }
+    // "benchmark N unify" measures RobSubstitution::unify() on N pairs of terms
+    if (argc > 2 && std::string(argv[2]) == "unify") {
+        return runUnify(numProofs);
+    }
+    // "benchmark N ordering" measures term comparisons of the default ordering
+    if (argc > 2 && std::string(argv[2]) == "ordering") {
+        return runOrdering(numProofs);
+    }
+
     std::cout << "Running " << numProofs << " trivial proofs with full reset..." << std::endl;
 
     auto start = std::chrono::high_resolution_clock::now();
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""
+Compute a portfolio schedule from per-strategy outcome logs.
+
+Command line:
+learn_schedule.py [-b budget] [-c cluster] log1.tsv ...
+
+Each non-empty line of a log that does not start with '%' is
+  problem <TAB> strategy <TAB> time [<TAB> cluster]
+where strategy is an encoded strategy without the time limit suffix
+(e.g. "lrs+10_1:1_sos=on"), and time is the number of deciseconds it
+took to solve the problem, or '-' if it did not solve it. With -c, only
+the lines of the given cluster (e.g. a group of problems with similar
+properties) are used.
+
+The schedule is built greedily: each step adds the strategy and time
+limit that solve the most not yet covered problems per decisecond,
+until the budget (default 3000 deciseconds) is used up or nothing new
+can be solved. The output, one strategy per line in the order the
+slices should run, is meant for --schedule file --schedule_file.
+"""
+
+import sys
+import getopt
+from collections import defaultdict
+
+
+def readLogs(fileNames, cluster):
+    """return {strategy: {problem: time}} of the solved runs"""
+    solved = defaultdict(dict)
+    for fileName in fileNames:
+        with open(fileName) as f:
+            for lineNo, line in enumerate(f, 1):
+                line = line.rstrip("\n")
+                if line == "" or line[0] == "%":
+                    continue
+                cols = line.split("\t")
+                if len(cols) not in (3, 4):
+                    sys.exit("%s:%d: expected 3 or 4 columns" % (fileName, lineNo))
+                if cluster is not None and (len(cols) < 4 or cols[3] != cluster):
+                    continue
+                problem, strategy, time = cols[:3]
+                if time == "-":
+                    continue
+                time = max(1, int(time))
+                old = solved[strategy].get(problem)
+                if old is None or time < old:
+                    solved[strategy][problem] = time
+    return solved
+
+
+def greedySchedule(solved, budget):
+    """return [(strategy, time limit)] covering many problems within budget"""
+    covered = set()
+    schedule = []
+    while budget > 0:
+        best = None
+        for strategy, times in solved.items():
+            fresh = sorted(t for p, t in times.items() if p not in covered)
+            # running up to the k-th smallest time solves k new problems
+            for k, limit in enumerate(fresh, 1):
+                if limit > budget:
+                    break
+                if best is None or k * best[2] > best[1] * limit:
+                    best = (strategy, k, limit)
+        if best is None:
+            break
+        strategy, _, limit = best
+        covered.update(p for p, t in solved[strategy].items() if t <= limit)
+        schedule.append((strategy, limit))
+        budget -= limit
+    return schedule, covered
+
+
+def main(args):
+    budget = 3000
+    cluster = None
+    opts, fileNames = getopt.getopt(args, "b:c:")
+    for opt, val in opts:
+        if opt == "-b":
+            budget = int(val)
+        elif opt == "-c":
+            cluster = val
+    if not fileNames:
+        sys.exit(__doc__)
+
+    solved = readLogs(fileNames, cluster)
+    schedule, covered = greedySchedule(solved, budget)
+
+    problems = set()
+    for times in solved.values():
+        problems.update(times)
+    print("%% covers %d of the %d solved problems in %d deciseconds" %
+          (len(covered), len(problems), sum(t for _, t in schedule)))
+    for strategy, limit in schedule:
+        print("%s_%d" % (strategy, limit))
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""
+Record the performance of Vampire on a pinned problem corpus and compare
+it against a baseline.
+
+Command line:
+perf_regression.py run [-n repeats] [-t seconds] [-s options]... vampire corpus.txt out.json
+perf_regression.py compare [-p percent] baseline.json current.json
+
+The corpus file lists one problem per line (blank lines and lines starting
+with '#' are skipped); relative paths are resolved against the directory
+of the corpus file. Each problem is run with each strategy given by -s
+(by default only with the default options), repeats times (default 3),
+with the statistics written through --statistics_json. Recorded are the
+termination reason, the instructions executed (needs perf_event access,
+see Lib/Timer.cpp; the count is far more stable than the time on a noisy
+machine), the activations, the peak memory and, measured by
+--phase_timing, the time of each saturation phase.
+
+compare reports, per problem and strategy and over the whole corpus per
+saturation phase, every metric whose mean grew by more than percent
+(default 5) such that the difference is also larger than three standard
+errors, and every problem that is no longer solved. The exit code is 1 if
+anything was reported.
+"""
+
+import getopt
+import json
+import math
+import os
+import subprocess
+import sys
+import tempfile
+
+SOLVED = ("REFUTATION", "SATISFIABLE")
+
+
+def readCorpus(fileName):
+    base = os.path.dirname(os.path.abspath(fileName))
+    problems = []
+    with open(fileName) as f:
+        for line in f:
+            line = line.strip()
+            if line and not line.startswith("#"):
+                problems.append(os.path.join(base, line))
+    return problems
+
+
+def metrics(stats):
+    """the metrics recorded for the JSON statistics line @b stats"""
+    res = {
+        "mega_instructions": stats["mega_instructions"],
+        "peak_memory_kb": stats["peak_memory_kb"],
+        "activations": 0,
+    }
+    for group in stats["groups"]:
+        if group["name"] == "SATURATION":
+            res["activations"] = group["entries"].get("Activations started", 0)
+        elif group["name"] == "PHASES":
+            for name, value in group["entries"].items():
+                if name.endswith(" ms"):
+                    res["phase " + name[:-3].lower()] = value
+    return res
+
+
+def runOne(vampire, problem, strategy, seconds):
+    with tempfile.NamedTemporaryFile(suffix=".json") as out:
+        cmd = [vampire, "--mode", "vampire", "-t", str(seconds), "--proof", "off",
+               "--statistics_json", out.name, "--phase_timing", "on"] + strategy.split() + [problem]
+        subprocess.run(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        lines = [l for l in open(out.name) if l.strip()]
+    if not lines:
+        return None
+    return json.loads(lines[-1])
+
+
+def run(args):
+    repeats, seconds, strategies = 3, 10, []
+    opts, args = getopt.getopt(args, "n:t:s:")
+    for opt, val in opts:
+        if opt == "-n":
+            repeats = int(val)
+        elif opt == "-t":
+            seconds = int(val)
+        elif opt == "-s":
+            strategies.append(val)
+    if len(args) != 3:
+        sys.exit(__doc__)
+    vampire, corpus, outName = args
+    strategies = strategies or [""]
+
+    results = {}
+    for problem in readCorpus(corpus):
+        for strategy in strategies:
+            key = os.path.basename(problem) + " " + strategy
+            samples, reasons = [], set()
+            for _ in range(repeats):
+                stats = runOne(vampire, problem, strategy, seconds)
+                if stats is None:
+                    reasons.add("CRASHED")
+                    continue
+                reasons.add(stats["termination_reason"])
+                samples.append(metrics(stats))
+            results[key.strip()] = {"termination": sorted(reasons), "samples": samples}
+            print("%-40s %s" % (key, "/".join(sorted(reasons))), file=sys.stderr)
+    with open(outName, "w") as f:
+        json.dump({"repeats": repeats, "time_limit": seconds, "results": results}, f, indent=1)
+
+
+def meanAndError(values):
+    """the mean of @b values and its standard error"""
+    n = len(values)
+    mean = sum(values) / n
+    if n < 2:
+        return mean, 0.0
+    var = sum((v - mean) ** 2 for v in values) / (n - 1)
+    return mean, math.sqrt(var / n)
+
+
+def slower(base, cur, percent):
+    """True if the samples @b cur are significantly larger than @b base"""
+    bMean, bErr = meanAndError(base)
+    cMean, cErr = meanAndError(cur)
+    if cMean <= bMean * (1 + percent / 100.0):
+        return False
+    return cMean - bMean > 3 * math.sqrt(bErr ** 2 + cErr ** 2)
+
+
+def compare(args):
+    percent = 5.0
+    opts, args = getopt.getopt(args, "p:")
+    for opt, val in opts:
+        if opt == "-p":
+            percent = float(val)
+    if len(args) != 2:
+        sys.exit(__doc__)
+    with open(args[0]) as f:
+        base = json.load(f)["results"]
+    with open(args[1]) as f:
+        cur = json.load(f)["results"]
+
+    reports = []
+    # per saturation phase, the corpus total of each repetition
+    phaseTotals = ({}, {})
+    for key in sorted(set(base) & set(cur)):
+        b, c = base[key], cur[key]
+        if any(r in SOLVED for r in b["termination"]) and not any(r in SOLVED for r in c["termination"]):
+            reports.append("%s: no longer solved (%s)" % (key, "/".join(c["termination"])))
+            continue
+        if not b["samples"] or not c["samples"]:
+            continue
+        for name in sorted(b["samples"][0]):
+            bVals = [s.get(name, 0) for s in b["samples"]]
+            cVals = [s.get(name, 0) for s in c["samples"]]
+            if name.startswith("phase "):
+                for totals, vals in zip(phaseTotals, (bVals, cVals)):
+                    acc = totals.setdefault(name, [0] * len(vals))
+                    for i, v in enumerate(vals[:len(acc)]):
+                        acc[i] += v
+                continue
+            if slower(bVals, cVals, percent):
+                reports.append("%s: %s %.0f -> %.0f" % (key, name, meanAndError(bVals)[0], meanAndError(cVals)[0]))
+    for name in sorted(phaseTotals[0]):
+        bVals, cVals = phaseTotals[0][name], phaseTotals[1].get(name)
+        if cVals and slower(bVals, cVals, percent):
+            reports.append("corpus: %s ms %.0f -> %.0f" % (name, meanAndError(bVals)[0], meanAndError(cVals)[0]))
+
+    for r in reports:
+        print(r)
+    missing = set(base) - set(cur)
+    if missing:
+        print("%% %d runs of the baseline are missing" % len(missing))
+    return 1 if reports else 0
+
+
+def main(args):
+    if args and args[0] == "run":
+        return run(args[1:])
+    if args and args[0] == "compare":
+        return compare(args[1:])
+    sys.exit(__doc__)
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
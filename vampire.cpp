@@ -664,6 +664,7 @@ int main(int argc, char* argv[])
 
 #if VTIME_PROFILING
     TimeTrace::instance().setEnabled(opts.timeStatistics());
+    TimeTrace::instance().startSampling(opts.timeStatisticsSamples());
 #endif
 
     // If any of these options are set then we just need to output and exit
@@ -674,6 +675,9 @@ int main(int argc, char* argv[])
     }
 
     Lib::setMemoryLimit(env.options->memoryLimit() * 1048576ul);
+#ifndef INDIVIDUAL_ALLOCATIONS
+    Lib::useHugePages(env.options->hugePages());
+#endif
 
     if (opts.mode() == Options::Mode::MODEL_CHECK) {
       opts.setOutputAxiomNames(true);